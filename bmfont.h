@@ -0,0 +1,23 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   bmfont.h -- 5x8 bitmap font for labels drawn without GDI                 */
+/******************************************************************************/
+
+#ifndef BMFONT_H
+#define BMFONT_H
+
+#include "segrender.h"
+
+#define BMFONT_WIDTH   5
+#define BMFONT_HEIGHT  8        /* 7 rows plus one for descenders */
+#define BMFONT_ADVANCE 6
+#define BMFONT_FIRST   0x20
+#define BMFONT_LAST    0x7e
+
+/* column-major, bit 0 is the top row */
+extern const unsigned char bmFontGlyphs[BMFONT_LAST - BMFONT_FIRST + 1][BMFONT_WIDTH];
+
+int  BmFontTextWidth(const char *text);
+void BmFontDrawText(FrameBufferStruct *fb, int x, int y, const char *text, uint32_t color);
+
+#endif /* BMFONT_H */
@@ -0,0 +1,644 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   clockreg.c -- contiguous clock registry with stable handles              */
+/*                                                                            */
+/* Replaces the linked list of windows and the per-window ClockInfoStruct.    */
+/* A handle is (generation << CLOCK_SLOT_BITS | slot + 1); the slot table     */
+/* maps it to the clock's current index.  Removing a clock closes the gap so  */
+/* display order is kept, and re-points the slots of the clocks that moved.   */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "clockreg.h"
+
+#define CLOCK_SLOT_BITS 20
+#define CLOCK_SLOT_MASK ((1u << CLOCK_SLOT_BITS) - 1)
+#define CLOCK_GENERATION_MASK 0xfffu
+#define CLOCK_LABEL_PIXELS    (CLOCK_DISPLAY_WIDTH * CLOCK_LABEL_HEIGHT)
+
+const ClockThemeStruct clockDefaultTheme = {
+    SEG_RGB(255,   0,   0),
+    SEG_RGB(255, 255, 255),
+    SEG_RGB(255, 255, 255),
+    SEG_RGB(  0,   0,   0)
+};
+
+void ClockRegInit(ClockRegistryStruct *reg, size_t sidecarSize)
+{
+    memset(reg, 0, sizeof(ClockRegistryStruct));
+    reg->sidecarSize = sidecarSize;
+    reg->freeSlot = -1;
+    reg->freeLong = -1;
+} /* ClockRegInit() */
+
+void ClockRegFree(ClockRegistryStruct *reg)
+{
+    free(reg->block);
+    free(reg->longText);
+    free(reg->longRefs);
+    free(reg->longHashes);
+    free(reg->longTable);
+    free(reg->slotIndex);
+    free(reg->slotGeneration);
+    free(reg->windowKeys);
+    free(reg->windowValues);
+    ClockRegInit(reg, reg->sidecarSize);
+} /* ClockRegFree() */
+
+static int GrowColumn(void **column, size_t elementSize, int capacity)
+{
+    void *grown = realloc(*column, elementSize * capacity);
+
+    if (grown == NULL)
+        return(0);
+    *column = grown;
+    return(1);
+} /* GrowColumn() */
+
+/* every per-clock column, and the bytes it takes per clock */
+#define CLOCK_COLUMNS(COLUMN) \
+    COLUMN(handles,      sizeof(ClockHandle)) \
+    COLUMN(windows,      sizeof(void *)) \
+    COLUMN(gmtOffsets,   sizeof(int32_t)) \
+    COLUMN(zones,        sizeof(TzZoneStruct *)) \
+    COLUMN(zoneCaches,   sizeof(TzCacheStruct)) \
+    COLUMN(zoneNames,    TZ_NAME_SIZE) \
+    COLUMN(labels,       CLOCK_NAME_SIZE) \
+    COLUMN(longLabels,   sizeof(int32_t)) \
+    COLUMN(labelLayouts, sizeof(ClockLabelStruct)) \
+    COLUMN(labelPixels,  CLOCK_LABEL_PIXELS * sizeof(uint32_t)) \
+    COLUMN(shownMasks,   sizeof(uint64_t)) \
+    COLUMN(dirtyDigits,  sizeof(unsigned int)) \
+    COLUMN(tickScratch,  5 * sizeof(int32_t)) \
+    COLUMN(themes,       sizeof(ClockThemeStruct)) \
+    COLUMN(sidecar,      reg->sidecarSize)
+
+#define COLUMN_ALIGN 64         /* each column starts a cache line */
+#define COLUMN_BYTES(bytes, capacity) \
+    (((bytes) * (size_t) (capacity) + COLUMN_ALIGN - 1) & ~(size_t) (COLUMN_ALIGN - 1))
+#define SIZE_COLUMN(column, bytes) size += COLUMN_BYTES(bytes, capacity);
+#define MOVE_COLUMN(column, bytes) \
+    if (reg->count > 0) \
+        memcpy(at, (const void *) reg->column, (bytes) * (size_t) reg->count); \
+    reg->column = (void *) at; \
+    at += COLUMN_BYTES(bytes, capacity);
+
+/******************************************************************************/
+/* GrowClocks -- room for capacity clocks: one new block carved into the      */
+/* columns, the clocks copied over and the old block freed.                   */
+/******************************************************************************/
+static int GrowClocks(ClockRegistryStruct *reg, int capacity)
+{
+    void *block;
+    unsigned char *at;
+    size_t size = COLUMN_ALIGN;         /* to align the first column */
+
+    CLOCK_COLUMNS(SIZE_COLUMN)
+    block = malloc(size);
+    if (block == NULL)
+        return(0);
+    at = (unsigned char *) block + (-(uintptr_t) block & (COLUMN_ALIGN - 1));
+    CLOCK_COLUMNS(MOVE_COLUMN)
+    free(reg->block);
+    reg->block = block;
+    reg->capacity = capacity;
+    return(1);
+} /* GrowClocks() */
+
+static int GrowSlots(ClockRegistryStruct *reg, int capacity)
+{
+    int i;
+
+    if (capacity > (int) CLOCK_SLOT_MASK ||
+        !GrowColumn((void **) &reg->slotIndex, sizeof(int32_t), capacity) ||
+        !GrowColumn((void **) &reg->slotGeneration, sizeof(uint16_t), capacity))
+        return(0);
+    for (i = capacity - 1; i >= reg->slotCapacity; i--)
+    { /* free slots chain through slotIndex as -(next + 2) */
+        reg->slotIndex[i] = -(reg->freeSlot + 2);
+        reg->slotGeneration[i] = 0;
+        reg->freeSlot = i;
+    } /* for i */
+    reg->slotCapacity = capacity;
+    return(1);
+} /* GrowSlots() */
+
+static int32_t AllocateSlot(ClockRegistryStruct *reg)
+{
+    int32_t slot;
+
+    if (reg->freeSlot < 0 && !GrowSlots(reg, reg->slotCapacity ? reg->slotCapacity * 2 : 16))
+        return(-1);
+    slot = reg->freeSlot;
+    reg->freeSlot = -reg->slotIndex[slot] - 2;
+    return(slot);
+} /* AllocateSlot() */
+
+/******************************************************************************/
+/* ClockRegReserve -- make room for count clocks at once, as a load that      */
+/* knows how many it will add can, so adding them allocates nothing.          */
+/* Returns 0 when out of memory.                                              */
+/******************************************************************************/
+int ClockRegReserve(ClockRegistryStruct *reg, int count)
+{
+    if (count > (int) CLOCK_SLOT_MASK)
+        return(0);
+    if (count > reg->capacity && !GrowClocks(reg, count))
+        return(0);
+    if (count > reg->slotCapacity && !GrowSlots(reg, count))
+        return(0);
+    return(1);
+} /* ClockRegReserve() */
+
+/******************************************************************************/
+/* window hash: pointer keys, linear probing, backward-shift deletion         */
+/******************************************************************************/
+static unsigned int HashWindow(const void *window, int capacity)
+{
+    uint64_t key = (uint64_t) (uintptr_t) window;
+
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    return((unsigned int) key & (unsigned int) (capacity - 1));
+} /* HashWindow() */
+
+static void InsertWindow(ClockRegistryStruct *reg, void *window, ClockHandle handle)
+{
+    unsigned int i = HashWindow(window, reg->windowCapacity);
+
+    while (reg->windowKeys[i] != NULL && reg->windowKeys[i] != window)
+        i = (i + 1) & (reg->windowCapacity - 1);
+    if (reg->windowKeys[i] == NULL)
+        reg->windowCount++;
+    reg->windowKeys[i] = window;
+    reg->windowValues[i] = handle;
+} /* InsertWindow() */
+
+static int GrowWindows(ClockRegistryStruct *reg)
+{
+    void **oldKeys = reg->windowKeys;
+    ClockHandle *oldValues = reg->windowValues;
+    int oldCapacity = reg->windowCapacity;
+    int capacity = oldCapacity ? oldCapacity * 2 : 32;
+    int i;
+
+    reg->windowKeys = (void **) calloc(capacity, sizeof(void *));
+    reg->windowValues = (ClockHandle *) calloc(capacity, sizeof(ClockHandle));
+    if (reg->windowKeys == NULL || reg->windowValues == NULL)
+    {
+        free(reg->windowKeys);
+        free(reg->windowValues);
+        reg->windowKeys = oldKeys;
+        reg->windowValues = oldValues;
+        return(0);
+    }
+    reg->windowCapacity = capacity;
+    reg->windowCount = 0;
+    for (i = 0; i < oldCapacity; i++)
+    {
+        if (oldKeys[i] != NULL)
+            InsertWindow(reg, oldKeys[i], oldValues[i]);
+    } /* for i */
+    free(oldKeys);
+    free(oldValues);
+    return(1);
+} /* GrowWindows() */
+
+static void RemoveWindow(ClockRegistryStruct *reg, const void *window)
+{
+    unsigned int i, j, home;
+    unsigned int mask = (unsigned int) reg->windowCapacity - 1;
+
+    if (reg->windowCapacity == 0)
+        return;
+    i = HashWindow(window, reg->windowCapacity);
+    while (reg->windowKeys[i] != window)
+    {
+        if (reg->windowKeys[i] == NULL)
+            return;
+        i = (i + 1) & mask;
+    } /* while */
+    reg->windowKeys[i] = NULL;
+    reg->windowCount--;
+
+    /* pull later entries of the probe run back into the hole */
+    for (j = (i + 1) & mask; reg->windowKeys[j] != NULL; j = (j + 1) & mask)
+    {
+        home = HashWindow(reg->windowKeys[j], reg->windowCapacity);
+        if (((j - home) & mask) >= ((j - i) & mask))
+        {
+            reg->windowKeys[i] = reg->windowKeys[j];
+            reg->windowValues[i] = reg->windowValues[j];
+            reg->windowKeys[j] = NULL;
+            i = j;
+        }
+    } /* for j */
+} /* RemoveWindow() */
+
+/******************************************************************************/
+/* long labels: fixed slots with a reference count each, free slots chained   */
+/* through longRefs as -(next + 2), and an open-addressed table over them     */
+/* with backward-shift deletion, like the window hash                         */
+/******************************************************************************/
+static uint32_t HashLabel(const char *label)
+{
+    uint32_t hash = 2166136261u;    /* FNV-1a */
+
+    while (*label != '\0')
+        hash = (hash ^ (unsigned char) *label++) * 16777619u;
+    return(hash);
+} /* HashLabel() */
+
+static void InsertLabel(ClockRegistryStruct *reg, int32_t slot)
+{
+    unsigned int mask = (unsigned int) reg->longTableCapacity - 1;
+    unsigned int i = reg->longHashes[slot] & mask;
+
+    while (reg->longTable[i] != 0)
+        i = (i + 1) & mask;
+    reg->longTable[i] = slot + 1;
+} /* InsertLabel() */
+
+static int GrowLabels(ClockRegistryStruct *reg)
+{
+    int capacity = reg->longCapacity ? reg->longCapacity * 2 : 16;
+    int32_t *table;
+    int i;
+
+    if (!GrowColumn((void **) &reg->longText, CLOCK_LABEL_SIZE, capacity) ||
+        !GrowColumn((void **) &reg->longRefs, sizeof(int32_t), capacity) ||
+        !GrowColumn((void **) &reg->longHashes, sizeof(uint32_t), capacity))
+        return(0);
+    table = (int32_t *) calloc((size_t) capacity * 2, sizeof(int32_t));
+    if (table == NULL)
+        return(0);
+    for (i = capacity - 1; i >= reg->longCapacity; i--)
+    {
+        reg->longRefs[i] = -(reg->freeLong + 2);
+        reg->freeLong = i;
+    } /* for i */
+    free(reg->longTable);
+    reg->longTable = table;
+    reg->longTableCapacity = capacity * 2;   /* at most half full */
+    for (i = 0; i < reg->longCapacity; i++)
+    {
+        if (reg->longRefs[i] > 0)
+            InsertLabel(reg, i);
+    } /* for i */
+    reg->longCapacity = capacity;
+    return(1);
+} /* GrowLabels() */
+
+/* the slot holding label, taken by one more clock, or -1 if out of memory */
+static int32_t InternLabel(ClockRegistryStruct *reg, const char *label)
+{
+    uint32_t hash = HashLabel(label);
+    unsigned int i, mask;
+    int32_t slot;
+
+    if (reg->longTableCapacity > 0)
+    {
+        mask = (unsigned int) reg->longTableCapacity - 1;
+        for (i = hash & mask; reg->longTable[i] != 0; i = (i + 1) & mask)
+        {
+            slot = reg->longTable[i] - 1;
+            if (reg->longHashes[slot] == hash && strcmp(reg->longText[slot], label) == 0)
+            {
+                reg->longRefs[slot]++;
+                return(slot);
+            }
+        } /* for i */
+    }
+    if (reg->freeLong < 0 && !GrowLabels(reg))
+        return(-1);
+    slot = reg->freeLong;
+    reg->freeLong = -reg->longRefs[slot] - 2;
+    strcpy(reg->longText[slot], label);
+    reg->longRefs[slot] = 1;
+    reg->longHashes[slot] = hash;
+    reg->longCount++;
+    InsertLabel(reg, slot);
+    return(slot);
+} /* InternLabel() */
+
+/* one clock fewer has the label in slot; the last frees it */
+static void ReleaseLabel(ClockRegistryStruct *reg, int32_t slot)
+{
+    unsigned int i, j, home, mask;
+
+    if (slot < 0 || --reg->longRefs[slot] > 0)
+        return;
+    mask = (unsigned int) reg->longTableCapacity - 1;
+    for (i = reg->longHashes[slot] & mask; reg->longTable[i] != slot + 1; i = (i + 1) & mask)
+        ;
+    reg->longTable[i] = 0;
+    for (j = (i + 1) & mask; reg->longTable[j] != 0; j = (j + 1) & mask)
+    {
+        home = reg->longHashes[reg->longTable[j] - 1] & mask;
+        if (((j - home) & mask) >= ((j - i) & mask))
+        {
+            reg->longTable[i] = reg->longTable[j];
+            reg->longTable[j] = 0;
+            i = j;
+        }
+    } /* for j */
+    reg->longRefs[slot] = -(reg->freeLong + 2);
+    reg->freeLong = slot;
+    reg->longCount--;
+} /* ReleaseLabel() */
+
+/* fixed offsets from the INI file are not checked; keep them within a day */
+static int32_t ClampOffset(int32_t gmtOffset)
+{
+    if (gmtOffset > CLOCK_MAX_OFFSET_HOURS * 3600)
+        return(CLOCK_MAX_OFFSET_HOURS * 3600);
+    if (gmtOffset < -CLOCK_MAX_OFFSET_HOURS * 3600)
+        return(-CLOCK_MAX_OFFSET_HOURS * 3600);
+    return(gmtOffset);
+} /* ClampOffset() */
+
+/* the Clock<n>Offset hours of the INI file in seconds, clamped first so   */
+/* that no value overflows                                                  */
+int32_t ClockRegHoursOffset(int hours)
+{
+    if (hours > CLOCK_MAX_OFFSET_HOURS)
+        hours = CLOCK_MAX_OFFSET_HOURS;
+    else if (hours < -CLOCK_MAX_OFFSET_HOURS)
+        hours = -CLOCK_MAX_OFFSET_HOURS;
+    return((int32_t) hours * 3600);
+} /* ClockRegHoursOffset() */
+
+/******************************************************************************/
+/* ClockRegAdd -- append a clock; returns CLOCK_HANDLE_NONE when out of       */
+/* memory.  An unknown zone leaves the clock on its fixed offset.             */
+/******************************************************************************/
+ClockHandle ClockRegAdd(ClockRegistryStruct *reg, const char *label, int32_t gmtOffset, const char *zoneName)
+{
+    int index = reg->count;
+    int32_t slot;
+    ClockHandle handle;
+
+    if (reg->count == reg->capacity && !GrowClocks(reg, reg->capacity ? reg->capacity * 2 : 16))
+        return(CLOCK_HANDLE_NONE);
+    slot = AllocateSlot(reg);
+    if (slot < 0)
+        return(CLOCK_HANDLE_NONE);
+
+    reg->slotGeneration[slot] = (uint16_t) ((reg->slotGeneration[slot] + 1) & CLOCK_GENERATION_MASK);
+    if (reg->slotGeneration[slot] == 0)
+        reg->slotGeneration[slot] = 1;
+    reg->slotIndex[slot] = index;
+    handle = (ClockHandle) reg->slotGeneration[slot] << CLOCK_SLOT_BITS | (ClockHandle) (slot + 1);
+
+    reg->count++;
+    reg->handles[index] = handle;
+    reg->windows[index] = NULL;
+    reg->gmtOffsets[index] = ClampOffset(gmtOffset);
+    reg->zones[index] = NULL;
+    reg->zoneNames[index][0] = '\0';
+    TzCacheInvalidate(&reg->zoneCaches[index]);
+    reg->shownMasks[index] = SEG_MASK_INVALID;
+    reg->themes[index] = clockDefaultTheme;
+    if (reg->sidecarSize)
+        memset(reg->sidecar + (size_t) index * reg->sidecarSize, 0, reg->sidecarSize);
+    reg->longLabels[index] = -1;
+    ClockRegSetLabel(reg, index, label);
+    if (zoneName != NULL)
+        ClockRegSetZone(reg, index, zoneName);
+    return(handle);
+} /* ClockRegAdd() */
+
+int ClockRegIndexOf(const ClockRegistryStruct *reg, ClockHandle handle)
+{
+    uint32_t slot = (handle & CLOCK_SLOT_MASK) - 1;
+
+    if (handle == CLOCK_HANDLE_NONE || slot >= (uint32_t) reg->slotCapacity ||
+        reg->slotGeneration[slot] != (handle >> CLOCK_SLOT_BITS) || reg->slotIndex[slot] < 0)
+        return(-1);
+    return(reg->slotIndex[slot]);
+} /* ClockRegIndexOf() */
+
+#define SHIFT_DOWN(column, index, count) \
+    memmove(&(column)[index], &(column)[(index) + 1], sizeof((column)[0]) * ((count) - (index) - 1))
+
+void ClockRegRemove(ClockRegistryStruct *reg, ClockHandle handle)
+{
+    int index = ClockRegIndexOf(reg, handle);
+    uint32_t slot = (handle & CLOCK_SLOT_MASK) - 1;
+    int i;
+
+    if (index < 0)
+        return;
+    if (reg->windows[index] != NULL)
+        RemoveWindow(reg, reg->windows[index]);
+    ReleaseLabel(reg, reg->longLabels[index]);
+
+    SHIFT_DOWN(reg->handles, index, reg->count);
+    SHIFT_DOWN(reg->windows, index, reg->count);
+    SHIFT_DOWN(reg->gmtOffsets, index, reg->count);
+    SHIFT_DOWN(reg->zones, index, reg->count);
+    SHIFT_DOWN(reg->zoneCaches, index, reg->count);
+    SHIFT_DOWN(reg->zoneNames, index, reg->count);
+    SHIFT_DOWN(reg->labels, index, reg->count);
+    SHIFT_DOWN(reg->longLabels, index, reg->count);
+    SHIFT_DOWN(reg->labelLayouts, index, reg->count);
+    memmove(reg->labelPixels + (size_t) index * CLOCK_LABEL_PIXELS,
+            reg->labelPixels + (size_t) (index + 1) * CLOCK_LABEL_PIXELS,
+            CLOCK_LABEL_PIXELS * sizeof(uint32_t) * (reg->count - index - 1));
+    SHIFT_DOWN(reg->shownMasks, index, reg->count);
+    SHIFT_DOWN(reg->themes, index, reg->count);
+    if (reg->sidecarSize)
+        memmove(reg->sidecar + (size_t) index * reg->sidecarSize,
+                reg->sidecar + (size_t) (index + 1) * reg->sidecarSize,
+                reg->sidecarSize * (reg->count - index - 1));
+    reg->count--;
+
+    for (i = index; i < reg->count; i++)
+        reg->slotIndex[(reg->handles[i] & CLOCK_SLOT_MASK) - 1] = i;
+
+    reg->slotIndex[slot] = -(reg->freeSlot + 2);
+    reg->freeSlot = (int32_t) slot;
+} /* ClockRegRemove() */
+
+ClockHandle ClockRegFindWindow(const ClockRegistryStruct *reg, const void *window)
+{
+    unsigned int i;
+
+    if (reg->windowCapacity == 0 || window == NULL)
+        return(CLOCK_HANDLE_NONE);
+    i = HashWindow(window, reg->windowCapacity);
+    while (reg->windowKeys[i] != NULL)
+    {
+        if (reg->windowKeys[i] == window)
+            return(reg->windowValues[i]);
+        i = (i + 1) & (reg->windowCapacity - 1);
+    } /* while */
+    return(CLOCK_HANDLE_NONE);
+} /* ClockRegFindWindow() */
+
+void ClockRegSetWindow(ClockRegistryStruct *reg, int index, void *window)
+{
+    if (reg->windows[index] != NULL)
+        RemoveWindow(reg, reg->windows[index]);
+    reg->windows[index] = window;
+    if (window == NULL)
+        return;
+    if ((reg->windowCount + 1) * 2 > reg->windowCapacity && !GrowWindows(reg))
+        return;
+    InsertWindow(reg, window, reg->handles[index]);
+} /* ClockRegSetWindow() */
+
+/******************************************************************************/
+/* ClockRegSetLabel -- rename a clock, and measure and draw the new label     */
+/* here so that painting it is a copy.  Labels are cut to                     */
+/* CLOCK_LABEL_SIZE - 1 characters.                                           */
+/******************************************************************************/
+void ClockRegSetLabel(ClockRegistryStruct *reg, int index, const char *label)
+{
+    ClockLabelStruct *layout = &reg->labelLayouts[index];
+    const ClockThemeStruct *theme = &reg->themes[index];
+    FrameBufferStruct band;
+    char text[CLOCK_LABEL_SIZE];
+    int32_t slot;
+
+    strncpy(text, label, CLOCK_LABEL_SIZE - 1);
+    text[CLOCK_LABEL_SIZE - 1] = '\0';
+    memcpy(reg->labels[index], text, CLOCK_NAME_SIZE - 1);     /* text is NUL-padded */
+    reg->labels[index][CLOCK_NAME_SIZE - 1] = '\0';
+    slot = strlen(text) >= CLOCK_NAME_SIZE ? InternLabel(reg, text) : -1;
+    ReleaseLabel(reg, reg->longLabels[index]);  /* after, in case it is the same */
+    reg->longLabels[index] = slot;
+    label = ClockRegLabel(reg, index);  /* cut to labels[] if it could not be interned */
+
+    if (++reg->labelSerial == 0)
+        reg->labelSerial = 1;
+    layout->serial = reg->labelSerial;
+    layout->length = (int) strlen(label);
+    layout->width = BmFontTextWidth(label);
+    layout->x = (CLOCK_DISPLAY_WIDTH - layout->width) / 2;
+
+    ClockRegLabelBand(reg, index, &band);
+    SegFillRect(&band, 0, 0, band.width, band.height, theme->backColor);
+    BmFontDrawText(&band, layout->x, 0, label, theme->textColor);
+} /* ClockRegSetLabel() */
+
+const char *ClockRegLabel(const ClockRegistryStruct *reg, int index)
+{
+    if (reg->longLabels[index] >= 0)
+        return(reg->longText[reg->longLabels[index]]);
+    return(reg->labels[index]);
+} /* ClockRegLabel() */
+
+/* the label as drawn, face-wide, for SegBlitPixels() at CLOCK_LABEL_TOP */
+void ClockRegLabelBand(const ClockRegistryStruct *reg, int index, FrameBufferStruct *band)
+{
+    band->pixels = reg->labelPixels + (size_t) index * CLOCK_LABEL_PIXELS;
+    band->width = band->stride = CLOCK_DISPLAY_WIDTH;
+    band->height = CLOCK_LABEL_HEIGHT;
+} /* ClockRegLabelBand() */
+
+void ClockRegSetOffset(ClockRegistryStruct *reg, int index, int32_t gmtOffset)
+{
+    reg->gmtOffsets[index] = ClampOffset(gmtOffset);
+    reg->shownMasks[index] = SEG_MASK_INVALID;
+} /* ClockRegSetOffset() */
+
+/******************************************************************************/
+/* ClockRegSetZone -- attach an IANA zone, or detach it with "".              */
+/* Returns 0, leaving the clock alone, if the zone cannot be loaded.          */
+/******************************************************************************/
+int ClockRegSetZone(ClockRegistryStruct *reg, int index, const char *zoneName)
+{
+    const TzZoneStruct *zone = NULL;
+
+    if (zoneName[0] != '\0')
+    {
+        zone = TzFindZone(zoneName);
+        if (zone == NULL)
+            return(0);
+    }
+    strncpy(reg->zoneNames[index], zoneName, TZ_NAME_SIZE - 1);
+    reg->zoneNames[index][TZ_NAME_SIZE - 1] = '\0';
+    reg->zones[index] = zone;
+    TzCacheInvalidate(&reg->zoneCaches[index]);
+    reg->shownMasks[index] = SEG_MASK_INVALID;
+    return(1);
+} /* ClockRegSetZone() */
+
+void *ClockRegSidecar(ClockRegistryStruct *reg, int index)
+{
+    return(reg->sidecar + (size_t) index * reg->sidecarSize);
+} /* ClockRegSidecar() */
+
+int32_t ClockRegOffsetAt(ClockRegistryStruct *reg, int index, int64_t utcSeconds)
+{
+    if (reg->zones[index] != NULL)
+        return(TzOffsetAt(reg->zones[index], &reg->zoneCaches[index], utcSeconds));
+    return(reg->gmtOffsets[index]);
+} /* ClockRegOffsetAt() */
+
+/******************************************************************************/
+/* ClockRegTick -- bring a clock's mask up to the tick and return the digit   */
+/* slots that changed, or CLOCK_DIRTY_ALL if nothing valid was on screen.     */
+/******************************************************************************/
+unsigned int ClockRegTick(ClockRegistryStruct *reg, int index, const TickSnapshotStruct *tick)
+{
+    ClockTimeStruct clockTime;
+    uint64_t newMask;
+    uint64_t oldMask = reg->shownMasks[index];
+
+    TickClockTime(tick, ClockRegOffsetAt(reg, index, tick->utcSeconds), &clockTime);
+    newMask = SegFaceMask(clockTime.hours, clockTime.minutes, clockTime.seconds);
+    reg->shownMasks[index] = newMask;
+    if (oldMask == SEG_MASK_INVALID)
+        return(CLOCK_DIRTY_ALL);
+    return(SegDirtyDigits(oldMask, newMask));
+} /* ClockRegTick() */
+
+/******************************************************************************/
+/* ClockRegTickRange -- ClockRegTick() for clocks first .. first + count - 1, */
+/* leaving the changed digits in reg->dirtyDigits[].  The offsets are         */
+/* gathered first so the time of day is worked out for all of them in one     */
+/* TickCivilBatch() pass.  Clocks outside the range are not touched.          */
+/******************************************************************************/
+void ClockRegTickRange(ClockRegistryStruct *reg, int first, int count, const TickSnapshotStruct *tick)
+{
+    TickCivilBatchStruct civil;
+    int32_t *offsets = reg->tickScratch;
+    uint64_t newMask, oldMask;
+    int i;
+
+    if (first < 0)
+    {
+        count += first;
+        first = 0;
+    }
+    if (count > reg->count - first)
+        count = reg->count - first;
+    if (count <= 0)
+        return;
+    civil.hours = offsets + reg->capacity;
+    civil.minutes = civil.hours + reg->capacity;
+    civil.seconds = civil.minutes + reg->capacity;
+    civil.dayOffsets = civil.seconds + reg->capacity;
+    civil.weekdays = civil.years = civil.months = civil.days = NULL;
+    for (i = 0; i < count; i++)
+        offsets[i] = ClockRegOffsetAt(reg, first + i, tick->utcSeconds);
+    TickCivilBatch(tick, offsets, count, &civil);
+
+    for (i = 0; i < count; i++)
+    {
+        oldMask = reg->shownMasks[first + i];
+        newMask = SegFaceMask(civil.hours[i], civil.minutes[i], civil.seconds[i]);
+        reg->shownMasks[first + i] = newMask;
+        reg->dirtyDigits[first + i] = (oldMask == SEG_MASK_INVALID) ?
+                                      CLOCK_DIRTY_ALL : SegDirtyDigits(oldMask, newMask);
+    } /* for i */
+} /* ClockRegTickRange() */
+
+void ClockRegTickAll(ClockRegistryStruct *reg, const TickSnapshotStruct *tick)
+{
+    ClockRegTickRange(reg, 0, reg->count, tick);
+} /* ClockRegTickAll() */
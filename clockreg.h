@@ -0,0 +1,129 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   clockreg.h -- contiguous clock registry with stable handles              */
+/******************************************************************************/
+
+#ifndef CLOCKREG_H
+#define CLOCKREG_H
+
+#include <stdint.h>
+#include "segrender.h"
+#include "bmfont.h"
+#include "ticktime.h"
+#include "tzone.h"
+
+#define CLOCK_NAME_SIZE  32      /* a label kept inline, with its NUL */
+#define CLOCK_LABEL_SIZE 128     /* the longest label kept, with its NUL */
+
+typedef uint32_t ClockHandle;
+#define CLOCK_HANDLE_NONE ((ClockHandle) 0)
+
+#define CLOCK_MAX_OFFSET_HOURS 24       /* a fixed offset is kept within this of UTC */
+
+#define CLOCK_DIRTY_ALL (~0u)   /* ClockRegTick(): repaint the whole clock */
+
+/* the label band of a face, drawn in the bitmap font: CLOCK_DISPLAY_WIDTH wide */
+#define CLOCK_LABEL_TOP    (DIGIT_HEIGHT + 1)
+#define CLOCK_LABEL_HEIGHT BMFONT_HEIGHT
+
+/* the label measured once when it changes, not every time it is drawn */
+typedef struct ClockLabelStructTag {
+    uint32_t serial;            /* new for every ClockRegSetLabel(), never 0 */
+    int length;                 /* strlen() */
+    int width;                  /* in the bitmap font */
+    int x;                      /* left edge in the face, centered, negative if too wide */
+} ClockLabelStruct;
+
+/* colors are 0x00RRGGBB, see SEG_RGB() */
+typedef struct ClockThemeStructTag {
+    uint32_t litColor;
+    uint32_t darkColor;
+    uint32_t backColor;
+    uint32_t textColor;
+} ClockThemeStruct;
+
+/******************************************************************************/
+/* Clocks are kept in display order in parallel arrays, so the tick, layout   */
+/* and save loops walk memory linearly.  The arrays are carved from one       */
+/* block, so the whole clock set is a single allocation that only changes     */
+/* when it doubles; adding, renaming and removing clocks below capacity       */
+/* allocate nothing.  A label shorter than CLOCK_NAME_SIZE lives in labels[]; */
+/* a longer one keeps its start there and is interned whole in a slot of      */
+/* longText, shared by every clock with that label and found through a hash   */
+/* table.  A slot no clock uses any more is reused, so the pool only grows    */
+/* with the number of distinct long labels in use at once.  Read labels with  */
+/* ClockRegLabel().  A handle names a clock for as long as it exists,         */
+/* whatever index it has moved to; the front end's window for a clock maps    */
+/* back to its handle through a hash table.                                   */
+/******************************************************************************/
+typedef struct ClockRegistryStructTag {
+    int count;
+    int capacity;
+    void *block;                        /* all the columns below */
+
+    /* one entry per clock, index 0 .. count-1 in display order */
+    ClockHandle *handles;
+    void **windows;                     /* front end window, may be NULL */
+    int32_t *gmtOffsets;                /* seconds east of UTC without a zone */
+    const TzZoneStruct **zones;
+    TzCacheStruct *zoneCaches;
+    char (*zoneNames)[TZ_NAME_SIZE];
+    char (*labels)[CLOCK_NAME_SIZE];    /* cut short if it is in longText */
+    int32_t *longLabels;                /* its slot of longText, or -1 */
+    ClockLabelStruct *labelLayouts;
+    uint32_t *labelPixels;              /* each label band, drawn on its back color */
+    uint32_t labelSerial;
+    uint64_t *shownMasks;
+    unsigned int *dirtyDigits;          /* from the last ClockRegTickAll() */
+    ClockThemeStruct *themes;
+    unsigned char *sidecar;             /* sidecarSize bytes per clock for the front end */
+    size_t sidecarSize;
+    int32_t *tickScratch;               /* ClockRegTickAll(): offsets, then h, m, s, day */
+
+    /* the labels too long for labels[], each once */
+    char (*longText)[CLOCK_LABEL_SIZE];
+    int32_t *longRefs;                  /* clocks with the label, or the free list */
+    uint32_t *longHashes;
+    int longCapacity;
+    int longCount;
+    int32_t freeLong;
+    int32_t *longTable;                 /* hash -> slot + 1, 0 if empty */
+    int longTableCapacity;
+
+    /* handle slot -> index */
+    int32_t *slotIndex;
+    uint16_t *slotGeneration;
+    int slotCapacity;
+    int32_t freeSlot;
+
+    /* window -> handle, open addressing */
+    void **windowKeys;
+    ClockHandle *windowValues;
+    int windowCapacity;
+    int windowCount;
+} ClockRegistryStruct;
+
+extern const ClockThemeStruct clockDefaultTheme;
+
+void        ClockRegInit(ClockRegistryStruct *reg, size_t sidecarSize);
+void        ClockRegFree(ClockRegistryStruct *reg);
+int         ClockRegReserve(ClockRegistryStruct *reg, int count);
+ClockHandle ClockRegAdd(ClockRegistryStruct *reg, const char *label, int32_t gmtOffset, const char *zoneName);
+void        ClockRegRemove(ClockRegistryStruct *reg, ClockHandle handle);
+int         ClockRegIndexOf(const ClockRegistryStruct *reg, ClockHandle handle);
+ClockHandle ClockRegFindWindow(const ClockRegistryStruct *reg, const void *window);
+void        ClockRegSetWindow(ClockRegistryStruct *reg, int index, void *window);
+void        ClockRegSetLabel(ClockRegistryStruct *reg, int index, const char *label);
+const char *ClockRegLabel(const ClockRegistryStruct *reg, int index);
+void        ClockRegSetOffset(ClockRegistryStruct *reg, int index, int32_t gmtOffset);
+int32_t     ClockRegHoursOffset(int hours);
+int         ClockRegSetZone(ClockRegistryStruct *reg, int index, const char *zoneName);
+void       *ClockRegSidecar(ClockRegistryStruct *reg, int index);
+void        ClockRegLabelBand(const ClockRegistryStruct *reg, int index, FrameBufferStruct *band);
+
+int32_t      ClockRegOffsetAt(ClockRegistryStruct *reg, int index, int64_t utcSeconds);
+unsigned int ClockRegTick(ClockRegistryStruct *reg, int index, const TickSnapshotStruct *tick);
+void         ClockRegTickRange(ClockRegistryStruct *reg, int first, int count, const TickSnapshotStruct *tick);
+void         ClockRegTickAll(ClockRegistryStruct *reg, const TickSnapshotStruct *tick);
+
+#endif /* CLOCKREG_H */
@@ -0,0 +1,151 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   gdicache.c -- shared, reference-counted pens, brushes and fonts          */
+/*                                                                            */
+/* GDI objects are looked up by (kind, style, width, color) and created the   */
+/* first time they are asked for.  Every clock window that uses an object     */
+/* holds a reference on it and gives it back in WM_DESTROY; the object is     */
+/* deleted when the last reference goes away.  Nothing is created or deleted  */
+/* while painting.                                                            */
+/******************************************************************************/
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <string.h>
+#include "gdicache.h"
+
+#define GDI_CACHE_SIZE 64
+
+#define GDI_KIND_PEN   1
+#define GDI_KIND_BRUSH 2
+#define GDI_KIND_FONT  3
+
+typedef struct GdiCacheEntryStructTag {
+    int kind;                   /* 0 when the slot is free */
+    int style;                  /* pen style, font weight */
+    int width;                  /* pen width, font height */
+    COLORREF color;
+    char faceName[LF_FACESIZE];
+    HGDIOBJ object;
+    int refCount;
+} GdiCacheEntryStruct;
+
+static GdiCacheEntryStruct gdiCache[GDI_CACHE_SIZE];
+
+static GdiCacheEntryStruct *FindEntry(int kind, int style, int width, COLORREF color, const char *faceName)
+{
+    int i;
+    GdiCacheEntryStruct *entry;
+
+    for (i = 0; i < GDI_CACHE_SIZE; i++)
+    {
+        entry = &gdiCache[i];
+        if (entry->kind == kind && entry->style == style && entry->width == width && entry->color == color &&
+            strcmp(entry->faceName, faceName) == 0)
+            return(entry);
+    } /* for i */
+    return(NULL);
+} /* FindEntry() */
+
+/******************************************************************************/
+/* Acquire -- return a cached object, adding a reference, or remember a new   */
+/* one.  When the cache is full the new object is handed out uncached and     */
+/* GdiCacheRelease() simply deletes it.                                       */
+/******************************************************************************/
+static HGDIOBJ Acquire(int kind, int style, int width, COLORREF color, const char *faceName)
+{
+    int i;
+    GdiCacheEntryStruct *entry;
+    HGDIOBJ object;
+
+    entry = FindEntry(kind, style, width, color, faceName);
+    if (entry != NULL)
+    {
+        entry->refCount++;
+        return(entry->object);
+    }
+
+    switch (kind)
+    {
+        case GDI_KIND_PEN:
+            object = CreatePen(style, width, color);
+            break;
+        case GDI_KIND_BRUSH:
+            object = CreateSolidBrush(color);
+            break;
+        default:
+            object = CreateFont(width, 0, 0, 0, style, FALSE, FALSE, FALSE, ANSI_CHARSET,
+                                OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS, DEFAULT_QUALITY,
+                                DEFAULT_PITCH | FF_SWISS, faceName);
+            break;
+    } /* switch kind */
+    if (object == NULL)
+        return(NULL);
+
+    for (i = 0; i < GDI_CACHE_SIZE; i++)
+    {
+        entry = &gdiCache[i];
+        if (entry->kind == 0)
+        {
+            entry->kind = kind;
+            entry->style = style;
+            entry->width = width;
+            entry->color = color;
+            strncpy_s(entry->faceName, LF_FACESIZE, faceName, _TRUNCATE);
+            entry->object = object;
+            entry->refCount = 1;
+            break;
+        }
+    } /* for i */
+    return(object);
+} /* Acquire() */
+
+HPEN GdiCacheAcquirePen(int style, int width, COLORREF color)
+{
+    return((HPEN) Acquire(GDI_KIND_PEN, style, width, color, ""));
+} /* GdiCacheAcquirePen() */
+
+HBRUSH GdiCacheAcquireBrush(COLORREF color)
+{
+    return((HBRUSH) Acquire(GDI_KIND_BRUSH, 0, 0, color, ""));
+} /* GdiCacheAcquireBrush() */
+
+HFONT GdiCacheAcquireFont(int weight, int height, const char *faceName)
+{
+    return((HFONT) Acquire(GDI_KIND_FONT, weight, height, 0, faceName));
+} /* GdiCacheAcquireFont() */
+
+void GdiCacheRelease(HGDIOBJ object)
+{
+    int i;
+    GdiCacheEntryStruct *entry;
+
+    if (object == NULL)
+        return;
+    for (i = 0; i < GDI_CACHE_SIZE; i++)
+    {
+        entry = &gdiCache[i];
+        if (entry->kind != 0 && entry->object == object)
+        {
+            if (--entry->refCount == 0)
+            {
+                DeleteObject(entry->object);
+                memset(entry, 0, sizeof(GdiCacheEntryStruct));
+            }
+            return;
+        }
+    } /* for i */
+    DeleteObject(object); /* was never cached */
+} /* GdiCacheRelease() */
+
+void GdiCacheReleaseAll(void)
+{
+    int i;
+
+    for (i = 0; i < GDI_CACHE_SIZE; i++)
+    {
+        if (gdiCache[i].kind != 0)
+            DeleteObject(gdiCache[i].object);
+    } /* for i */
+    memset(gdiCache, 0, sizeof(gdiCache));
+} /* GdiCacheReleaseAll() */
@@ -0,0 +1,15 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   gdicache.h -- shared, reference-counted pens, brushes and fonts          */
+/******************************************************************************/
+
+#ifndef GDICACHE_H
+#define GDICACHE_H
+
+HPEN   GdiCacheAcquirePen(int style, int width, COLORREF color);
+HBRUSH GdiCacheAcquireBrush(COLORREF color);
+HFONT  GdiCacheAcquireFont(int weight, int height, const char *faceName);
+void   GdiCacheRelease(HGDIOBJ object);
+void   GdiCacheReleaseAll(void);
+
+#endif /* GDICACHE_H */
@@ -25,8 +25,13 @@
 #define WC_SAVEDATA                     105
 #define WC_ABOUT                        106
 #define WC_EXIT                         107
+#define WC_STATS                        108
+#define WC_PAGE_NEXT                    109
+#define WC_PAGE_PREV                    110
 #define GMT_OFFSET_SLIDER               102
 #define GMT_OFFSET_TEXT                 103
+#define TIMEZONE_ZONE                   104
+#define TIMEZONE_LIST                   105
 
 
 
@@ -0,0 +1,469 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   segrender.c -- portable seven-segment rasterizer and glyph atlas         */
+/*                                                                            */
+/* The segment geometry used to live in DrawDigit()/DrawColon() as GDI pen    */
+/* strokes.  Here the same vectors are rasterized into a plain 32-bit frame   */
+/* buffer, once per glyph, and clock faces are composed by copying glyphs.    */
+/*                                                                            */
+/* Every segment is a box in pixels at 100%, so a glyph can be drawn at any   */
+/* scale by scaling the boxes and giving each edge pixel the share of it the  */
+/* box covers.  At whole multiples of 100% no pixel is shared and the glyphs  */
+/* come out exactly as the pen drew them.  An atlas is one scale; the cache   */
+/* keeps a few, so moving to another monitor costs at most one build.         */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "segrender.h"
+
+const unsigned char segDigitBitmap[10] = { 0x3f,
+                                           0x06,
+                                           0x5b,
+                                           0x4f,
+                                           0x66,
+                                           0x6d,
+                                           0x7d,
+                                           0x07,
+                                           0x7f,
+                                           0x6f };
+
+const SegmentVectorsStruct segmentVectors[7] = {{ 2, 0,10, 0},
+                                                {13, 2,13,12},
+                                                {13,16,13,26},
+                                                { 2,28,10,28},
+                                                { 0,16, 0,26},
+                                                { 0, 2, 0,12},
+                                                { 2,14,10,14}};
+
+int SegFrameBufferInit(FrameBufferStruct *fb, int width, int height)
+{
+    fb->pixels = (uint32_t *) calloc((size_t) width * height, sizeof(uint32_t));
+    if (fb->pixels == NULL)
+    {
+        fb->width = fb->height = fb->stride = 0;
+        return(0);
+    }
+    fb->width = width;
+    fb->height = height;
+    fb->stride = width;
+    return(1);
+} /* SegFrameBufferInit() */
+
+void SegFrameBufferFree(FrameBufferStruct *fb)
+{
+    free(fb->pixels);
+    fb->pixels = NULL;
+    fb->width = fb->height = fb->stride = 0;
+} /* SegFrameBufferFree() */
+
+/******************************************************************************/
+/* SegFillRect -- fill [left,right) x [top,bottom), clipped to the buffer.    */
+/******************************************************************************/
+void SegFillRect(FrameBufferStruct *fb, int left, int top, int right, int bottom, uint32_t color)
+{
+    int x, y;
+    uint32_t *row;
+
+    if (left < 0)
+        left = 0;
+    if (top < 0)
+        top = 0;
+    if (right > fb->width)
+        right = fb->width;
+    if (bottom > fb->height)
+        bottom = fb->height;
+
+    for (y = top; y < bottom; y++)
+    {
+        row = fb->pixels + (size_t) y * fb->stride;
+        for (x = left; x < right; x++)
+            row[x] = color;
+    } /* for y */
+} /* SegFillRect() */
+
+/* pixels at 100% to pixels at scale, rounded to nearest */
+int SegScaled(int pixels, int scale)
+{
+    return((pixels * scale + SEG_SCALE_ONE / 2) / SEG_SCALE_ONE);
+} /* SegScaled() */
+
+/* one channel of back moved toward color by cover, out of SEG_SCALE_ONE squared */
+#define BlendChannel(back, color, cover, shift) \
+    ((uint32_t) ((int) ((back) >> (shift) & 0xff) + \
+                 ((int) ((color) >> (shift) & 0xff) - (int) ((back) >> (shift) & 0xff)) * (cover) \
+                 / (SEG_SCALE_ONE * SEG_SCALE_ONE)) << (shift))
+
+/******************************************************************************/
+/* FillCoverage -- fill [left,right) x [top,bottom), given in hundredths of a */
+/* pixel, blending each pixel the edges cross by how much of it is covered.   */
+/******************************************************************************/
+static void FillCoverage(FrameBufferStruct *fb, int left, int top, int right, int bottom, uint32_t color)
+{
+    const int one = SEG_SCALE_ONE;
+    int x, y, x0, x1, y0, y1, coverX, coverY, cover;
+    uint32_t *pixel;
+
+    if (left < 0)
+        left = 0;
+    if (top < 0)
+        top = 0;
+    x0 = left / one;
+    y0 = top / one;
+    x1 = (right + one - 1) / one;
+    y1 = (bottom + one - 1) / one;
+    if (x1 > fb->width)
+        x1 = fb->width;
+    if (y1 > fb->height)
+        y1 = fb->height;
+
+    for (y = y0; y < y1; y++)
+    {
+        coverY = ((bottom < (y + 1) * one) ? bottom : (y + 1) * one) - ((top > y * one) ? top : y * one);
+        for (x = x0; x < x1; x++)
+        {
+            coverX = ((right < (x + 1) * one) ? right : (x + 1) * one) - ((left > x * one) ? left : x * one);
+            cover = coverX * coverY;
+            pixel = fb->pixels + (size_t) y * fb->stride + x;
+            if (cover >= one * one)
+                *pixel = color;
+            else if (cover > 0)
+                *pixel = BlendChannel(*pixel, color, cover, 16) |
+                         BlendChannel(*pixel, color, cover, 8) |
+                         BlendChannel(*pixel, color, cover, 0);
+        } /* for x */
+    } /* for y */
+} /* FillCoverage() */
+
+/******************************************************************************/
+/* RasterizeDigit -- draw one digit the way the 2 pixel GDI pen did, with     */
+/* its origin at (x, y) in hundredths of a pixel: each segment is an          */
+/* axis-aligned stroke two pixels thick at 100%, centered on its line.        */
+/******************************************************************************/
+static void RasterizeDigit(FrameBufferStruct *fb, int x, int y, int scale, unsigned int digit,
+                           uint32_t litColor, uint32_t darkColor)
+{
+    int i;
+    int x0, y0, x1, y1;
+    const SegmentVectorsStruct *v;
+
+    if (digit > 9)
+        return;
+    for (i = 0; i < 7; i++)
+    {
+        v = &segmentVectors[i];
+        x0 = (int) v->startX;
+        y0 = (int) v->startY;
+        x1 = (int) v->endX;
+        y1 = (int) v->endY;
+        if (y0 == y1) /* horizontal segment */
+            FillCoverage(fb, x + x0 * scale, y + (y0 - 1) * scale, x + (x1 + 1) * scale, y + (y0 + 1) * scale,
+                         (segDigitBitmap[digit] & (1 << i)) ? litColor : darkColor);
+        else          /* vertical segment */
+            FillCoverage(fb, x + (x0 - 1) * scale, y + y0 * scale, x + (x0 + 1) * scale, y + (y1 + 1) * scale,
+                         (segDigitBitmap[digit] & (1 << i)) ? litColor : darkColor);
+    } /* for i */
+} /* RasterizeDigit() */
+
+static void RasterizeColon(FrameBufferStruct *fb, int x, int y, int scale, int onOff,
+                           uint32_t litColor, uint32_t darkColor)
+{
+    uint32_t color = onOff ? litColor : darkColor;
+    int upper = DIGIT_HEIGHT * 3 / 10, lower = DIGIT_HEIGHT * 6 / 10;
+
+    FillCoverage(fb, x, y + upper * scale, x + 3 * scale, y + (upper + 3) * scale, color);
+    FillCoverage(fb, x, y + lower * scale, x + 3 * scale, y + (lower + 3) * scale, color);
+} /* RasterizeColon() */
+
+void SegRasterizeDigit(FrameBufferStruct *fb, int x, int y, unsigned int digit, uint32_t litColor, uint32_t darkColor)
+{
+    RasterizeDigit(fb, x * SEG_SCALE_ONE, y * SEG_SCALE_ONE, SEG_SCALE_ONE, digit, litColor, darkColor);
+} /* SegRasterizeDigit() */
+
+void SegRasterizeColon(FrameBufferStruct *fb, int x, int y, int onOff, uint32_t litColor, uint32_t darkColor)
+{
+    RasterizeColon(fb, x * SEG_SCALE_ONE, y * SEG_SCALE_ONE, SEG_SCALE_ONE, onOff, litColor, darkColor);
+} /* SegRasterizeColon() */
+
+int SegAtlasInit(GlyphAtlasStruct *atlas, uint32_t litColor, uint32_t darkColor, uint32_t backColor)
+{
+    return(SegAtlasInitScaled(atlas, SEG_SCALE_ONE, litColor, darkColor, backColor));
+} /* SegAtlasInit() */
+
+/******************************************************************************/
+/* SegAtlasInitScaled -- pre-render the ten digits and both colon states at   */
+/* scale, clamped to SEG_SCALE_MIN..SEG_SCALE_MAX.  Cell widths round down,   */
+/* so the cells of a face never outgrow the face.  Returns nonzero on         */
+/* success.                                                                   */
+/******************************************************************************/
+int SegAtlasInitScaled(GlyphAtlasStruct *atlas, int scale, uint32_t litColor, uint32_t darkColor, uint32_t backColor)
+{
+    int i, x;
+
+    if (scale < SEG_SCALE_MIN)
+        scale = SEG_SCALE_MIN;
+    if (scale > SEG_SCALE_MAX)
+        scale = SEG_SCALE_MAX;
+    atlas->litColor = litColor;
+    atlas->darkColor = darkColor;
+    atlas->backColor = backColor;
+    atlas->scale = scale;
+    atlas->digitWidth = DIGIT_WIDTH * scale / SEG_SCALE_ONE;
+    atlas->colonWidth = COLON_WIDTH * scale / SEG_SCALE_ONE;
+    atlas->glyphTop = SegScaled(SEG_GLYPH_TOP, scale);
+    atlas->glyphHeight = SegScaled(SEG_GLYPH_HEIGHT, scale);
+    atlas->faceWidth = SegScaled(SEG_FACE_WIDTH, scale);
+    atlas->faceHeight = SegScaled(SEG_FACE_HEIGHT, scale);
+
+    x = 0;
+    for (i = 0; i < SEG_GLYPH_COUNT; i++)
+    {
+        atlas->glyphX[i] = x;
+        atlas->glyphWidth[i] = (i < 10) ? atlas->digitWidth : atlas->colonWidth;
+        x += atlas->glyphWidth[i];
+    } /* for i */
+
+    if (!SegFrameBufferInit(&atlas->strip, x, atlas->glyphHeight))
+        return(0);
+    SegFillRect(&atlas->strip, 0, 0, x, atlas->glyphHeight, backColor);
+
+    for (i = 0; i < 10; i++)
+        RasterizeDigit(&atlas->strip, atlas->glyphX[i] * SEG_SCALE_ONE + scale, scale, scale, i, litColor, darkColor);
+    RasterizeColon(&atlas->strip, atlas->glyphX[SEG_GLYPH_COLON_OFF] * SEG_SCALE_ONE, scale, scale, 0,
+                   litColor, darkColor);
+    RasterizeColon(&atlas->strip, atlas->glyphX[SEG_GLYPH_COLON_ON] * SEG_SCALE_ONE, scale, scale, 1,
+                   litColor, darkColor);
+    return(1);
+} /* SegAtlasInitScaled() */
+
+void SegAtlasFree(GlyphAtlasStruct *atlas)
+{
+    SegFrameBufferFree(&atlas->strip);
+} /* SegAtlasFree() */
+
+void SegAtlasCacheInit(SegAtlasCacheStruct *cache)
+{
+    memset(cache, 0, sizeof(SegAtlasCacheStruct));
+} /* SegAtlasCacheInit() */
+
+void SegAtlasCacheFree(SegAtlasCacheStruct *cache)
+{
+    int i;
+
+    for (i = 0; i < SEG_ATLAS_CACHE_SIZE; i++)
+        SegAtlasFree(&cache->atlases[i]);
+    SegAtlasCacheInit(cache);
+} /* SegAtlasCacheFree() */
+
+/******************************************************************************/
+/* SegAtlasCacheGet -- the atlas for scale and the colours, built in place of */
+/* the least recently used one if the cache has none.  It stays valid until   */
+/* SEG_ATLAS_CACHE_SIZE other atlases have been asked for.  NULL when out of  */
+/* memory.                                                                    */
+/******************************************************************************/
+const GlyphAtlasStruct *SegAtlasCacheGet(SegAtlasCacheStruct *cache, int scale,
+                                         uint32_t litColor, uint32_t darkColor, uint32_t backColor)
+{
+    GlyphAtlasStruct *atlas;
+    int i, oldest = 0;
+
+    if (scale < SEG_SCALE_MIN)
+        scale = SEG_SCALE_MIN;
+    if (scale > SEG_SCALE_MAX)
+        scale = SEG_SCALE_MAX;
+    for (i = 0; i < SEG_ATLAS_CACHE_SIZE; i++)
+    {
+        atlas = &cache->atlases[i];
+        if (cache->lastUsed[i] != 0 && atlas->scale == scale && atlas->litColor == litColor &&
+            atlas->darkColor == darkColor && atlas->backColor == backColor)
+        {
+            cache->lastUsed[i] = ++cache->uses;
+            return(atlas);
+        }
+        if (cache->lastUsed[i] < cache->lastUsed[oldest])
+            oldest = i;
+    } /* for i */
+
+    atlas = &cache->atlases[oldest];
+    SegAtlasFree(atlas);
+    cache->lastUsed[oldest] = 0;
+    if (!SegAtlasInitScaled(atlas, scale, litColor, darkColor, backColor))
+        return(NULL);
+    cache->lastUsed[oldest] = ++cache->uses;
+    cache->builds++;
+    return(atlas);
+} /* SegAtlasCacheGet() */
+
+void SegBlitGlyph(const GlyphAtlasStruct *atlas, FrameBufferStruct *fb, int glyph, int x, int y)
+{
+    int row, width, height, srcX;
+    const uint32_t *src;
+
+    if (glyph < 0 || glyph >= SEG_GLYPH_COUNT)
+        return;
+    width = atlas->glyphWidth[glyph];
+    height = atlas->glyphHeight;
+    srcX = atlas->glyphX[glyph];
+
+    /* clip against the destination */
+    if (x < 0)
+    {
+        srcX -= x;
+        width += x;
+        x = 0;
+    }
+    if (x + width > fb->width)
+        width = fb->width - x;
+    if (width <= 0)
+        return;
+
+    for (row = 0; row < height; row++)
+    {
+        if (y + row < 0 || y + row >= fb->height)
+            continue;
+        src = atlas->strip.pixels + (size_t) row * atlas->strip.stride + srcX;
+        memcpy(fb->pixels + (size_t) (y + row) * fb->stride + x, src, width * sizeof(uint32_t));
+    } /* for row */
+} /* SegBlitGlyph() */
+
+/* copy all of source to fb with its top left at (x, y), clipped to fb */
+void SegBlitPixels(FrameBufferStruct *fb, int x, int y, const FrameBufferStruct *source)
+{
+    int row, width = source->width, srcX = 0;
+
+    if (x < 0)
+    {
+        srcX -= x;
+        width += x;
+        x = 0;
+    }
+    if (x + width > fb->width)
+        width = fb->width - x;
+    if (width <= 0)
+        return;
+
+    for (row = 0; row < source->height; row++)
+    {
+        if (y + row < 0 || y + row >= fb->height)
+            continue;
+        memcpy(fb->pixels + (size_t) (y + row) * fb->stride + x,
+               source->pixels + (size_t) row * source->stride + srcX, width * sizeof(uint32_t));
+    } /* for row */
+} /* SegBlitPixels() */
+
+/******************************************************************************/
+/* SegFaceMask -- the segments a face shows, digit slot 0 in the low bits.    */
+/******************************************************************************/
+uint64_t SegFaceMask(int hours, int minutes, int seconds)
+{
+    int digits[6];
+    int i;
+    uint64_t mask = 0;
+
+    digits[0] = hours / 10;
+    digits[1] = hours % 10;
+    digits[2] = minutes / 10;
+    digits[3] = minutes % 10;
+    digits[4] = seconds / 10;
+    digits[5] = seconds % 10;
+
+    for (i = 0; i < SEG_FACE_DIGITS; i++)
+    {
+        if (digits[i] < 0 || digits[i] > 9)
+            continue;           /* out of range shows blank, as DrawDigit() did */
+        mask |= (uint64_t) segDigitBitmap[digits[i]] << (i * SEG_MASK_DIGIT_BITS);
+    } /* for i */
+    for (i = 0; i < SEG_FACE_DIGITS / 2 - 1; i++)
+        mask |= (uint64_t) 1 << (SEG_MASK_COLON_SHIFT + i);
+    return(mask);
+} /* SegFaceMask() */
+
+/******************************************************************************/
+/* SegDirtyDigits -- bit n is set when digit slot n differs between masks.    */
+/* Colon changes mark the digit slot to their left.                           */
+/******************************************************************************/
+unsigned int SegDirtyDigits(uint64_t previous, uint64_t current)
+{
+    uint64_t changed = previous ^ current;
+    unsigned int dirty = 0;
+    int i;
+
+    if (changed == 0)
+        return(0);
+    for (i = 0; i < SEG_FACE_DIGITS; i++)
+    {
+        if ((changed >> (i * SEG_MASK_DIGIT_BITS)) & 0x7f)
+            dirty |= 1u << i;
+    } /* for i */
+    for (i = 0; i < SEG_FACE_DIGITS / 2 - 1; i++)
+    {
+        if ((changed >> (SEG_MASK_COLON_SHIFT + i)) & 1)
+            dirty |= 1u << (i * 2 + 1);
+    } /* for i */
+    return(dirty);
+} /* SegDirtyDigits() */
+
+/******************************************************************************/
+/* SegDigitSlotX -- face-relative x of a digit slot at the atlas's scale;     */
+/* colons sit after 1, 3.                                                     */
+/******************************************************************************/
+int SegDigitSlotX(const GlyphAtlasStruct *atlas, int slot)
+{
+    return(SegScaled(CLOCK_X_OFFSET, atlas->scale) + slot * atlas->digitWidth + (slot / 2) * atlas->colonWidth);
+} /* SegDigitSlotX() */
+
+static int GlyphForSegments(unsigned int segments)
+{
+    int digit;
+
+    for (digit = 0; digit < 10; digit++)
+    {
+        if (segDigitBitmap[digit] == segments)
+            return(digit);
+    } /* for digit */
+    return(-1);
+} /* GlyphForSegments() */
+
+/******************************************************************************/
+/* SegRenderFaceDigits -- re-blit only the digit slots set in digits, each    */
+/* with the colon to its right.  Glyph cells cover their whole area, and a    */
+/* slot that is no digit is filled blank, so the rest of the face is left     */
+/* alone.                                                                     */
+/******************************************************************************/
+void SegRenderFaceDigits(const GlyphAtlasStruct *atlas, FrameBufferStruct *fb, int x, int y,
+                         uint64_t mask, unsigned int digits)
+{
+    int i, slotX, glyph;
+    int glyphY = y + atlas->glyphTop;
+
+    for (i = 0; i < SEG_FACE_DIGITS; i++)
+    {
+        if (!(digits & (1u << i)))
+            continue;
+        slotX = x + SegDigitSlotX(atlas, i);
+        glyph = GlyphForSegments((unsigned int) (mask >> (i * SEG_MASK_DIGIT_BITS)) & 0x7f);
+        if (glyph < 0)
+            SegFillRect(fb, slotX, glyphY, slotX + atlas->digitWidth, glyphY + atlas->glyphHeight, atlas->backColor);
+        else
+            SegBlitGlyph(atlas, fb, glyph, slotX, glyphY);
+        if ((i & 1) && i < SEG_FACE_DIGITS - 1)
+            SegBlitGlyph(atlas, fb,
+                         ((mask >> (SEG_MASK_COLON_SHIFT + i / 2)) & 1) ? SEG_GLYPH_COLON_ON : SEG_GLYPH_COLON_OFF,
+                         slotX + atlas->digitWidth, glyphY);
+    } /* for i */
+} /* SegRenderFaceDigits() */
+
+/******************************************************************************/
+/* SegRenderFaceMask -- compose a face from cached glyphs at (x, y).          */
+/******************************************************************************/
+void SegRenderFaceMask(const GlyphAtlasStruct *atlas, FrameBufferStruct *fb, int x, int y, uint64_t mask)
+{
+    SegFillRect(fb, x, y, x + atlas->faceWidth, y + atlas->faceHeight, atlas->backColor);
+    SegRenderFaceDigits(atlas, fb, x, y, mask, (1u << SEG_FACE_DIGITS) - 1);
+} /* SegRenderFaceMask() */
+
+void SegRenderFace(const GlyphAtlasStruct *atlas, FrameBufferStruct *fb, int x, int y,
+                   int hours, int minutes, int seconds)
+{
+    SegRenderFaceMask(atlas, fb, x, y, SegFaceMask(hours, minutes, seconds));
+} /* SegRenderFace() */
@@ -0,0 +1,127 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   segrender.h -- portable seven-segment rasterizer and glyph atlas         */
+/******************************************************************************/
+
+#ifndef SEGRENDER_H
+#define SEGRENDER_H
+
+#include <stdint.h>
+
+#define SHOW_SECONDS
+
+#define DIGIT_WIDTH  18
+#define DIGIT_HEIGHT 34
+#define COLON_WIDTH  5
+#ifdef SHOW_SECONDS
+#define CLOCK_DISPLAY_WIDTH  (DIGIT_WIDTH * 6 + COLON_WIDTH * 2 + 6)
+#else
+#define CLOCK_DISPLAY_WIDTH  (DIGIT_WIDTH * 4 + COLON_WIDTH + 6)
+#endif
+#define CLOCK_DISPLAY_HEIGHT (DIGIT_HEIGHT + 15)
+#define CLOCK_Y_OFFSET 2
+#define CLOCK_X_OFFSET 3
+
+/* glyph cells hold one digit or colon, drawn with a 1 pixel top margin */
+#define SEG_GLYPH_HEIGHT (DIGIT_HEIGHT - 4)
+#define SEG_GLYPH_TOP    (CLOCK_Y_OFFSET - 1)
+
+/* the face is the digit band above the location label */
+#define SEG_FACE_WIDTH   CLOCK_DISPLAY_WIDTH
+#define SEG_FACE_HEIGHT  (DIGIT_HEIGHT - 2)
+
+#ifdef SHOW_SECONDS
+#define SEG_FACE_DIGITS  6
+#else
+#define SEG_FACE_DIGITS  4
+#endif
+
+/* a face mask packs 7 segment bits per digit slot, then one bit per colon */
+#define SEG_MASK_DIGIT_BITS 7
+#define SEG_MASK_COLON_SHIFT (SEG_MASK_DIGIT_BITS * SEG_FACE_DIGITS)
+#define SEG_MASK_INVALID     (~(uint64_t) 0)
+
+/* scales are in percent; glyph geometry is in pixels at SEG_SCALE_ONE */
+#define SEG_SCALE_ONE  100
+#define SEG_SCALE_MIN  100
+#define SEG_SCALE_MAX  800
+
+#define SEG_ATLAS_CACHE_SIZE 4  /* atlases kept, e.g. one per monitor DPI */
+
+#define SEG_GLYPH_COLON_OFF 10
+#define SEG_GLYPH_COLON_ON  11
+#define SEG_GLYPH_COUNT     12
+
+/* pixels are 0x00RRGGBB, which is also the layout of a 32-bit Win32 DIB */
+#define SEG_RGB(r, g, b) ((uint32_t) (((r) & 0xff) << 16 | ((g) & 0xff) << 8 | ((b) & 0xff)))
+
+typedef struct SegmentVectorsStructTag {
+    unsigned int startX;
+    unsigned int startY;
+    unsigned int endX;
+    unsigned int endY;
+} SegmentVectorsStruct;
+
+typedef struct FrameBufferStructTag {
+    uint32_t *pixels;
+    int width;
+    int height;
+    int stride;                 /* pixels per row */
+} FrameBufferStruct;
+
+/* the glyphs of one scale and colour scheme, and the face metrics at that scale */
+typedef struct GlyphAtlasStructTag {
+    uint32_t litColor;
+    uint32_t darkColor;
+    uint32_t backColor;
+    int scale;
+    int digitWidth;
+    int colonWidth;
+    int glyphTop;
+    int glyphHeight;
+    int faceWidth;
+    int faceHeight;
+    FrameBufferStruct strip;    /* all glyphs side by side */
+    int glyphX[SEG_GLYPH_COUNT];
+    int glyphWidth[SEG_GLYPH_COUNT];
+} GlyphAtlasStruct;
+
+/* atlases by scale and colours, the least recently used one rebuilt on a miss */
+typedef struct SegAtlasCacheStructTag {
+    GlyphAtlasStruct atlases[SEG_ATLAS_CACHE_SIZE];
+    uint32_t lastUsed[SEG_ATLAS_CACHE_SIZE];   /* 0 for an empty entry */
+    uint32_t uses;
+    unsigned long builds;
+} SegAtlasCacheStruct;
+
+extern const unsigned char segDigitBitmap[10];
+extern const SegmentVectorsStruct segmentVectors[7];
+
+int  SegFrameBufferInit(FrameBufferStruct *fb, int width, int height);
+void SegFrameBufferFree(FrameBufferStruct *fb);
+void SegFillRect(FrameBufferStruct *fb, int left, int top, int right, int bottom, uint32_t color);
+
+void SegRasterizeDigit(FrameBufferStruct *fb, int x, int y, unsigned int digit, uint32_t litColor, uint32_t darkColor);
+void SegRasterizeColon(FrameBufferStruct *fb, int x, int y, int onOff, uint32_t litColor, uint32_t darkColor);
+
+int  SegScaled(int pixels, int scale);
+int  SegAtlasInit(GlyphAtlasStruct *atlas, uint32_t litColor, uint32_t darkColor, uint32_t backColor);
+int  SegAtlasInitScaled(GlyphAtlasStruct *atlas, int scale, uint32_t litColor, uint32_t darkColor, uint32_t backColor);
+void SegAtlasFree(GlyphAtlasStruct *atlas);
+void SegAtlasCacheInit(SegAtlasCacheStruct *cache);
+void SegAtlasCacheFree(SegAtlasCacheStruct *cache);
+const GlyphAtlasStruct *SegAtlasCacheGet(SegAtlasCacheStruct *cache, int scale,
+                                         uint32_t litColor, uint32_t darkColor, uint32_t backColor);
+void SegBlitGlyph(const GlyphAtlasStruct *atlas, FrameBufferStruct *fb, int glyph, int x, int y);
+void SegBlitPixels(FrameBufferStruct *fb, int x, int y, const FrameBufferStruct *source);
+void SegRenderFace(const GlyphAtlasStruct *atlas, FrameBufferStruct *fb, int x, int y,
+                   int hours, int minutes, int seconds);
+void SegRenderFaceMask(const GlyphAtlasStruct *atlas, FrameBufferStruct *fb, int x, int y, uint64_t mask);
+void SegRenderFaceDigits(const GlyphAtlasStruct *atlas, FrameBufferStruct *fb, int x, int y,
+                         uint64_t mask, unsigned int digits);
+
+uint64_t     SegFaceMask(int hours, int minutes, int seconds);
+unsigned int SegDirtyDigits(uint64_t previous, uint64_t current);
+int          SegDigitSlotX(const GlyphAtlasStruct *atlas, int slot);
+
+#endif /* SEGRENDER_H */
@@ -0,0 +1,45 @@
+#!/bin/sh
+# WorldClock -- A Multiple-Timezone Digital Clock
+#   tests/golden.sh -- wcrender's frames against reference checksums
+#
+# Usage: sh tests/golden.sh [-u]
+# Builds wcrender with $CC (cc) into $TESTDIR (a temporary directory) and
+# compares `wcrender -c` for tests/golden/golden.ini over four minutes around
+# New York's 2024 change to daylight saving time with tests/golden/z<scale>.txt
+# at each scale, on one thread and on a pool.  -u writes the files instead,
+# after a change that is meant to alter the pixels.  Zones come from the
+# system's tzdata; the exit status is the number of mismatches.
+
+cd "$(dirname "$0")/.." || exit 1
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:--std=c99 -D_POSIX_C_SOURCE=200809L -O2 -Wall -Wextra -pthread}
+TESTDIR=${TESTDIR:-$(mktemp -d)}
+SCALES="100 150 200 400"
+RANGE="-t 2024-03-10T06:58:00Z -e 2024-03-10T07:02:00Z"
+failed=0
+
+if ! $CC $CFLAGS -I. -o "$TESTDIR/wcrender" wcrender.c wcsetup.c wcconfig.c clockreg.c tzone.c \
+        ticktime.c ticksched.c segrender.c wclayout.c bmfont.c wcimage.c wcstats.c wcframe.c \
+        wcpool.c -lm; then
+    echo "golden: wcrender does not build"
+    exit 1
+fi
+
+for scale in $SCALES; do
+    golden=tests/golden/z$scale.txt
+    if [ "$1" = "-u" ]; then
+        "$TESTDIR/wcrender" -i tests/golden/golden.ini $RANGE -z "$scale" -c 2>/dev/null > "$golden"
+        continue
+    fi
+    for threads in 1 4; do
+        "$TESTDIR/wcrender" -i tests/golden/golden.ini $RANGE -z "$scale" -P $threads -c 2>/dev/null \
+            > "$TESTDIR/z$scale.txt"
+        if ! cmp -s "$golden" "$TESTDIR/z$scale.txt"; then
+            echo "golden: -z $scale -P $threads differs from $golden:"
+            diff "$golden" "$TESTDIR/z$scale.txt" | head -5
+            failed=$((failed + 1))
+        fi
+    done
+done
+[ "$1" = "-u" ] || echo "golden       $SCALES: $failed mismatched"
+exit $failed
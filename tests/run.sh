@@ -0,0 +1,45 @@
+#!/bin/sh
+# WorldClock -- A Multiple-Timezone Digital Clock
+#   tests/run.sh -- build and run the portable tests
+#
+# Usage: sh tests/run.sh [test ...]
+# Builds each test with $CC (cc) into $TESTDIR (a temporary directory) and
+# runs it; the exit status is the number of tests that failed.
+
+cd "$(dirname "$0")/.." || exit 1
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:--std=c99 -D_POSIX_C_SOURCE=200809L -O2 -Wall -Wextra -pthread}
+TESTDIR=${TESTDIR:-$(mktemp -d)}
+failed=0
+
+# name and the sources it is built from
+run()
+{
+    name=$1
+    shift
+    if ! $CC $CFLAGS -I. -o "$TESTDIR/$name" "tests/$name.c" "$@" -lm; then
+        echo "$name: does not build"
+        failed=$((failed + 1))
+    elif ! "$TESTDIR/$name"; then
+        failed=$((failed + 1))
+    fi
+}
+
+wanted()
+{
+    [ -z "$selected" ] && return 0
+    case " $selected " in *" $1 "*) return 0;; esac
+    return 1
+}
+selected="$*"
+
+wanted tsched   && run tsched ticksched.c
+wanted tface    && run tface clockreg.c segrender.c bmfont.c tzone.c ticktime.c
+wanted tclockreg && run tclockreg clockreg.c segrender.c bmfont.c tzone.c ticktime.c
+wanted talarm   && run talarm wcalarm.c clockreg.c segrender.c bmfont.c tzone.c ticktime.c
+wanted tstream  && run tstream wcstream.c clockreg.c segrender.c bmfont.c tzone.c ticktime.c
+wanted tzfind   && run tzfind clockreg.c segrender.c bmfont.c tzone.c ticktime.c
+wanted tzindex  && run tzindex wczindex.c wczdata.c
+wanted golden   && { TESTDIR=$TESTDIR sh tests/golden.sh || failed=$((failed + 1)); }
+
+exit $failed
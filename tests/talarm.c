@@ -0,0 +1,251 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   tests/talarm.c -- the alarm wheel against a brute-force model            */
+/*                                                                            */
+/* Thousands of daily alarms and countdowns on zoned and fixed clocks are     */
+/* run a second at a time over four days that cross the US change to          */
+/* daylight saving time, with offsets edited and alarms cancelled on the      */
+/* way.  Each second, every live alarm is checked against its clock's local   */
+/* time: it must ring exactly when it is due, and only then.  Zones come      */
+/* from the system's tzdata.                                                  */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "wctest.h"
+#include "wcalarm.h"
+
+#define NUM_CLOCKS  8
+#define NUM_ALARMS  3000
+#define TEST_START  1709856000LL    /* 2024-03-08, two days before the change */
+#define TEST_DAYS   4
+#define EDIT_AT     (TEST_START + SECONDS_PER_DAY + 5000)
+#define CANCEL_AT   (TEST_START + 2 * SECONDS_PER_DAY)
+
+typedef struct ModelStructTag {
+    AlarmHandle handle;
+    int clock;
+    AlarmKind kind;
+    int32_t localSeconds;
+    unsigned int weekdays;
+    int64_t dueUtc;
+    int live;
+    int rung;                       /* this second */
+} ModelStruct;
+
+static const char *zoneNames[NUM_CLOCKS] = {
+    "America/New_York", "Europe/London", "Asia/Kolkata", "Australia/Adelaide",
+    "Asia/Kathmandu", "America/St_Johns", "", ""
+};
+
+static ModelStruct model[NUM_ALARMS];
+static int numModel;
+static int64_t now;
+static int strayRings;
+
+static void RingModel(void *context, const AlarmStruct *alarm, int64_t utcSeconds)
+{
+    int i;
+
+    (void) context;
+    for (i = 0; i < numModel; i++)
+        if (model[i].live && model[i].handle == alarm->handle)
+            break;
+    if (i == numModel || utcSeconds != now)
+    {
+        strayRings++;
+        return;
+    }
+    model[i].rung++;
+} /* RingModel() */
+
+/* whether alarm i is due at utcSeconds, its clock showing offset */
+static int ModelDue(const ModelStruct *alarm, int64_t utcSeconds, int32_t offset)
+{
+    int64_t local = utcSeconds + offset, day;
+
+    if (alarm->kind == ALARM_COUNTDOWN)
+        return(alarm->dueUtc == utcSeconds);
+    day = (local >= 0) ? local / SECONDS_PER_DAY : -((-local + SECONDS_PER_DAY - 1) / SECONDS_PER_DAY);
+    return(local - day * SECONDS_PER_DAY == alarm->localSeconds &&
+           (alarm->weekdays >> (int) (((day + 4) % 7 + 7) % 7) & 1));
+} /* ModelDue() */
+
+static void TestBruteForce(void)
+{
+    ClockRegistryStruct reg;
+    AlarmWheelStruct wheel;
+    ModelStruct *alarm;
+    int32_t offsets[NUM_CLOCKS];
+    char label[8];
+    long expected = 0, mismatches = 0;
+    int i;
+
+    ClockRegInit(&reg, 0);
+    for (i = 0; i < NUM_CLOCKS; i++)
+    {
+        sprintf(label, "C%d", i);
+        CHECK(ClockRegAdd(&reg, label, (i - 3) * 3600, zoneNames[i]) != CLOCK_HANDLE_NONE);
+        CHECK(zoneNames[i][0] == '\0' || reg.zones[i] != NULL);    /* is tzdata installed? */
+    } /* for i */
+
+    AlarmWheelInit(&wheel, TEST_START);
+    srand(7);
+    for (numModel = 0; numModel < NUM_ALARMS; numModel++)
+    {
+        alarm = &model[numModel];
+        alarm->clock = rand() % NUM_CLOCKS;
+        alarm->live = 1;
+        if (rand() % 3 != 0)
+        {
+            /* daily, clear of the hours the change skips or repeats */
+            alarm->kind = ALARM_DAILY;
+            alarm->localSeconds = 4 * 3600 + rand() % (20 * 3600);
+            alarm->weekdays = (unsigned int) (rand() % ALARM_EVERY_DAY) + 1;
+            alarm->handle = AlarmAddDaily(&wheel, &reg, reg.handles[alarm->clock], "daily",
+                                          alarm->localSeconds, alarm->weekdays);
+        }
+        else
+        {
+            alarm->kind = ALARM_COUNTDOWN;
+            alarm->dueUtc = TEST_START + 1 + rand() % ((TEST_DAYS + 1) * SECONDS_PER_DAY);
+            alarm->handle = AlarmAddCountdown(&wheel, reg.handles[alarm->clock], "countdown", alarm->dueUtc);
+        }
+        CHECK(alarm->handle != ALARM_HANDLE_NONE);
+    } /* for numModel */
+
+    for (now = TEST_START + 1; now <= TEST_START + TEST_DAYS * SECONDS_PER_DAY; now++)
+    {
+        if (now == EDIT_AT)
+        {
+            /* the two fixed clocks are edited; their daily alarms follow */
+            ClockRegSetOffset(&reg, 6, 5 * 3600);
+            AlarmClockChanged(&wheel, &reg, reg.handles[6]);
+            ClockRegSetOffset(&reg, 7, -7 * 3600);
+            AlarmClockChanged(&wheel, &reg, reg.handles[7]);
+        }
+        if (now == CANCEL_AT)
+        {
+            for (i = 0; i < numModel; i += 10)
+            {
+                if (!model[i].live)
+                    continue;
+                AlarmCancel(&wheel, model[i].handle);
+                CHECK(AlarmFind(&wheel, model[i].handle) == NULL);
+                model[i].live = 0;
+            } /* for i */
+        }
+        for (i = 0; i < NUM_CLOCKS; i++)
+            offsets[i] = ClockRegOffsetAt(&reg, i, now);
+        for (i = 0; i < numModel; i++)
+            model[i].rung = 0;
+
+        AlarmAdvance(&wheel, &reg, now, RingModel, NULL);
+
+        for (i = 0; i < numModel; i++)
+        {
+            alarm = &model[i];
+            if (!alarm->live)
+                continue;
+            if (ModelDue(alarm, now, offsets[alarm->clock]))
+            {
+                expected++;
+                if (alarm->rung != 1)
+                    mismatches++;
+                if (alarm->kind == ALARM_COUNTDOWN)
+                    alarm->live = 0;
+            }
+            else if (alarm->rung != 0)
+                mismatches++;
+        } /* for i */
+    } /* for now */
+
+    printf("talarm       %ld rings checked over %d days\n", expected, TEST_DAYS);
+    CHECK(mismatches == 0);
+    CHECK(strayRings == 0);
+    CHECK(expected > 3000);         /* the model is not vacuous */
+    for (i = 0; i < numModel; i++)
+        CHECK(model[i].live == (AlarmFind(&wheel, model[i].handle) != NULL));
+    AlarmWheelFree(&wheel);
+    ClockRegFree(&reg);
+} /* TestBruteForce() */
+
+static int64_t lastRing;
+static int numRings;
+
+static void RingCount(void *context, const AlarmStruct *alarm, int64_t utcSeconds)
+{
+    (void) context;
+    (void) alarm;
+    lastRing = utcSeconds;
+    numRings++;
+} /* RingCount() */
+
+/* run the wheel from start to end a second at a time; how many rang */
+static int Run(AlarmWheelStruct *wheel, const ClockRegistryStruct *reg, int64_t start, int64_t end)
+{
+    int64_t t;
+
+    numRings = 0;
+    for (t = start; t <= end; t++)
+        AlarmAdvance(wheel, reg, t, RingCount, NULL);
+    return(numRings);
+} /* Run() */
+
+static void TestChangeHours(void)
+{
+    ClockRegistryStruct reg;
+    AlarmWheelStruct wheel;
+    int64_t springDay = 1710028800LL, fallDay = 1730592000LL;   /* 2024-03-10, 2024-11-03 UTC */
+
+    ClockRegInit(&reg, 0);
+    CHECK(ClockRegAdd(&reg, "New York", 0, "America/New_York") != CLOCK_HANDLE_NONE);
+
+    /* 02:30 does not happen on the spring day; it rings once, within the hour of the change */
+    AlarmWheelInit(&wheel, springDay);
+    CHECK(AlarmAddDaily(&wheel, &reg, reg.handles[0], "skipped", 2 * 3600 + 1800, ALARM_EVERY_DAY) != ALARM_HANDLE_NONE);
+    CHECK(Run(&wheel, &reg, springDay + 1, springDay + SECONDS_PER_DAY) == 1);
+    CHECK(lastRing >= springDay + 6 * 3600 && lastRing <= springDay + 8 * 3600);  /* the change is at 07:00 UTC */
+    AlarmWheelFree(&wheel);
+
+    /* 01:30 happens twice on the fall day; it rings once */
+    AlarmWheelInit(&wheel, fallDay);
+    CHECK(AlarmAddDaily(&wheel, &reg, reg.handles[0], "repeated", 1 * 3600 + 1800, ALARM_EVERY_DAY) != ALARM_HANDLE_NONE);
+    CHECK(Run(&wheel, &reg, fallDay + 1, fallDay + SECONDS_PER_DAY) == 1);
+    AlarmWheelFree(&wheel);
+    ClockRegFree(&reg);
+} /* TestChangeHours() */
+
+/******************************************************************************/
+/* A wheel started after alarms came due, as World Clock is at start-up:      */
+/* an overdue countdown rings with the first second, and a daily alarm whose  */
+/* time has passed waits for its next day.                                    */
+/******************************************************************************/
+static void TestStartLate(void)
+{
+    ClockRegistryStruct reg;
+    AlarmWheelStruct wheel;
+    AlarmHandle daily, countdown;
+
+    ClockRegInit(&reg, 0);
+    CHECK(ClockRegAdd(&reg, "GMT", 0, "") != CLOCK_HANDLE_NONE);
+    AlarmWheelInit(&wheel, TEST_START + 3600);
+    daily = AlarmAddDaily(&wheel, &reg, reg.handles[0], "daily", 1800, ALARM_EVERY_DAY);
+    countdown = AlarmAddCountdown(&wheel, reg.handles[0], "countdown", TEST_START + 1800);
+    CHECK(Run(&wheel, &reg, TEST_START + 3601, TEST_START + 3601) == 1);
+    CHECK(AlarmFind(&wheel, countdown) == NULL);
+    CHECK(AlarmFind(&wheel, daily) != NULL && AlarmFind(&wheel, daily)->dueUtc == TEST_START + SECONDS_PER_DAY + 1800);
+    CHECK(Run(&wheel, &reg, TEST_START + 3602, TEST_START + SECONDS_PER_DAY + 1800) == 1);
+    CHECK(lastRing == TEST_START + SECONDS_PER_DAY + 1800);
+    AlarmWheelFree(&wheel);
+    ClockRegFree(&reg);
+} /* TestStartLate() */
+
+int main(void)
+{
+    TestBruteForce();
+    TestChangeHours();
+    TestStartLate();
+    TzFreeAllZones();
+    return(TestResult("talarm"));
+} /* main() */
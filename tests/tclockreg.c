@@ -0,0 +1,273 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   tests/tclockreg.c -- clock registry labels, handles and allocations      */
+/*                                                                            */
+/* Random adds, removes and renames are checked against a plain model of the  */
+/* clock list, with long labels that repeat and long labels never seen        */
+/* before.  Renaming must reuse the slots of labels no clock has any more, so */
+/* a session that renames for ever allocates nothing once warm; interning     */
+/* must not slow down with the number of labels.  Allocations are counted on  */
+/* glibc by wrapping malloc(), as wcbench does; elsewhere those checks are    */
+/* skipped.                                                                   */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "wctest.h"
+#include "clockreg.h"
+
+#define MODEL_CLOCKS 300
+#define CHURN_CLOCKS 1000
+
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__) && !defined(TEST_NO_ALLOC_COUNT)
+#define TEST_COUNT_ALLOCS
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *block, size_t size);
+
+static unsigned long allocCount = 0;
+
+void *malloc(size_t size)
+{
+    allocCount++;
+    return(__libc_malloc(size));
+} /* malloc() */
+
+void *calloc(size_t count, size_t size)
+{
+    allocCount++;
+    return(__libc_calloc(count, size));
+} /* calloc() */
+
+void *realloc(void *block, size_t size)
+{
+    allocCount++;
+    return(__libc_realloc(block, size));
+} /* realloc() */
+#endif
+
+static unsigned long randomState = 12345;
+
+static int Random(int range)
+{
+    randomState = randomState * 1103515245 + 12345;
+    return((int) ((randomState >> 16) % (unsigned long) range));
+} /* Random() */
+
+/* a label: short, one of a few long ones, or long and never seen before */
+static void MakeLabel(char *label, unsigned long fresh)
+{
+    switch (Random(3))
+    {
+        case 0:
+            sprintf(label, "City %d", Random(50));
+            break;
+        case 1:
+            sprintf(label, "A long label shared by many clocks, number %d", Random(8));
+            break;
+        default:
+            sprintf(label, "A long label no clock has had before this one, %lu", fresh);
+            break;
+    } /* switch */
+} /* MakeLabel() */
+
+/* the distinct labels the model holds that are too long for labels[] */
+static int DistinctLong(char (*model)[CLOCK_LABEL_SIZE], int count)
+{
+    int i, j, distinct = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        if (strlen(model[i]) < CLOCK_NAME_SIZE)
+            continue;
+        for (j = 0; j < i && strcmp(model[i], model[j]) != 0; j++)
+            ;
+        if (j == i)
+            distinct++;
+    } /* for i */
+    return(distinct);
+} /* DistinctLong() */
+
+static void TestModel(void)
+{
+    static char model[MODEL_CLOCKS][CLOCK_LABEL_SIZE];
+    static ClockHandle handles[MODEL_CLOCKS];
+    ClockRegistryStruct reg;
+    char label[CLOCK_LABEL_SIZE];
+    unsigned long fresh = 0;
+    int count = 0, op, i, index, same = 1;
+
+    ClockRegInit(&reg, 0);
+    for (op = 0; op < 30000; op++)
+    {
+        MakeLabel(label, fresh++);
+        i = Random(10);
+        if (count < MODEL_CLOCKS && (i < 4 || count == 0))
+        {
+            handles[count] = ClockRegAdd(&reg, label, 0, NULL);
+            strcpy(model[count++], label);
+        }
+        else if (i < 7)
+        {
+            index = Random(count);
+            ClockRegRemove(&reg, handles[index]);
+            memmove(&handles[index], &handles[index + 1], sizeof(handles[0]) * (count - index - 1));
+            memmove(&model[index], &model[index + 1], sizeof(model[0]) * (count - index - 1));
+            count--;
+        }
+        else
+        {
+            index = Random(count);
+            if (i == 9)
+                strcpy(label, ClockRegLabel(&reg, index));  /* its own label again */
+            ClockRegSetLabel(&reg, index, label);
+            strcpy(model[index], label);
+        }
+
+        if (op % 97 != 0)
+            continue;
+        CHECK(reg.count == count);
+        for (i = 0; i < count; i++)
+        {
+            same &= ClockRegIndexOf(&reg, handles[i]) == i && strcmp(ClockRegLabel(&reg, i), model[i]) == 0 &&
+                    strncmp(reg.labels[i], model[i], CLOCK_NAME_SIZE - 1) == 0 &&
+                    reg.labelLayouts[i].length == (int) strlen(model[i]);
+        } /* for i */
+        CHECK(same);
+        CHECK(reg.longCount == DistinctLong(model, count));
+        CHECK(reg.longCapacity <= 2 * MODEL_CLOCKS);
+    } /* for op */
+
+    while (reg.count > 0)
+        ClockRegRemove(&reg, reg.handles[reg.count - 1]);
+    CHECK(reg.longCount == 0);
+    ClockRegFree(&reg);
+} /* TestModel() */
+
+static void TestTooLong(void)
+{
+    ClockRegistryStruct reg;
+    char label[300];
+
+    ClockRegInit(&reg, 0);
+    memset(label, 'x', sizeof(label) - 1);
+    label[sizeof(label) - 1] = '\0';
+    ClockRegAdd(&reg, label, 0, NULL);
+    ClockRegAdd(&reg, label, 0, NULL);
+    CHECK(strlen(ClockRegLabel(&reg, 0)) == CLOCK_LABEL_SIZE - 1);
+    CHECK(reg.longCount == 1 && reg.longLabels[0] == reg.longLabels[1]);
+    ClockRegSetLabel(&reg, 0, ClockRegLabel(&reg, 0));
+    CHECK(strlen(ClockRegLabel(&reg, 0)) == CLOCK_LABEL_SIZE - 1 && reg.longCount == 1);
+    ClockRegSetLabel(&reg, 1, "Short");
+    CHECK(reg.longCount == 1 && strcmp(ClockRegLabel(&reg, 1), "Short") == 0);
+    ClockRegSetLabel(&reg, 0, "Short");
+    CHECK(reg.longCount == 0);
+    ClockRegFree(&reg);
+} /* TestTooLong() */
+
+/* a warm registry renaming every clock to labels never seen allocates nothing */
+static void TestChurn(void)
+{
+    ClockRegistryStruct reg;
+    char label[CLOCK_LABEL_SIZE];
+    unsigned long fresh = 0;
+    int i, round, capacity;
+#ifdef TEST_COUNT_ALLOCS
+    unsigned long before;
+#endif
+
+    ClockRegInit(&reg, 16);
+    CHECK(ClockRegReserve(&reg, CHURN_CLOCKS));
+    for (i = 0; i < CHURN_CLOCKS; i++)
+    {
+        sprintf(label, "Long label of a clock being renamed all the time %lu", fresh++);
+        ClockRegAdd(&reg, label, 0, NULL);
+    } /* for i */
+    for (i = 0; i < CHURN_CLOCKS; i++)
+    {
+        sprintf(label, "Long label of a clock being renamed all the time %lu", fresh++);
+        ClockRegSetLabel(&reg, i, label);
+    } /* for i */
+    capacity = reg.longCapacity;
+
+#ifdef TEST_COUNT_ALLOCS
+    before = allocCount;
+#endif
+    for (round = 0; round < 50; round++)
+    {
+        for (i = 0; i < CHURN_CLOCKS; i++)
+        {
+            sprintf(label, "Long label of a clock being renamed all the time %lu", fresh++);
+            ClockRegSetLabel(&reg, i, label);
+        } /* for i */
+        ClockRegRemove(&reg, reg.handles[round % CHURN_CLOCKS]);
+        sprintf(label, "Long label of a clock being renamed all the time %lu", fresh++);
+        ClockRegAdd(&reg, label, 3600, NULL);
+    } /* for round */
+#ifdef TEST_COUNT_ALLOCS
+    CHECK(allocCount == before);
+#endif
+    CHECK(reg.longCapacity == capacity);
+    CHECK(reg.longCount == CHURN_CLOCKS);
+    CHECK(strcmp(ClockRegLabel(&reg, CHURN_CLOCKS - 1), label) == 0);
+    ClockRegFree(&reg);
+} /* TestChurn() */
+
+/* seconds to load count clocks with distinct long labels, the best of three */
+static double LoadSeconds(int count, unsigned long *allocs)
+{
+    ClockRegistryStruct reg;
+    char label[CLOCK_LABEL_SIZE];
+    double best = 1e9, seconds;
+    clock_t start;
+    int run, i;
+
+    for (run = 0; run < 3; run++)
+    {
+#ifdef TEST_COUNT_ALLOCS
+        *allocs = allocCount;
+#endif
+        start = clock();
+        ClockRegInit(&reg, 0);
+        ClockRegReserve(&reg, count);
+        for (i = 0; i < count; i++)
+        {
+            sprintf(label, "Clock number %d of a very long list, with a long label", i);
+            ClockRegAdd(&reg, label, 0, NULL);
+        } /* for i */
+        seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+#ifdef TEST_COUNT_ALLOCS
+        *allocs = allocCount - *allocs;
+#else
+        *allocs = 0;
+#endif
+        CHECK(reg.count == count && reg.longCount == count);
+        ClockRegFree(&reg);
+        if (seconds < best)
+            best = seconds;
+    } /* for run */
+    return(best);
+} /* LoadSeconds() */
+
+static void TestLoad(void)
+{
+    unsigned long smallAllocs, largeAllocs;
+    double small = LoadSeconds(3000, &smallAllocs), large = LoadSeconds(30000, &largeAllocs);
+
+    /* ten times the labels, about ten times the time; interning by scanning */
+    /* every label took a hundred times                                      */
+    printf("tclockreg    loads 3000 long labels in %.4f s, 30000 in %.4f s\n", small, large);
+    CHECK(large < 50 * small + 0.01);
+    CHECK(largeAllocs <= 60);       /* doubling, not one per label */
+} /* TestLoad() */
+
+int main(void)
+{
+    TestModel();
+    TestTooLong();
+    TestChurn();
+    TestLoad();
+    return(TestResult("tclockreg"));
+} /* main() */
@@ -0,0 +1,119 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   tests/tface.c -- face masks and fixed offsets out of range               */
+/*                                                                            */
+/* Clock<n>Offset is read from the INI file unchecked.  Any value must load,  */
+/* be kept within CLOCK_MAX_OFFSET_HOURS, and tick to a face of real digits;  */
+/* a digit SegFaceMask() has no segments for is drawn blank, whether the     */
+/* face is drawn whole or a changed slot at a time.                           */
+/******************************************************************************/
+
+#include <string.h>
+#include "wctest.h"
+#include "clockreg.h"
+
+#define DIGIT_MASK ((1u << SEG_MASK_DIGIT_BITS) - 1)
+
+static unsigned int Digit(uint64_t mask, int slot)
+{
+    return((unsigned int) (mask >> (slot * SEG_MASK_DIGIT_BITS)) & DIGIT_MASK);
+} /* Digit() */
+
+static void TestFaceMask(void)
+{
+    uint64_t mask = SegFaceMask(12, 34, 56), wild;
+
+    wild = SegFaceMask(100, 34, 56);
+    CHECK(Digit(wild, 0) == 0);                 /* 10 has no segments */
+    CHECK(Digit(wild, 1) == Digit(SegFaceMask(0, 0, 0), 1));   /* 100 % 10 */
+    CHECK(Digit(wild, 2) == Digit(mask, 2));
+    wild = SegFaceMask(-5, 34, 56);
+    CHECK(Digit(wild, 0) == Digit(SegFaceMask(0, 0, 0), 0));
+    CHECK(Digit(wild, 1) == 0);
+    wild = SegFaceMask(99999, -99999, 99999);
+    CHECK(Digit(wild, 0) == 0 && Digit(wild, 2) == 0);
+} /* TestFaceMask() */
+
+static void TestOffsets(void)
+{
+    static const int hours[] = { 1000, -1000, 2147483647, -2147483647 - 1, 24, -24, 5 };
+    ClockRegistryStruct reg;
+    TickSnapshotStruct tick;
+    int64_t second;
+    int i, n = (int) (sizeof(hours) / sizeof(hours[0]));
+
+    ClockRegInit(&reg, 0);
+    for (i = 0; i < n; i++)
+        CHECK(ClockRegAdd(&reg, "Wild", ClockRegHoursOffset(hours[i]), "") != CLOCK_HANDLE_NONE);
+    for (i = 0; i < n; i++)
+    {
+        CHECK(reg.gmtOffsets[i] >= -CLOCK_MAX_OFFSET_HOURS * 3600);
+        CHECK(reg.gmtOffsets[i] <= CLOCK_MAX_OFFSET_HOURS * 3600);
+    } /* for i */
+    CHECK(reg.gmtOffsets[6] == 5 * 3600);
+    ClockRegSetOffset(&reg, 6, 2147483647);
+    CHECK(reg.gmtOffsets[6] == CLOCK_MAX_OFFSET_HOURS * 3600);
+
+    /* a day, a minute at a time, each face from real digits */
+    for (second = 1709251200; second < 1709251200 + 86400; second += 60)
+    {
+        TickTakeSnapshot(&tick, second);
+        ClockRegTickAll(&reg, &tick);
+        for (i = 0; i < n; i++)
+            CHECK(Digit(reg.shownMasks[i], 0) != 0 && Digit(reg.shownMasks[i], 1) != 0);
+    } /* for second */
+    ClockRegFree(&reg);
+} /* TestOffsets() */
+
+/* face b drawn over face a a slot at a time, against b drawn whole */
+static int RedrawMatches(const GlyphAtlasStruct *atlas, uint64_t a, uint64_t b)
+{
+    FrameBufferStruct partial, whole;
+    size_t row;
+    int same = 1;
+
+    if (!SegFrameBufferInit(&partial, atlas->faceWidth, atlas->faceHeight) ||
+        !SegFrameBufferInit(&whole, atlas->faceWidth, atlas->faceHeight))
+        return(0);
+    SegRenderFaceMask(atlas, &partial, 0, 0, a);
+    SegRenderFaceDigits(atlas, &partial, 0, 0, b, SegDirtyDigits(a, b));
+    SegRenderFaceMask(atlas, &whole, 0, 0, b);
+    for (row = 0; row < (size_t) whole.height && same; row++)
+        same = (memcmp(partial.pixels + row * partial.stride, whole.pixels + row * whole.stride,
+                       (size_t) whole.width * sizeof(uint32_t)) == 0);
+    SegFrameBufferFree(&partial);
+    SegFrameBufferFree(&whole);
+    return(same);
+} /* RedrawMatches() */
+
+/* a digit that turns blank, incrementally, is blank: the old one is gone */
+static void TestBlankRedraw(void)
+{
+    static const int scales[] = { SEG_SCALE_ONE, SEG_SCALE_ONE * 5 / 2 };
+    GlyphAtlasStruct atlas;
+    uint64_t face = SegFaceMask(12, 34, 56), noSegments, noDigit;
+    int s, slot;
+
+    for (s = 0; s < (int) (sizeof(scales) / sizeof(scales[0])); s++)
+    {
+        CHECK(SegAtlasInitScaled(&atlas, scales[s], 0xff0000u, 0x200000u, 0x000000u));
+        CHECK(RedrawMatches(&atlas, face, SegFaceMask(100, 34, 56)));   /* hours 10: slot 0 blank */
+        for (slot = 0; slot < SEG_FACE_DIGITS; slot++)
+        {
+            noSegments = face & ~((uint64_t) DIGIT_MASK << (slot * SEG_MASK_DIGIT_BITS));
+            noDigit = noSegments | (uint64_t) 0x01 << (slot * SEG_MASK_DIGIT_BITS);   /* one bar: no digit */
+            CHECK(RedrawMatches(&atlas, face, noSegments));
+            CHECK(RedrawMatches(&atlas, face, noDigit));
+            CHECK(RedrawMatches(&atlas, noSegments, face));
+        } /* for slot */
+        SegAtlasFree(&atlas);
+    } /* for s */
+} /* TestBlankRedraw() */
+
+int main(void)
+{
+    TestFaceMask();
+    TestOffsets();
+    TestBlankRedraw();
+    return(TestResult("tface"));
+} /* main() */
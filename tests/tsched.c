@@ -0,0 +1,103 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   tests/tsched.c -- the tick scheduler on a simulated clock                */
+/*                                                                            */
+/* Ticks must land on each boundary in turn, an early timer must still show   */
+/* the second it was armed for, and a wall clock stepped back or forward must */
+/* move the next tick to the next boundary of the new time, never hold it off */
+/* for the length of the step.                                                */
+/******************************************************************************/
+
+#include "wctest.h"
+#include "ticksched.h"
+
+#define START_UTC (1700000000LL * NS_PER_SECOND + 250 * NS_PER_MS)
+#define HOUR_NS   (3600 * NS_PER_SECOND)
+
+static TickSimClockStruct sim;
+static TickSchedulerStruct sched;
+
+/* let the armed timer run, lateNs after its deadline, and fire it */
+static int64_t RunTick(int64_t lateNs, uint32_t *delayMs)
+{
+    *delayMs = TickSchedArm(&sched);
+    TickSimClockAdvance(&sim, sched.deadlineMonoNs - sim.monoNs + lateNs);
+    return(TickSchedFired(&sched));
+} /* RunTick() */
+
+static void TestSteady(int showSeconds)
+{
+    int64_t period = showSeconds ? 1 : 60, second, expected;
+    uint32_t delayMs;
+    int i;
+
+    TickSimClockInit(&sim, START_UTC);
+    TickSchedInit(&sched, &sim.source, showSeconds);
+    expected = (START_UTC / NS_PER_SECOND / period + 1) * period;
+    for (i = 0; i < 200; i++)
+    {
+        second = RunTick((i % 7) * NS_PER_MS, &delayMs);
+        CHECK(second == expected);
+        CHECK(delayMs <= period * 1000);
+        expected += period;
+    } /* for i */
+    CHECK(sched.jitter.earlyTicks == 0);
+} /* TestSteady() */
+
+static void TestEarly(void)
+{
+    uint32_t delayMs;
+    int64_t second;
+
+    TickSimClockInit(&sim, START_UTC);
+    TickSchedInit(&sched, &sim.source, 1);
+    second = RunTick(-3 * NS_PER_MS, &delayMs);
+    CHECK(second == START_UTC / NS_PER_SECOND + 1);
+    CHECK(sched.jitter.earlyTicks == 1);
+    second = RunTick(0, &delayMs);  /* skips the boundary already shown */
+    CHECK(second == START_UTC / NS_PER_SECOND + 2);
+    CHECK(delayMs >= 1000 && delayMs <= 1004);
+} /* TestEarly() */
+
+static void TestStep(int64_t stepNs, int pending)
+{
+    uint32_t delayMs;
+    int64_t second, expected;
+
+    TickSimClockInit(&sim, START_UTC);
+    TickSchedInit(&sched, &sim.source, 1);
+    RunTick(0, &delayMs);
+    if (pending)
+    {   /* step while the timer is armed, then let it fire early */
+        delayMs = TickSchedArm(&sched);
+        TickSimClockAdvance(&sim, 400 * NS_PER_MS);
+        TickSimClockStep(&sim, stepNs);
+        TickSimClockAdvance(&sim, sched.deadlineMonoNs - sim.monoNs - 2 * NS_PER_MS);
+        second = TickSchedFired(&sched);
+        CHECK(second == (sim.utcNs + 2 * NS_PER_MS) / NS_PER_SECOND);
+        expected = second + 1;
+    }
+    else
+    {
+        TickSimClockStep(&sim, stepNs);
+        expected = sim.utcNs / NS_PER_SECOND + 1;
+    }
+    second = RunTick(0, &delayMs);
+    CHECK(delayMs <= 1003);
+    CHECK(second == expected);
+    second = RunTick(NS_PER_MS, &delayMs);
+    CHECK(second == expected + 1);
+} /* TestStep() */
+
+int main(void)
+{
+    TestSteady(1);
+    TestSteady(0);
+    TestEarly();
+    TestStep(-HOUR_NS, 0);
+    TestStep(HOUR_NS, 0);
+    TestStep(-HOUR_NS, 1);
+    TestStep(HOUR_NS, 1);
+    TestStep(-300 * NS_PER_MS, 0);
+    return(TestResult("tsched"));
+} /* main() */
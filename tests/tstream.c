@@ -0,0 +1,231 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   tests/tstream.c -- segment-mask streams, whole, truncated and corrupted  */
+/*                                                                            */
+/* A few minutes of clocks at whole-hour, half-hour and odd offsets are       */
+/* encoded, with a rename on the way, and read back: each record must bring   */
+/* the reader to the registry as it was encoded.  The stream is then cut at   */
+/* every length, which must give exactly the records that were whole, and     */
+/* bytes are flipped at random, which must be survived and, given a keyframe  */
+/* after the damage, recovered from.  A keyframe claiming more clocks than    */
+/* its payload could hold is refused before anything is allocated for them.   */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "wctest.h"
+#include "wcstream.h"
+
+#define NUM_CLOCKS   40
+#define NUM_RECORDS  240
+#define TEST_START   1709251200LL   /* 2024-03-01 */
+#define RENAME_AT    100            /* a record; its label change forces a keyframe */
+#define TRIALS       2000
+
+static unsigned char stream[1 << 18];
+static size_t streamLength;
+static size_t recordEnds[NUM_RECORDS];
+static int keyframes[NUM_RECORDS];
+static uint64_t truth[NUM_RECORDS][NUM_CLOCKS];
+static char truthLabels[2][NUM_CLOCKS][CLOCK_NAME_SIZE];  /* before and from RENAME_AT */
+
+static unsigned long randomState = 4242;
+
+static int Random(int range)
+{
+    randomState = randomState * 1103515245 + 12345;
+    return((int) ((randomState >> 16) % (unsigned long) range));
+} /* Random() */
+
+/* the stream, record by record, and what each record must leave a reader with */
+static void Encode(void)
+{
+    ClockRegistryStruct reg;
+    StreamWriterStruct writer;
+    TickSnapshotStruct tick;
+    char label[64];
+    int r, i;
+
+    ClockRegInit(&reg, 0);
+    for (i = 0; i < NUM_CLOCKS; i++)
+    {
+        sprintf(label, (i % 7 == 0) ? "A label longer than the reader keeps, %d" : "Clock %d", i);
+        CHECK(ClockRegAdd(&reg, label, (i % 5 == 0) ? i * 1234 - 20000 : ((i % 27) - 12) * 1800, "") !=
+              CLOCK_HANDLE_NONE);
+    } /* for i */
+    StreamWriterInit(&writer, 30);
+    for (r = 0; r < NUM_RECORDS; r++)
+    {
+        if (r == RENAME_AT)
+            ClockRegSetLabel(&reg, 3, "Renamed");
+        TickTakeSnapshot(&tick, TEST_START + r * 7);    /* a step that changes minutes too */
+        ClockRegTickAll(&reg, &tick);
+        CHECK(StreamEncode(&writer, &reg, tick.utcSeconds));
+        memcpy(stream + streamLength, writer.record, writer.length);
+        streamLength += writer.length;
+        recordEnds[r] = streamLength;
+        keyframes[r] = writer.keyframe;
+        memcpy(truth[r], reg.shownMasks, sizeof(truth[r]));
+        for (i = 0; i < NUM_CLOCKS && (r == 0 || r == RENAME_AT); i++)
+        {
+            strncpy(truthLabels[r == RENAME_AT][i], ClockRegLabel(&reg, i), CLOCK_NAME_SIZE - 1);
+            truthLabels[r == RENAME_AT][i][CLOCK_NAME_SIZE - 1] = '\0';
+        } /* for i */
+    } /* for r */
+    CHECK(keyframes[0] && keyframes[RENAME_AT]);
+    StreamWriterFree(&writer);
+    ClockRegFree(&reg);
+} /* Encode() */
+
+/* bytes as a file to read */
+static FILE *Feed(const unsigned char *bytes, size_t length)
+{
+    FILE *file = tmpfile();
+
+    if (file == NULL)
+    {
+        perror("tstream: tmpfile");
+        exit(1);
+    }
+    fwrite(bytes, 1, length, file);
+    rewind(file);
+    return(file);
+} /* Feed() */
+
+static int Matches(const StreamReaderStruct *reader, int r)
+{
+    return(reader->count == NUM_CLOCKS && reader->utcSeconds == TEST_START + r * 7 &&
+           memcmp(reader->masks, truth[r], sizeof(truth[r])) == 0);
+} /* Matches() */
+
+static void TestRoundTrip(void)
+{
+    StreamReaderStruct reader;
+    FILE *file = Feed(stream, streamLength);
+    int r, i;
+
+    StreamReaderInit(&reader);
+    for (r = 0; r < NUM_RECORDS; r++)
+    {
+        CHECK(StreamRead(&reader, file) == (keyframes[r] ? STREAM_KEYFRAME : STREAM_UPDATE));
+        CHECK(Matches(&reader, r));
+        CHECK(reader.bytes == recordEnds[r]);
+        for (i = 0; i < NUM_CLOCKS && keyframes[r]; i++)
+            CHECK(strcmp(reader.labels[i], truthLabels[r >= RENAME_AT][i]) == 0);
+    } /* for r */
+    CHECK(StreamRead(&reader, file) == STREAM_END);
+    CHECK(reader.skipped == 0);
+    StreamReaderFree(&reader);
+    fclose(file);
+} /* TestRoundTrip() */
+
+/* cut anywhere: the whole records are read, the cut one is not */
+static void TestTruncated(void)
+{
+    StreamReaderStruct reader;
+    FILE *file;
+    size_t length;
+    int whole, read;
+
+    for (length = 0; length <= streamLength; length += (length < recordEnds[3]) ? 1 : 1 + Random(13))
+    {
+        for (whole = 0; whole < NUM_RECORDS && recordEnds[whole] <= length; whole++)
+            ;
+        file = Feed(stream, length);
+        StreamReaderInit(&reader);
+        for (read = 0; StreamRead(&reader, file) != STREAM_END; read++)
+            ;
+        CHECK(read == whole);
+        CHECK(whole == 0 || Matches(&reader, whole - 1));
+        StreamReaderFree(&reader);
+        fclose(file);
+    } /* for length */
+} /* TestTruncated() */
+
+/******************************************************************************/
+/* Flip a few bytes before the last keyframe.  Nothing may crash or read out  */
+/* of bounds, and a reader must end on the true clocks unless the damage made */
+/* it swallow that keyframe, as a stretched record length can.                */
+/******************************************************************************/
+static void TestCorrupted(void)
+{
+    static unsigned char damaged[sizeof(stream)];
+    StreamReaderStruct reader;
+    FILE *file;
+    size_t lastKeyframe = 0;
+    int trial, flips, recovered = 0, r;
+
+    for (r = 1; r < NUM_RECORDS; r++)
+        if (keyframes[r])
+            lastKeyframe = recordEnds[r - 1];
+    for (trial = 0; trial < TRIALS; trial++)
+    {
+        memcpy(damaged, stream, streamLength);
+        for (flips = 1 + Random(3); flips > 0; flips--)
+            damaged[Random((int) lastKeyframe)] ^= (unsigned char) (1 + Random(255));
+        file = Feed(damaged, streamLength);
+        StreamReaderInit(&reader);
+        while (StreamRead(&reader, file) != STREAM_END)
+            CHECK(reader.count >= 0 && (size_t) reader.count <= streamLength / 2);
+        recovered += Matches(&reader, NUM_RECORDS - 1);
+        StreamReaderFree(&reader);
+        fclose(file);
+    } /* for trial */
+    CHECK(recovered > TRIALS * 9 / 10);
+} /* TestCorrupted() */
+
+/* read a lying keyframe alone: refused with nothing allocated */
+static void CheckRefused(const unsigned char *bytes, size_t length)
+{
+    StreamReaderStruct reader;
+    FILE *file = Feed(bytes, length);
+
+    StreamReaderInit(&reader);
+    CHECK(StreamRead(&reader, file) == STREAM_END);
+    CHECK(reader.count == 0 && reader.masks == NULL && reader.labels == NULL);
+    CHECK(reader.skipped > 0);
+    StreamReaderFree(&reader);
+    fclose(file);
+} /* CheckRefused() */
+
+/* a keyframe whose count the payload cannot hold is refused, and skipped */
+static void TestHugeCount(void)
+{
+    static const unsigned char lying[] = {
+        'W', 'C', 'S', 'K', 6,          /* a six-byte payload */
+        0, 6,                           /* utc 0, six digits */
+        0xff, 0xff, 0xff, 0x07          /* 16777215 clocks */
+    };
+    static unsigned char bytes[6 + 192 + sizeof(stream)];
+    StreamReaderStruct reader;
+    FILE *file;
+
+    CheckRefused(lying, sizeof(lying));
+    memcpy(bytes, lying, sizeof(lying));
+    memcpy(bytes + sizeof(lying), stream, recordEnds[0]);
+    file = Feed(bytes, sizeof(lying) + recordEnds[0]);
+    StreamReaderInit(&reader);
+    CHECK(StreamRead(&reader, file) == STREAM_KEYFRAME);
+    CHECK(Matches(&reader, 0));
+    CHECK(reader.keyframes == 1);
+    StreamReaderFree(&reader);
+    fclose(file);
+
+    /* a payload with room for 96 clocks does not hold 16777215 either */
+    memcpy(bytes, lying, 4);
+    bytes[4] = 0x80 | 0x40;
+    bytes[5] = 0x01;                    /* 192 bytes */
+    memset(bytes + 6, 0, 192);
+    memcpy(bytes + 6, lying + 5, sizeof(lying) - 5);
+    CheckRefused(bytes, 6 + 192);
+} /* TestHugeCount() */
+
+int main(void)
+{
+    Encode();
+    TestRoundTrip();
+    TestTruncated();
+    TestCorrupted();
+    TestHugeCount();
+    return(TestResult("tstream"));
+} /* main() */
@@ -0,0 +1,122 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   tests/tzfind.c -- the shared table of loaded zones                       */
+/*                                                                            */
+/* A zone directory of many more zones than the table once held is written    */
+/* to a temporary directory, each zone a fixed offset of its own, and every   */
+/* one is found through TZDIR: the table grows, a zone found again is the     */
+/* same zone, and a clock that named an early zone still points at it after   */
+/* the table moved.                                                           */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "wctest.h"
+#include "clockreg.h"
+
+#define NUM_ZONES 1000
+
+static char zoneDir[] = "/tmp/tzfindXXXXXX";
+
+/* a version 1 TZif file of one type, offset seconds east of UTC */
+static int WriteZone(const char *name, int32_t offset)
+{
+    unsigned char data[44 + 6 + 4];
+    char path[64];
+    FILE *file;
+    int i;
+
+    memset(data, 0, sizeof(data));
+    memcpy(data, "TZif", 4);
+    data[39] = 1;                       /* typecnt */
+    data[43] = 4;                       /* charcnt */
+    for (i = 0; i < 4; i++)
+        data[44 + i] = (unsigned char) ((uint32_t) offset >> (24 - 8 * i));
+    memcpy(data + 50, "TST", 4);
+    sprintf(path, "%s/%s", zoneDir, name);
+    if ((file = fopen(path, "wb")) == NULL)
+        return(0);
+    i = (fwrite(data, 1, sizeof(data), file) == sizeof(data));
+    return(fclose(file) == 0 && i);
+} /* WriteZone() */
+
+static void ZoneName(char *name, int i)
+{
+    sprintf(name, "Test%04d", i);
+} /* ZoneName() */
+
+static void RemoveZones(void)
+{
+    char name[16], path[64];
+    int i;
+
+    for (i = 0; i < NUM_ZONES; i++)
+    {
+        ZoneName(name, i);
+        sprintf(path, "%s/%s", zoneDir, name);
+        remove(path);
+    } /* for i */
+    rmdir(zoneDir);
+} /* RemoveZones() */
+
+static void TestManyZones(void)
+{
+    static const TzZoneStruct *found[NUM_ZONES];
+    ClockRegistryStruct reg;
+    TzCacheStruct cache;
+    char name[16];
+    int i, ok = 1;
+
+    for (i = 0; i < NUM_ZONES && ok; i++)
+    {
+        ZoneName(name, i);
+        ok = WriteZone(name, (i - NUM_ZONES / 2) * 60);
+    } /* for i */
+    CHECK(ok);
+    setenv("TZDIR", zoneDir, 1);
+
+    ClockRegInit(&reg, 0);
+    CHECK(ClockRegAdd(&reg, "First", 0, "Test0000") != CLOCK_HANDLE_NONE);
+    for (i = 0; i < NUM_ZONES; i++)
+    {
+        ZoneName(name, i);
+        found[i] = TzFindZone(name);
+        CHECK(found[i] != NULL);
+        if (found[i] == NULL)
+            continue;
+        TzCacheInvalidate(&cache);
+        CHECK(TzOffsetAt(found[i], &cache, 1709251200) == (i - NUM_ZONES / 2) * 60);
+    } /* for i */
+    for (i = 0; i < NUM_ZONES; i++)
+    {
+        ZoneName(name, i);
+        CHECK(TzFindZone(name) == found[i]);
+    } /* for i */
+    CHECK(reg.zones[0] == found[0]);
+    CHECK(ClockRegAdd(&reg, "Last", 0, "Test0999") != CLOCK_HANDLE_NONE);
+    CHECK(reg.zones[1] == found[NUM_ZONES - 1]);
+    CHECK(TzFindZone("Missing") == NULL);
+    ClockRegFree(&reg);
+
+    /* all of them again after the table is let go */
+    TzFreeAllZones();
+    for (i = 0; i < NUM_ZONES; i++)
+    {
+        ZoneName(name, i);
+        CHECK(TzFindZone(name) != NULL);
+    } /* for i */
+    TzFreeAllZones();
+} /* TestManyZones() */
+
+int main(void)
+{
+    if (mkdtemp(zoneDir) == NULL)
+    {
+        perror("tzfind: mkdtemp");
+        return(1);
+    }
+    TestManyZones();
+    RemoveZones();
+    return(TestResult("tzfind"));
+} /* main() */
@@ -0,0 +1,193 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   tests/tzindex.c -- zone search against a scan of every term              */
+/*                                                                            */
+/* Every string of one to three characters found in a term, every whole      */
+/* term, and each of those as a user might type it (capitals, '_' for a      */
+/* space, leading spaces) is searched for, by prefix and by substring.  The   */
+/* zones found, and their order, must be what a plain scan of the terms for   */
+/* the query gives: whole terms first, then term prefixes, then word starts,  */
+/* then the rest, alphabetically within each.                                 */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "wctest.h"
+#include "wczindex.h"
+
+#define MAX_QUERIES 60000
+
+static char (*queries)[ZONE_INDEX_MAX_QUERY];
+static int numQueries;
+static long queriesChecked;
+static long mismatches;
+
+/* a query as ZoneIndexNormalize() leaves it, without leading spaces; */
+/* repeats are dropped once all are in                                 */
+static void AddQuery(const char *query)
+{
+    while (*query == ' ')
+        query++;
+    if (*query != '\0' && numQueries < MAX_QUERIES && strlen(query) < ZONE_INDEX_MAX_QUERY)
+        strcpy(queries[numQueries++], query);
+} /* AddQuery() */
+
+static int CompareQueries(const void *left, const void *right)
+{
+    return(strcmp((const char *) left, (const char *) right));
+} /* CompareQueries() */
+
+/* the queries, sorted with repeats dropped */
+static void MakeQueries(void)
+{
+    const char *term;
+    char query[ZONE_INDEX_MAX_QUERY];
+    int t, length, start, i, kept;
+
+    queries = (char (*)[ZONE_INDEX_MAX_QUERY]) malloc(MAX_QUERIES * sizeof(*queries));
+    if (queries == NULL)
+        exit(1);
+    for (t = 0; t < zoneIndex.termCount; t++)
+    {
+        term = zoneIndex.text + zoneIndex.termOffsets[t];
+        AddQuery(term);
+        for (start = 0; term[start] != '\0'; start++)
+        {
+            for (length = 1; length <= 3 && term[start + length - 1] != '\0'; length++)
+            {
+                memcpy(query, term + start, length);
+                query[length] = '\0';
+                AddQuery(query);
+            } /* for length */
+        } /* for start */
+    } /* for t */
+    AddQuery("zzzz");
+    AddQuery("q!");
+    qsort(queries, numQueries, sizeof(*queries), CompareQueries);
+    for (i = kept = 0; i < numQueries; i++)
+    {
+        if (kept == 0 || strcmp(queries[kept - 1], queries[i]) != 0)
+            memmove(queries[kept++], queries[i], sizeof(*queries));
+    } /* for i */
+    numQueries = kept;
+} /* MakeQueries() */
+
+/* how well term matches normal, by looking at every place it could start */
+static int ScanTerm(const char *term, const char *normal, int substrings)
+{
+    size_t length = strlen(normal);
+    const char *at;
+    int best = ZONE_MATCH_NONE;
+
+    if (strncmp(term, normal, length) == 0)
+        return(term[length] == '\0' ? ZONE_MATCH_EXACT : ZONE_MATCH_PREFIX);
+    if (!substrings)
+        return(ZONE_MATCH_NONE);
+    for (at = strstr(term + 1, normal); at != NULL; at = strstr(at + 1, normal))
+    {
+        if (at[-1] == ' ' || at[-1] == '/' || at[-1] == '-')
+            return(ZONE_MATCH_WORD);
+        best = ZONE_MATCH_SUBSTRING;
+    } /* for at */
+    return(best);
+} /* ScanTerm() */
+
+/* the search for query against the scan of its normal form */
+static void CheckQuery(const char *query, const char *normal, int substrings)
+{
+    static int found[ZONE_INDEX_MAX_ZONES];
+    unsigned char rank[ZONE_INDEX_MAX_ZONES];
+    int expected = 0, count, t, i, match, zone, ok;
+
+    memset(rank, ZONE_MATCH_NONE, sizeof(rank));
+    for (t = 0; t < zoneIndex.termCount; t++)
+    {
+        match = ScanTerm(zoneIndex.text + zoneIndex.termOffsets[t], normal, substrings);
+        for (i = zoneIndex.zoneStarts[t]; i < zoneIndex.zoneStarts[t + 1] && match != ZONE_MATCH_NONE; i++)
+        {
+            zone = zoneIndex.termZones[i];
+            if (rank[zone] < match)
+                rank[zone] = (unsigned char) match;
+        } /* for i */
+    } /* for t */
+    for (i = 0; i < zoneIndex.zoneCount; i++)
+        expected += (rank[i] != ZONE_MATCH_NONE);
+
+    count = ZoneIndexSearch(query, substrings, found, ZONE_INDEX_MAX_ZONES);
+    ok = (count == expected);
+    for (i = 0; i < count && ok; i++)
+    {
+        ok = (found[i] >= 0 && found[i] < zoneIndex.zoneCount && rank[found[i]] != ZONE_MATCH_NONE);
+        if (ok && i > 0)
+            ok = (rank[found[i - 1]] > rank[found[i]] ||
+                  (rank[found[i - 1]] == rank[found[i]] &&
+                   strcmp(ZoneIndexName(found[i - 1]), ZoneIndexName(found[i])) < 0));
+    } /* for i */
+    if (!ok && mismatches++ < 10)
+        fprintf(stderr, "tzindex: \"%s\" (%s) found %d zones, not %d, or out of order\n",
+                query, substrings ? "substring" : "prefix", count, expected);
+    queriesChecked++;
+} /* CheckQuery() */
+
+/* the query as typed, and as a user might type it otherwise */
+static void CheckAsTyped(const char *normal, int substrings)
+{
+    char typed[ZONE_INDEX_MAX_QUERY + 2];
+    size_t i;
+
+    CheckQuery(normal, normal, substrings);
+    if (strlen(normal) + 2 >= ZONE_INDEX_MAX_QUERY)
+        return;
+    typed[0] = typed[1] = ' ';
+    for (i = 0; normal[i] != '\0'; i++)
+    {
+        typed[i + 2] = normal[i];
+        if (normal[i] >= 'a' && normal[i] <= 'z' && i % 2 == 0)
+            typed[i + 2] = (char) (normal[i] - 'a' + 'A');
+        else if (normal[i] == ' ')
+            typed[i + 2] = '_';
+    } /* for i */
+    typed[i + 2] = '\0';
+    CheckQuery(typed, normal, substrings);
+} /* CheckAsTyped() */
+
+static void TestTables(void)
+{
+    int i;
+
+    CHECK(zoneIndex.zoneCount > 0 && zoneIndex.zoneCount <= ZONE_INDEX_MAX_ZONES);
+    CHECK(zoneIndex.termCount > 0 && zoneIndex.termCount <= ZONE_INDEX_MAX_TERMS);
+    for (i = 1; i < zoneIndex.zoneCount; i++)
+        CHECK(strcmp(zoneIndex.zones[i - 1], zoneIndex.zones[i]) < 0);
+    for (i = 1; i < zoneIndex.termCount; i++)
+        CHECK(strcmp(zoneIndex.text + zoneIndex.termOffsets[i - 1], zoneIndex.text + zoneIndex.termOffsets[i]) < 0);
+    CHECK(ZoneIndexName(-1) == NULL && ZoneIndexName(zoneIndex.zoneCount) == NULL);
+} /* TestTables() */
+
+static void TestQueries(void)
+{
+    int found[4], i;
+
+    MakeQueries();
+    for (i = 0; i < numQueries; i++)
+    {
+        CheckAsTyped(queries[i], 0);
+        CheckAsTyped(queries[i], 1);
+    } /* for i */
+    printf("tzindex      %ld queries checked\n", queriesChecked);
+    CHECK(mismatches == 0);
+    CHECK(queriesChecked > 10000);
+
+    /* an empty query finds nothing; a short list still counts them all */
+    CHECK(ZoneIndexSearch("", 1, found, 4) == 0);
+    CHECK(ZoneIndexSearch("   ", 0, found, 4) == 0);
+    CHECK(ZoneIndexSearch("a", 1, found, 4) > 4);
+    free(queries);
+} /* TestQueries() */
+
+int main(void)
+{
+    TestTables();
+    TestQueries();
+    return(TestResult("tzindex"));
+} /* main() */
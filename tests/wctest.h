@@ -0,0 +1,36 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   tests/wctest.h -- the checks the portable tests share                    */
+/*                                                                            */
+/* Each test is a program that exits nonzero when a check fails; run them     */
+/* all with tests/run.sh.                                                     */
+/******************************************************************************/
+
+#ifndef WCTEST_H
+#define WCTEST_H
+
+#include <stdio.h>
+
+static int testChecks = 0;
+static int testFailures = 0;
+
+/* count the check, and report it where it is if it fails */
+#define CHECK(condition) \
+    do \
+    { \
+        testChecks++; \
+        if (!(condition)) \
+        { \
+            testFailures++; \
+            fprintf(stderr, "%s:%d: failed: %s\n", __FILE__, __LINE__, #condition); \
+        } \
+    } while (0)
+
+/* the exit status of a test program */
+static int TestResult(const char *name)
+{
+    printf("%-12s %6d checks, %d failed\n", name, testChecks, testFailures);
+    return(testFailures != 0);
+} /* TestResult() */
+
+#endif /* WCTEST_H */
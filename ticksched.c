@@ -0,0 +1,186 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   ticksched.c -- second-aligned, drift-free tick scheduling                */
+/*                                                                            */
+/* A periodic 1000 ms timer drifts against the wall clock and is never        */
+/* aligned with the second boundary, so the display could lag by up to a      */
+/* second.  Instead the scheduler computes the wall-clock instant of the next */
+/* visible change (the next second, or the next minute when seconds are not  */
+/* shown), converts it to a one-shot delay, and is re-armed on every tick.    */
+/* One deadline serves every clock whose offset is whole minutes.  Local mean */
+/* time offsets from TZif data (such as +0:09:21 for Paris before 1911) turn  */
+/* their minute between boundaries, so without seconds such a clock shows it  */
+/* up to a minute late.  Whether the timer is early or late is judged on the  */
+/* monotonic clock, so a wall clock stepped back or forward only moves the    */
+/* boundary the next tick lands on.                                           */
+/******************************************************************************/
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+#include "ticksched.h"
+
+#ifdef _WIN32
+static int64_t SystemRealtimeNs(void *context)
+{
+    FILETIME fileTime;
+    ULARGE_INTEGER ticks;
+
+    (void) context;
+    GetSystemTimePreciseAsFileTime(&fileTime);
+    ticks.LowPart = fileTime.dwLowDateTime;
+    ticks.HighPart = fileTime.dwHighDateTime;
+    /* FILETIME counts 100 ns units from 1601 */
+    return(((int64_t) ticks.QuadPart - 116444736000000000LL) * 100);
+} /* SystemRealtimeNs() */
+
+static int64_t SystemMonotonicNs(void *context)
+{
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+
+    (void) context;
+    if (frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return((int64_t) (counter.QuadPart / frequency.QuadPart) * NS_PER_SECOND +
+           (int64_t) (counter.QuadPart % frequency.QuadPart) * NS_PER_SECOND / frequency.QuadPart);
+} /* SystemMonotonicNs() */
+#else
+static int64_t SystemRealtimeNs(void *context)
+{
+    struct timespec now;
+
+    (void) context;
+    clock_gettime(CLOCK_REALTIME, &now);
+    return((int64_t) now.tv_sec * NS_PER_SECOND + now.tv_nsec);
+} /* SystemRealtimeNs() */
+
+static int64_t SystemMonotonicNs(void *context)
+{
+    struct timespec now;
+
+    (void) context;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((int64_t) now.tv_sec * NS_PER_SECOND + now.tv_nsec);
+} /* SystemMonotonicNs() */
+#endif
+
+const TickClockSourceStruct tickSystemClock = { SystemRealtimeNs, SystemMonotonicNs, NULL };
+
+static int64_t SimRealtimeNs(void *context)
+{
+    return(((TickSimClockStruct *) context)->utcNs);
+} /* SimRealtimeNs() */
+
+static int64_t SimMonotonicNs(void *context)
+{
+    return(((TickSimClockStruct *) context)->monoNs);
+} /* SimMonotonicNs() */
+
+/******************************************************************************/
+/* TickSimClockInit -- a simulated clock standing at startUtcNs.  Time passes */
+/* only through TickSimClockAdvance(), so a year of ticks runs as fast as the */
+/* code it drives.                                                            */
+/******************************************************************************/
+void TickSimClockInit(TickSimClockStruct *sim, int64_t startUtcNs)
+{
+    sim->source.realtimeNs = SimRealtimeNs;
+    sim->source.monotonicNs = SimMonotonicNs;
+    sim->source.context = sim;
+    sim->utcNs = startUtcNs;
+    sim->monoNs = 0;
+} /* TickSimClockInit() */
+
+void TickSimClockAdvance(TickSimClockStruct *sim, int64_t ns)
+{
+    sim->utcNs += ns;
+    sim->monoNs += ns;
+} /* TickSimClockAdvance() */
+
+/* set the wall clock by ns, back if negative, as NTP or the user does */
+void TickSimClockStep(TickSimClockStruct *sim, int64_t ns)
+{
+    sim->utcNs += ns;
+} /* TickSimClockStep() */
+
+void TickSchedInit(TickSchedulerStruct *sched, const TickClockSourceStruct *clock, int showSeconds)
+{
+    sched->clock = clock;
+    sched->periodNs = showSeconds ? NS_PER_SECOND : 60 * NS_PER_SECOND;
+    sched->deadlineUtcNs = 0;
+    sched->deadlineMonoNs = 0;
+    sched->jitter.ticks = 0;
+    sched->jitter.earlyTicks = 0;
+    sched->jitter.lastLateNs = 0;
+    sched->jitter.maxLateNs = 0;
+    sched->jitter.totalLateNs = 0;
+} /* TickSchedInit() */
+
+/******************************************************************************/
+/* TickSchedArm -- pick the next period boundary after now and return the     */
+/* one-shot delay to it in milliseconds, rounded up so the timer never fires  */
+/* ahead of the boundary.  After an early tick the boundary already shown is  */
+/* skipped.  Early means before the deadline on the monotonic clock, so a     */
+/* wall clock stepped back does not hold the next tick off for the step.      */
+/******************************************************************************/
+uint32_t TickSchedArm(TickSchedulerStruct *sched)
+{
+    int64_t nowUtc = sched->clock->realtimeNs(sched->clock->context);
+    int64_t nowMono = sched->clock->monotonicNs(sched->clock->context);
+    int64_t base = nowUtc;
+    int64_t into, delayNs;
+
+    if (nowMono < sched->deadlineMonoNs)
+        base = nowUtc + (sched->deadlineMonoNs - nowMono);  /* the pending deadline, on today's wall clock */
+    into = base % sched->periodNs;
+
+    if (into < 0)
+        into += sched->periodNs;
+    delayNs = base + sched->periodNs - into - nowUtc;
+    sched->deadlineUtcNs = nowUtc + delayNs;
+    sched->deadlineMonoNs = nowMono + delayNs;
+    return((uint32_t) ((delayNs + NS_PER_MS - 1) / NS_PER_MS));
+} /* TickSchedArm() */
+
+/******************************************************************************/
+/* TickSchedFired -- record how late the timer was and return the UTC second  */
+/* to display.  A timer that fires a little early still shows the second it  */
+/* was armed for.                                                             */
+/******************************************************************************/
+int64_t TickSchedFired(TickSchedulerStruct *sched)
+{
+    int64_t nowUtc = sched->clock->realtimeNs(sched->clock->context);
+    int64_t nowMono = sched->clock->monotonicNs(sched->clock->context);
+    int64_t lateNs = nowMono - sched->deadlineMonoNs;
+    TickJitterStruct *jitter = &sched->jitter;
+
+    jitter->ticks++;
+    jitter->lastLateNs = lateNs;
+    if (lateNs < 0)
+    {
+        jitter->earlyTicks++;
+        jitter->totalLateNs -= lateNs;
+        nowUtc -= lateNs;       /* show the boundary it was armed for */
+    }
+    else
+    {
+        jitter->totalLateNs += lateNs;
+        if (lateNs > jitter->maxLateNs)
+            jitter->maxLateNs = lateNs;
+    }
+
+    if (nowUtc < 0)
+        return((nowUtc - (NS_PER_SECOND - 1)) / NS_PER_SECOND);
+    return(nowUtc / NS_PER_SECOND);
+} /* TickSchedFired() */
+
+int64_t TickSchedAverageLateNs(const TickSchedulerStruct *sched)
+{
+    if (sched->jitter.ticks == 0)
+        return(0);
+    return(sched->jitter.totalLateNs / sched->jitter.ticks);
+} /* TickSchedAverageLateNs() */
@@ -0,0 +1,55 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   ticksched.h -- second-aligned, drift-free tick scheduling                */
+/******************************************************************************/
+
+#ifndef TICKSCHED_H
+#define TICKSCHED_H
+
+#include <stdint.h>
+
+#define NS_PER_MS     1000000LL
+#define NS_PER_SECOND 1000000000LL
+
+/* where the scheduler gets its time from; tests and replays supply their own */
+typedef struct TickClockSourceStructTag {
+    int64_t (*realtimeNs)(void *context);   /* wall clock, ns since 1970 UTC */
+    int64_t (*monotonicNs)(void *context);  /* never steps, arbitrary epoch */
+    void *context;
+} TickClockSourceStruct;
+
+typedef struct TickJitterStructTag {
+    uint32_t ticks;
+    uint32_t earlyTicks;        /* timer fired before the deadline */
+    int64_t lastLateNs;         /* negative when early */
+    int64_t maxLateNs;
+    int64_t totalLateNs;        /* sum of |lateness| */
+} TickJitterStruct;
+
+typedef struct TickSchedulerStructTag {
+    const TickClockSourceStruct *clock;
+    int64_t periodNs;           /* distance between visible changes */
+    int64_t deadlineUtcNs;      /* wall-clock instant of the pending tick */
+    int64_t deadlineMonoNs;     /* the same instant on the monotonic clock */
+    TickJitterStruct jitter;
+} TickSchedulerStruct;
+
+/* a clock that moves only when told to, for replays and tests */
+typedef struct TickSimClockStructTag {
+    TickClockSourceStruct source;   /* pass &sim->source to TickSchedInit() */
+    int64_t utcNs;
+    int64_t monoNs;
+} TickSimClockStruct;
+
+extern const TickClockSourceStruct tickSystemClock;
+
+void     TickSimClockInit(TickSimClockStruct *sim, int64_t startUtcNs);
+void     TickSimClockAdvance(TickSimClockStruct *sim, int64_t ns);
+void     TickSimClockStep(TickSimClockStruct *sim, int64_t ns);
+
+void     TickSchedInit(TickSchedulerStruct *sched, const TickClockSourceStruct *clock, int showSeconds);
+uint32_t TickSchedArm(TickSchedulerStruct *sched);
+int64_t  TickSchedFired(TickSchedulerStruct *sched);
+int64_t  TickSchedAverageLateNs(const TickSchedulerStruct *sched);
+
+#endif /* TICKSCHED_H */
@@ -0,0 +1,256 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   ticktime.c -- one UTC breakdown per tick, shared by every clock          */
+/*                                                                            */
+/* The timer handler takes a single snapshot of the current instant and      */
+/* hands it to every clock, so all clocks show the same second and each one   */
+/* only adds its offset to the time of day instead of calling gmtime().       */
+/******************************************************************************/
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "ticktime.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TICK_SSE2
+#include <emmintrin.h>
+#endif
+
+void TickTakeSnapshot(TickSnapshotStruct *tick, int64_t utcSeconds)
+{
+    int64_t days = utcSeconds / SECONDS_PER_DAY;
+    int64_t rest = utcSeconds % SECONDS_PER_DAY;
+
+    if (rest < 0)
+    { /* floor, not truncate, for instants before 1970 */
+        rest += SECONDS_PER_DAY;
+        days--;
+    }
+    tick->utcSeconds = utcSeconds;
+    tick->dayNumber = days;
+    tick->secondOfDay = (int32_t) rest;
+} /* TickTakeSnapshot() */
+
+/******************************************************************************/
+/* TickClockTime -- local time of day for a clock offsetSeconds east of UTC.  */
+/* Offsets are expected to be within one day either way.                      */
+/******************************************************************************/
+void TickClockTime(const TickSnapshotStruct *tick, int32_t offsetSeconds, ClockTimeStruct *clockTime)
+{
+    int32_t local = tick->secondOfDay + offsetSeconds;
+
+    clockTime->dayOffset = 0;
+    if (local < 0)
+    {
+        local += SECONDS_PER_DAY;
+        clockTime->dayOffset = -1;
+    }
+    else
+        if (local >= SECONDS_PER_DAY)
+        {
+            local -= SECONDS_PER_DAY;
+            clockTime->dayOffset = 1;
+        }
+
+    clockTime->hours = local / 3600;
+    local -= clockTime->hours * 3600;
+    clockTime->minutes = local / 60;
+    clockTime->seconds = local - clockTime->minutes * 60;
+} /* TickClockTime() */
+
+/******************************************************************************/
+/* TickCivilDate -- proleptic Gregorian date of a day number (days since      */
+/* 1970-01-01), after H. Hinnant's civil_from_days().                         */
+/******************************************************************************/
+void TickCivilDate(int64_t dayNumber, int32_t *year, int32_t *month, int32_t *day)
+{
+    int64_t z = dayNumber + 719468;
+    int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    int64_t dayOfEra = z - era * 146097;
+    int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    int64_t monthIndex = (5 * dayOfYear + 2) / 153;    /* March = 0 */
+
+    *day = (int32_t) (dayOfYear - (153 * monthIndex + 2) / 5 + 1);
+    *month = (int32_t) (monthIndex < 10 ? monthIndex + 3 : monthIndex - 9);
+    *year = (int32_t) (yearOfEra + era * 400 + (*month <= 2));
+} /* TickCivilDate() */
+
+/* days since 1970-01-01 of a proleptic Gregorian date, the inverse of the above */
+int64_t TickDaysFromCivil(int64_t year, int month, int day)
+{
+    int64_t era, yearOfEra, dayOfYear, dayOfEra;
+
+    year -= month <= 2;
+    era = (year >= 0 ? year : year - 399) / 400;
+    yearOfEra = year - era * 400;
+    dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return(era * 146097 + dayOfEra - 719468);
+} /* TickDaysFromCivil() */
+
+/******************************************************************************/
+/* TickParseInstant -- Unix seconds, or an ISO 8601 UTC date and time         */
+/* (YYYY-MM-DD[THH:MM:SS][Z]), as the tools take them on the command line.    */
+/* Returns 0 if the text is neither.                                          */
+/******************************************************************************/
+int TickParseInstant(const char *text, int64_t *instant)
+{
+    long long year;
+    int month, day, hour = 0, minute = 0, second = 0, used = 0;
+    char *end;
+
+    if (sscanf(text, "%lld-%d-%d%n", &year, &month, &day, &used) == 3 && used > 0)
+    {
+        text += used;
+        if (*text == 'T' || *text == ' ')
+        {
+            if (sscanf(text + 1, "%d:%d:%d%n", &hour, &minute, &second, &used) != 3)
+                return(0);
+            text += 1 + used;
+        }
+        if (*text == 'Z')
+            text++;
+        if (*text != '\0' || month < 1 || month > 12 || day < 1 || day > 31 ||
+            hour < 0 || hour > 23 || minute < 0 || minute > 59 || second < 0 || second > 60)
+            return(0);
+        *instant = TickDaysFromCivil(year, month, day) * SECONDS_PER_DAY + hour * 3600 + minute * 60 + second;
+        return(1);
+    }
+    *instant = (int64_t) strtoll(text, &end, 10);
+    return(end != text && *end == '\0');
+} /* TickParseInstant() */
+
+#ifdef TICK_SSE2
+/* value / divisor and the remainder, for 0 <= value < 2^24 and divisors and */
+/* quotients below 2^15.  Biased by half a unit, the float quotient is at     */
+/* least 0.5 / divisor away from an integer, far more than its rounding      */
+/* error, so truncating it is exact.                                          */
+static __m128i DivideSse2(__m128i value, __m128 reciprocal, __m128i divisor, __m128i *remainder)
+{
+    __m128i quotient = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(_mm_cvtepi32_ps(value), _mm_set1_ps(0.5f)),
+                                                   reciprocal));
+
+    *remainder = _mm_sub_epi32(value, _mm_madd_epi16(quotient, divisor));     /* 16-bit multiply */
+    return(quotient);
+} /* DivideSse2() */
+
+/* the time-of-day loop four clocks at a time; returns how many were done */
+static int CivilTimeSse2(int32_t secondOfDay, const int32_t *offsets, int count, const TickCivilBatchStruct *out)
+{
+    const __m128i midnight = _mm_set1_epi32(SECONDS_PER_DAY);
+    const __m128i lastSecond = _mm_set1_epi32(SECONDS_PER_DAY - 1);
+    const __m128i hour = _mm_set1_epi32(3600), minute = _mm_set1_epi32(60);
+    const __m128 perHour = _mm_set1_ps(1.0f / 3600), perMinute = _mm_set1_ps(1.0f / 60);
+    __m128i local, before, after, hours, minutes, rest, seconds;
+    int i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        local = _mm_add_epi32(_mm_set1_epi32(secondOfDay), _mm_loadu_si128((const __m128i *) (offsets + i)));
+        before = _mm_cmplt_epi32(local, _mm_setzero_si128());
+        after = _mm_cmpgt_epi32(local, lastSecond);
+        local = _mm_sub_epi32(_mm_add_epi32(local, _mm_and_si128(before, midnight)), _mm_and_si128(after, midnight));
+        hours = DivideSse2(local, perHour, hour, &rest);
+        minutes = DivideSse2(rest, perMinute, minute, &seconds);
+        _mm_storeu_si128((__m128i *) (out->hours + i), hours);
+        _mm_storeu_si128((__m128i *) (out->minutes + i), minutes);
+        _mm_storeu_si128((__m128i *) (out->seconds + i), seconds);
+        _mm_storeu_si128((__m128i *) (out->dayOffsets + i), _mm_sub_epi32(before, after));
+    } /* for i */
+    return(i);
+} /* CivilTimeSse2() */
+
+/* pick one of three values per lane: yesterday's, today's or tomorrow's */
+static __m128i SelectSse2(__m128i before, __m128i after, const int32_t *values)
+{
+    __m128i today = _mm_set1_epi32(values[1]);
+
+    today = _mm_add_epi32(today, _mm_and_si128(before, _mm_set1_epi32(values[0] - values[1])));
+    return(_mm_add_epi32(today, _mm_and_si128(after, _mm_set1_epi32(values[2] - values[1]))));
+} /* SelectSse2() */
+
+static int CivilDateSse2(const int32_t *year, const int32_t *month, const int32_t *day, int32_t weekday,
+                         int count, const TickCivilBatchStruct *out)
+{
+    const __m128i week = _mm_set1_epi32(7), saturday = _mm_set1_epi32(6);
+    __m128i dayOffset, before, after, w;
+    int i;
+
+    for (i = 0; i + 4 <= count; i += 4)
+    {
+        dayOffset = _mm_loadu_si128((const __m128i *) (out->dayOffsets + i));
+        before = _mm_cmplt_epi32(dayOffset, _mm_setzero_si128());
+        after = _mm_cmpgt_epi32(dayOffset, _mm_setzero_si128());
+        w = _mm_add_epi32(_mm_set1_epi32(weekday), dayOffset);
+        w = _mm_add_epi32(w, _mm_and_si128(_mm_cmplt_epi32(w, _mm_setzero_si128()), week));
+        w = _mm_sub_epi32(w, _mm_and_si128(_mm_cmpgt_epi32(w, saturday), week));
+        _mm_storeu_si128((__m128i *) (out->years + i), SelectSse2(before, after, year));
+        _mm_storeu_si128((__m128i *) (out->months + i), SelectSse2(before, after, month));
+        _mm_storeu_si128((__m128i *) (out->days + i), SelectSse2(before, after, day));
+        _mm_storeu_si128((__m128i *) (out->weekdays + i), w);
+    } /* for i */
+    return(i);
+} /* CivilDateSse2() */
+#endif
+
+/******************************************************************************/
+/* TickCivilBatch -- local time and date for every clock at one instant.      */
+/*                                                                            */
+/* All clocks share the tick, so a local date can only be the UTC date or     */
+/* the day either side of it: those three dates are worked out once, and     */
+/* each clock selects one with masks.  Per clock the work is branch-free      */
+/* 32-bit arithmetic, with SSE2 where available (every x64 Windows) and a     */
+/* scalar loop otherwise and for the last few clocks.  Offsets must be        */
+/* within one day either way.                                                 */
+/******************************************************************************/
+void TickCivilBatch(const TickSnapshotStruct *tick, const int32_t *offsets, int count,
+                    const TickCivilBatchStruct *out)
+{
+    const int32_t secondOfDay = tick->secondOfDay;
+    int32_t year[3], month[3], day[3], weekday;
+    int i = 0;
+
+#ifdef TICK_SSE2
+    i = CivilTimeSse2(secondOfDay, offsets, count, out);
+#endif
+    for (; i < count; i++)
+    {
+        int32_t local = secondOfDay + offsets[i];
+        int32_t before = -(int32_t) (local < 0);                  /* all ones or zero */
+        int32_t after = -(int32_t) (local >= SECONDS_PER_DAY);
+        uint32_t sinceMidnight, hour, rest, minute;
+
+        sinceMidnight = (uint32_t) (local + (before & SECONDS_PER_DAY) - (after & SECONDS_PER_DAY));
+        hour = (sinceMidnight * 37283u) >> 27;                   /* / 3600 below 86400 */
+        rest = sinceMidnight - hour * 3600;
+        minute = (rest * 2185u) >> 17;                           /* / 60 below 3600 */
+        out->hours[i] = (int32_t) hour;
+        out->minutes[i] = (int32_t) minute;
+        out->seconds[i] = (int32_t) (rest - minute * 60);
+        out->dayOffsets[i] = before - after;
+    } /* for i */
+
+    if (out->years == NULL)
+        return;
+    for (i = 0; i < 3; i++)
+        TickCivilDate(tick->dayNumber + i - 1, &year[i], &month[i], &day[i]);
+    weekday = (int32_t) (((tick->dayNumber + 4) % 7 + 7) % 7);  /* 1970-01-01 was a Thursday */
+    i = 0;
+#ifdef TICK_SSE2
+    i = CivilDateSse2(year, month, day, weekday, count, out);
+#endif
+    for (; i < count; i++)
+    {
+        int32_t dayOffset = out->dayOffsets[i];
+        int32_t before = -(int32_t) (dayOffset < 0);
+        int32_t after = -(int32_t) (dayOffset > 0);
+        int32_t w = weekday + dayOffset;
+
+        out->years[i] = year[1] + (before & (year[0] - year[1])) + (after & (year[2] - year[1]));
+        out->months[i] = month[1] + (before & (month[0] - month[1])) + (after & (month[2] - month[1]));
+        out->days[i] = day[1] + (before & (day[0] - day[1])) + (after & (day[2] - day[1]));
+        out->weekdays[i] = w + (7 & -(int32_t) (w < 0)) - (7 & -(int32_t) (w > 6));
+    } /* for i */
+} /* TickCivilBatch() */
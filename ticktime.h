@@ -0,0 +1,47 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   ticktime.h -- one UTC breakdown per tick, shared by every clock          */
+/******************************************************************************/
+
+#ifndef TICKTIME_H
+#define TICKTIME_H
+
+#include <stdint.h>
+
+#define SECONDS_PER_DAY 86400
+
+typedef struct TickSnapshotStructTag {
+    int64_t utcSeconds;         /* seconds since 1970-01-01 00:00:00 UTC */
+    int64_t dayNumber;          /* days since 1970-01-01 */
+    int32_t secondOfDay;        /* 0 .. SECONDS_PER_DAY - 1 */
+} TickSnapshotStruct;
+
+typedef struct ClockTimeStructTag {
+    int hours;
+    int minutes;
+    int seconds;
+    int dayOffset;              /* -1, 0 or +1 relative to the UTC date */
+} ClockTimeStruct;
+
+/* where TickCivilBatch() puts its results, one array of count entries each; */
+/* the date arrays may be NULL when only the time of day is wanted           */
+typedef struct TickCivilBatchStructTag {
+    int32_t *hours;
+    int32_t *minutes;
+    int32_t *seconds;
+    int32_t *dayOffsets;        /* -1, 0 or +1 relative to the UTC date */
+    int32_t *weekdays;          /* 0 = Sunday */
+    int32_t *years;
+    int32_t *months;            /* 1 .. 12 */
+    int32_t *days;              /* 1 .. 31 */
+} TickCivilBatchStruct;
+
+void TickTakeSnapshot(TickSnapshotStruct *tick, int64_t utcSeconds);
+void TickClockTime(const TickSnapshotStruct *tick, int32_t offsetSeconds, ClockTimeStruct *clockTime);
+void TickCivilDate(int64_t dayNumber, int32_t *year, int32_t *month, int32_t *day);
+int64_t TickDaysFromCivil(int64_t year, int month, int day);
+int  TickParseInstant(const char *text, int64_t *instant);
+void TickCivilBatch(const TickSnapshotStruct *tick, const int32_t *offsets, int count,
+                    const TickCivilBatchStruct *out);
+
+#endif /* TICKTIME_H */
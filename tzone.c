@@ -0,0 +1,564 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   tzone.c -- IANA time zones loaded from compiled TZif files               */
+/*                                                                            */
+/* A zone file (RFC 8536) is mapped into memory, its 64-bit transition data   */
+/* is copied into compact tables, and the POSIX TZ footer is kept as a rule   */
+/* for instants past the last transition.  Each clock keeps a TzCacheStruct   */
+/* with the offset in force and the instants it is good for; a lookup only    */
+/* happens when a transition instant has passed.                              */
+/******************************************************************************/
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tzone.h"
+#include "ticktime.h"
+
+#define TZIF_HEADER_SIZE 44
+
+static TzZoneStruct **loadedZones = NULL;  /* each zone its own block: clocks keep pointers */
+static int loadedZoneCount = 0;
+static int loadedZoneCapacity = 0;
+
+const char *TzDefaultZoneDir(void)
+{
+    const char *zoneDir = getenv("TZDIR");
+
+    if (zoneDir != NULL && *zoneDir != '\0')
+        return(zoneDir);
+#ifdef _WIN32
+    return("./zoneinfo");       /* shipped next to WorldClock.exe */
+#else
+    return("/usr/share/zoneinfo");
+#endif
+} /* TzDefaultZoneDir() */
+
+static int32_t ReadBE32(const unsigned char *p)
+{
+    return((int32_t) ((uint32_t) p[0] << 24 | (uint32_t) p[1] << 16 | (uint32_t) p[2] << 8 | p[3]));
+} /* ReadBE32() */
+
+static int64_t ReadBE64(const unsigned char *p)
+{
+    return((int64_t) ((uint64_t) (uint32_t) ReadBE32(p) << 32 | (uint32_t) ReadBE32(p + 4)));
+} /* ReadBE64() */
+
+static int64_t YearOfDays(int64_t days)
+{
+    int64_t era, doe, yoe, doy, mp;
+
+    days += 719468;
+    era = (days >= 0 ? days : days - 146096) / 146097;
+    doe = days - era * 146097;
+    yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    mp = (5 * doy + 2) / 153;
+    return(yoe + era * 400 + (mp >= 10));
+} /* YearOfDays() */
+
+static int IsLeapYear(int64_t year)
+{
+    return((year % 4 == 0 && year % 100 != 0) || year % 400 == 0);
+} /* IsLeapYear() */
+
+/******************************************************************************/
+/* POSIX TZ string parsing, e.g. "EST5EDT,M3.2.0,M11.1.0" or "<+0530>-5:30"   */
+/******************************************************************************/
+static const char *ParseAbbr(const char *p, char *abbr)
+{
+    int length = 0;
+
+    if (*p == '<')
+    {
+        p++;
+        while (*p != '>' && *p != '\0')
+        {
+            if (length < TZ_ABBR_SIZE - 1)
+                abbr[length++] = *p;
+            p++;
+        }
+        if (*p != '>')
+            return(NULL);
+        p++;
+    }
+    else
+    {
+        while ((*p >= 'A' && *p <= 'Z') || (*p >= 'a' && *p <= 'z'))
+        {
+            if (length < TZ_ABBR_SIZE - 1)
+                abbr[length++] = *p;
+            p++;
+        }
+    }
+    abbr[length] = '\0';
+    return(length >= 3 ? p : NULL);
+} /* ParseAbbr() */
+
+static const char *ParseNumber(const char *p, int *value)
+{
+    if (*p < '0' || *p > '9')
+        return(NULL);
+    *value = 0;
+    while (*p >= '0' && *p <= '9')
+        *value = *value * 10 + (*p++ - '0');
+    return(p);
+} /* ParseNumber() */
+
+/* [+|-]hh[:mm[:ss]] as seconds */
+static const char *ParseTime(const char *p, int32_t *seconds)
+{
+    int sign = 1, hours, minutes = 0, secs = 0;
+
+    if (*p == '+' || *p == '-')
+        sign = (*p++ == '-') ? -1 : 1;
+    if ((p = ParseNumber(p, &hours)) == NULL)
+        return(NULL);
+    if (*p == ':' && (p = ParseNumber(p + 1, &minutes)) != NULL && *p == ':')
+        p = ParseNumber(p + 1, &secs);
+    if (p == NULL)
+        return(NULL);
+    *seconds = sign * (hours * 3600 + minutes * 60 + secs);
+    return(p);
+} /* ParseTime() */
+
+static const char *ParseRuleDate(const char *p, TzRuleDateStruct *date)
+{
+    date->time = 2 * 3600;
+    if (*p == 'M')
+    {
+        date->kind = 'M';
+        if ((p = ParseNumber(p + 1, &date->month)) == NULL || *p != '.' ||
+            (p = ParseNumber(p + 1, &date->week)) == NULL || *p != '.' ||
+            (p = ParseNumber(p + 1, &date->day)) == NULL)
+            return(NULL);
+        if (date->month < 1 || date->month > 12 || date->week < 1 || date->week > 5 || date->day > 6)
+            return(NULL);
+    }
+    else if (*p == 'J')
+    {
+        date->kind = 'J';
+        if ((p = ParseNumber(p + 1, &date->day)) == NULL || date->day < 1 || date->day > 365)
+            return(NULL);
+    }
+    else
+    {
+        date->kind = 'D';
+        if ((p = ParseNumber(p, &date->day)) == NULL || date->day > 365)
+            return(NULL);
+    }
+    if (*p == '/')
+        p = ParseTime(p + 1, &date->time);
+    return(p);
+} /* ParseRuleDate() */
+
+static int ParseRule(const char *p, TzRuleStruct *rule)
+{
+    int32_t offset;
+
+    memset(rule, 0, sizeof(TzRuleStruct));
+    if ((p = ParseAbbr(p, rule->std.abbr)) == NULL || (p = ParseTime(p, &offset)) == NULL)
+        return(0);
+    rule->std.utcOffset = -offset;  /* POSIX counts hours west */
+    if (*p == '\0')
+        return(1);
+
+    rule->hasDst = 1;
+    rule->dst.isDst = 1;
+    if ((p = ParseAbbr(p, rule->dst.abbr)) == NULL)
+        return(0);
+    rule->dst.utcOffset = rule->std.utcOffset + 3600;
+    if (*p != ',' && *p != '\0')
+    {
+        if ((p = ParseTime(p, &offset)) == NULL)
+            return(0);
+        rule->dst.utcOffset = -offset;
+    }
+    if (*p != ',')
+        return(0);      /* no built-in default rules */
+    if ((p = ParseRuleDate(p + 1, &rule->start)) == NULL || *p != ',' ||
+        (p = ParseRuleDate(p + 1, &rule->end)) == NULL)
+        return(0);
+    return(*p == '\0');
+} /* ParseRule() */
+
+/* local midnight of a rule date in year, as days since 1970 */
+static int64_t RuleDay(const TzRuleDateStruct *date, int64_t year)
+{
+    static const int monthDays[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    int64_t days;
+    int weekday, mday, length;
+
+    switch (date->kind)
+    {
+        case 'J': /* Feb 29 is never counted */
+            days = TickDaysFromCivil(year, 1, 1) + date->day - 1;
+            if (IsLeapYear(year) && date->day >= 60)
+                days++;
+            return(days);
+
+        case 'D':
+            return(TickDaysFromCivil(year, 1, 1) + date->day);
+
+        default:  /* day of week 'day' in week 'week' (5 = last) of 'month' */
+            days = TickDaysFromCivil(year, date->month, 1);
+            weekday = (int) ((days % 7 + 11) % 7);   /* 1970-01-01 was a Thursday */
+            mday = 1 + (date->day - weekday + 7) % 7 + (date->week - 1) * 7;
+            length = monthDays[date->month - 1] + (date->month == 2 && IsLeapYear(year));
+            while (mday > length)
+                mday -= 7;
+            return(days + mday - 1);
+    } /* switch kind */
+} /* RuleDay() */
+
+/******************************************************************************/
+/* ResolveRule -- offset from the footer rule, with the surrounding rule      */
+/* transitions as the cache bounds.                                           */
+/******************************************************************************/
+static void ResolveRule(const TzRuleStruct *rule, int64_t t, TzCacheStruct *cache)
+{
+    int64_t edges[6];
+    int isDst[6];
+    int64_t year, start, end;
+    int count = 0, i, j, current;
+    const TzTypeStruct *type;
+
+    if (!rule->hasDst)
+    {
+        cache->validFrom = TZ_TIME_MIN;
+        cache->validUntil = TZ_TIME_MAX;
+        type = &rule->std;
+    }
+    else
+    {
+        year = YearOfDays((t >= 0 ? t : t - 86399) / 86400);
+        for (i = -1; i <= 1; i++)
+        {
+            start = RuleDay(&rule->start, year + i) * 86400 + rule->start.time - rule->std.utcOffset;
+            end = RuleDay(&rule->end, year + i) * 86400 + rule->end.time - rule->dst.utcOffset;
+            edges[count] = start;
+            isDst[count++] = 1;
+            edges[count] = end;
+            isDst[count++] = 0;
+        } /* for i */
+        for (i = 1; i < count; i++)
+        { /* insertion sort, six entries */
+            for (j = i; j > 0 && edges[j - 1] > edges[j]; j--)
+            {
+                start = edges[j]; edges[j] = edges[j - 1]; edges[j - 1] = start;
+                current = isDst[j]; isDst[j] = isDst[j - 1]; isDst[j - 1] = current;
+            }
+        } /* for i */
+        for (i = count - 1; i >= 0 && edges[i] > t; i--)
+            ;
+        /* before the first edge we are in whatever the first edge ends */
+        current = (i >= 0) ? isDst[i] : !isDst[0];
+        cache->validFrom = (i >= 0) ? edges[i] : TZ_TIME_MIN;
+        cache->validUntil = (i + 1 < count) ? edges[i + 1] : TZ_TIME_MAX;
+        type = current ? &rule->dst : &rule->std;
+    }
+    cache->utcOffset = type->utcOffset;
+    cache->isDst = type->isDst;
+    memcpy(cache->abbr, type->abbr, TZ_ABBR_SIZE);
+} /* ResolveRule() */
+
+/******************************************************************************/
+/* TzParseZone -- build the tables of a zone from TZif bytes.                 */
+/* Returns nonzero on success.                                                */
+/******************************************************************************/
+int TzParseZone(TzZoneStruct *zone, const char *name, const unsigned char *data, size_t size)
+{
+    const unsigned char *p, *end = data + size;
+    int32_t isUtCount, isStdCount, leapCount, timeCount, typeCount, charCount;
+    int timeSize, i, abbrIndex;
+    const unsigned char *times, *indices, *typeData, *chars;
+    char footer[128];
+    size_t footerLength;
+
+    memset(zone, 0, sizeof(TzZoneStruct));
+    strncpy(zone->name, name, TZ_NAME_SIZE - 1);
+    if (size < TZIF_HEADER_SIZE || memcmp(data, "TZif", 4) != 0)
+        return(0);
+
+    p = data;
+    timeSize = 4;
+    for (;;)
+    {
+        if ((size_t) (end - p) < TZIF_HEADER_SIZE)
+            return(0);
+        isUtCount  = ReadBE32(p + 20);
+        isStdCount = ReadBE32(p + 24);
+        leapCount  = ReadBE32(p + 28);
+        timeCount  = ReadBE32(p + 32);
+        typeCount  = ReadBE32(p + 36);
+        charCount  = ReadBE32(p + 40);
+        if (isUtCount < 0 || isStdCount < 0 || leapCount < 0 || timeCount < 0 ||
+            typeCount <= 0 || typeCount > 256 || charCount < 0)
+            return(0);
+        if ((size_t) (end - p - TZIF_HEADER_SIZE) <
+            (size_t) timeCount * (timeSize + 1) + (size_t) typeCount * 6 + charCount +
+            (size_t) leapCount * (timeSize + 4) + isStdCount + isUtCount)
+            return(0);
+        if (timeSize == 8 || data[4] < '2')
+            break;
+        /* skip the 32-bit block of a version 2+ file */
+        p += TZIF_HEADER_SIZE + (size_t) timeCount * 5 + (size_t) typeCount * 6 + charCount +
+             (size_t) leapCount * 8 + isStdCount + isUtCount;
+        if ((size_t) (end - p) < TZIF_HEADER_SIZE || memcmp(p, "TZif", 4) != 0)
+            return(0);
+        timeSize = 8;
+    } /* for ever */
+
+    times = p + TZIF_HEADER_SIZE;
+    indices = times + (size_t) timeCount * timeSize;
+    typeData = indices + timeCount;
+    chars = typeData + (size_t) typeCount * 6;
+    p = chars + charCount + (size_t) leapCount * (timeSize + 4) + isStdCount + isUtCount;
+
+    /* one block: times, then types, then type indices */
+    zone->transitionTimes = (int64_t *) malloc((size_t) timeCount * sizeof(int64_t) +
+                                               (size_t) typeCount * sizeof(TzTypeStruct) + timeCount + 1);
+    if (zone->transitionTimes == NULL)
+        return(0);
+    zone->types = (TzTypeStruct *) (zone->transitionTimes + timeCount);
+    zone->transitionTypes = (uint8_t *) (zone->types + typeCount);
+    zone->transitionCount = timeCount;
+    zone->typeCount = typeCount;
+
+    for (i = 0; i < timeCount; i++)
+    {
+        zone->transitionTimes[i] = (timeSize == 8) ? ReadBE64(times + i * 8) : ReadBE32(times + i * 4);
+        zone->transitionTypes[i] = indices[i];
+        if (indices[i] >= typeCount)
+        {
+            TzFreeZone(zone);
+            return(0);
+        }
+    } /* for i */
+    for (i = 0; i < typeCount; i++)
+    {
+        zone->types[i].utcOffset = ReadBE32(typeData + i * 6);
+        zone->types[i].isDst = typeData[i * 6 + 4];
+        abbrIndex = typeData[i * 6 + 5];
+        zone->types[i].abbr[0] = '\0';
+        if (abbrIndex < charCount)
+        {
+            strncpy(zone->types[i].abbr, (const char *) chars + abbrIndex, TZ_ABBR_SIZE - 1);
+            zone->types[i].abbr[TZ_ABBR_SIZE - 1] = '\0';
+        }
+    } /* for i */
+
+    /* version 2+ footer: "\n" POSIX-TZ "\n" */
+    if (timeSize == 8 && p < end && *p == '\n')
+    {
+        p++;
+        for (footerLength = 0; p + footerLength < end && p[footerLength] != '\n'; footerLength++)
+            ;
+        if (footerLength > 0 && footerLength < sizeof(footer) && p + footerLength < end)
+        {
+            memcpy(footer, p, footerLength);
+            footer[footerLength] = '\0';
+            zone->hasRule = ParseRule(footer, &zone->rule);
+        }
+    }
+    return(1);
+} /* TzParseZone() */
+
+/******************************************************************************/
+/* TzLoadZone -- map zoneDir/name and parse it.  Returns nonzero on success.  */
+/******************************************************************************/
+int TzLoadZone(TzZoneStruct *zone, const char *zoneDir, const char *name)
+{
+    char path[512];
+    int result = 0;
+#ifdef _WIN32
+    HANDLE file, mapping;
+    LARGE_INTEGER size;
+    const unsigned char *data;
+#else
+    int fd;
+    struct stat info;
+    void *data;
+#endif
+
+    memset(zone, 0, sizeof(TzZoneStruct));
+    /* zone names are relative paths below the zone directory */
+    if (name[0] == '\0' || name[0] == '/' || name[0] == '\\' || strstr(name, "..") != NULL)
+        return(0);
+    if (snprintf(path, sizeof(path), "%s/%s", zoneDir, name) >= (int) sizeof(path))
+        return(0);
+
+#ifdef _WIN32
+    file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return(0);
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+    {
+        mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping != NULL)
+        {
+            data = (const unsigned char *) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (data != NULL)
+            {
+                result = TzParseZone(zone, name, data, (size_t) size.QuadPart);
+                UnmapViewOfFile(data);
+            }
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+#else
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return(0);
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0)
+    {
+        data = mmap(NULL, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            result = TzParseZone(zone, name, (const unsigned char *) data, (size_t) info.st_size);
+            munmap(data, (size_t) info.st_size);
+        }
+    }
+    close(fd);
+#endif
+    return(result);
+} /* TzLoadZone() */
+
+void TzFreeZone(TzZoneStruct *zone)
+{
+    free(zone->transitionTimes);
+    zone->transitionTimes = NULL;
+    zone->transitionTypes = NULL;
+    zone->types = NULL;
+    zone->transitionCount = 0;
+    zone->typeCount = 0;
+} /* TzFreeZone() */
+
+/******************************************************************************/
+/* TzFindZone -- a zone loaded once from the default directory and shared by  */
+/* every clock that names it.  NULL if it cannot be loaded.                   */
+/******************************************************************************/
+const TzZoneStruct *TzFindZone(const char *name)
+{
+    int i, capacity;
+    TzZoneStruct *zone, **grown;
+
+    for (i = 0; i < loadedZoneCount; i++)
+    {
+        if (strcmp(loadedZones[i]->name, name) == 0)
+            return(loadedZones[i]);
+    } /* for i */
+    if (strlen(name) >= TZ_NAME_SIZE)
+        return(NULL);
+    if (loadedZoneCount == loadedZoneCapacity)
+    {
+        capacity = (loadedZoneCapacity > 0) ? loadedZoneCapacity * 2 : 16;
+        grown = (TzZoneStruct **) realloc(loadedZones, capacity * sizeof(TzZoneStruct *));
+        if (grown == NULL)
+            return(NULL);
+        loadedZones = grown;
+        loadedZoneCapacity = capacity;
+    }
+
+    zone = (TzZoneStruct *) malloc(sizeof(TzZoneStruct));
+    if (zone == NULL)
+        return(NULL);
+    if (!TzLoadZone(zone, TzDefaultZoneDir(), name))
+    {
+        TzFreeZone(zone);
+        free(zone);
+        return(NULL);
+    }
+    loadedZones[loadedZoneCount++] = zone;
+    return(zone);
+} /* TzFindZone() */
+
+void TzFreeAllZones(void)
+{
+    int i;
+
+    for (i = 0; i < loadedZoneCount; i++)
+    {
+        TzFreeZone(loadedZones[i]);
+        free(loadedZones[i]);
+    } /* for i */
+    free(loadedZones);
+    loadedZones = NULL;
+    loadedZoneCount = 0;
+    loadedZoneCapacity = 0;
+} /* TzFreeAllZones() */
+
+void TzCacheInvalidate(TzCacheStruct *cache)
+{
+    cache->validFrom = TZ_TIME_MAX;
+    cache->validUntil = TZ_TIME_MIN;
+} /* TzCacheInvalidate() */
+
+/******************************************************************************/
+/* TzResolve -- full lookup of the offset at t: binary search over the        */
+/* transitions, then the footer rule past the last one.                       */
+/******************************************************************************/
+void TzResolve(const TzZoneStruct *zone, int64_t t, TzCacheStruct *cache)
+{
+    int32_t low, high, middle;
+    const TzTypeStruct *type;
+
+    if (zone->transitionCount == 0 || t < zone->transitionTimes[0])
+    {
+        if (zone->transitionCount == 0 && zone->hasRule)
+        {
+            ResolveRule(&zone->rule, t, cache);
+            return;
+        }
+        type = &zone->types[0];
+        cache->validFrom = TZ_TIME_MIN;
+        cache->validUntil = (zone->transitionCount > 0) ? zone->transitionTimes[0] : TZ_TIME_MAX;
+    }
+    else
+    {
+        low = 0;
+        high = zone->transitionCount - 1;
+        while (low < high)
+        { /* last transition at or before t */
+            middle = low + (high - low + 1) / 2;
+            if (zone->transitionTimes[middle] <= t)
+                low = middle;
+            else
+                high = middle - 1;
+        } /* while low < high */
+        if (low == zone->transitionCount - 1 && zone->hasRule)
+        {
+            ResolveRule(&zone->rule, t, cache);
+            if (cache->validFrom < zone->transitionTimes[low])
+                cache->validFrom = zone->transitionTimes[low];
+            return;
+        }
+        type = &zone->types[zone->transitionTypes[low]];
+        cache->validFrom = zone->transitionTimes[low];
+        cache->validUntil = (low + 1 < zone->transitionCount) ? zone->transitionTimes[low + 1] : TZ_TIME_MAX;
+    }
+    cache->utcOffset = type->utcOffset;
+    cache->isDst = type->isDst;
+    memcpy(cache->abbr, type->abbr, TZ_ABBR_SIZE);
+} /* TzResolve() */
+
+/******************************************************************************/
+/* TzOffsetAt -- seconds east of UTC at t, re-resolving only when t has left  */
+/* the interval the cache was filled for.                                     */
+/******************************************************************************/
+int32_t TzOffsetAt(const TzZoneStruct *zone, TzCacheStruct *cache, int64_t t)
+{
+    if (t < cache->validFrom || t >= cache->validUntil)
+        TzResolve(zone, t, cache);
+    return(cache->utcOffset);
+} /* TzOffsetAt() */
@@ -0,0 +1,74 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   tzone.h -- IANA time zones loaded from compiled TZif files               */
+/******************************************************************************/
+
+#ifndef TZONE_H
+#define TZONE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TZ_NAME_SIZE 64
+#define TZ_ABBR_SIZE 8
+
+#define TZ_TIME_MIN INT64_MIN
+#define TZ_TIME_MAX INT64_MAX
+
+typedef struct TzTypeStructTag {
+    int32_t utcOffset;          /* seconds east of UTC */
+    int isDst;
+    char abbr[TZ_ABBR_SIZE];
+} TzTypeStruct;
+
+/* one end of a POSIX TZ daylight saving rule, e.g. "M3.2.0/2" */
+typedef struct TzRuleDateStructTag {
+    char kind;                  /* 'J' Julian 1..365, 'D' day 0..365, 'M' month.week.day */
+    int day;
+    int week;
+    int month;
+    int32_t time;               /* seconds after local midnight, may be negative */
+} TzRuleDateStruct;
+
+/* the footer rule that extends the zone past its last transition */
+typedef struct TzRuleStructTag {
+    TzTypeStruct std;
+    TzTypeStruct dst;
+    int hasDst;
+    TzRuleDateStruct start;     /* switch to daylight time, in standard time */
+    TzRuleDateStruct end;       /* switch back, in daylight time */
+} TzRuleStruct;
+
+typedef struct TzZoneStructTag {
+    char name[TZ_NAME_SIZE];
+    int32_t transitionCount;
+    int64_t *transitionTimes;   /* ascending UTC instants */
+    uint8_t *transitionTypes;   /* index into types[] from that instant on */
+    int32_t typeCount;
+    TzTypeStruct *types;
+    int hasRule;
+    TzRuleStruct rule;
+} TzZoneStruct;
+
+/* what a clock remembers between ticks: the offset holds while */
+/* validFrom <= t < validUntil, so most ticks need no lookup at all */
+typedef struct TzCacheStructTag {
+    int64_t validFrom;
+    int64_t validUntil;
+    int32_t utcOffset;
+    int isDst;
+    char abbr[TZ_ABBR_SIZE];
+} TzCacheStruct;
+
+const char *TzDefaultZoneDir(void);
+int  TzParseZone(TzZoneStruct *zone, const char *name, const unsigned char *data, size_t size);
+int  TzLoadZone(TzZoneStruct *zone, const char *zoneDir, const char *name);
+void TzFreeZone(TzZoneStruct *zone);
+const TzZoneStruct *TzFindZone(const char *name);
+void TzFreeAllZones(void);
+
+void    TzCacheInvalidate(TzCacheStruct *cache);
+void    TzResolve(const TzZoneStruct *zone, int64_t t, TzCacheStruct *cache);
+int32_t TzOffsetAt(const TzZoneStruct *zone, TzCacheStruct *cache, int64_t t);
+
+#endif /* TZONE_H */
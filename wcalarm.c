@@ -0,0 +1,372 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcalarm.c -- alarms and countdowns on a hierarchical timing wheel        */
+/*                                                                            */
+/* A daily alarm is kept as a time of day on its clock and resolved to the    */
+/* UTC instant of its next ring through the clock's zone, so it follows       */
+/* daylight saving time, and is resolved again when the clock's offset or     */
+/* zone changes.  Only that one instant is in the wheel.  Time is given, not  */
+/* read, so the wheel runs the same on a replayed or simulated clock.  A jump */
+/* of more than ALARM_REBUILD_AFTER, or backwards, re-sorts every alarm       */
+/* instead of stepping through each second; after it the alarms that were     */
+/* passed ring once each, in no particular order.                             */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "wcalarm.h"
+
+#define ALARM_SLOT_BITS       20
+#define ALARM_SLOT_MASK       ((1u << ALARM_SLOT_BITS) - 1)
+#define ALARM_GENERATION_MASK 0xfffu
+#define ALARM_REBUILD_AFTER   ((int64_t) ALARM_WHEEL_SLOTS * ALARM_WHEEL_SLOTS)   /* seconds */
+#define ALARM_NEVER           INT64_MAX
+#define ALARM_DAYS_AHEAD      8         /* a week, and a day for offset changes */
+
+void AlarmWheelInit(AlarmWheelStruct *wheel, int64_t utcSeconds)
+{
+    int i;
+
+    memset(wheel, 0, sizeof(AlarmWheelStruct));
+    wheel->freeAlarm = -1;
+    for (i = 0; i < ALARM_WHEEL_LEVELS * ALARM_WHEEL_SLOTS; i++)
+        wheel->heads[i] = -1;
+    wheel->now = utcSeconds;
+} /* AlarmWheelInit() */
+
+void AlarmWheelFree(AlarmWheelStruct *wheel)
+{
+    free(wheel->alarms);
+    AlarmWheelInit(wheel, wheel->now);
+} /* AlarmWheelFree() */
+
+static int64_t FloorDiv(int64_t value, int64_t divisor)
+{
+    return((value >= 0) ? value / divisor : -((-value + divisor - 1) / divisor));
+} /* FloorDiv() */
+
+/* the clock's offset at t, without touching the zone cache its ticks use */
+static int32_t OffsetAt(const ClockRegistryStruct *reg, int index, int64_t t)
+{
+    TzCacheStruct cache;
+
+    if (reg->zones[index] == NULL)
+        return(reg->gmtOffsets[index]);
+    TzCacheInvalidate(&cache);
+    return(TzOffsetAt(reg->zones[index], &cache, t));
+} /* OffsetAt() */
+
+/******************************************************************************/
+/* NextDaily -- the first instant after after at which the alarm's clock      */
+/* shows its time of day on one of its weekdays, or ALARM_NEVER if the clock  */
+/* is gone.  A time that is skipped when the clocks go forward rings at the   */
+/* same distance from the change; one that happens twice rings once.          */
+/******************************************************************************/
+static int64_t NextDaily(const AlarmStruct *alarm, const ClockRegistryStruct *reg, int64_t after)
+{
+    int64_t day, local, utc;
+    int index = ClockRegIndexOf(reg, alarm->clock), i;
+
+    if (index < 0)
+        return(ALARM_NEVER);
+    day = FloorDiv(after + OffsetAt(reg, index, after), SECONDS_PER_DAY) - 1;
+    for (i = 0; i <= ALARM_DAYS_AHEAD; i++, day++)
+    {
+        if (!(alarm->weekdays & (1u << (int) (((day + 4) % 7 + 7) % 7))))   /* 1970-01-01 was a Thursday */
+            continue;
+        local = day * SECONDS_PER_DAY + alarm->localSeconds;
+        utc = local - OffsetAt(reg, index, local - OffsetAt(reg, index, local));
+        if (utc > after)
+            return(utc);
+    } /* for i */
+    return(ALARM_NEVER);
+} /* NextDaily() */
+
+static void Unlink(AlarmWheelStruct *wheel, int32_t i)
+{
+    AlarmStruct *alarm = &wheel->alarms[i];
+
+    if (alarm->bucket < 0)
+        return;
+    if (alarm->previous >= 0)
+        wheel->alarms[alarm->previous].next = alarm->next;
+    else
+        wheel->heads[alarm->bucket] = alarm->next;
+    if (alarm->next >= 0)
+        wheel->alarms[alarm->next].previous = alarm->previous;
+    alarm->bucket = -1;
+} /* Unlink() */
+
+static void Link(AlarmWheelStruct *wheel, int32_t i, int bucket)
+{
+    AlarmStruct *alarm = &wheel->alarms[i];
+
+    alarm->bucket = bucket;
+    alarm->previous = -1;
+    alarm->next = wheel->heads[bucket];
+    if (alarm->next >= 0)
+        wheel->alarms[alarm->next].previous = i;
+    wheel->heads[bucket] = i;
+} /* Link() */
+
+/******************************************************************************/
+/* Place -- put alarm i in the slot of the lowest level whose span reaches    */
+/* its due time.  One already due rings with the next second; one beyond the  */
+/* top level waits in its last slot and is placed again from there.           */
+/******************************************************************************/
+static void Place(AlarmWheelStruct *wheel, int32_t i)
+{
+    int64_t due = wheel->alarms[i].dueUtc, delta;
+    int level = 0, slot;
+
+    if (due <= wheel->now)
+        due = wheel->now + 1;
+    delta = due - wheel->now;
+    while (level < ALARM_WHEEL_LEVELS - 1 && delta >= (int64_t) 1 << (ALARM_WHEEL_BITS * (level + 1)))
+        level++;
+    if (delta >= (int64_t) 1 << (ALARM_WHEEL_BITS * ALARM_WHEEL_LEVELS))
+        due = wheel->now + ((int64_t) 1 << (ALARM_WHEEL_BITS * ALARM_WHEEL_LEVELS)) - 1;
+    slot = (int) (((uint64_t) due >> (ALARM_WHEEL_BITS * level)) & (ALARM_WHEEL_SLOTS - 1));
+    Link(wheel, i, level * ALARM_WHEEL_SLOTS + slot);
+} /* Place() */
+
+static void FreeAlarm(AlarmWheelStruct *wheel, int32_t i)
+{
+    AlarmStruct *alarm = &wheel->alarms[i];
+
+    Unlink(wheel, i);
+    alarm->handle = ALARM_HANDLE_NONE;
+    alarm->generation = (uint16_t) ((alarm->generation + 1) & ALARM_GENERATION_MASK);
+    if (alarm->generation == 0)
+        alarm->generation = 1;
+    alarm->next = wheel->freeAlarm;
+    wheel->freeAlarm = i;
+    wheel->count--;
+} /* FreeAlarm() */
+
+/* a free entry, filled in but in no slot; -1 when out of memory */
+static int32_t NewAlarm(AlarmWheelStruct *wheel, ClockHandle clock, AlarmKind kind, const char *name)
+{
+    AlarmStruct *alarm, *grown;
+    int capacity, i;
+
+    if (wheel->freeAlarm < 0)
+    {
+        capacity = (wheel->capacity > 0) ? wheel->capacity * 2 : 16;
+        if (capacity > (int) ALARM_SLOT_MASK)
+            return(-1);
+        grown = (AlarmStruct *) realloc(wheel->alarms, capacity * sizeof(AlarmStruct));
+        if (grown == NULL)
+            return(-1);
+        wheel->alarms = grown;
+        for (i = capacity - 1; i >= wheel->capacity; i--)
+        {
+            memset(&grown[i], 0, sizeof(AlarmStruct));
+            grown[i].generation = 1;
+            grown[i].bucket = -1;
+            grown[i].next = wheel->freeAlarm;
+            wheel->freeAlarm = i;
+        } /* for i */
+        wheel->capacity = capacity;
+    }
+
+    i = wheel->freeAlarm;
+    alarm = &wheel->alarms[i];
+    wheel->freeAlarm = alarm->next;
+    alarm->handle = (AlarmHandle) alarm->generation << ALARM_SLOT_BITS | (AlarmHandle) (i + 1);
+    alarm->clock = clock;
+    alarm->kind = kind;
+    alarm->localSeconds = 0;
+    alarm->weekdays = 0;
+    alarm->dueUtc = ALARM_NEVER;
+    strncpy(alarm->name, name, ALARM_NAME_SIZE - 1);
+    alarm->name[ALARM_NAME_SIZE - 1] = '\0';
+    alarm->next = alarm->previous = alarm->bucket = -1;
+    wheel->count++;
+    return(i);
+} /* NewAlarm() */
+
+/******************************************************************************/
+/* AlarmAddDaily -- ring at localSeconds after midnight on clock, on the      */
+/* weekdays in its local calendar.  Returns ALARM_HANDLE_NONE for an unknown  */
+/* clock, a time outside the day, no weekdays, or no memory.                  */
+/******************************************************************************/
+AlarmHandle AlarmAddDaily(AlarmWheelStruct *wheel, const ClockRegistryStruct *reg, ClockHandle clock,
+                          const char *name, int32_t localSeconds, unsigned int weekdays)
+{
+    AlarmStruct *alarm;
+    int32_t i;
+
+    if (localSeconds < 0 || localSeconds >= SECONDS_PER_DAY || (weekdays & ALARM_EVERY_DAY) == 0 ||
+        ClockRegIndexOf(reg, clock) < 0 || (i = NewAlarm(wheel, clock, ALARM_DAILY, name)) < 0)
+        return(ALARM_HANDLE_NONE);
+    alarm = &wheel->alarms[i];
+    alarm->localSeconds = localSeconds;
+    alarm->weekdays = weekdays & ALARM_EVERY_DAY;
+    alarm->dueUtc = NextDaily(alarm, reg, wheel->now);
+    Place(wheel, i);
+    return(alarm->handle);
+} /* AlarmAddDaily() */
+
+/* ring once at dueUtc; clock is only what it is shown with */
+AlarmHandle AlarmAddCountdown(AlarmWheelStruct *wheel, ClockHandle clock, const char *name, int64_t dueUtc)
+{
+    int32_t i = NewAlarm(wheel, clock, ALARM_COUNTDOWN, name);
+
+    if (i < 0)
+        return(ALARM_HANDLE_NONE);
+    wheel->alarms[i].dueUtc = dueUtc;
+    Place(wheel, i);
+    return(wheel->alarms[i].handle);
+} /* AlarmAddCountdown() */
+
+const AlarmStruct *AlarmFind(const AlarmWheelStruct *wheel, AlarmHandle handle)
+{
+    uint32_t slot = (handle & ALARM_SLOT_MASK) - 1;
+
+    if (handle == ALARM_HANDLE_NONE || slot >= (uint32_t) wheel->capacity || wheel->alarms[slot].handle != handle)
+        return(NULL);
+    return(&wheel->alarms[slot]);
+} /* AlarmFind() */
+
+void AlarmCancel(AlarmWheelStruct *wheel, AlarmHandle handle)
+{
+    if (AlarmFind(wheel, handle) != NULL)
+        FreeAlarm(wheel, (int32_t) (handle & ALARM_SLOT_MASK) - 1);
+} /* AlarmCancel() */
+
+/******************************************************************************/
+/* AlarmClockChanged -- resolve the daily alarms of clock again after its     */
+/* offset or zone changed; those of a clock that is gone are dropped.  Walks  */
+/* every alarm, which is fine for something the user does by hand.           */
+/******************************************************************************/
+void AlarmClockChanged(AlarmWheelStruct *wheel, const ClockRegistryStruct *reg, ClockHandle clock)
+{
+    AlarmStruct *alarm;
+    int32_t i;
+
+    for (i = 0; i < wheel->capacity; i++)
+    {
+        alarm = &wheel->alarms[i];
+        if (alarm->handle == ALARM_HANDLE_NONE || alarm->clock != clock || alarm->kind != ALARM_DAILY)
+            continue;
+        Unlink(wheel, i);
+        alarm->dueUtc = NextDaily(alarm, reg, wheel->now);
+        if (alarm->dueUtc == ALARM_NEVER)
+            FreeAlarm(wheel, i);
+        else
+            Place(wheel, i);
+    } /* for i */
+} /* AlarmClockChanged() */
+
+/* ring alarm i and set a daily one for its next day; 0 if its clock is gone */
+static int Ring(AlarmWheelStruct *wheel, const ClockRegistryStruct *reg, int32_t i, int64_t utcSeconds,
+                 AlarmRingFunc ring, void *context)
+{
+    AlarmStruct *alarm = &wheel->alarms[i];
+
+    if (alarm->kind == ALARM_DAILY && ClockRegIndexOf(reg, alarm->clock) < 0)
+    {
+        FreeAlarm(wheel, i);    /* its clock was deleted */
+        return(0);
+    }
+    ring(context, alarm, utcSeconds);
+    alarm = &wheel->alarms[i];  /* ring may have added alarms and moved them all */
+    if (alarm->kind == ALARM_DAILY)
+        alarm->dueUtc = NextDaily(alarm, reg, utcSeconds);
+    if (alarm->kind == ALARM_COUNTDOWN || alarm->dueUtc == ALARM_NEVER)
+        FreeAlarm(wheel, i);
+    else
+        Place(wheel, i);
+    return(1);
+} /* Ring() */
+
+/* second now + 1: spread the slots of levels that wrapped, ring level 0 */
+static int Step(AlarmWheelStruct *wheel, const ClockRegistryStruct *reg, int64_t utcSeconds,
+                AlarmRingFunc ring, void *context)
+{
+    uint64_t t = (uint64_t) utcSeconds;
+    int32_t i, next;
+    int level = 1, bucket, rung = 0;
+
+    wheel->now = utcSeconds;
+    while (level < ALARM_WHEEL_LEVELS && (t & (((uint64_t) 1 << (ALARM_WHEEL_BITS * level)) - 1)) == 0)
+        level++;
+    for (level--; level > 0; level--)
+    {
+        bucket = level * ALARM_WHEEL_SLOTS + (int) ((t >> (ALARM_WHEEL_BITS * level)) & (ALARM_WHEEL_SLOTS - 1));
+        i = wheel->heads[bucket];
+        wheel->heads[bucket] = -1;
+        for (; i >= 0; i = next)
+        {
+            next = wheel->alarms[i].next;
+            if (wheel->alarms[i].dueUtc <= utcSeconds)
+                Link(wheel, i, (int) (t & (ALARM_WHEEL_SLOTS - 1)));     /* rings below */
+            else
+                Place(wheel, i);
+        } /* for i */
+    } /* for level */
+
+    bucket = (int) (t & (ALARM_WHEEL_SLOTS - 1));
+    i = wheel->heads[bucket];
+    wheel->heads[bucket] = -1;
+    for (; i >= 0; i = next)
+    {
+        next = wheel->alarms[i].next;
+        wheel->alarms[i].bucket = -1;
+        if (wheel->alarms[i].dueUtc > utcSeconds)
+            Place(wheel, i);
+        else
+            rung += Ring(wheel, reg, i, utcSeconds, ring, context);
+    } /* for i */
+    return(rung);
+} /* Step() */
+
+/* after a jump: every alarm placed again from utcSeconds, those passed rung */
+static int Rebuild(AlarmWheelStruct *wheel, const ClockRegistryStruct *reg, int64_t utcSeconds,
+                   AlarmRingFunc ring, void *context)
+{
+    AlarmStruct *alarm;
+    int forward = (utcSeconds > wheel->now), capacity = wheel->capacity, rung = 0;
+    int32_t i;
+
+    wheel->now = utcSeconds;
+    for (i = 0; i < ALARM_WHEEL_LEVELS * ALARM_WHEEL_SLOTS; i++)
+        wheel->heads[i] = -1;
+    for (i = 0; i < capacity; i++)
+        wheel->alarms[i].bucket = -1;
+    for (i = 0; i < capacity; i++)
+    {
+        alarm = &wheel->alarms[i];
+        if (alarm->handle == ALARM_HANDLE_NONE || alarm->bucket >= 0)
+            continue;           /* free, or added by ring and placed already */
+        if (forward && alarm->dueUtc <= utcSeconds)
+        {
+            rung += Ring(wheel, reg, i, utcSeconds, ring, context);
+            continue;
+        }
+        if (alarm->kind == ALARM_DAILY)
+            alarm->dueUtc = NextDaily(alarm, reg, utcSeconds);
+        if (alarm->dueUtc == ALARM_NEVER)
+            FreeAlarm(wheel, i);
+        else
+            Place(wheel, i);
+    } /* for i */
+    return(rung);
+} /* Rebuild() */
+
+/******************************************************************************/
+/* AlarmAdvance -- ring every alarm due after the last call and by            */
+/* utcSeconds, in order of their due times.  Returns how many rang.           */
+/******************************************************************************/
+int AlarmAdvance(AlarmWheelStruct *wheel, const ClockRegistryStruct *reg, int64_t utcSeconds,
+                 AlarmRingFunc ring, void *context)
+{
+    int rung = 0;
+
+    if (utcSeconds < wheel->now || utcSeconds - wheel->now > ALARM_REBUILD_AFTER)
+        return(Rebuild(wheel, reg, utcSeconds, ring, context));
+    while (wheel->now < utcSeconds)
+        rung += Step(wheel, reg, wheel->now + 1, ring, context);
+    return(rung);
+} /* AlarmAdvance() */
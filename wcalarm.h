@@ -0,0 +1,71 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcalarm.h -- alarms and countdowns on a hierarchical timing wheel        */
+/******************************************************************************/
+
+#ifndef WCALARM_H
+#define WCALARM_H
+
+#include <stdint.h>
+#include "clockreg.h"
+
+#define ALARM_NAME_SIZE    32
+#define ALARM_WHEEL_BITS   6
+#define ALARM_WHEEL_SLOTS  (1 << ALARM_WHEEL_BITS)
+#define ALARM_WHEEL_LEVELS 4    /* seconds, 64 s, 68 min, 3 days a slot */
+#define ALARM_EVERY_DAY    0x7f /* weekday bits, bit 0 for Sunday */
+
+typedef uint32_t AlarmHandle;
+#define ALARM_HANDLE_NONE ((AlarmHandle) 0)
+
+typedef enum {
+    ALARM_DAILY,                /* a time of day on its clock, on some weekdays */
+    ALARM_COUNTDOWN             /* one instant, whatever the clock's offset */
+} AlarmKind;
+
+typedef struct AlarmStructTag {
+    AlarmHandle handle;         /* ALARM_HANDLE_NONE while the entry is free */
+    ClockHandle clock;
+    AlarmKind kind;
+    int32_t localSeconds;       /* ALARM_DAILY: seconds after local midnight */
+    unsigned int weekdays;      /* ALARM_DAILY: local days it rings on */
+    int64_t dueUtc;             /* when it rings next */
+    char name[ALARM_NAME_SIZE];
+    int32_t next;               /* in its wheel slot, or the free list */
+    int32_t previous;
+    int32_t bucket;             /* level * ALARM_WHEEL_SLOTS + slot, -1 if in none */
+    uint16_t generation;
+} AlarmStruct;
+
+/* called for each alarm as it rings; it may add alarms, but not cancel any */
+typedef void (*AlarmRingFunc)(void *context, const AlarmStruct *alarm, int64_t utcSeconds);
+
+/******************************************************************************/
+/* Level n of the wheel holds the alarms due 64^n to 64^(n+1) seconds ahead,  */
+/* in the slot their due time names at that level's resolution.  A second     */
+/* rings one level 0 slot; each time a level wraps, the next level's slot is  */
+/* spread over the levels below.  Adding, cancelling and ringing an alarm     */
+/* are constant time, and an alarm moves down at most once per level.         */
+/* Entries live in one array; the live ones are those with a handle.          */
+/******************************************************************************/
+typedef struct AlarmWheelStructTag {
+    AlarmStruct *alarms;
+    int capacity;
+    int count;
+    int32_t freeAlarm;
+    int32_t heads[ALARM_WHEEL_LEVELS * ALARM_WHEEL_SLOTS];
+    int64_t now;                /* every alarm due by then has rung */
+} AlarmWheelStruct;
+
+void        AlarmWheelInit(AlarmWheelStruct *wheel, int64_t utcSeconds);
+void        AlarmWheelFree(AlarmWheelStruct *wheel);
+AlarmHandle AlarmAddDaily(AlarmWheelStruct *wheel, const ClockRegistryStruct *reg, ClockHandle clock,
+                          const char *name, int32_t localSeconds, unsigned int weekdays);
+AlarmHandle AlarmAddCountdown(AlarmWheelStruct *wheel, ClockHandle clock, const char *name, int64_t dueUtc);
+void        AlarmCancel(AlarmWheelStruct *wheel, AlarmHandle handle);
+const AlarmStruct *AlarmFind(const AlarmWheelStruct *wheel, AlarmHandle handle);
+void        AlarmClockChanged(AlarmWheelStruct *wheel, const ClockRegistryStruct *reg, ClockHandle clock);
+int         AlarmAdvance(AlarmWheelStruct *wheel, const ClockRegistryStruct *reg, int64_t utcSeconds,
+                         AlarmRingFunc ring, void *context);
+
+#endif /* WCALARM_H */
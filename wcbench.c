@@ -0,0 +1,856 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcbench.c -- micro-benchmarks for the portable hot paths                 */
+/*                                                                            */
+/* Usage: wcbench [-n clocks] [-r samples] [-b name] [-f json|text] [-t max]  */
+/*   -n  one clock count instead of 1, 10, 100, 1000 and 10000                */
+/*   -r  timed samples per benchmark (31)                                     */
+/*   -b  run only the named benchmark                                         */
+/*   -f  output format, json (default) or text                                */
+/*   -t  most threads for the scaling benchmarks (one per processor)          */
+/*                                                                            */
+/* Each benchmark times one operation over the whole clock set, the work of   */
+/* a WM_PAINT of every clock, a WM_TIMER sweep, an AdjustWindow relayout, a   */
+/* Save Setup or a startup load, and reports ns/op percentiles over the       */
+/* samples and allocations per operation.  "stats" is the WM_TIMER sweep with */
+/* the statistics recorded, so its difference from "tick" is their cost.      */
+/* "civil" is the batch time and date conversion alone, checked against       */
+/* gmtime() before it is timed.  "atlas_scaled" builds the glyphs at 200%,    */
+/* as a move to a high-DPI monitor does, and "atlas_cache" switches between   */
+/* scales the atlas cache already holds.  "frame" brings a whole wall of      */
+/* tiles up to the next second and "frame_full" redraws it, on 1, 2, 4, ...   */
+/* threads up to -t; each checks first that its frame is the one drawn on     */
+/* one thread.  "alarm" is one second of the alarm wheel with a daily alarm   */
+/* on every clock, which should not grow with the number of alarms.           */
+/* "zone_search" is a keystroke of the Clock Setup zone search per clock,     */
+/* each a substring search of the generated index.  "clock_churn" deletes,    */
+/* re-adds and renames every clock, some with labels too long to keep inline; */
+/* its allocations per operation should be 0.                                 */
+/* Build with the portable sources:                                           */
+/*   cc -O2 -pthread -o wcbench wcbench.c wcconfig.c clockreg.c tzone.c \     */
+/*         ticktime.c ticksched.c segrender.c wclayout.c bmfont.c wcstats.c \ */
+/*         wcframe.c wcpool.c wcalarm.c wczindex.c wczdata.c                  */
+/* Allocations are counted on glibc by wrapping malloc(); elsewhere they are  */
+/* reported as null.                                                          */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "wcconfig.h"
+#include "clockreg.h"
+#include "wclayout.h"
+#include "bmfont.h"
+#include "ticksched.h"
+#include "wcstats.h"
+#include "wcframe.h"
+#include "wcalarm.h"
+#include "wczindex.h"
+
+#define BENCH_INI_FILE     "./wcbench.ini"
+#define BENCH_MAX_SAMPLES  1001
+#define BENCH_SAMPLE_NS    2000000LL    /* aim for samples of at least 2 ms */
+
+#if defined(__GLIBC__) && !defined(WCBENCH_NO_ALLOC_COUNT)
+#define BENCH_COUNT_ALLOCS
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *block, size_t size);
+extern void  __libc_free(void *block);
+
+static unsigned long long allocCount = 0;
+static unsigned long long allocBytes = 0;
+
+void *malloc(size_t size)
+{
+    allocCount++;
+    allocBytes += size;
+    return(__libc_malloc(size));
+} /* malloc() */
+
+void *calloc(size_t count, size_t size)
+{
+    allocCount++;
+    allocBytes += count * size;
+    return(__libc_calloc(count, size));
+} /* calloc() */
+
+void *realloc(void *block, size_t size)
+{
+    allocCount++;
+    allocBytes += size;
+    return(__libc_realloc(block, size));
+} /* realloc() */
+
+void free(void *block)
+{
+    __libc_free(block);
+} /* free() */
+#endif
+
+typedef struct BenchCaseStructTag {
+    const char *name;
+    int  (*setup)(int numClocks);       /* returns 0 on failure */
+    void (*run)(int numClocks);         /* one operation */
+    void (*teardown)(void);
+    int fixedSize;                      /* does not depend on the clock count */
+    int scaling;                        /* run on 1, 2, 4, ... threads */
+    int maxClocks;                      /* skip larger counts; 0 for no limit */
+} BenchCaseStruct;
+
+typedef struct BenchResultStructTag {
+    int samples;
+    long opsPerSample;
+    double mean, min, p50, p90, p99, max;   /* ns per operation */
+    double allocsPerOp;
+    double bytesPerOp;
+} BenchResultStruct;
+
+static ClockRegistryStruct registry;
+static GlyphAtlasStruct atlas;
+static FrameBufferStruct faceBuffer;
+static ClockLayoutStruct tiles;
+static ConfigStruct config;
+static int64_t benchInstant;
+static int benchThreads = 1;            /* for the scaling benchmarks */
+static PoolStruct benchPool;
+static FrameStruct benchFrame;
+static uint32_t benchVersion;
+static volatile long benchSink;         /* keeps results alive */
+
+static int64_t NowNs(void)
+{
+    return(tickSystemClock.monotonicNs(tickSystemClock.context));
+} /* NowNs() */
+
+/******************************************************************************/
+/* Clock sets: a mix of whole-hour offsets and, when zone data is installed,  */
+/* IANA zones, as a real WorldClock.ini would have.                           */
+/******************************************************************************/
+static const char *const benchZones[] = { "", "Europe/Paris", "", "America/New_York",
+                                          "", "Asia/Kolkata", "", "Australia/Lord_Howe" };
+
+static int FillRegistry(int numClocks)
+{
+    char label[CLOCK_NAME_SIZE];
+    const char *zone;
+    int i;
+
+    ClockRegInit(&registry, 0);
+    if (!ClockRegReserve(&registry, numClocks))
+        return(0);
+    for (i = 0; i < numClocks; i++)
+    {
+        sprintf(label, "City %d", i + 1);
+        zone = benchZones[i % (sizeof(benchZones) / sizeof(benchZones[0]))];
+        if (zone[0] != '\0' && TzFindZone(zone) == NULL)
+            zone = "";
+        if (ClockRegAdd(&registry, label, (i % 24 - 11) * 3600, zone) == CLOCK_HANDLE_NONE)
+            return(0);
+    } /* for i */
+    return(1);
+} /* FillRegistry() */
+
+static void FreeRegistry(void)
+{
+    ClockRegFree(&registry);
+} /* FreeRegistry() */
+
+/* --- atlas: rasterize the ten digits and both colons ---------------------- */
+
+static int SetupAtlas(int numClocks)
+{
+    (void) numClocks;
+    return(1);
+} /* SetupAtlas() */
+
+static void RunAtlas(int numClocks)
+{
+    (void) numClocks;
+    SegAtlasInit(&atlas, clockDefaultTheme.litColor, clockDefaultTheme.darkColor, clockDefaultTheme.backColor);
+    benchSink += (long) atlas.strip.pixels[atlas.strip.width / 2];
+    SegAtlasFree(&atlas);
+} /* RunAtlas() */
+
+static void RunAtlasScaled(int numClocks)
+{
+    (void) numClocks;
+    SegAtlasInitScaled(&atlas, 2 * SEG_SCALE_ONE,
+                       clockDefaultTheme.litColor, clockDefaultTheme.darkColor, clockDefaultTheme.backColor);
+    benchSink += (long) atlas.strip.pixels[atlas.strip.width / 2];
+    SegAtlasFree(&atlas);
+} /* RunAtlasScaled() */
+
+static void TeardownNothing(void)
+{
+} /* TeardownNothing() */
+
+/* --- atlas_cache: a scale the cache holds, as on moving between monitors -- */
+
+static SegAtlasCacheStruct atlasCache;
+static unsigned int atlasCacheTurn;
+
+static int SetupAtlasCache(int numClocks)
+{
+    (void) numClocks;
+    SegAtlasCacheInit(&atlasCache);
+    return(1);
+} /* SetupAtlasCache() */
+
+static void RunAtlasCache(int numClocks)
+{
+    static const int scales[SEG_ATLAS_CACHE_SIZE] = { 100, 125, 150, 200 };
+    const GlyphAtlasStruct *cached;
+
+    (void) numClocks;
+    cached = SegAtlasCacheGet(&atlasCache, scales[atlasCacheTurn++ % SEG_ATLAS_CACHE_SIZE],
+                              clockDefaultTheme.litColor, clockDefaultTheme.darkColor, clockDefaultTheme.backColor);
+    benchSink += (cached != NULL) ? cached->faceWidth : 0;
+} /* RunAtlasCache() */
+
+static void TeardownAtlasCache(void)
+{
+    SegAtlasCacheFree(&atlasCache);
+} /* TeardownAtlasCache() */
+
+/* --- paint: every clock's face and label, as in WM_PAINT ------------------ */
+
+static int SetupPaint(int numClocks)
+{
+    TickSnapshotStruct tick;
+    int i;
+
+    if (!FillRegistry(numClocks) ||
+        !SegAtlasInit(&atlas, clockDefaultTheme.litColor, clockDefaultTheme.darkColor, clockDefaultTheme.backColor) ||
+        !SegFrameBufferInit(&faceBuffer, CLOCK_DISPLAY_WIDTH, CLOCK_DISPLAY_HEIGHT))
+        return(0);
+    TickTakeSnapshot(&tick, 1700000000);
+    for (i = 0; i < registry.count; i++)
+        ClockRegTick(&registry, i, &tick);
+    return(1);
+} /* SetupPaint() */
+
+static void RunPaint(int numClocks)
+{
+    FrameBufferStruct band;
+    int i;
+
+    for (i = 0; i < numClocks; i++)
+    {
+        SegRenderFaceMask(&atlas, &faceBuffer, 0, 0, registry.shownMasks[i]);
+        ClockRegLabelBand(&registry, i, &band);
+        SegBlitPixels(&faceBuffer, 0, CLOCK_LABEL_TOP, &band);
+    } /* for i */
+    benchSink += (long) faceBuffer.pixels[CLOCK_X_OFFSET + 3];
+} /* RunPaint() */
+
+static void TeardownPaint(void)
+{
+    SegFrameBufferFree(&faceBuffer);
+    SegAtlasFree(&atlas);
+    FreeRegistry();
+} /* TeardownPaint() */
+
+/* --- tick: one snapshot and every clock's time, as in WM_TIMER ------------ */
+
+static int SetupTick(int numClocks)
+{
+    benchInstant = 1700000000;
+    return(FillRegistry(numClocks));
+} /* SetupTick() */
+
+static void RunTick(int numClocks)
+{
+    TickSnapshotStruct tick;
+    unsigned int dirty = 0;
+    int i;
+
+    TickTakeSnapshot(&tick, benchInstant++);
+    ClockRegTickAll(&registry, &tick);
+    for (i = 0; i < numClocks; i++)
+        dirty |= registry.dirtyDigits[i];
+    benchSink += (long) dirty;
+} /* RunTick() */
+
+static void RunStats(int numClocks)
+{
+    TickSnapshotStruct tick;
+    unsigned int dirty = 0;
+    int64_t startNs;
+    int i;
+
+    StatsEndFrame();
+    TickTakeSnapshot(&tick, benchInstant++);
+    StatsCount(STAT_TICKS, 1);
+    StatsRecord(STAT_TIMER_LATE_US, (uint64_t) (benchInstant & 1023));
+    ClockRegTickAll(&registry, &tick);
+    for (i = 0; i < numClocks; i++)
+    {
+        startNs = StatsNowNs();
+        dirty |= registry.dirtyDigits[i];
+        StatsFrameArea(DIGIT_WIDTH * DIGIT_HEIGHT);
+        StatsGdiCalls(1);
+        StatsCount(STAT_PAINTS, 1);
+        StatsRecord(STAT_PAINT_US, (uint64_t) (StatsNowNs() - startNs) / 1000);
+    } /* for i */
+    benchSink += (long) dirty;
+} /* RunStats() */
+
+/* --- civil: time and date for offsets to the second, checked by gmtime() -- */
+
+static int32_t *civilOffsets;
+static TickCivilBatchStruct civil;
+
+static int SetupCivil(int numClocks)
+{
+    static const int64_t checkInstants[] = { 0, 86399, 951825600, 1700000000, 4107542399LL, -86401 };
+    TickSnapshotStruct tick;
+    struct tm *expected;
+    time_t local;
+    size_t c;
+    int i;
+
+    civilOffsets = (int32_t *) malloc(9 * (size_t) numClocks * sizeof(int32_t));
+    if (civilOffsets == NULL)
+        return(0);
+    civil.hours = civilOffsets + numClocks;
+    civil.minutes = civil.hours + numClocks;
+    civil.seconds = civil.minutes + numClocks;
+    civil.dayOffsets = civil.seconds + numClocks;
+    civil.weekdays = civil.dayOffsets + numClocks;
+    civil.years = civil.weekdays + numClocks;
+    civil.months = civil.years + numClocks;
+    civil.days = civil.months + numClocks;
+    for (i = 0; i < numClocks; i++)
+        civilOffsets[i] = (int32_t) ((i * 7919L) % (2 * SECONDS_PER_DAY - 1)) - (SECONDS_PER_DAY - 1);
+
+    /* a fast wrong answer is no use: compare with the C library first */
+    for (c = 0; c < sizeof(checkInstants) / sizeof(checkInstants[0]); c++)
+    {
+        TickTakeSnapshot(&tick, checkInstants[c]);
+        TickCivilBatch(&tick, civilOffsets, numClocks, &civil);
+        for (i = 0; i < numClocks; i++)
+        {
+            local = (time_t) (checkInstants[c] + civilOffsets[i]);
+            expected = gmtime(&local);
+            if (expected == NULL)
+                continue;       /* before 1970 on some C libraries */
+            if (civil.hours[i] != expected->tm_hour || civil.minutes[i] != expected->tm_min ||
+                civil.seconds[i] != expected->tm_sec || civil.weekdays[i] != expected->tm_wday ||
+                civil.years[i] != expected->tm_year + 1900 || civil.months[i] != expected->tm_mon + 1 ||
+                civil.days[i] != expected->tm_mday)
+            {
+                fprintf(stderr, "wcbench: civil time differs from gmtime() at %lld%+ld\n",
+                        (long long) checkInstants[c], (long) civilOffsets[i]);
+                return(0);
+            }
+        } /* for i */
+    } /* for c */
+    benchInstant = 1700000000;
+    return(1);
+} /* SetupCivil() */
+
+static void RunCivil(int numClocks)
+{
+    TickSnapshotStruct tick;
+
+    TickTakeSnapshot(&tick, benchInstant++);
+    TickCivilBatch(&tick, civilOffsets, numClocks, &civil);
+    benchSink += civil.days[numClocks - 1];
+} /* RunCivil() */
+
+static void TeardownCivil(void)
+{
+    free(civilOffsets);
+    civilOffsets = NULL;
+} /* TeardownCivil() */
+
+/* --- frame: every tile of a wall brought up to the tick, on a pool -------- */
+
+static int RenderFrame(FrameStruct *frame, PoolStruct *pool)
+{
+    TickSnapshotStruct tick;
+
+    TickTakeSnapshot(&tick, benchInstant);
+    return(FrameRender(frame, &registry, &tiles, &atlas, &tick, benchVersion, pool));
+} /* RenderFrame() */
+
+static int SetupFrame(int numClocks)
+{
+    FrameStruct single;
+    int same;
+
+    benchInstant = 1700000000;
+    benchVersion = 1;
+    FrameInit(&benchFrame);
+    PoolInit(&benchPool, benchThreads);
+    if (!FillRegistry(numClocks) ||
+        !SegAtlasInit(&atlas, clockDefaultTheme.litColor, clockDefaultTheme.darkColor, clockDefaultTheme.backColor))
+        return(0);
+    LayoutInit(&tiles, numClocks, 1, CLOCK_DISPLAY_WIDTH, CLOCK_DISPLAY_HEIGHT);
+
+    /* the pool must not change a pixel */
+    FrameInit(&single);
+    same = RenderFrame(&single, NULL) && RenderFrame(&benchFrame, &benchPool) &&
+           memcmp(single.surface.pixels, benchFrame.surface.pixels,
+                  (size_t) tiles.width * tiles.height * sizeof(uint32_t)) == 0;
+    FrameFree(&single);
+    if (!same)
+        fprintf(stderr, "wcbench: frame on %d threads differs from one thread\n", benchPool.threads);
+    return(same);
+} /* SetupFrame() */
+
+static void RunFrame(int numClocks)
+{
+    (void) numClocks;
+    benchInstant++;
+    benchSink += RenderFrame(&benchFrame, &benchPool);
+} /* RunFrame() */
+
+static void RunFrameFull(int numClocks)
+{
+    (void) numClocks;
+    benchVersion++;
+    benchSink += RenderFrame(&benchFrame, &benchPool);
+} /* RunFrameFull() */
+
+static void TeardownFrame(void)
+{
+    PoolFree(&benchPool);
+    FrameFree(&benchFrame);
+    SegAtlasFree(&atlas);
+    FreeRegistry();
+} /* TeardownFrame() */
+
+/* --- layout: place a grid on an 8K work area and hit-test it -------------- */
+
+#define BENCH_AREA_WIDTH  7680
+#define BENCH_AREA_HEIGHT 4320
+
+static int SetupLayout(int numClocks)
+{
+    (void) numClocks;
+    return(1);
+} /* SetupLayout() */
+
+static void RunLayout(int numClocks)
+{
+    LayoutRectStruct tile;
+    long sum = 0;
+    int i;
+
+    LayoutInitGrid(&tiles, numClocks, 0, 0, BENCH_AREA_WIDTH, BENCH_AREA_HEIGHT, (int) (benchSink & 1),
+                   CLOCK_DISPLAY_WIDTH, CLOCK_DISPLAY_HEIGHT);
+    for (i = 0; i < tiles.count; i++)
+    {
+        LayoutTileRect(&tiles, i, &tile);
+        sum += LayoutHitTest(&tiles, tile.left + 1, tile.top + 1);
+    } /* for i */
+    benchSink += sum;
+} /* RunLayout() */
+
+/* --- alarm: one second of the alarm wheel, a daily alarm per clock -------- */
+
+static AlarmWheelStruct alarmWheel;
+
+static void RingNothing(void *context, const AlarmStruct *alarm, int64_t utcSeconds)
+{
+    (void) context;
+    (void) alarm;
+    benchSink += (long) utcSeconds;
+} /* RingNothing() */
+
+static int SetupAlarm(int numClocks)
+{
+    int i;
+
+    benchInstant = 1700000000;
+    if (!FillRegistry(numClocks))
+        return(0);
+    AlarmWheelInit(&alarmWheel, benchInstant);
+    for (i = 0; i < numClocks; i++)
+    {
+        if (AlarmAddDaily(&alarmWheel, &registry, registry.handles[i], "bench",
+                          (int32_t) ((i * 7919L) % SECONDS_PER_DAY), ALARM_EVERY_DAY) == ALARM_HANDLE_NONE)
+            return(0);
+    } /* for i */
+    return(1);
+} /* SetupAlarm() */
+
+static void RunAlarm(int numClocks)
+{
+    (void) numClocks;
+    benchSink += AlarmAdvance(&alarmWheel, &registry, ++benchInstant, RingNothing, NULL);
+} /* RunAlarm() */
+
+static void TeardownAlarm(void)
+{
+    AlarmWheelFree(&alarmWheel);
+    FreeRegistry();
+} /* TeardownAlarm() */
+
+/* --- zone_search: a keystroke of the zone search per clock ---------------- */
+
+#define BENCH_MAX_KEYS 256
+
+static const char *const benchQueries[] = { "New York", "kolkata", "United States", "Sydney", "est",
+                                            "buenos aires", "Europe/", "ist", "Pacific/Auckland" };
+static char benchKeys[BENCH_MAX_KEYS][ZONE_INDEX_MAX_QUERY];
+static int benchKeyCount;
+
+/* every query as it is typed, a letter at a time */
+static int SetupZoneSearch(int numClocks)
+{
+    const char *name;
+    size_t q, length;
+    int zone;
+
+    (void) numClocks;
+    benchKeyCount = 0;
+    for (q = 0; q < sizeof(benchQueries) / sizeof(benchQueries[0]); q++)
+    {
+        for (length = 1; length <= strlen(benchQueries[q]) && benchKeyCount < BENCH_MAX_KEYS; length++)
+        {
+            memcpy(benchKeys[benchKeyCount], benchQueries[q], length);
+            benchKeys[benchKeyCount++][length] = '\0';
+        } /* for length */
+    } /* for q */
+    if (ZoneIndexSearch("new york", 1, &zone, 1) != 1)
+        return(0);
+    name = ZoneIndexName(zone);
+    return(name != NULL && strcmp(name, "America/New_York") == 0);
+} /* SetupZoneSearch() */
+
+static void RunZoneSearch(int numClocks)
+{
+    int zones[64];
+    long found = 0;
+    int i;
+
+    for (i = 0; i < numClocks; i++)
+        found += ZoneIndexSearch(benchKeys[i % benchKeyCount], 1, zones, 64);
+    benchSink += found;
+} /* RunZoneSearch() */
+
+/* --- clock_churn: delete, add and rename every clock ---------------------- */
+
+/* short labels stay inline, long ones are interned once, in the first pass */
+static const char *const churnLabels[] = { "Paris", "New York",
+    "Research Station Amundsen-Scott, South Pole", "Tokyo",
+    "Head Office, Level 3, Building Seven, Melbourne" };
+#define CHURN_LABELS (int) (sizeof(churnLabels) / sizeof(churnLabels[0]))
+
+static void RunChurn(int numClocks)
+{
+    int i;
+
+    for (i = 0; i < numClocks; i++)
+    {
+        ClockRegRemove(&registry, registry.handles[registry.count - 1 - i % 2]);
+        if (ClockRegAdd(&registry, churnLabels[i % CHURN_LABELS], (i % 24 - 11) * 3600, "") == CLOCK_HANDLE_NONE)
+            return;
+        ClockRegSetLabel(&registry, registry.count - 1, churnLabels[(i + 2) % CHURN_LABELS]);
+    } /* for i */
+    benchSink += registry.labelLayouts[0].width;
+} /* RunChurn() */
+
+static int SetupChurn(int numClocks)
+{
+    if (!FillRegistry(numClocks))
+        return(0);
+    RunChurn(numClocks);
+    return(registry.count == numClocks);
+} /* SetupChurn() */
+
+/* --- config: the keys worldclock.c saves and loads ------------------------ */
+
+static void StoreClocks(ConfigStruct *target, int numClocks)
+{
+    char key[32];
+    int i;
+
+    ConfigSetInt(target, "WindowData", "Layout", 1);
+    ConfigClearSection(target, "ClockData");
+    ConfigSetInt(target, "ClockData", "NumClocks", numClocks);
+    for (i = 0; i < numClocks; i++)
+    {
+        sprintf(key, "Clock%dName", i + 1);
+        ConfigSetString(target, "ClockData", key, ClockRegLabel(&registry, i));
+        sprintf(key, "Clock%dOffset", i + 1);
+        ConfigSetInt(target, "ClockData", key, registry.gmtOffsets[i] / 3600);
+        sprintf(key, "Clock%dZone", i + 1);
+        ConfigSetString(target, "ClockData", key, registry.zoneNames[i]);
+    } /* for i */
+} /* StoreClocks() */
+
+static int SetupSave(int numClocks)
+{
+    if (!FillRegistry(numClocks))
+        return(0);
+    ConfigInit(&config);
+    StoreClocks(&config, numClocks);
+    return(ConfigSave(&config, BENCH_INI_FILE));
+} /* SetupSave() */
+
+static void RunSave(int numClocks)
+{
+    StoreClocks(&config, numClocks);
+    benchSink += ConfigSave(&config, BENCH_INI_FILE);
+} /* RunSave() */
+
+static void TeardownSave(void)
+{
+    ConfigFree(&config);
+    FreeRegistry();
+    remove(BENCH_INI_FILE);
+} /* TeardownSave() */
+
+static int SetupLoad(int numClocks)
+{
+    return(SetupSave(numClocks));
+} /* SetupLoad() */
+
+static void RunLoad(int numClocks)
+{
+    ConfigStruct loaded;
+    char key[32];
+    int i, count;
+    long found = 0;
+
+    (void) numClocks;
+    ConfigInit(&loaded);
+    ConfigLoad(&loaded, BENCH_INI_FILE);
+    count = ConfigGetInt(&loaded, "ClockData", "NumClocks", 0);
+    for (i = 1; i <= count; i++)
+    {
+        sprintf(key, "Clock%dName", i);
+        if (ConfigGetString(&loaded, "ClockData", key, "")[0] == '\0')
+            break;
+        sprintf(key, "Clock%dOffset", i);
+        found += ConfigGetInt(&loaded, "ClockData", key, 24);
+        sprintf(key, "Clock%dZone", i);
+        found += ConfigGetString(&loaded, "ClockData", key, "")[0];
+    } /* for i */
+    ConfigFree(&loaded);
+    benchSink += found;
+} /* RunLoad() */
+
+static const BenchCaseStruct benchCases[] = {
+    { "atlas",        SetupAtlas,      RunAtlas,       TeardownNothing,    1, 0, 0 },
+    { "atlas_scaled", SetupAtlas,      RunAtlasScaled, TeardownNothing,    1, 0, 0 },
+    { "atlas_cache",  SetupAtlasCache, RunAtlasCache,  TeardownAtlasCache, 1, 0, 0 },
+    { "paint",        SetupPaint,      RunPaint,       TeardownPaint,      0, 0, 0 },
+    { "tick",         SetupTick,       RunTick,        FreeRegistry,       0, 0, 0 },
+    { "stats",        SetupTick,       RunStats,       FreeRegistry,       0, 0, 0 },
+    { "civil",        SetupCivil,      RunCivil,       TeardownCivil,      0, 0, 0 },
+    { "frame",        SetupFrame,      RunFrame,       TeardownFrame,      0, 1, 1000 },
+    { "frame_full",   SetupFrame,      RunFrameFull,   TeardownFrame,      0, 1, 1000 },
+    { "layout",       SetupLayout,     RunLayout,      TeardownNothing,    0, 0, 0 },
+    { "alarm",        SetupAlarm,      RunAlarm,       TeardownAlarm,      0, 0, 0 },
+    { "zone_search",  SetupZoneSearch, RunZoneSearch,  TeardownNothing,    0, 0, 0 },
+    { "clock_churn",  SetupChurn,      RunChurn,       FreeRegistry,       0, 0, 0 },
+    { "config_save",  SetupSave,       RunSave,        TeardownSave,       0, 0, 0 },
+    { "config_load",  SetupLoad,       RunLoad,        TeardownSave,       0, 0, 0 }
+};
+
+static int CompareDoubles(const void *a, const void *b)
+{
+    double x = *(const double *) a, y = *(const double *) b;
+
+    return((x > y) - (x < y));
+} /* CompareDoubles() */
+
+/* nearest-rank percentile of sorted values */
+static double Percentile(const double *sorted, int count, int percent)
+{
+    int rank = (percent * count + 99) / 100;
+
+    if (rank < 1)
+        rank = 1;
+    return(sorted[rank - 1]);
+} /* Percentile() */
+
+/******************************************************************************/
+/* RunCase -- calibrate the operations per sample, warm up, then time the     */
+/* samples.  Returns 0 if setup failed.                                       */
+/******************************************************************************/
+static int RunCase(const BenchCaseStruct *benchCase, int numClocks, int samples, BenchResultStruct *result)
+{
+    static double perOp[BENCH_MAX_SAMPLES];
+    int64_t start, elapsed;
+    long ops, op;
+    int sample;
+    double total = 0;
+#ifdef BENCH_COUNT_ALLOCS
+    unsigned long long allocsBefore, bytesBefore;
+#endif
+
+    if (!benchCase->setup(numClocks))
+    {
+        benchCase->teardown();
+        return(0);
+    }
+
+    /* one untimed warm-up, then size the samples */
+    benchCase->run(numClocks);
+    start = NowNs();
+    benchCase->run(numClocks);
+    elapsed = NowNs() - start;
+    ops = elapsed > 0 ? (long) (BENCH_SAMPLE_NS / elapsed) : 1000;
+    if (ops < 1)
+        ops = 1;
+
+#ifdef BENCH_COUNT_ALLOCS
+    allocsBefore = allocCount;
+    bytesBefore = allocBytes;
+#endif
+    for (sample = 0; sample < samples; sample++)
+    {
+        start = NowNs();
+        for (op = 0; op < ops; op++)
+            benchCase->run(numClocks);
+        perOp[sample] = (double) (NowNs() - start) / ops;
+        total += perOp[sample];
+    } /* for sample */
+#ifdef BENCH_COUNT_ALLOCS
+    result->allocsPerOp = (double) (allocCount - allocsBefore) / ((double) ops * samples);
+    result->bytesPerOp = (double) (allocBytes - bytesBefore) / ((double) ops * samples);
+#else
+    result->allocsPerOp = result->bytesPerOp = -1;
+#endif
+    benchCase->teardown();
+
+    qsort(perOp, samples, sizeof(double), CompareDoubles);
+    result->samples = samples;
+    result->opsPerSample = ops;
+    result->mean = total / samples;
+    result->min = perOp[0];
+    result->p50 = Percentile(perOp, samples, 50);
+    result->p90 = Percentile(perOp, samples, 90);
+    result->p99 = Percentile(perOp, samples, 99);
+    result->max = perOp[samples - 1];
+    return(1);
+} /* RunCase() */
+
+static void PrintResult(const BenchCaseStruct *benchCase, int numClocks, const BenchResultStruct *result,
+                        int json, int first)
+{
+    if (!json)
+    {
+        printf("%-12s %6d %7d %12.1f %12.1f %12.1f %12.1f %10.2f\n", benchCase->name, numClocks, benchThreads,
+               result->p50, result->p90, result->p99, result->p50 / numClocks, result->allocsPerOp);
+        return;
+    }
+    printf("%s\n    {\"name\": \"%s\", \"clocks\": %d, \"threads\": %d, \"samples\": %d, \"ops_per_sample\": %ld,\n"
+           "     \"ns_per_op\": {\"mean\": %.1f, \"min\": %.1f, \"p50\": %.1f, \"p90\": %.1f, \"p99\": %.1f, \"max\": %.1f},\n"
+           "     \"ns_per_clock_p50\": %.2f, ",
+           first ? "" : ",", benchCase->name, numClocks, benchThreads, result->samples, result->opsPerSample,
+           result->mean, result->min, result->p50, result->p90, result->p99, result->max,
+           result->p50 / numClocks);
+    if (result->allocsPerOp < 0)
+        printf("\"allocs_per_op\": null, \"bytes_per_op\": null}");
+    else
+        printf("\"allocs_per_op\": %.2f, \"bytes_per_op\": %.1f}", result->allocsPerOp, result->bytesPerOp);
+} /* PrintResult() */
+
+static int Usage(void)
+{
+    fprintf(stderr, "usage: wcbench [-n clocks] [-r samples] [-b name] [-f json|text] [-t max]\n");
+    return(2);
+} /* Usage() */
+
+int main(int argc, char *argv[])
+{
+    static const int defaultCounts[] = { 1, 10, 100, 1000, 10000 };
+    int counts[5], numCounts = 5;
+    int samples = 31, json = 1, first = 1, failed = 0;
+    int maxThreads = PoolCpuCount(), numClocks;
+    const char *only = NULL;
+    BenchResultStruct result;
+    size_t c;
+    int i;
+
+    memcpy(counts, defaultCounts, sizeof(counts));
+    for (i = 1; i < argc; i++)
+    {
+        if (i + 1 >= argc || argv[i][0] != '-')
+            return(Usage());
+        switch (argv[i][1])
+        {
+            case 'n':
+                counts[0] = atoi(argv[++i]);
+                numCounts = 1;
+                if (counts[0] <= 0)
+                    return(Usage());
+                break;
+            case 'r':
+                samples = atoi(argv[++i]);
+                if (samples < 1 || samples > BENCH_MAX_SAMPLES)
+                    return(Usage());
+                break;
+            case 'b':
+                only = argv[++i];
+                break;
+            case 't':
+                maxThreads = atoi(argv[++i]);
+                if (maxThreads < 1 || maxThreads > POOL_MAX_THREADS)
+                    return(Usage());
+                break;
+            case 'f':
+                i++;
+                if (strcmp(argv[i], "json") == 0)
+                    json = 1;
+                else if (strcmp(argv[i], "text") == 0)
+                    json = 0;
+                else
+                    return(Usage());
+                break;
+            default:
+                return(Usage());
+        } /* switch option */
+    } /* for i */
+
+    if (json)
+        printf("{\"tool\": \"wcbench\", \"alloc_counting\": %s, \"results\": [",
+#ifdef BENCH_COUNT_ALLOCS
+               "true"
+#else
+               "false"
+#endif
+               );
+    else
+        printf("%-12s %6s %7s %12s %12s %12s %12s %10s\n", "benchmark", "clocks", "threads",
+               "p50 ns/op", "p90 ns/op", "p99 ns/op", "ns/clock", "allocs/op");
+
+    for (c = 0; c < sizeof(benchCases) / sizeof(benchCases[0]); c++)
+    {
+        if (only != NULL && strcmp(only, benchCases[c].name) != 0)
+            continue;
+        for (i = 0; i < (benchCases[c].fixedSize ? 1 : numCounts); i++)
+        {
+            numClocks = benchCases[c].fixedSize ? 1 : counts[i];
+            if (benchCases[c].maxClocks != 0 && numClocks > benchCases[c].maxClocks)
+                continue;
+            /* 1, 2, 4, ... threads and the most, or only 1 */
+            for (benchThreads = 1; benchThreads <= (benchCases[c].scaling ? maxThreads : 1);
+                 benchThreads = (benchThreads < maxThreads && benchThreads * 2 > maxThreads) ? maxThreads : benchThreads * 2)
+            {
+                if (!RunCase(&benchCases[c], numClocks, samples, &result))
+                {
+                    fprintf(stderr, "wcbench: %s setup failed at %d clocks\n", benchCases[c].name, numClocks);
+                    failed = 1;
+                    continue;
+                }
+                PrintResult(&benchCases[c], numClocks, &result, json, first);
+                first = 0;
+                fflush(stdout);
+            } /* for benchThreads */
+        } /* for i */
+    } /* for c */
+    if (json)
+        printf("\n]}\n");
+    TzFreeAllZones();
+    return(failed);
+} /* main() */
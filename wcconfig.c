@@ -0,0 +1,483 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcconfig.c -- in-memory model of WorldClock.ini                          */
+/*                                                                            */
+/* GetPrivateProfileString() and friends open and parse the whole file on     */
+/* every call, so loading and saving N clocks cost O(N^2) I/O and a crash     */
+/* mid-save left a half-written file.  The file is now read once into a      */
+/* ConfigStruct, and saved by writing a temporary file in one go and          */
+/* renaming it over the old one.                                              */
+/******************************************************************************/
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wcconfig.h"
+
+#ifdef _WIN32
+#define CONFIG_NEWLINE "\r\n"
+#else
+#define CONFIG_NEWLINE "\n"
+#endif
+
+#define CONFIG_BLOCK_SIZE 16384
+
+void ConfigInit(ConfigStruct *config)
+{
+    memset(config, 0, sizeof(ConfigStruct));
+} /* ConfigInit() */
+
+void ConfigFree(ConfigStruct *config)
+{
+    ConfigBlockStruct *block, *next;
+
+    for (block = config->blocks; block != NULL; block = next)
+    {
+        next = block->next;
+        free(block);
+    } /* for block */
+    free(config->sections);
+    free(config->entries);
+    free(config->hashSlots);
+    memset(config, 0, sizeof(ConfigStruct));
+} /* ConfigFree() */
+
+/******************************************************************************/
+/* ConfigAlloc -- carve size bytes from the newest block, or start a block.   */
+/******************************************************************************/
+static char *ConfigAlloc(ConfigStruct *config, size_t size)
+{
+    ConfigBlockStruct *block = config->blocks;
+    size_t blockSize;
+
+    if (block == NULL || block->size - block->used < size)
+    {
+        blockSize = size > CONFIG_BLOCK_SIZE ? size : CONFIG_BLOCK_SIZE;
+        block = (ConfigBlockStruct *) malloc(sizeof(ConfigBlockStruct) + blockSize);
+        if (block == NULL)
+            return(NULL);
+        block->text = (char *) (block + 1);
+        block->used = 0;
+        block->size = blockSize;
+        block->next = config->blocks;
+        config->blocks = block;
+    }
+    block->used += size;
+    return(block->text + block->used - size);
+} /* ConfigAlloc() */
+
+static const char *ConfigDup(ConfigStruct *config, const char *text)
+{
+    size_t size = strlen(text) + 1;
+    char *copy = ConfigAlloc(config, size);
+
+    if (copy != NULL)
+        memcpy(copy, text, size);
+    return(copy);
+} /* ConfigDup() */
+
+static unsigned int ConfigHash(const char *section, const char *key)
+{
+    unsigned int hash = 2166136261u;      /* FNV-1a over "section\0key" */
+
+    for (; *section != '\0'; section++)
+        hash = (hash ^ (unsigned char) tolower((unsigned char) *section)) * 16777619u;
+    hash = (hash ^ 0) * 16777619u;
+    for (; *key != '\0'; key++)
+        hash = (hash ^ (unsigned char) tolower((unsigned char) *key)) * 16777619u;
+    return(hash);
+} /* ConfigHash() */
+
+static int ConfigSame(const char *a, const char *b)
+{
+    for (; *a != '\0' && *b != '\0'; a++, b++)
+    {
+        if (tolower((unsigned char) *a) != tolower((unsigned char) *b))
+            return(0);
+    } /* for a, b */
+    return(*a == *b);
+} /* ConfigSame() */
+
+static int ConfigFindSection(const ConfigStruct *config, const char *section)
+{
+    int i;
+
+    for (i = 0; i < config->sectionCount; i++)
+    {
+        if (ConfigSame(config->sections[i].name, section))
+            return(i);
+    } /* for i */
+    return(-1);
+} /* ConfigFindSection() */
+
+static int ConfigAddSection(ConfigStruct *config, const char *name)
+{
+    ConfigSectionStruct *grown;
+    int capacity;
+
+    if (config->sectionCount == config->sectionCapacity)
+    {
+        capacity = config->sectionCapacity ? config->sectionCapacity * 2 : 8;
+        grown = (ConfigSectionStruct *) realloc(config->sections, sizeof(ConfigSectionStruct) * capacity);
+        if (grown == NULL)
+            return(-1);
+        config->sections = grown;
+        config->sectionCapacity = capacity;
+    }
+    config->sections[config->sectionCount].name = name;
+    config->sections[config->sectionCount].first = -1;
+    config->sections[config->sectionCount].last = -1;
+    return(config->sectionCount++);
+} /* ConfigAddSection() */
+
+/* the hash slot holding section/key, or the empty slot where it belongs */
+static int ConfigSlot(const ConfigStruct *config, int section, const char *key)
+{
+    unsigned int mask = (unsigned int) config->hashCapacity - 1;
+    unsigned int slot = ConfigHash(config->sections[section].name, key) & mask;
+    const ConfigEntryStruct *entry;
+
+    while (config->hashSlots[slot] >= 0)
+    {
+        entry = &config->entries[config->hashSlots[slot]];
+        if (entry->section == section && ConfigSame(entry->key, key))
+            break;
+        slot = (slot + 1) & mask;
+    } /* while */
+    return((int) slot);
+} /* ConfigSlot() */
+
+static int ConfigGrowHash(ConfigStruct *config)
+{
+    int *oldSlots = config->hashSlots;
+    int oldCapacity = config->hashCapacity;
+    int capacity = oldCapacity ? oldCapacity * 2 : 64;
+    int i;
+
+    config->hashSlots = (int *) malloc(sizeof(int) * capacity);
+    if (config->hashSlots == NULL)
+    {
+        config->hashSlots = oldSlots;
+        return(0);
+    }
+    config->hashCapacity = capacity;
+    for (i = 0; i < capacity; i++)
+        config->hashSlots[i] = -1;
+    for (i = 0; i < oldCapacity; i++)
+    {
+        if (oldSlots[i] >= 0)
+            config->hashSlots[ConfigSlot(config, config->entries[oldSlots[i]].section,
+                                         config->entries[oldSlots[i]].key)] = oldSlots[i];
+    } /* for i */
+    free(oldSlots);
+    return(1);
+} /* ConfigGrowHash() */
+
+/******************************************************************************/
+/* ConfigPut -- set section/key; key and value must already be owned by the   */
+/* config.  The first value read wins, as with GetPrivateProfileString(), so  */
+/* the parser passes replace = 0.                                             */
+/******************************************************************************/
+static int ConfigPut(ConfigStruct *config, int section, const char *key, const char *value, int replace)
+{
+    ConfigEntryStruct *grown, *entry;
+    int slot, capacity;
+
+    if (config->entryCount * 2 >= config->hashCapacity && !ConfigGrowHash(config))
+        return(0);
+    slot = ConfigSlot(config, section, key);
+    if (config->hashSlots[slot] >= 0)
+    {
+        entry = &config->entries[config->hashSlots[slot]];
+        if (replace || entry->removed)
+            entry->value = value;
+        entry->removed = 0;
+        return(1);
+    }
+
+    if (config->entryCount == config->entryCapacity)
+    {
+        capacity = config->entryCapacity ? config->entryCapacity * 2 : 64;
+        grown = (ConfigEntryStruct *) realloc(config->entries, sizeof(ConfigEntryStruct) * capacity);
+        if (grown == NULL)
+            return(0);
+        config->entries = grown;
+        config->entryCapacity = capacity;
+    }
+    entry = &config->entries[config->entryCount];
+    entry->section = section;
+    entry->next = -1;
+    entry->key = key;
+    entry->value = value;
+    entry->removed = 0;
+    if (config->sections[section].last >= 0)
+        config->entries[config->sections[section].last].next = config->entryCount;
+    else
+        config->sections[section].first = config->entryCount;
+    config->sections[section].last = config->entryCount;
+    config->hashSlots[slot] = config->entryCount++;
+    return(1);
+} /* ConfigPut() */
+
+static char *Trim(char *start, char *end)
+{
+    while (start < end && isspace((unsigned char) *start))
+        start++;
+    while (end > start && isspace((unsigned char) end[-1]))
+        end--;
+    *end = '\0';
+    return(start);
+} /* Trim() */
+
+/******************************************************************************/
+/* ConfigParse -- add the sections and keys of INI text to config.            */
+/* Lines before the first section, comments and lines without '=' are         */
+/* skipped.  Returns nonzero on success.                                      */
+/******************************************************************************/
+int ConfigParse(ConfigStruct *config, const char *text, size_t size)
+{
+    char *copy, *line, *lineEnd, *end, *equals, *key, *value;
+    int section = -1;
+
+    /* parse a private copy in place; its pieces become the strings */
+    copy = ConfigAlloc(config, size + 1);
+    if (copy == NULL)
+        return(0);
+    memcpy(copy, text, size);
+    copy[size] = '\0';
+    end = copy + size;
+
+    for (line = copy; line < end; line = lineEnd + 1)
+    {
+        lineEnd = memchr(line, '\n', (size_t) (end - line));
+        if (lineEnd == NULL)
+            lineEnd = end;
+        line = Trim(line, lineEnd);
+        if (*line == '\0' || *line == ';' || *line == '#')
+            continue;
+
+        if (*line == '[')
+        {
+            value = strchr(line, ']');
+            if (value == NULL)
+                continue;
+            *value = '\0';
+            line = Trim(line + 1, value);
+            section = ConfigFindSection(config, line);
+            if (section < 0)
+                section = ConfigAddSection(config, line);
+            if (section < 0)
+                return(0);
+            continue;
+        }
+
+        equals = strchr(line, '=');
+        if (equals == NULL || section < 0)
+            continue;
+        key = Trim(line, equals);
+        value = Trim(equals + 1, equals + 1 + strlen(equals + 1));
+        if (value[0] == '"' && strlen(value) >= 2 && value[strlen(value) - 1] == '"')
+        {
+            value[strlen(value) - 1] = '\0';
+            value++;
+        }
+        if (*key != '\0' && !ConfigPut(config, section, key, value, 0))
+            return(0);
+    } /* for line */
+    return(1);
+} /* ConfigParse() */
+
+/******************************************************************************/
+/* ConfigLoad -- read a whole file with one read.  Returns 0 if it is absent  */
+/* or unreadable, leaving config as it was.                                   */
+/******************************************************************************/
+int ConfigLoad(ConfigStruct *config, const char *path)
+{
+    FILE *file;
+    char *text;
+    long size;
+    int result = 0;
+
+    file = fopen(path, "rb");
+    if (file == NULL)
+        return(0);
+    if (fseek(file, 0, SEEK_END) == 0 && (size = ftell(file)) >= 0 && fseek(file, 0, SEEK_SET) == 0)
+    {
+        text = (char *) malloc((size_t) size + 1);
+        if (text != NULL)
+        {
+            if (fread(text, 1, (size_t) size, file) == (size_t) size)
+                result = ConfigParse(config, text, (size_t) size);
+            free(text);
+        }
+    }
+    fclose(file);
+    return(result);
+} /* ConfigLoad() */
+
+/******************************************************************************/
+/* ConfigSave -- serialize into one buffer, write it to path.tmp, flush it to */
+/* disk and rename it over path, so readers see the old file or the new one.  */
+/* Returns nonzero on success.                                                */
+/******************************************************************************/
+int ConfigSave(const ConfigStruct *config, const char *path)
+{
+    char tempPath[512];
+    char *text, *out;
+    size_t size = 0;
+    int i, e, ok;
+    FILE *file;
+    const ConfigEntryStruct *entry;
+
+    if (snprintf(tempPath, sizeof(tempPath), "%s.tmp", path) >= (int) sizeof(tempPath))
+        return(0);
+
+    /* "[name]\n" and "key=value\n", with room for a blank line per section */
+    for (i = 0; i < config->sectionCount; i++)
+        size += strlen(config->sections[i].name) + 2 * sizeof(CONFIG_NEWLINE) + 2;
+    for (e = 0; e < config->entryCount; e++)
+    {
+        if (!config->entries[e].removed)
+            size += strlen(config->entries[e].key) + strlen(config->entries[e].value) + sizeof(CONFIG_NEWLINE);
+    } /* for e */
+    text = (char *) malloc(size + 1);
+    if (text == NULL)
+        return(0);
+
+    out = text;
+    for (i = 0; i < config->sectionCount; i++)
+    {
+        if (i > 0)
+            out += sprintf(out, CONFIG_NEWLINE);
+        out += sprintf(out, "[%s]" CONFIG_NEWLINE, config->sections[i].name);
+        for (e = config->sections[i].first; e >= 0; e = entry->next)
+        {
+            entry = &config->entries[e];
+            if (!entry->removed)
+                out += sprintf(out, "%s=%s" CONFIG_NEWLINE, entry->key, entry->value);
+        } /* for e */
+    } /* for i */
+
+    file = fopen(tempPath, "wb");
+    if (file == NULL)
+    {
+        free(text);
+        return(0);
+    }
+    ok = fwrite(text, 1, (size_t) (out - text), file) == (size_t) (out - text) && fflush(file) == 0;
+#ifdef _WIN32
+    ok = ok && _commit(_fileno(file)) == 0;
+#else
+    ok = ok && fsync(fileno(file)) == 0;
+#endif
+    ok = (fclose(file) == 0) && ok;
+    free(text);
+
+#ifdef _WIN32
+    ok = ok && MoveFileExA(tempPath, path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+#else
+    ok = ok && rename(tempPath, path) == 0;
+#endif
+    if (!ok)
+        remove(tempPath);
+    return(ok);
+} /* ConfigSave() */
+
+const char *ConfigGetString(const ConfigStruct *config, const char *section, const char *key, const char *defaultValue)
+{
+    int sectionIndex, slot;
+    const ConfigEntryStruct *entry;
+
+    sectionIndex = ConfigFindSection(config, section);
+    if (sectionIndex < 0 || config->hashCapacity == 0)
+        return(defaultValue);
+    slot = ConfigSlot(config, sectionIndex, key);
+    if (config->hashSlots[slot] < 0)
+        return(defaultValue);
+    entry = &config->entries[config->hashSlots[slot]];
+    return(entry->removed ? defaultValue : entry->value);
+} /* ConfigGetString() */
+
+/* like GetPrivateProfileInt(), but a value that is not a number gives the default */
+int ConfigGetInt(const ConfigStruct *config, const char *section, const char *key, int defaultValue)
+{
+    const char *value = ConfigGetString(config, section, key, NULL);
+    char *end;
+    long number;
+
+    if (value == NULL)
+        return(defaultValue);
+    number = strtol(value, &end, 10);
+    if (end == value)
+        return(defaultValue);
+    return((int) number);
+} /* ConfigGetInt() */
+
+int ConfigSetString(ConfigStruct *config, const char *section, const char *key, const char *value)
+{
+    int sectionIndex, slot;
+    const char *owned;
+    ConfigEntryStruct *entry;
+
+    sectionIndex = ConfigFindSection(config, section);
+    if (sectionIndex < 0)
+    {
+        owned = ConfigDup(config, section);
+        if (owned == NULL || (sectionIndex = ConfigAddSection(config, owned)) < 0)
+            return(0);
+    }
+    if (config->hashCapacity > 0)
+    {
+        slot = ConfigSlot(config, sectionIndex, key);
+        if (config->hashSlots[slot] >= 0)
+        {
+            /* unchanged values cost nothing, the common case on save */
+            entry = &config->entries[config->hashSlots[slot]];
+            if (strcmp(entry->value, value) != 0)
+            {
+                value = ConfigDup(config, value);
+                if (value == NULL)
+                    return(0);
+                entry->value = value;
+            }
+            entry->removed = 0;
+            return(1);
+        }
+    }
+    key = ConfigDup(config, key);
+    value = ConfigDup(config, value);
+    if (key == NULL || value == NULL)
+        return(0);
+    return(ConfigPut(config, sectionIndex, key, value, 1));
+} /* ConfigSetString() */
+
+int ConfigSetInt(ConfigStruct *config, const char *section, const char *key, int value)
+{
+    char text[16];
+
+    sprintf(text, "%d", value);
+    return(ConfigSetString(config, section, key, text));
+} /* ConfigSetInt() */
+
+/******************************************************************************/
+/* ConfigClearSection -- drop every key of a section, e.g. before writing a   */
+/* shorter clock list.  Keys set again afterwards keep their old position.    */
+/******************************************************************************/
+void ConfigClearSection(ConfigStruct *config, const char *section)
+{
+    int sectionIndex, e;
+
+    sectionIndex = ConfigFindSection(config, section);
+    if (sectionIndex < 0)
+        return;
+    for (e = config->sections[sectionIndex].first; e >= 0; e = config->entries[e].next)
+        config->entries[e].removed = 1;
+} /* ConfigClearSection() */
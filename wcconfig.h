@@ -0,0 +1,62 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcconfig.h -- in-memory model of WorldClock.ini                          */
+/******************************************************************************/
+
+#ifndef WCCONFIG_H
+#define WCCONFIG_H
+
+#include <stddef.h>
+
+/* strings live in large blocks that are freed together */
+typedef struct ConfigBlockStructTag {
+    struct ConfigBlockStructTag *next;
+    size_t used;
+    size_t size;
+    char *text;
+} ConfigBlockStruct;
+
+typedef struct ConfigEntryStructTag {
+    int section;
+    int next;                   /* next entry of the same section, -1 ends */
+    const char *key;
+    const char *value;
+    int removed;                /* ConfigClearSection() hides it until set again */
+} ConfigEntryStruct;
+
+typedef struct ConfigSectionStructTag {
+    const char *name;
+    int first;
+    int last;
+} ConfigSectionStruct;
+
+/******************************************************************************/
+/* Sections and keys keep the order they were read or added in, and match     */
+/* case-insensitively the way GetPrivateProfileString() does.  Lookups go     */
+/* through one hash table keyed by section and key.                           */
+/******************************************************************************/
+typedef struct ConfigStructTag {
+    ConfigSectionStruct *sections;
+    int sectionCount;
+    int sectionCapacity;
+    ConfigEntryStruct *entries;
+    int entryCount;
+    int entryCapacity;
+    int *hashSlots;             /* entry index, -1 when empty */
+    int hashCapacity;
+    ConfigBlockStruct *blocks;
+} ConfigStruct;
+
+void ConfigInit(ConfigStruct *config);
+void ConfigFree(ConfigStruct *config);
+int  ConfigParse(ConfigStruct *config, const char *text, size_t size);
+int  ConfigLoad(ConfigStruct *config, const char *path);
+int  ConfigSave(const ConfigStruct *config, const char *path);
+
+const char *ConfigGetString(const ConfigStruct *config, const char *section, const char *key, const char *defaultValue);
+int  ConfigGetInt(const ConfigStruct *config, const char *section, const char *key, int defaultValue);
+int  ConfigSetString(ConfigStruct *config, const char *section, const char *key, const char *value);
+int  ConfigSetInt(ConfigStruct *config, const char *section, const char *key, int value);
+void ConfigClearSection(ConfigStruct *config, const char *section);
+
+#endif /* WCCONFIG_H */
@@ -0,0 +1,271 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcframe.c -- whole-surface frames handed from a render thread to the UI  */
+/*                                                                            */
+/* The render thread brings a frame up to the tick: clock times, segment      */
+/* masks and the changed digits of every tile.  A frame slot is reused two    */
+/* publishes later, so each slot keeps the masks it was drawn with and is     */
+/* brought up to date from those, not from the frame just before it.  The     */
+/* hand-off itself is one atomic exchange on each side.                       */
+/******************************************************************************/
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+#include <stdlib.h>
+#include <string.h>
+#include "wcframe.h"
+
+#ifdef _WIN32
+#define FrameSwap(target, value) InterlockedExchange((target), (value))
+#define FrameLoad(target)        InterlockedCompareExchange((target), 0, 0)
+#else
+#define FrameSwap(target, value) __atomic_exchange_n((target), (value), __ATOMIC_ACQ_REL)
+#define FrameLoad(target)        __atomic_load_n((target), __ATOMIC_ACQUIRE)
+#endif
+
+void FrameInit(FrameStruct *frame)
+{
+    memset(frame, 0, sizeof(FrameStruct));
+} /* FrameInit() */
+
+void FrameFree(FrameStruct *frame)
+{
+    SegFrameBufferFree(&frame->surface);
+    free(frame->masks);
+    FrameInit(frame);
+} /* FrameFree() */
+
+/* the part of fb one tile covers, as a buffer of its own; 0 if it is outside */
+static int TileView(const FrameBufferStruct *fb, const ClockLayoutStruct *layout, int index,
+                    FrameBufferStruct *view)
+{
+    LayoutRectStruct tile;
+
+    LayoutTileRect(layout, index, &tile);
+    if (tile.right > fb->width)
+        tile.right = fb->width;
+    if (tile.bottom > fb->height)
+        tile.bottom = fb->height;
+    if (tile.left < 0 || tile.top < 0 || tile.left >= tile.right || tile.top >= tile.bottom)
+        return(0);
+    view->pixels = fb->pixels + (size_t) tile.top * fb->stride + tile.left;
+    view->width = tile.right - tile.left;
+    view->height = tile.bottom - tile.top;
+    view->stride = fb->stride;
+    return(1);
+} /* TileView() */
+
+/******************************************************************************/
+/* FrameDrawTile -- frame, background, face and label of one clock, as        */
+/* ComposeTile() draws them with GDI, but with the label the registry drew   */
+/* in the bitmap font.  The label stays the font's size at any scale,         */
+/* centred under the face.  Nothing is drawn outside the tile, and the label  */
+/* not outside its frame, so tiles can be drawn in any order or at once.      */
+/******************************************************************************/
+void FrameDrawTile(FrameBufferStruct *fb, const ClockRegistryStruct *reg, const ClockLayoutStruct *layout,
+                   const GlyphAtlasStruct *atlas, int index, uint64_t mask)
+{
+    FrameBufferStruct view, inside, band;
+    int x = LAYOUT_TILE_BORDER, y = LAYOUT_TILE_BORDER;
+
+    if (!TileView(fb, layout, index, &view))
+        return;
+    SegFillRect(&view, 0, 0, view.width, view.height, 0);
+    SegFillRect(&view, x, y, view.width - LAYOUT_TILE_BORDER, view.height - LAYOUT_TILE_BORDER,
+                reg->themes[index].backColor);
+    SegRenderFaceMask(atlas, &view, x, y, mask);
+
+    inside.pixels = view.pixels + (size_t) y * view.stride + x;
+    inside.width = view.width - 2 * LAYOUT_TILE_BORDER;
+    inside.height = view.height - 2 * LAYOUT_TILE_BORDER;
+    inside.stride = view.stride;
+    ClockRegLabelBand(reg, index, &band);
+    SegBlitPixels(&inside, (layout->tileWidth - band.width) / 2,
+                  atlas->faceHeight + CLOCK_LABEL_TOP - SEG_FACE_HEIGHT, &band);
+} /* FrameDrawTile() */
+
+static void UnionRect(LayoutRectStruct *area, int left, int top, int right, int bottom)
+{
+    if (left < area->left)
+        area->left = left;
+    if (top < area->top)
+        area->top = top;
+    if (right > area->right)
+        area->right = right;
+    if (bottom > area->bottom)
+        area->bottom = bottom;
+} /* UnionRect() */
+
+/* add the digit slots in dirty, and the colons right of them, to area */
+static void UnionDigits(LayoutRectStruct *area, const GlyphAtlasStruct *atlas, int x, int y, unsigned int dirty)
+{
+    int first = 0, last = SEG_FACE_DIGITS - 1;
+
+    while (!(dirty & (1u << first)))
+        first++;
+    while (!(dirty & (1u << last)))
+        last--;
+    UnionRect(area, x + SegDigitSlotX(atlas, first), y + atlas->glyphTop,
+              x + SegDigitSlotX(atlas, last) + atlas->digitWidth +
+                  ((last & 1) && last < SEG_FACE_DIGITS - 1 ? atlas->colonWidth : 0),
+              y + atlas->glyphTop + atlas->glyphHeight);
+} /* UnionDigits() */
+
+/* what DrawTiles() needs of FrameRender() */
+typedef struct TileJobStructTag {
+    FrameStruct *frame;
+    const ClockRegistryStruct *reg;
+    const ClockLayoutStruct *layout;
+    const GlyphAtlasStruct *atlas;
+} TileJobStruct;
+
+/* pool job: bring tiles [first, last) of the frame up to the ticked registry */
+static void DrawTiles(void *context, int first, int last)
+{
+    const TileJobStruct *job = (const TileJobStruct *) context;
+    FrameStruct *frame = job->frame;
+    FrameBufferStruct view;
+    uint64_t shown;
+    unsigned int digits;
+    int i, clock;
+
+    for (i = first; i < last; i++)
+    {
+        clock = job->layout->first + i;
+        shown = job->reg->shownMasks[clock];
+        if (frame->masks[i] == SEG_MASK_INVALID)
+            FrameDrawTile(&frame->surface, job->reg, job->layout, job->atlas, clock, shown);
+        else
+        {
+            digits = SegDirtyDigits(frame->masks[i], shown);
+            if (digits != 0 && TileView(&frame->surface, job->layout, clock, &view))
+                SegRenderFaceDigits(job->atlas, &view, LAYOUT_TILE_BORDER, LAYOUT_TILE_BORDER, shown, digits);
+        }
+        frame->masks[i] = shown;
+    } /* for i */
+} /* DrawTiles() */
+
+/******************************************************************************/
+/* FrameRender -- bring the clocks the layout shows up to the tick and frame  */
+/* up to date with them; the others are neither ticked nor drawn.  version    */
+/* names the clock settings; when it differs from the frame's, or the view    */
+/* has moved, every tile is redrawn.  The tiles are drawn on pool, or on the  */
+/* calling thread when it is NULL, with the same result.  Ticks the           */
+/* registry, so the caller must keep other threads from changing it           */
+/* meanwhile.  Returns 0 when out of memory.                                  */
+/******************************************************************************/
+int FrameRender(FrameStruct *frame, ClockRegistryStruct *reg, const ClockLayoutStruct *layout,
+                const GlyphAtlasStruct *atlas, const TickSnapshotStruct *tick, uint32_t version,
+                PoolStruct *pool)
+{
+    LayoutRectStruct tile, changed;
+    TileJobStruct job;
+    uint64_t *masks;
+    int count = (reg->count - layout->first < layout->count) ? reg->count - layout->first : layout->count;
+    int redraw = (frame->version != version || frame->first != layout->first), i;
+
+    if (frame->surface.width != layout->width || frame->surface.height != layout->height)
+    {
+        SegFrameBufferFree(&frame->surface);
+        if (layout->width > 0 && layout->height > 0 &&
+            !SegFrameBufferInit(&frame->surface, layout->width, layout->height))
+            return(0);
+        redraw = 1;
+    }
+    if (count < 0)
+        count = 0;
+    if (count > frame->maskCapacity)
+    {
+        masks = (uint64_t *) realloc(frame->masks, count * sizeof(uint64_t));
+        if (masks == NULL)
+            return(0);
+        frame->masks = masks;
+        frame->maskCapacity = count;
+        redraw = 1;
+    }
+
+    changed.left = layout->width;
+    changed.top = layout->height;
+    changed.right = changed.bottom = 0;
+    if (redraw)
+    {
+        SegFillRect(&frame->surface, 0, 0, frame->surface.width, frame->surface.height, 0);
+        for (i = 0; i < count; i++)
+            frame->masks[i] = SEG_MASK_INVALID;
+        frame->version = version;
+        frame->first = layout->first;
+        UnionRect(&changed, 0, 0, layout->width, layout->height);
+    }
+
+    ClockRegTickRange(reg, layout->first, count, tick);
+    job.frame = frame;
+    job.reg = reg;
+    job.layout = layout;
+    job.atlas = atlas;
+    PoolFor(pool, count, FRAME_TILE_GRAIN, DrawTiles, &job);
+
+    /* against the frame published before this one, which the registry last ticked */
+    for (i = layout->first; i < layout->first + count; i++)
+    {
+        if (reg->dirtyDigits[i] == 0)
+            continue;
+        LayoutTileRect(layout, i, &tile);
+        if (reg->dirtyDigits[i] == CLOCK_DIRTY_ALL)
+            UnionRect(&changed, tile.left, tile.top, tile.right, tile.bottom);
+        else
+            UnionDigits(&changed, atlas, tile.left + LAYOUT_TILE_BORDER, tile.top + LAYOUT_TILE_BORDER,
+                        reg->dirtyDigits[i]);
+    } /* for i */
+    frame->utcSeconds = tick->utcSeconds;
+    frame->changed = changed;
+    return(1);
+} /* FrameRender() */
+
+void FrameExchangeInit(FrameExchangeStruct *exchange)
+{
+    int i;
+
+    for (i = 0; i < FRAME_SLOTS; i++)
+        FrameInit(&exchange->frames[i]);
+    exchange->back = 0;
+    exchange->middle = 1;
+    exchange->front = 2;
+    exchange->published = 0;
+} /* FrameExchangeInit() */
+
+/* only once neither thread uses the exchange any more */
+void FrameExchangeFree(FrameExchangeStruct *exchange)
+{
+    int i;
+
+    for (i = 0; i < FRAME_SLOTS; i++)
+        FrameFree(&exchange->frames[i]);
+} /* FrameExchangeFree() */
+
+/* producer: the frame to draw next */
+FrameStruct *FrameBack(FrameExchangeStruct *exchange)
+{
+    return(&exchange->frames[exchange->back]);
+} /* FrameBack() */
+
+/* producer: make the back frame the latest and take the one it replaces */
+void FramePublish(FrameExchangeStruct *exchange)
+{
+    exchange->frames[exchange->back].sequence = ++exchange->published;
+    exchange->back = (int) (FrameSwap(&exchange->middle, exchange->back | FRAME_FRESH) & ~FRAME_FRESH);
+} /* FramePublish() */
+
+/******************************************************************************/
+/* FrameLatest -- consumer: the latest published frame, which stays valid     */
+/* and unchanged until the next call.  NULL before the first publish.         */
+/******************************************************************************/
+FrameStruct *FrameLatest(FrameExchangeStruct *exchange)
+{
+    if (FrameLoad(&exchange->middle) & FRAME_FRESH)
+        exchange->front = (int) (FrameSwap(&exchange->middle, exchange->front) & ~FRAME_FRESH);
+    if (exchange->frames[exchange->front].sequence == 0)
+        return(NULL);
+    return(&exchange->frames[exchange->front]);
+} /* FrameLatest() */
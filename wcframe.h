@@ -0,0 +1,58 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcframe.h -- whole-surface frames handed from a render thread to the UI  */
+/******************************************************************************/
+
+#ifndef WCFRAME_H
+#define WCFRAME_H
+
+#include <stdint.h>
+#include "clockreg.h"
+#include "wclayout.h"
+#include "wcpool.h"
+
+#define FRAME_SLOTS      3
+#define FRAME_TILE_GRAIN 8      /* tiles per pool job */
+
+/* one complete picture of every clock */
+typedef struct FrameStructTag {
+    FrameBufferStruct surface;
+    uint64_t *masks;            /* what each tile shows, SEG_MASK_INVALID to redraw it */
+    int maskCapacity;
+    int first;                  /* the clock in the top left tile */
+    uint32_t version;           /* the clock settings the tiles were drawn with */
+    int64_t utcSeconds;         /* the instant shown */
+    uint32_t sequence;          /* 1, 2, ... in publishing order */
+    LayoutRectStruct changed;   /* what differs from frame sequence - 1 */
+} FrameStruct;
+
+/******************************************************************************/
+/* One producer draws into back and publishes it by swapping it with middle;  */
+/* one consumer swaps middle with front when a new frame is there.  Neither   */
+/* waits for the other, and the consumer always gets the latest frame.        */
+/******************************************************************************/
+typedef struct FrameExchangeStructTag {
+    FrameStruct frames[FRAME_SLOTS];
+    int back;                   /* the producer's */
+    int front;                  /* the consumer's */
+    volatile long middle;       /* slot index, FRAME_FRESH while not yet taken */
+    uint32_t published;
+} FrameExchangeStruct;
+
+#define FRAME_FRESH 4
+
+void FrameInit(FrameStruct *frame);
+void FrameFree(FrameStruct *frame);
+void FrameDrawTile(FrameBufferStruct *fb, const ClockRegistryStruct *reg, const ClockLayoutStruct *layout,
+                   const GlyphAtlasStruct *atlas, int index, uint64_t mask);
+int  FrameRender(FrameStruct *frame, ClockRegistryStruct *reg, const ClockLayoutStruct *layout,
+                 const GlyphAtlasStruct *atlas, const TickSnapshotStruct *tick, uint32_t version,
+                 PoolStruct *pool);
+
+void        FrameExchangeInit(FrameExchangeStruct *exchange);
+void        FrameExchangeFree(FrameExchangeStruct *exchange);
+FrameStruct *FrameBack(FrameExchangeStruct *exchange);
+void        FramePublish(FrameExchangeStruct *exchange);
+FrameStruct *FrameLatest(FrameExchangeStruct *exchange);
+
+#endif /* WCFRAME_H */
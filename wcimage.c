@@ -0,0 +1,228 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcimage.c -- PPM and PNG output of frame buffers                         */
+/*                                                                            */
+/* PNG images are written with stored (uncompressed) deflate blocks.  Clock   */
+/* faces are small, so this costs little space and keeps the writer fast and  */
+/* free of a zlib dependency.  Each image is built in memory and written      */
+/* with one fwrite().                                                         */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "wcimage.h"
+
+#define PNG_STORED_BLOCK 65535
+
+static uint32_t crcTable[256];
+static int crcTableReady = 0;
+
+void ImageWriterInit(ImageWriterStruct *writer)
+{
+    writer->buffer = NULL;
+    writer->capacity = 0;
+} /* ImageWriterInit() */
+
+void ImageWriterFree(ImageWriterStruct *writer)
+{
+    free(writer->buffer);
+    writer->buffer = NULL;
+    writer->capacity = 0;
+} /* ImageWriterFree() */
+
+static int Reserve(ImageWriterStruct *writer, size_t size)
+{
+    unsigned char *grown;
+
+    if (size <= writer->capacity)
+        return(1);
+    grown = (unsigned char *) realloc(writer->buffer, size);
+    if (grown == NULL)
+        return(0);
+    writer->buffer = grown;
+    writer->capacity = size;
+    return(1);
+} /* Reserve() */
+
+static uint32_t Crc32(uint32_t crc, const unsigned char *data, size_t size)
+{
+    uint32_t c;
+    int n, k;
+
+    if (!crcTableReady)
+    {
+        for (n = 0; n < 256; n++)
+        {
+            c = (uint32_t) n;
+            for (k = 0; k < 8; k++)
+                c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+            crcTable[n] = c;
+        } /* for n */
+        crcTableReady = 1;
+    }
+    crc = ~crc;
+    while (size-- > 0)
+        crc = crcTable[(crc ^ *data++) & 0xff] ^ (crc >> 8);
+    return(~crc);
+} /* Crc32() */
+
+static unsigned char *PutBig32(unsigned char *out, uint32_t value)
+{
+    out[0] = (unsigned char) (value >> 24);
+    out[1] = (unsigned char) (value >> 16);
+    out[2] = (unsigned char) (value >> 8);
+    out[3] = (unsigned char) value;
+    return(out + 4);
+} /* PutBig32() */
+
+/* finish a chunk whose type and data start at chunk, dataSize bytes of data */
+static unsigned char *EndChunk(unsigned char *chunk, size_t dataSize)
+{
+    PutBig32(chunk - 4, (uint32_t) dataSize);
+    return(PutBig32(chunk + 4 + dataSize, Crc32(0, chunk, 4 + dataSize)));
+} /* EndChunk() */
+
+static size_t WritePpm(ImageWriterStruct *writer, const FrameBufferStruct *fb)
+{
+    unsigned char *out;
+    const uint32_t *row;
+    int header, x, y;
+
+    if (!Reserve(writer, 32 + (size_t) fb->width * fb->height * 3))
+        return(0);
+    header = sprintf((char *) writer->buffer, "P6\n%d %d\n255\n", fb->width, fb->height);
+    out = writer->buffer + header;
+    for (y = 0; y < fb->height; y++)
+    {
+        row = fb->pixels + (size_t) y * fb->stride;
+        for (x = 0; x < fb->width; x++)
+        {
+            *out++ = (unsigned char) (row[x] >> 16);
+            *out++ = (unsigned char) (row[x] >> 8);
+            *out++ = (unsigned char) row[x];
+        } /* for x */
+    } /* for y */
+    return((size_t) (out - writer->buffer));
+} /* WritePpm() */
+
+static size_t WritePng(ImageWriterStruct *writer, const FrameBufferStruct *fb)
+{
+    static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    size_t rowSize = 1 + (size_t) fb->width * 3;
+    size_t rawSize = rowSize * fb->height;
+    size_t blocks = (rawSize + PNG_STORED_BLOCK - 1) / PNG_STORED_BLOCK;
+    size_t idatSize, offset, blockSize, i;
+    uint32_t adlerA = 1, adlerB = 0;
+    unsigned char *out, *chunk, *raw, *p;
+    const uint32_t *row;
+    int x, y;
+
+    if (blocks == 0)
+        blocks = 1;
+    idatSize = 2 + blocks * 5 + rawSize + 4;
+    if (!Reserve(writer, 8 + 25 + 12 + idatSize + rawSize + 12))
+        return(0);
+    out = writer->buffer;
+    memcpy(out, signature, 8);
+    out += 8;
+
+    chunk = out + 4;
+    memcpy(chunk, "IHDR", 4);
+    p = PutBig32(chunk + 4, (uint32_t) fb->width);
+    p = PutBig32(p, (uint32_t) fb->height);
+    p[0] = 8;                   /* bit depth */
+    p[1] = 2;                   /* truecolor RGB */
+    p[2] = p[3] = p[4] = 0;     /* deflate, adaptive filtering, no interlace */
+    out = EndChunk(chunk, 13);
+
+    /* the filtered scanlines go past the end of the chunk, then are copied */
+    /* into stored blocks; a stored block cannot be filled in place */
+    raw = writer->buffer + 8 + 25 + 12 + idatSize;
+    p = raw;
+    for (y = 0; y < fb->height; y++)
+    {
+        row = fb->pixels + (size_t) y * fb->stride;
+        *p++ = 0;               /* filter type None */
+        for (x = 0; x < fb->width; x++)
+        {
+            *p++ = (unsigned char) (row[x] >> 16);
+            *p++ = (unsigned char) (row[x] >> 8);
+            *p++ = (unsigned char) row[x];
+        } /* for x */
+    } /* for y */
+
+    chunk = out + 4;
+    memcpy(chunk, "IDAT", 4);
+    p = chunk + 4;
+    *p++ = 0x78;                /* zlib header, 32K window, no preset dictionary */
+    *p++ = 0x01;
+    for (offset = 0; offset < rawSize || offset == 0; offset += blockSize)
+    {
+        blockSize = rawSize - offset < PNG_STORED_BLOCK ? rawSize - offset : PNG_STORED_BLOCK;
+        *p++ = (offset + blockSize >= rawSize) ? 1 : 0;  /* BFINAL, BTYPE stored */
+        *p++ = (unsigned char) blockSize;
+        *p++ = (unsigned char) (blockSize >> 8);
+        *p++ = (unsigned char) ~blockSize;
+        *p++ = (unsigned char) (~blockSize >> 8);
+        memcpy(p, raw + offset, blockSize);
+        for (i = 0; i < blockSize; i++)
+        {
+            adlerA += p[i];
+            adlerB += adlerA;
+            if ((i & 4095) == 4095)
+            {
+                adlerA %= 65521;
+                adlerB %= 65521;
+            }
+        } /* for i */
+        adlerA %= 65521;
+        adlerB %= 65521;
+        p += blockSize;
+        if (rawSize == 0)
+            break;
+    } /* for offset */
+    PutBig32(p, adlerB << 16 | adlerA);
+    out = EndChunk(chunk, idatSize);
+
+    chunk = out + 4;
+    memcpy(chunk, "IEND", 4);
+    out = EndChunk(chunk, 0);
+    return((size_t) (out - writer->buffer));
+} /* WritePng() */
+
+/******************************************************************************/
+/* ImageWrite -- write fb to file as one PPM (P6) or PNG image.               */
+/* Returns nonzero on success.                                                */
+/******************************************************************************/
+int ImageWrite(ImageWriterStruct *writer, FILE *file, const FrameBufferStruct *fb, ImageFormat format)
+{
+    size_t size;
+
+    size = (format == IMAGE_PNG) ? WritePng(writer, fb) : WritePpm(writer, fb);
+    if (size == 0)
+        return(0);
+    return(fwrite(writer->buffer, 1, size, file) == size);
+} /* ImageWrite() */
+
+/******************************************************************************/
+/* ImageChecksum -- FNV-1a over the visible pixels, for comparing renders     */
+/* against known-good values without keeping the images.                     */
+/******************************************************************************/
+uint32_t ImageChecksum(const FrameBufferStruct *fb)
+{
+    uint32_t hash = 2166136261u;
+    const uint32_t *row;
+    int x, y;
+
+    for (y = 0; y < fb->height; y++)
+    {
+        row = fb->pixels + (size_t) y * fb->stride;
+        for (x = 0; x < fb->width; x++)
+        {
+            hash = (hash ^ (row[x] & 0xff)) * 16777619u;
+            hash = (hash ^ ((row[x] >> 8) & 0xff)) * 16777619u;
+            hash = (hash ^ ((row[x] >> 16) & 0xff)) * 16777619u;
+        } /* for x */
+    } /* for y */
+    return(hash);
+} /* ImageChecksum() */
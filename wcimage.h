@@ -0,0 +1,28 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcimage.h -- PPM and PNG output of frame buffers                         */
+/******************************************************************************/
+
+#ifndef WCIMAGE_H
+#define WCIMAGE_H
+
+#include <stdio.h>
+#include "segrender.h"
+
+typedef enum {
+    IMAGE_PPM,
+    IMAGE_PNG
+} ImageFormat;
+
+/* scratch space reused from frame to frame, free with ImageWriterFree() */
+typedef struct ImageWriterStructTag {
+    unsigned char *buffer;
+    size_t capacity;
+} ImageWriterStruct;
+
+void     ImageWriterInit(ImageWriterStruct *writer);
+void     ImageWriterFree(ImageWriterStruct *writer);
+int      ImageWrite(ImageWriterStruct *writer, FILE *file, const FrameBufferStruct *fb, ImageFormat format);
+uint32_t ImageChecksum(const FrameBufferStruct *fb);
+
+#endif /* WCIMAGE_H */
@@ -0,0 +1,118 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wclayout.c -- placement of clock tiles and hit-testing                   */
+/******************************************************************************/
+
+#include "wclayout.h"
+
+/******************************************************************************/
+/* LayoutInit -- one row of tiles, or one column when vertical.               */
+/******************************************************************************/
+void LayoutInit(ClockLayoutStruct *layout, int count, int vertical, int tileWidth, int tileHeight)
+{
+    LayoutInitView(layout, count, 0, 0, vertical, tileWidth, tileHeight);
+} /* LayoutInit() */
+
+/******************************************************************************/
+/* LayoutInitView -- a row or column of capacity tiles (all of them if 0)     */
+/* onto total clocks, starting at clock first.  first is moved back if the    */
+/* tiles would run past the end, so the view stays full.                      */
+/******************************************************************************/
+void LayoutInitView(ClockLayoutStruct *layout, int total, int first, int capacity,
+                    int vertical, int tileWidth, int tileHeight)
+{
+    layout->total = total > 0 ? total : 0;
+    layout->count = (capacity > 0 && capacity < layout->total) ? capacity : layout->total;
+    if (first > layout->total - layout->count)
+        first = layout->total - layout->count;
+    layout->first = first > 0 ? first : 0;
+    layout->columns = vertical ? 1 : layout->count;
+    layout->rows = vertical ? layout->count : 1;
+    if (layout->count == 0)
+        layout->columns = layout->rows = 0;
+    layout->tileWidth = tileWidth;
+    layout->tileHeight = tileHeight;
+    layout->width = layout->columns * tileWidth;
+    layout->height = layout->rows * tileHeight;
+} /* LayoutInitView() */
+
+/******************************************************************************/
+/* LayoutInitGrid -- as many rows and columns of tiles as fit in areaWidth by */
+/* areaHeight, no more than capacity tiles if it is above 0, onto total       */
+/* clocks from clock first.  The grid is as wide as it needs to be before it  */
+/* grows a row, or with vertical as tall before it grows a column; an area    */
+/* one tile deep gives the row or column of LayoutInitView().  At least one   */
+/* tile fits any area.                                                        */
+/******************************************************************************/
+void LayoutInitGrid(ClockLayoutStruct *layout, int total, int first, int capacity,
+                    int areaWidth, int areaHeight, int vertical, int tileWidth, int tileHeight)
+{
+    int fitColumns, fitRows;
+
+    fitColumns = tileWidth > 0 ? areaWidth / tileWidth : 1;
+    fitRows = tileHeight > 0 ? areaHeight / tileHeight : 1;
+    if (fitColumns < 1)
+        fitColumns = 1;
+    if (fitRows < 1)
+        fitRows = 1;
+    if (capacity <= 0 || capacity > fitColumns * fitRows)
+        capacity = fitColumns * fitRows;
+    LayoutInitView(layout, total, first, capacity, vertical, tileWidth, tileHeight);
+    if (layout->count == 0)
+        return;
+
+    if (vertical)
+    {
+        layout->rows = layout->count < fitRows ? layout->count : fitRows;
+        layout->columns = (layout->count + layout->rows - 1) / layout->rows;
+    }
+    else
+        layout->columns = layout->count < fitColumns ? layout->count : fitColumns;
+    layout->rows = (layout->count + layout->columns - 1) / layout->columns;
+    layout->width = layout->columns * tileWidth;
+    layout->height = layout->rows * tileHeight;
+} /* LayoutInitGrid() */
+
+int LayoutShows(const ClockLayoutStruct *layout, int index)
+{
+    return(index >= layout->first && index < layout->first + layout->count);
+} /* LayoutShows() */
+
+/******************************************************************************/
+/* LayoutPage -- the first clock of the next page of the view, or with        */
+/* forward 0 the one before, wrapping around at either end.  Pass it to       */
+/* LayoutInitView().                                                          */
+/******************************************************************************/
+int LayoutPage(const ClockLayoutStruct *layout, int forward)
+{
+    if (forward)
+        return(layout->first + layout->count >= layout->total ? 0 : layout->first + layout->count);
+    return(layout->first == 0 ? layout->total - layout->count : layout->first - layout->count);
+} /* LayoutPage() */
+
+/* the tile of a clock the layout shows */
+void LayoutTileRect(const ClockLayoutStruct *layout, int index, LayoutRectStruct *rect)
+{
+    int column, row;
+
+    index -= layout->first;
+    column = layout->columns > 0 ? index % layout->columns : 0;
+    row = layout->columns > 0 ? index / layout->columns : 0;
+    rect->left = column * layout->tileWidth;
+    rect->top = row * layout->tileHeight;
+    rect->right = rect->left + layout->tileWidth;
+    rect->bottom = rect->top + layout->tileHeight;
+} /* LayoutTileRect() */
+
+/******************************************************************************/
+/* LayoutHitTest -- the clock under (x, y), or -1 if none.                    */
+/******************************************************************************/
+int LayoutHitTest(const ClockLayoutStruct *layout, int x, int y)
+{
+    int index;
+
+    if (x < 0 || y < 0 || x >= layout->width || y >= layout->height)
+        return(-1);
+    index = (y / layout->tileHeight) * layout->columns + x / layout->tileWidth;
+    return(index < layout->count ? layout->first + index : -1);
+} /* LayoutHitTest() */
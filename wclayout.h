@@ -0,0 +1,46 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wclayout.h -- placement of clock tiles and hit-testing                   */
+/******************************************************************************/
+
+#ifndef WCLAYOUT_H
+#define WCLAYOUT_H
+
+#define LAYOUT_TILE_BORDER 1    /* the frame WS_BORDER drew around each clock */
+
+typedef struct LayoutRectStructTag {
+    int left;
+    int top;
+    int right;                  /* exclusive */
+    int bottom;                 /* exclusive */
+} LayoutRectStruct;
+
+/******************************************************************************/
+/* Tiles are placed row by row.  A layout may be a view of part of a long     */
+/* list: its tiles show clocks first .. first + count - 1 of total, clock     */
+/* first at the top left, and only those need drawing or ticking.  Indices    */
+/* passed to and returned by the functions below are clock indices.           */
+/******************************************************************************/
+typedef struct ClockLayoutStructTag {
+    int total;                  /* clocks in the list */
+    int first;                  /* the clock in the top left tile */
+    int count;                  /* tiles, the clocks shown */
+    int columns;
+    int rows;
+    int tileWidth;
+    int tileHeight;
+    int width;                  /* the whole surface */
+    int height;
+} ClockLayoutStruct;
+
+void LayoutInit(ClockLayoutStruct *layout, int count, int vertical, int tileWidth, int tileHeight);
+void LayoutInitView(ClockLayoutStruct *layout, int total, int first, int capacity,
+                    int vertical, int tileWidth, int tileHeight);
+void LayoutInitGrid(ClockLayoutStruct *layout, int total, int first, int capacity,
+                    int areaWidth, int areaHeight, int vertical, int tileWidth, int tileHeight);
+int  LayoutShows(const ClockLayoutStruct *layout, int index);
+int  LayoutPage(const ClockLayoutStruct *layout, int forward);
+void LayoutTileRect(const ClockLayoutStruct *layout, int index, LayoutRectStruct *rect);
+int  LayoutHitTest(const ClockLayoutStruct *layout, int x, int y);
+
+#endif /* WCLAYOUT_H */
@@ -12,21 +12,53 @@
 #include <time.h>
 #include "worldclock.h"
 #include "wclock.h"
+#include "ticksched.h"
+#include "gdicache.h"
+#include "wcstats.h"
+#include "wcframe.h"
 
-typedef struct SegmentVectorsStructTag {
-    UINT startX;
-    UINT startY;
-    UINT endX;
-    UINT endY;
-} SegmentVectorsStruct;
+static SegAtlasCacheStruct atlasCache;
+static const GlyphAtlasStruct *glyphAtlas;      /* from atlasCache, at clockScale */
+static int clockScale = SEG_SCALE_ONE;
+static FrameBufferStruct faceBuffer;
+static BITMAPINFO faceBitmapInfo;
+static TickSnapshotStruct currentTick;
+static HDC labelDC;                     /* selects each label bitmap to paint it; kept until exit */
+static HINSTANCE clockInstance;
+
+/* window mode: the clocks on screen, the only ones with a window */
+static ClockLayoutStruct windowLayout;
+
+/* compositor mode: every clock is a tile of one back buffer owned by the host */
+static HWND compositorWindow;
+static HDC compositorDC;
+static HBITMAP compositorBitmap, compositorOldBitmap;
+static FrameBufferStruct compositorBuffer;   /* pixels belong to the DIB section */
+static ClockLayoutStruct compositorLayout;
+
+/* render thread: frames are drawn off the UI thread and handed over by frameExchange */
+static HANDLE renderThread, renderStop, renderWake;
+static CRITICAL_SECTION renderLock;     /* guards the registry, compositorLayout and renderVersion */
+static uint32_t renderVersion;
+static int renderSeconds;
+static FrameExchangeStruct frameExchange;
+static PoolStruct tilePool;             /* draws the tiles of each frame */
+static volatile long framePosted;       /* a WC_FRAME_READY is on its way */
+static FrameStruct *presentedFrame;     /* UI thread's */
 
 LRESULT WINAPI ClockWndProc (HWND, UINT, WPARAM, LPARAM);
-void DrawDigit(HDC hdc, UINT x, UINT y, UINT digit, HPEN litPen, HPEN darkPen);
-void DrawColon(HDC hdc, UINT x, UINT y, UINT onOff, HPEN litPen, HPEN darkPen);
 
 void RegisterClockClass(HINSTANCE hInstance)
 {
     WNDCLASS clockClass;
+
+    clockInstance = hInstance;
+    if (glyphAtlas == NULL)
+    { /* all clocks share one atlas and one face buffer */
+        SegAtlasCacheInit(&atlasCache);
+        ClockSetScale(SEG_SCALE_ONE);
+    } /* if glyphAtlas == NULL */
+
     if (!GetClassInfo(hInstance, CLOCK_CLASS_NAME, &clockClass))
     {
         clockClass.style = CS_HREDRAW | CS_VREDRAW  | CS_DBLCLKS;
@@ -36,109 +68,758 @@ void RegisterClockClass(HINSTANCE hInstance)
         clockClass.hInstance = hInstance;
         clockClass.hIcon = NULL;
         clockClass.hCursor = LoadCursor (NULL, IDC_ARROW);
-        clockClass.hbrBackground = GetStockObject (WHITE_BRUSH);
+        clockClass.hbrBackground = NULL; /* see WM_ERASEBKGND */
         clockClass.lpszMenuName = NULL;
         clockClass.lpszClassName = CLOCK_CLASS_NAME;
         RegisterClass (&clockClass);
     }
 } /* RegisterClockClass */
 
+/******************************************************************************/
+/* ClockSetScale -- draw the clocks at scale percent from now on, e.g. for a  */
+/* new DPI.  The host then lays them out again at ClockTileSize().  Returns   */
+/* FALSE, keeping the old scale, when out of memory.                          */
+/******************************************************************************/
+int ClockSetScale(int scale)
+{
+    const GlyphAtlasStruct *atlas;
+    FrameBufferStruct face;
+    int i;
+
+    CompositorBeginChange();
+    atlas = SegAtlasCacheGet(&atlasCache, scale,
+                             clockDefaultTheme.litColor, clockDefaultTheme.darkColor, clockDefaultTheme.backColor);
+    if (atlas == NULL || !SegFrameBufferInit(&face, atlas->faceWidth, atlas->faceHeight))
+    {
+        CompositorEndChange();
+        return(FALSE);
+    }
+    SegFrameBufferFree(&faceBuffer);
+    faceBuffer = face;
+    glyphAtlas = atlas;
+    clockScale = atlas->scale;
+    faceBitmapInfo.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    faceBitmapInfo.bmiHeader.biWidth = face.width;
+    faceBitmapInfo.bmiHeader.biHeight = -face.height; /* top-down */
+    faceBitmapInfo.bmiHeader.biPlanes = 1;
+    faceBitmapInfo.bmiHeader.biBitCount = 32;
+    faceBitmapInfo.bmiHeader.biCompression = BI_RGB;
+    for (i = 0; i < clockRegistry.count; i++)   /* labels sit lower and wider */
+        ((ClockWinStruct *) ClockRegSidecar(&clockRegistry, i))->labelSerial = 0;
+    CompositorEndChange();
+    return(TRUE);
+} /* ClockSetScale() */
+
+/* the size of one clock, its border included, at the current scale */
+void ClockTileSize(int *width, int *height)
+{
+    *width = SegScaled(CLOCK_DISPLAY_WIDTH, clockScale);
+    *height = SegScaled(CLOCK_DISPLAY_HEIGHT, clockScale);
+} /* ClockTileSize() */
+
+/* bring a clock that has not been shown yet up to the current tick */
+static void EnsureTicked(int index)
+{
+    if (clockRegistry.shownMasks[index] == SEG_MASK_INVALID)
+    {
+        if (currentTick.utcSeconds == 0) /* painted before the first tick */
+            TickTakeSnapshot(&currentTick, (int64_t) time(NULL));
+        ClockRegTick(&clockRegistry, index, &currentTick);
+    }
+} /* EnsureTicked() */
+
+/* face-relative rectangle of a digit slot and the colon to its right */
+static void DigitRect(int slot, RECT *digitRect)
+{
+    digitRect->left = SegDigitSlotX(glyphAtlas, slot);
+    digitRect->top = glyphAtlas->glyphTop;
+    digitRect->right = digitRect->left + glyphAtlas->digitWidth;
+    if ((slot & 1) && slot < SEG_FACE_DIGITS - 1) /* include the colon */
+        digitRect->right += glyphAtlas->colonWidth;
+    digitRect->bottom = glyphAtlas->glyphTop + glyphAtlas->glyphHeight;
+} /* DigitRect() */
+
+/******************************************************************************/
+/* MeasureLabel -- measure a clock's label with GDI, but only if the label or */
+/* the font changed since it was last measured.  Returns the number of GDI    */
+/* calls made, for the statistics.                                            */
+/******************************************************************************/
+static int MeasureLabel(HDC hdc, int index, ClockWinStruct *clockWin, HFONT labelFont)
+{
+    const ClockLabelStruct *layout = &clockRegistry.labelLayouts[index];
+    HFONT oldFont;
+    int calls = 1;
+
+    if (clockWin->labelSerial == layout->serial && clockWin->labelExtentFont == labelFont)
+        return(0);
+    oldFont = (labelFont != NULL) ? (HFONT) SelectObject(hdc, labelFont) : NULL;
+    GetTextExtentPoint32(hdc, ClockRegLabel(&clockRegistry, index), layout->length, &clockWin->labelExtent);
+    if (oldFont != NULL)
+    {
+        SelectObject(hdc, oldFont);
+        calls += 2;
+    }
+    clockWin->labelSerial = layout->serial;
+    clockWin->labelExtentFont = labelFont;
+    if (clockWin->labelBitmap != NULL)
+    {
+        DeleteObject(clockWin->labelBitmap);
+        clockWin->labelBitmap = NULL;
+        calls++;
+    }
+    return(calls);
+} /* MeasureLabel() */
+
+/* returns the number of GDI calls made, for the statistics */
+static int DrawLabel(HDC hdc, int x, int y, int index, ClockWinStruct *clockWin, HFONT labelFont)
+{
+    const ClockThemeStruct *theme = &clockRegistry.themes[index];
+    int length = clockRegistry.labelLayouts[index].length;
+    int calls;
+    HFONT oldFont;
+
+    if (length == 0)
+        return(0);
+    calls = MeasureLabel(hdc, index, clockWin, labelFont) + 3;
+    oldFont = (labelFont != NULL) ? (HFONT) SelectObject(hdc, labelFont) : NULL;
+    SetTextColor(hdc, SEG_TO_COLORREF(theme->textColor));
+    SetBkColor(hdc, SEG_TO_COLORREF(theme->backColor));
+    TextOutA(hdc,
+             x + (int)(SegScaled(CLOCK_DISPLAY_WIDTH, clockScale) - clockWin->labelExtent.cx) / 2,
+             y + glyphAtlas->faceHeight,
+             ClockRegLabel(&clockRegistry, index),
+             length);
+    if (oldFont == NULL)
+        return(calls);
+    SelectObject(hdc, oldFont);
+    return(calls + 2);
+} /* DrawLabel() */
+
+/******************************************************************************/
+/* PaintLabel -- copy a clock window's label from the bitmap it was drawn     */
+/* into, drawing it there first if the label or the font changed, so most     */
+/* paints do no text work at all.  Returns the number of GDI calls made.      */
+/******************************************************************************/
+static int PaintLabel(HDC hdc, int index, ClockWinStruct *clockWin)
+{
+    HGDIOBJ oldBitmap;
+    RECT bandRect;
+    int calls, width = SegScaled(CLOCK_DISPLAY_WIDTH, clockScale) - 2 * LAYOUT_TILE_BORDER;
+
+    if (clockRegistry.labelLayouts[index].length == 0)
+        return(0);
+    if (labelDC == NULL)
+        labelDC = CreateCompatibleDC(hdc);
+    if (labelDC == NULL)
+        return(DrawLabel(hdc, 0, 0, index, clockWin, clockWin->labelFont));
+
+    calls = MeasureLabel(labelDC, index, clockWin, clockWin->labelFont);
+    if (clockWin->labelBitmap == NULL)
+    {
+        SetRect(&bandRect, 0, 0, width, clockWin->labelExtent.cy);
+        clockWin->labelBitmap = CreateCompatibleBitmap(hdc, width, bandRect.bottom);
+        if (clockWin->labelBitmap == NULL) /* out of GDI memory */
+            return(calls + 1 + DrawLabel(hdc, 0, 0, index, clockWin, clockWin->labelFont));
+        oldBitmap = SelectObject(labelDC, clockWin->labelBitmap);
+        FillRect(labelDC, &bandRect, clockWin->backBrush);
+        calls += 5 + DrawLabel(labelDC, 0, -glyphAtlas->faceHeight, index, clockWin, clockWin->labelFont);
+        SelectObject(labelDC, oldBitmap);
+    }
+
+    oldBitmap = SelectObject(labelDC, clockWin->labelBitmap);
+    BitBlt(hdc, 0, glyphAtlas->faceHeight, width, clockWin->labelExtent.cy, labelDC, 0, 0, SRCCOPY);
+    SelectObject(labelDC, oldBitmap);
+    return(calls + 3);
+} /* PaintLabel() */
+
+/******************************************************************************/
+/* ComposeTile -- draw one clock, frame, face and label, into the back        */
+/* buffer.  The caller presents it.                                           */
+/******************************************************************************/
+static void ComposeTile(int index)
+{
+    LayoutRectStruct tile;
+    int x, y;
+
+    EnsureTicked(index);
+    LayoutTileRect(&compositorLayout, index, &tile);
+    x = tile.left + LAYOUT_TILE_BORDER;
+    y = tile.top + LAYOUT_TILE_BORDER;
+
+    GdiFlush(); /* finish pending GDI text before touching the pixels */
+    SegFillRect(&compositorBuffer, tile.left, tile.top, tile.right, tile.bottom, 0);
+    SegFillRect(&compositorBuffer, x, y, tile.right - LAYOUT_TILE_BORDER, tile.bottom - LAYOUT_TILE_BORDER,
+                clockRegistry.themes[index].backColor);
+    SegRenderFaceMask(glyphAtlas, &compositorBuffer, x, y, clockRegistry.shownMasks[index]);
+    StatsGdiCalls(2 + DrawLabel(compositorDC, x, y, index, (ClockWinStruct *) ClockRegSidecar(&clockRegistry, index), NULL));
+    GdiFlush();
+} /* ComposeTile() */
+
+static void InvalidateTile(int index)
+{
+    LayoutRectStruct tile;
+    RECT tileRect;
+
+    LayoutTileRect(&compositorLayout, index, &tile);
+    SetRect(&tileRect, tile.left, tile.top, tile.right, tile.bottom);
+    InvalidateRect(compositorWindow, &tileRect, FALSE);
+    StatsFrameArea((uint64_t) (tile.right - tile.left) * (tile.bottom - tile.top));
+} /* InvalidateTile() */
+
+/******************************************************************************/
+/* ForgetHidden -- clocks off screen are only data: drop their windows, and   */
+/* with them their GDI objects, and what they showed, so that they are        */
+/* neither ticked nor drawn until they come back, and then start afresh.      */
+/******************************************************************************/
+static void ForgetHidden(const ClockLayoutStruct *layout)
+{
+    int i;
+
+    for (i = 0; i < clockRegistry.count; i++)
+    {
+        if (i == layout->first && layout->count > 0)
+        {
+            i += layout->count - 1;
+            continue;
+        }
+        clockRegistry.shownMasks[i] = SEG_MASK_INVALID;
+        if (clockRegistry.windows[i] != NULL)
+            DestroyWindow((HWND) clockRegistry.windows[i]);
+    } /* for i */
+} /* ForgetHidden() */
+
+/******************************************************************************/
+/* ClockWindowLayout -- give each clock the layout shows a window of its own  */
+/* in parentWindow, at its tile, and take the others' windows away.  Drawing  */
+/* is held off meanwhile: the windows that stay are moved in one deferred     */
+/* batch, and parentWindow and all the clocks are painted once at the end.    */
+/* Returns FALSE if a window could not be made.                               */
+/******************************************************************************/
+int ClockWindowLayout(HWND parentWindow, const ClockLayoutStruct *layout)
+{
+    LayoutRectStruct tile;
+    HWND clockWindow;
+    HDWP batch;
+    int i, end, made = TRUE;
+
+    SendMessage(parentWindow, WM_SETREDRAW, FALSE, 0);
+    ForgetHidden(layout);
+    windowLayout = *layout;
+    end = layout->first + layout->count;
+    if (end > clockRegistry.count)
+        end = clockRegistry.count;
+
+    batch = BeginDeferWindowPos(layout->count);
+    for (i = layout->first; i < end; i++)
+    {
+        clockWindow = (HWND) clockRegistry.windows[i];
+        if (clockWindow == NULL)
+            continue;
+        LayoutTileRect(layout, i, &tile);
+        if (batch != NULL)
+            batch = DeferWindowPos(batch, clockWindow, NULL, tile.left, tile.top, tile.right - tile.left,
+                                   tile.bottom - tile.top, SWP_NOZORDER | SWP_NOACTIVATE);
+        if (batch == NULL)      /* out of memory; the batch is gone, so move it alone */
+            SetWindowPos(clockWindow, NULL, tile.left, tile.top, tile.right - tile.left,
+                         tile.bottom - tile.top, SWP_NOZORDER | SWP_NOACTIVATE);
+    } /* for i */
+    if (batch != NULL)
+        EndDeferWindowPos(batch);
+
+    for (i = layout->first; i < end; i++)
+    {
+        if (clockRegistry.windows[i] != NULL)
+            continue;
+        LayoutTileRect(layout, i, &tile);
+        clockWindow = CreateWindow(CLOCK_CLASS_NAME,
+                                   ClockRegLabel(&clockRegistry, i),
+                                   WS_CHILD | WS_VISIBLE | WS_BORDER,
+                                   tile.left,
+                                   tile.top,
+                                   tile.right - tile.left,
+                                   tile.bottom - tile.top,
+                                   parentWindow,
+                                   NULL,
+                                   clockInstance,
+                                   (LPVOID) (UINT_PTR) clockRegistry.handles[i]);
+        if (clockWindow == NULL)
+            made = FALSE;
+    } /* for i */
+
+    SendMessage(parentWindow, WM_SETREDRAW, TRUE, 0);
+    RedrawWindow(parentWindow, NULL, NULL, RDW_ERASE | RDW_FRAME | RDW_INVALIDATE | RDW_ALLCHILDREN);
+    return(made);
+} /* ClockWindowLayout() */
+
+/******************************************************************************/
+/* CompositorAttach -- render all clocks into one surface presented by hwnd   */
+/* instead of one child window each.  Call before the first AddClock().       */
+/******************************************************************************/
+void CompositorAttach(HWND hwnd)
+{
+    compositorWindow = hwnd;
+} /* CompositorAttach() */
+
+int CompositorActive(void)
+{
+    return(compositorWindow != NULL);
+} /* CompositorActive() */
+
+void CompositorDetach(void)
+{
+    if (renderThread != NULL)
+    {
+        SetEvent(renderStop);
+        WaitForSingleObject(renderThread, INFINITE);
+        CloseHandle(renderThread);
+        CloseHandle(renderStop);
+        CloseHandle(renderWake);
+        DeleteCriticalSection(&renderLock);
+        FrameExchangeFree(&frameExchange);
+        PoolFree(&tilePool);
+        renderThread = NULL;
+        presentedFrame = NULL;
+    }
+    if (compositorDC != NULL)
+    {
+        SelectObject(compositorDC, compositorOldBitmap);
+        DeleteDC(compositorDC);
+        DeleteObject(compositorBitmap);
+    }
+    compositorDC = NULL;
+    compositorBitmap = compositorOldBitmap = NULL;
+    compositorBuffer.pixels = NULL;
+    compositorBuffer.width = compositorBuffer.height = compositorBuffer.stride = 0;
+    compositorWindow = NULL;
+} /* CompositorDetach() */
+
+/******************************************************************************/
+/* CompositorLayout -- size the back buffer for layout and redraw every tile. */
+/* Returns FALSE if the buffer could not be made.                             */
+/******************************************************************************/
+int CompositorLayout(const ClockLayoutStruct *layout)
+{
+    BITMAPINFO bitmapInfo;
+    void *bits;
+    int i;
+
+    if (compositorWindow == NULL)
+        return(FALSE);
+    if (renderThread != NULL)
+    {
+        CompositorBeginChange();
+        ForgetHidden(layout);
+        compositorLayout = *layout;
+        CompositorEndChange();
+        return(TRUE);
+    }
+    ForgetHidden(layout);
+    compositorLayout = *layout;
+
+    if (compositorDC == NULL || compositorBuffer.width != layout->width || compositorBuffer.height != layout->height)
+    {
+        HWND window = compositorWindow;
+
+        CompositorDetach();     /* not threaded here, so only the back buffer goes */
+        compositorWindow = window;
+        if (layout->width <= 0 || layout->height <= 0)
+            return(TRUE);
+
+        memset(&bitmapInfo, 0, sizeof(bitmapInfo));
+        bitmapInfo.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+        bitmapInfo.bmiHeader.biWidth = layout->width;
+        bitmapInfo.bmiHeader.biHeight = -layout->height; /* top-down */
+        bitmapInfo.bmiHeader.biPlanes = 1;
+        bitmapInfo.bmiHeader.biBitCount = 32;
+        bitmapInfo.bmiHeader.biCompression = BI_RGB;
+        compositorDC = CreateCompatibleDC(NULL);
+        if (compositorDC == NULL)
+            return(FALSE);
+        compositorBitmap = CreateDIBSection(compositorDC, &bitmapInfo, DIB_RGB_COLORS, &bits, NULL, 0);
+        if (compositorBitmap == NULL)
+        {
+            DeleteDC(compositorDC);
+            compositorDC = NULL;
+            return(FALSE);
+        }
+        compositorOldBitmap = SelectObject(compositorDC, compositorBitmap);
+        compositorBuffer.pixels = (uint32_t *) bits;
+        compositorBuffer.width = layout->width;
+        compositorBuffer.height = layout->height;
+        compositorBuffer.stride = layout->width;
+    }
+
+    for (i = layout->first; i < layout->first + layout->count && i < clockRegistry.count; i++)
+        ComposeTile(i);
+    InvalidateRect(compositorWindow, NULL, FALSE);
+    return(TRUE);
+} /* CompositorLayout() */
+
+/* the part of the presented frame inside rect, one band of rows */
+static void PaintFrame(HDC hdc, const RECT *rect)
+{
+    const FrameBufferStruct *surface = &presentedFrame->surface;
+    BITMAPINFO bitmapInfo;
+    int top = (rect->top > 0) ? rect->top : 0;
+    int bottom = (rect->bottom < surface->height) ? rect->bottom : surface->height;
+    int left = (rect->left > 0) ? rect->left : 0;
+    int right = (rect->right < surface->width) ? rect->right : surface->width;
+
+    if (top >= bottom || left >= right)
+        return;
+    memset(&bitmapInfo, 0, sizeof(bitmapInfo));
+    bitmapInfo.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    bitmapInfo.bmiHeader.biWidth = surface->stride;
+    bitmapInfo.bmiHeader.biHeight = -(bottom - top); /* top-down */
+    bitmapInfo.bmiHeader.biPlanes = 1;
+    bitmapInfo.bmiHeader.biBitCount = 32;
+    bitmapInfo.bmiHeader.biCompression = BI_RGB;
+    SetDIBitsToDevice(hdc, left, top, right - left, bottom - top, left, 0, 0, bottom - top,
+                      surface->pixels + (size_t) top * surface->stride, &bitmapInfo, DIB_RGB_COLORS);
+} /* PaintFrame() */
+
+/* present the part of the back buffer inside rect, e.g. ps.rcPaint */
+void CompositorPaint(HDC hdc, const RECT *rect)
+{
+    int64_t startNs = StatsNowNs();
+
+    if (renderThread != NULL)
+    {
+        if (presentedFrame == NULL)
+            return;
+        PaintFrame(hdc, rect);
+        StatsGdiCalls(1);
+        StatsCount(STAT_PAINTS, 1);
+        StatsRecord(STAT_PAINT_US, (uint64_t) (StatsNowNs() - startNs) / 1000);
+        return;
+    }
+    if (compositorDC == NULL)
+        return;
+    GdiFlush();
+    BitBlt(hdc, rect->left, rect->top, rect->right - rect->left, rect->bottom - rect->top,
+           compositorDC, rect->left, rect->top, SRCCOPY);
+    StatsGdiCalls(2);
+    StatsCount(STAT_PAINTS, 1);
+    StatsRecord(STAT_PAINT_US, (uint64_t) (StatsNowNs() - startNs) / 1000);
+} /* CompositorPaint() */
+
+/* the clock under a point of the host window, CLOCK_HANDLE_NONE if none */
+ClockHandle CompositorHitTest(int x, int y)
+{
+    int index = LayoutHitTest(&compositorLayout, x, y);
+
+    if (index < 0 || index >= clockRegistry.count)
+        return(CLOCK_HANDLE_NONE);
+    return(clockRegistry.handles[index]);
+} /* CompositorHitTest() */
+
+/******************************************************************************/
+/* CompositorBeginChange, CompositorEndChange -- bracket every change to the  */
+/* registry or the layout while the render thread runs.  Ending a change has  */
+/* the thread redraw every tile at once.  Without the thread they do nothing. */
+/******************************************************************************/
+void CompositorBeginChange(void)
+{
+    if (renderThread != NULL)
+        EnterCriticalSection(&renderLock);
+} /* CompositorBeginChange() */
+
+void CompositorEndChange(void)
+{
+    if (renderThread == NULL)
+        return;
+    renderVersion++;
+    LeaveCriticalSection(&renderLock);
+    SetEvent(renderWake);
+} /* CompositorEndChange() */
+
+/* milliseconds left until the tick the scheduler is armed for, rounded up */
+static DWORD RemainingMs(const TickSchedulerStruct *scheduler)
+{
+    int64_t leftNs = scheduler->deadlineMonoNs - scheduler->clock->monotonicNs(scheduler->clock->context);
+
+    if (leftNs <= 0)
+        return(0);
+    return((DWORD) ((leftNs + NS_PER_MS - 1) / NS_PER_MS));
+} /* RemainingMs() */
+
+/******************************************************************************/
+/* RenderThreadProc -- tick the clocks on time and draw each tick's frame,    */
+/* then let the UI thread know.  A change from the UI thread wakes it to      */
+/* redraw the same tick; a stop ends it.                                      */
+/******************************************************************************/
+static DWORD WINAPI RenderThreadProc(LPVOID parameter)
+{
+    TickSchedulerStruct scheduler;
+    TickSnapshotStruct tick;
+    HANDLE events[2];
+    DWORD timeout, wait;
+    int rendered;
+
+    (void) parameter;
+    events[0] = renderStop;
+    events[1] = renderWake;
+    TickSchedInit(&scheduler, &tickSystemClock, renderSeconds);
+    TickTakeSnapshot(&tick, (int64_t) time(NULL));
+    timeout = TickSchedArm(&scheduler);
+    for (;;)
+    {
+        EnterCriticalSection(&renderLock);
+        rendered = FrameRender(FrameBack(&frameExchange), &clockRegistry, &compositorLayout,
+                               glyphAtlas, &tick, renderVersion, &tilePool);
+        LeaveCriticalSection(&renderLock);
+        if (rendered)
+        {
+            FramePublish(&frameExchange);
+            if (InterlockedExchange(&framePosted, 1) == 0)
+                PostMessage(compositorWindow, WC_FRAME_READY, 0, 0L);
+        }
+
+        wait = WaitForMultipleObjects(2, events, FALSE, timeout);
+        if (wait == WAIT_TIMEOUT)
+        {
+            StatsEndFrame();
+            TickTakeSnapshot(&tick, TickSchedFired(&scheduler));
+            StatsTick(scheduler.jitter.lastLateNs);
+            timeout = TickSchedArm(&scheduler);
+        }
+        else if (wait == WAIT_OBJECT_0 + 1)
+            timeout = RemainingMs(&scheduler);  /* arming again would skip the tick */
+        else
+            break;
+    } /* for */
+    return(0);
+} /* RenderThreadProc() */
+
+/******************************************************************************/
+/* CompositorStartThread -- tick and draw the clocks on a thread of their     */
+/* own, so a modal dialog or a slow save on the UI thread does not stall      */
+/* them.  The tiles of a frame are drawn by threads workers, the render       */
+/* thread among them, or by one per processor if threads is 0.  Call after    */
+/* CompositorAttach() and before the first AddClock(); the host then needs    */
+/* no timer.  Returns FALSE if the thread could not start.                    */
+/******************************************************************************/
+int CompositorStartThread(int showSeconds, int threads)
+{
+    if (compositorWindow == NULL || renderThread != NULL)
+        return(FALSE);
+    renderStop = CreateEvent(NULL, TRUE, FALSE, NULL);
+    renderWake = CreateEvent(NULL, FALSE, FALSE, NULL);
+    if (renderStop == NULL || renderWake == NULL)
+    {
+        if (renderStop != NULL)
+            CloseHandle(renderStop);
+        if (renderWake != NULL)
+            CloseHandle(renderWake);
+        return(FALSE);
+    }
+    InitializeCriticalSection(&renderLock);
+    FrameExchangeInit(&frameExchange);
+    PoolInit(&tilePool, threads > 0 ? threads : PoolCpuCount());
+    renderVersion = 1;
+    renderSeconds = showSeconds;
+    framePosted = 0;
+    renderThread = CreateThread(NULL, 0, RenderThreadProc, NULL, 0, NULL);
+    if (renderThread == NULL)
+    {
+        PoolFree(&tilePool);
+        DeleteCriticalSection(&renderLock);
+        CloseHandle(renderStop);
+        CloseHandle(renderWake);
+        return(FALSE);
+    }
+    return(TRUE);
+} /* CompositorStartThread() */
+
+/******************************************************************************/
+/* CompositorFrameReady -- the host's WC_FRAME_READY: take the latest frame   */
+/* and invalidate what changed since the one presented before it, or all of   */
+/* it when frames were skipped.                                               */
+/******************************************************************************/
+void CompositorFrameReady(void)
+{
+    FrameStruct *frame;
+    RECT changedRect;
+    uint32_t previous;
+
+    if (renderThread == NULL)
+        return;
+    InterlockedExchange(&framePosted, 0);   /* before taking it, so no frame goes unannounced */
+    frame = FrameLatest(&frameExchange);
+    if (frame == NULL || frame == presentedFrame)
+        return;
+    previous = (presentedFrame != NULL) ? presentedFrame->sequence : 0;
+    presentedFrame = frame;
+    if (frame->sequence != previous + 1)
+    {
+        InvalidateRect(compositorWindow, NULL, FALSE);
+        StatsFrameArea((uint64_t) frame->surface.width * frame->surface.height);
+    }
+    else if (frame->changed.right > frame->changed.left && frame->changed.bottom > frame->changed.top)
+    {
+        SetRect(&changedRect, frame->changed.left, frame->changed.top, frame->changed.right, frame->changed.bottom);
+        InvalidateRect(compositorWindow, &changedRect, FALSE);
+        StatsFrameArea((uint64_t) (changedRect.right - changedRect.left) * (changedRect.bottom - changedRect.top));
+    }
+} /* CompositorFrameReady() */
+
+/******************************************************************************/
+/* RedrawClock -- repaint a clock after its settings changed.                 */
+/******************************************************************************/
+void RedrawClock(ClockHandle handle)
+{
+    int index = ClockRegIndexOf(&clockRegistry, handle);
+
+    if (index < 0)
+        return;
+    if (compositorWindow == NULL)
+    {
+        if (clockRegistry.windows[index] != NULL)   /* off screen otherwise */
+            InvalidateRect((HWND) clockRegistry.windows[index], NULL, TRUE);
+        return;
+    }
+    if (renderThread != NULL)
+    {
+        CompositorBeginChange();
+        CompositorEndChange();
+        return;
+    }
+    if (compositorDC == NULL || !LayoutShows(&compositorLayout, index))
+        return;                 /* the next CompositorLayout() draws it */
+    ComposeTile(index);
+    InvalidateTile(index);
+} /* RedrawClock() */
+
+/******************************************************************************/
+/* TickClocks -- bring the clocks on screen up to the tick, invalidating      */
+/* only the digits whose segments changed; the rest are not looked at.  In    */
+/* compositor mode the digits are redrawn into the back buffer here and the   */
+/* host presents them in one WM_PAINT.                                        */
+/******************************************************************************/
+void TickClocks(const TickSnapshotStruct *tick)
+{
+    int i, slot;
+    unsigned int dirtyDigits;
+    RECT digitRect;
+    LayoutRectStruct tile;
+    int compose = (compositorDC != NULL);
+    const ClockLayoutStruct *view = (compositorWindow != NULL) ? &compositorLayout : &windowLayout;
+    int last = view->first + view->count;
+
+    currentTick = *tick;
+    if (compose)
+        GdiFlush();
+    if (last > clockRegistry.count)
+        last = clockRegistry.count;
+    ClockRegTickRange(&clockRegistry, view->first, last - view->first, tick);
+    for (i = view->first; i < last; i++)
+    {
+        dirtyDigits = clockRegistry.dirtyDigits[i];
+        if (dirtyDigits == 0)
+            continue;
+        if (compose)
+        {
+            if (dirtyDigits == CLOCK_DIRTY_ALL)
+            {
+                ComposeTile(i);
+                InvalidateTile(i);
+                continue;
+            }
+            LayoutTileRect(&compositorLayout, i, &tile);
+            tile.left += LAYOUT_TILE_BORDER;
+            tile.top += LAYOUT_TILE_BORDER;
+            SegRenderFaceDigits(glyphAtlas, &compositorBuffer, tile.left, tile.top,
+                                clockRegistry.shownMasks[i], dirtyDigits);
+        }
+        else if (clockRegistry.windows[i] == NULL)
+            continue;           /* not made yet; it paints itself when it is */
+        else if (dirtyDigits == CLOCK_DIRTY_ALL)
+        {
+            InvalidateRect((HWND) clockRegistry.windows[i], NULL, TRUE);
+            StatsFrameArea((uint64_t) SegScaled(CLOCK_DISPLAY_WIDTH, clockScale) *
+                           SegScaled(CLOCK_DISPLAY_HEIGHT, clockScale));
+            continue;
+        }
+        for (slot = 0; dirtyDigits != 0; slot++, dirtyDigits >>= 1)
+        {
+            if (!(dirtyDigits & 1))
+                continue;
+            DigitRect(slot, &digitRect);
+            StatsFrameArea((uint64_t) (digitRect.right - digitRect.left) * (digitRect.bottom - digitRect.top));
+            if (compose)
+            {
+                OffsetRect(&digitRect, tile.left, tile.top);
+                InvalidateRect(compositorWindow, &digitRect, FALSE);
+            }
+            else
+                InvalidateRect((HWND) clockRegistry.windows[i], &digitRect, FALSE);
+        } /* for slot */
+    } /* for i */
+} /* TickClocks() */
+
 /******************************************************************************/
 /* ClockWndProc -- message handling for the clock window.                     */
+/* The window's user data is the registry handle of its clock.                */
 /******************************************************************************/
 LRESULT WINAPI ClockWndProc (HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
     HDC hdc;
-    HPEN litPen, darkPen;
     PAINTSTRUCT ps;
-    int oldMapMode;
-    ClockInfoStruct *clockInfo;
-    int hours;
-    UINT tens, ones, xOffset;
-    char *newName;
-    short int newOffset;
-    time_t now;
-    struct tm gmtTime;
-    int textWidth;
+    int oldMapMode, gdiCalls;
+    int64_t startNs;
+    ClockHandle handle;
+    ClockWinStruct *clockWin;
+    int index;
+    RECT clientRect;
     POINT point;
-    SIZE textSize;
 
-    switch (message)
+    if (message == WM_CREATE)
     {
-        case WM_CREATE:
-            clockInfo = (ClockInfoStruct *) wmalloc(sizeof(ClockInfoStruct));
-            clockInfo->gmtOffset = 0;
-            clockInfo->locationName = NULL;
-            SetWindowLongPtr(hwnd, GWLP_USERDATA, (LONG_PTR) clockInfo);
-            return(0);
+        handle = (ClockHandle) (UINT_PTR) ((LPCREATESTRUCT) lParam)->lpCreateParams;
+        index = ClockRegIndexOf(&clockRegistry, handle);
+        if (index < 0)
+            return(-1);
+        SetWindowLongPtr(hwnd, GWLP_USERDATA, (LONG_PTR) handle);
+        ClockRegSetWindow(&clockRegistry, index, hwnd);
+        clockWin = (ClockWinStruct *) ClockRegSidecar(&clockRegistry, index);
+        clockWin->backBrush = GdiCacheAcquireBrush(SEG_TO_COLORREF(clockRegistry.themes[index].backColor));
+        clockWin->labelFont = NULL;
+        return(0);
+    }
 
-        case CLOCK_PARAMS_MSG:
-            clockInfo = (ClockInfoStruct *) (LONG_PTR) GetWindowLongPtr(hwnd, GWLP_USERDATA);
-            newName = (char *) lParam;
-            newOffset = (short int) wParam;
-            if (clockInfo->locationName != NULL)
-                wfree(clockInfo->locationName);
-            clockInfo->locationName = (char *) wmalloc(strlen(newName) +1);
-            strcpy_s(clockInfo->locationName, CLOCK_NAME_SIZE, newName);
-            clockInfo->gmtOffset = newOffset;
-            return(0);
+    handle = (ClockHandle) GetWindowLongPtr(hwnd, GWLP_USERDATA);
+    index = ClockRegIndexOf(&clockRegistry, handle);
+    if (index < 0)
+        return DefWindowProc (hwnd, message, wParam, lParam);
+    clockWin = (ClockWinStruct *) ClockRegSidecar(&clockRegistry, index);
+
+    switch (message)
+    {
+        case WM_ERASEBKGND:
+            GetClientRect(hwnd, &clientRect);
+            FillRect((HDC) wParam, &clientRect, clockWin->backBrush);
+            StatsGdiCalls(1);
+            return(1);
 
         case WM_PAINT:
-            clockInfo = (ClockInfoStruct *) (LONG_PTR) GetWindowLongPtr(hwnd, GWLP_USERDATA);
-            now = time(NULL);
-			gmtime_s(&gmtTime, &now);
+            startNs = StatsNowNs();
+            EnsureTicked(index);
             hdc = BeginPaint (hwnd, &ps);
-            hours = gmtTime.tm_hour + clockInfo->gmtOffset;
-            if (hours < 0)
-                hours += 24;
-            else
-                if (hours > 23)
-                    hours -= 24;
-
             oldMapMode = SetMapMode(hdc, MM_TEXT);
-            xOffset = 3;
-            tens = hours / 10;
-            ones = hours - tens * 10;
-
-            litPen  = CreatePen(PS_SOLID, 2, RGB(255,  0,  0));
-            darkPen = CreatePen(PS_SOLID, 2, RGB(255,255,255));
-            
-            DrawDigit(hdc, xOffset, CLOCK_Y_OFFSET, tens, litPen, darkPen);
-            xOffset += DIGIT_WIDTH;
-            DrawDigit(hdc, xOffset, CLOCK_Y_OFFSET, ones, litPen, darkPen);
-            xOffset += DIGIT_WIDTH;
-            DrawColon(hdc, xOffset, CLOCK_Y_OFFSET, TRUE, litPen, darkPen);
-            xOffset += COLON_WIDTH;
-            tens = gmtTime.tm_min / 10;
-            ones = gmtTime.tm_min - tens * 10;
-            DrawDigit(hdc, xOffset, CLOCK_Y_OFFSET, tens, litPen, darkPen);
-            xOffset += DIGIT_WIDTH;
-            DrawDigit(hdc, xOffset, CLOCK_Y_OFFSET, ones, litPen, darkPen);
-#ifdef SHOW_SECONDS
-            xOffset += DIGIT_WIDTH;
-            DrawColon(hdc, xOffset, CLOCK_Y_OFFSET, TRUE, litPen, darkPen);
-            xOffset += COLON_WIDTH;
-            tens = gmtTime.tm_sec / 10;
-            ones = gmtTime.tm_sec - tens * 10;
-            DrawDigit(hdc, xOffset, CLOCK_Y_OFFSET, tens, litPen, darkPen);
-            xOffset += DIGIT_WIDTH;
-            DrawDigit(hdc, xOffset, CLOCK_Y_OFFSET, ones, litPen, darkPen);
-#endif
-            DeleteObject(litPen);
-            DeleteObject(darkPen);
-            
-            if (clockInfo->locationName != NULL)
+            if (faceBuffer.pixels != NULL && glyphAtlas != NULL)
             {
-                GetTextExtentPoint32(hdc, clockInfo->locationName, (int) strlen(clockInfo->locationName), &textSize);
-                textWidth = textSize.cx;
-                TextOutA(hdc,
-                        (int)(CLOCK_DISPLAY_WIDTH - textWidth) / 2,
-                        DIGIT_HEIGHT - 2,
-                        clockInfo->locationName, 
-						(int) strlen(clockInfo->locationName));
+                SegRenderFaceMask(glyphAtlas, &faceBuffer, 0, 0, clockRegistry.shownMasks[index]);
+                SetDIBitsToDevice(hdc, 0, 0, faceBuffer.width, faceBuffer.height,
+                                  0, 0, 0, faceBuffer.height,
+                                  faceBuffer.pixels, &faceBitmapInfo, DIB_RGB_COLORS);
             }
+
+            gdiCalls = 5 + PaintLabel(hdc, index, clockWin);
             SetMapMode(hdc, oldMapMode);
             EndPaint (hwnd, &ps);
+            StatsGdiCalls(gdiCalls);
+            StatsCount(STAT_PAINTS, 1);
+            StatsRecord(STAT_PAINT_US, (uint64_t) (StatsNowNs() - startNs) / 1000);
             return(0);
 
         case WM_RBUTTONDOWN:
@@ -152,59 +833,16 @@ LRESULT WINAPI ClockWndProc (HWND hwnd, UINT message, WPARAM wParam, LPARAM lPar
         case WM_COMMAND:
             return(SendMessage(GetParent(hwnd), WM_COMMAND, wParam, (LPARAM) hwnd));
 
-        case WM_DESTROY: /* clean up data and close the window */
-            clockInfo = (ClockInfoStruct *) (LONG_PTR) GetWindowLongPtr(hwnd, GWLP_USERDATA);
-            wfree(clockInfo->locationName);
-            wfree(clockInfo);
+        case WM_DESTROY: /* the clock scrolled away or is being deleted; it stays in the registry */
+            GdiCacheRelease(clockWin->backBrush);
+            GdiCacheRelease(clockWin->labelFont);
+            if (clockWin->labelBitmap != NULL)
+                DeleteObject(clockWin->labelBitmap);
+            memset(clockWin, 0, sizeof(ClockWinStruct));
+            ClockRegSetWindow(&clockRegistry, index, NULL);
+            SetWindowLongPtr(hwnd, GWLP_USERDATA, 0);
             return(0);
 
     } /* switch */
     return DefWindowProc (hwnd, message, wParam, lParam);
 } /* ClockWndProc() */
-
-void DrawDigit(HDC hdc, UINT x, UINT y, UINT digit, HPEN litPen, HPEN darkPen)
-{
-    const unsigned char digitBitmap[10] = { 0x3f,
-                                            0x06,
-                                            0x5b,
-                                            0x4f,
-                                            0x66,
-                                            0x6d,
-                                            0x7d,
-                                            0x07,
-                                            0x7f,
-                                            0x6f };
-
-    const SegmentVectorsStruct segmentVectors[7] = {{ 2, 0,10, 0},
-                                                    {13, 2,13,12},
-                                                    {13,16,13,26},
-                                                    { 2,28,10,28},
-                                                    { 0,16, 0,26},
-                                                    { 0, 2, 0,12},
-                                                    { 2,14,10,14}};
-    int i;
-    HPEN oldPen;
-
-    if (digit > 9)
-        return;
-    oldPen = SelectObject(hdc, litPen);
-    for (i = 0; i < 7; i++)
-    {
-        if (digitBitmap[digit] & (1 << i))
-            SelectObject(hdc, litPen);
-        else
-            SelectObject(hdc, darkPen);
-        MoveToEx(hdc, segmentVectors[i].startX + x, segmentVectors[i].startY + y, NULL);
-        LineTo(hdc, segmentVectors[i].endX   + x, segmentVectors[i].endY   + y);
-    } /* for i */
-    SelectObject(hdc, oldPen);
-} /* DrawDigit */
-
-void DrawColon(HDC hdc, UINT x, UINT y, UINT onOff, HPEN litPen, HPEN darkPen)
-{
-    HPEN oldPen;
-    oldPen = SelectObject(hdc, onOff ? litPen : darkPen);
-    Rectangle(hdc, x, y + DIGIT_HEIGHT * 3 / 10, x + 2, y + DIGIT_HEIGHT * 3 / 10 + 2);
-    Rectangle(hdc, x, y + DIGIT_HEIGHT * 6 / 10, x + 2, y + DIGIT_HEIGHT * 6 / 10 + 2);
-    SelectObject(hdc, oldPen);
-} /* DrawColon */
@@ -1,18 +1,24 @@
+#include "segrender.h"
+#include "wclayout.h"
+
 void RegisterClockClass(HINSTANCE hInstance);
+void TickClocks(const TickSnapshotStruct *tick);
+void RedrawClock(ClockHandle handle);
+int  ClockSetScale(int scale);
+void ClockTileSize(int *width, int *height);
+int  ClockWindowLayout(HWND parentWindow, const ClockLayoutStruct *layout);
 
-#define SHOW_SECONDS 
+void        CompositorAttach(HWND hwnd);
+void        CompositorDetach(void);
+int         CompositorActive(void);
+int         CompositorLayout(const ClockLayoutStruct *layout);
+void        CompositorPaint(HDC hdc, const RECT *rect);
+ClockHandle CompositorHitTest(int x, int y);
+int         CompositorStartThread(int showSeconds, int threads);
+void        CompositorBeginChange(void);
+void        CompositorEndChange(void);
+void        CompositorFrameReady(void);
 
 #define CLOCK_CLASS_NAME "ClockClass"
-#define DIGIT_WIDTH  18
-#define DIGIT_HEIGHT 34
-#define COLON_WIDTH  5
-#ifdef SHOW_SECONDS
-#define CLOCK_DISPLAY_WIDTH  (DIGIT_WIDTH * 6 + COLON_WIDTH * 2 + 6)
-#else
-#define CLOCK_DISPLAY_WIDTH  (DIGIT_WIDTH * 4 + COLON_WIDTH + 6)
-#endif
-#define CLOCK_DISPLAY_HEIGHT (DIGIT_HEIGHT + 15)
-#define CLOCK_Y_OFFSET 2
-
-#define CLOCK_PARAMS_MSG (WM_USER + 1)
 
+#define SEG_TO_COLORREF(c) RGB(((c) >> 16) & 0xff, ((c) >> 8) & 0xff, (c) & 0xff)
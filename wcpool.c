@@ -0,0 +1,262 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcpool.c -- work-stealing thread pool for independent tile jobs          */
+/*                                                                            */
+/* PoolFor() splits the items into one contiguous share per thread, the       */
+/* caller's included.  Each thread works through its own share a grain at a   */
+/* time from the front; a thread that runs out takes the back half of         */
+/* another's share.  Items are only ever handed out once, so a job that       */
+/* writes nothing but its own items gives the same result on any number of    */
+/* threads.  Each share has its own lock, held for a few instructions, and    */
+/* the pool lock is only taken to start and finish a PoolFor().               */
+/******************************************************************************/
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include <string.h>
+#include "wcpool.h"
+
+#ifdef _WIN32
+#define PoolMutexInit(m)       InitializeCriticalSection(m)
+#define PoolMutexFree(m)       DeleteCriticalSection(m)
+#define PoolLock(m)            EnterCriticalSection(m)
+#define PoolUnlock(m)          LeaveCriticalSection(m)
+#define PoolConditionInit(c)   InitializeConditionVariable(c)
+#define PoolConditionFree(c)
+#define PoolWait(c, m)         SleepConditionVariableCS((c), (m), INFINITE)
+#define PoolSignalAll(c)       WakeAllConditionVariable(c)
+#else
+#define PoolMutexInit(m)       pthread_mutex_init((m), NULL)
+#define PoolMutexFree(m)       pthread_mutex_destroy(m)
+#define PoolLock(m)            pthread_mutex_lock(m)
+#define PoolUnlock(m)          pthread_mutex_unlock(m)
+#define PoolConditionInit(c)   pthread_cond_init((c), NULL)
+#define PoolConditionFree(c)   pthread_cond_destroy(c)
+#define PoolWait(c, m)         pthread_cond_wait((c), (m))
+#define PoolSignalAll(c)       pthread_cond_broadcast(c)
+#endif
+
+int PoolCpuCount(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+
+    GetSystemInfo(&info);
+    return((int) info.dwNumberOfProcessors);
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return(count > 0 ? (int) count : 1);
+#endif
+} /* PoolCpuCount() */
+
+/* the next grain of the thread's own share; returns 0 when it is used up */
+static int TakeOwn(PoolShareStruct *share, int grain, int *first, int *last)
+{
+    int taken = 0;
+
+    PoolLock(&share->lock);
+    if (share->next < share->end)
+    {
+        *first = share->next;
+        *last = (share->end - share->next > grain) ? share->next + grain : share->end;
+        share->next = *last;
+        taken = 1;
+    }
+    PoolUnlock(&share->lock);
+    return(taken);
+} /* TakeOwn() */
+
+/******************************************************************************/
+/* Steal -- move the back half of the first other share with items left into  */
+/* the thread's own, which is empty.  Returns 0 when every share is empty.    */
+/******************************************************************************/
+static int Steal(PoolStruct *pool, int self)
+{
+    PoolShareStruct *victim, *own = &pool->shares[self];
+    int v, first = 0, last = 0;
+
+    for (v = 1; v < pool->threads && last == 0; v++)
+    {
+        victim = &pool->shares[(self + v) % pool->threads];
+        PoolLock(&victim->lock);
+        if (victim->next < victim->end)
+        {
+            first = victim->next + (victim->end - victim->next) / 2;
+            last = victim->end;
+            victim->end = first;
+        }
+        PoolUnlock(&victim->lock);
+    } /* for v */
+    if (last == 0)
+        return(0);
+    PoolLock(&own->lock);
+    own->next = first;
+    own->end = last;
+    own->steals++;
+    PoolUnlock(&own->lock);
+    return(1);
+} /* Steal() */
+
+static void RunShare(PoolStruct *pool, int self)
+{
+    int first, last;
+
+    for (;;)
+    {
+        if (TakeOwn(&pool->shares[self], pool->grain, &first, &last))
+            pool->job(pool->context, first, last);
+        else if (!Steal(pool, self))
+            break;
+    } /* for */
+} /* RunShare() */
+
+#ifdef _WIN32
+static DWORD WINAPI WorkerThread(LPVOID parameter)
+#else
+static void *WorkerThread(void *parameter)
+#endif
+{
+    PoolShareStruct *share = (PoolShareStruct *) parameter;
+    PoolStruct *pool = share->pool;
+    unsigned long seen = 0;
+
+    PoolLock(&pool->lock);
+    for (;;)
+    {
+        while (pool->generation == seen && !pool->stop)
+            PoolWait(&pool->wake, &pool->lock);
+        if (pool->stop)
+            break;
+        seen = pool->generation;
+        PoolUnlock(&pool->lock);
+        RunShare(pool, (int) (share - pool->shares));
+        PoolLock(&pool->lock);
+        if (--pool->running == 0)
+            PoolSignalAll(&pool->done);
+    } /* for */
+    PoolUnlock(&pool->lock);
+    return(0);
+} /* WorkerThread() */
+
+/******************************************************************************/
+/* PoolInit -- a pool of threads workers, the thread calling PoolFor()        */
+/* counted as one of them, so 1 starts no thread.  Returns the number there   */
+/* are, which is less than asked for if not all the threads started.          */
+/******************************************************************************/
+int PoolInit(PoolStruct *pool, int threads)
+{
+    int i;
+
+    memset(pool, 0, sizeof(PoolStruct));
+    if (threads < 1)
+        threads = 1;
+    if (threads > POOL_MAX_THREADS)
+        threads = POOL_MAX_THREADS;
+    for (i = 0; i < POOL_MAX_THREADS; i++)
+    {
+        pool->shares[i].pool = pool;
+        PoolMutexInit(&pool->shares[i].lock);
+    } /* for i */
+    PoolMutexInit(&pool->lock);
+    PoolConditionInit(&pool->wake);
+    PoolConditionInit(&pool->done);
+
+    pool->threads = 1;
+    for (i = 1; i < threads; i++)
+    {
+#ifdef _WIN32
+        pool->workers[i - 1] = CreateThread(NULL, 0, WorkerThread, &pool->shares[i], 0, NULL);
+        if (pool->workers[i - 1] == NULL)
+            break;
+#else
+        if (pthread_create(&pool->workers[i - 1], NULL, WorkerThread, &pool->shares[i]) != 0)
+            break;
+#endif
+        pool->threads++;
+    } /* for i */
+    return(pool->threads);
+} /* PoolInit() */
+
+void PoolFree(PoolStruct *pool)
+{
+    int i;
+
+    PoolLock(&pool->lock);
+    pool->stop = 1;
+    PoolSignalAll(&pool->wake);
+    PoolUnlock(&pool->lock);
+    for (i = 1; i < pool->threads; i++)
+    {
+#ifdef _WIN32
+        WaitForSingleObject(pool->workers[i - 1], INFINITE);
+        CloseHandle(pool->workers[i - 1]);
+#else
+        pthread_join(pool->workers[i - 1], NULL);
+#endif
+    } /* for i */
+    for (i = 0; i < POOL_MAX_THREADS; i++)
+        PoolMutexFree(&pool->shares[i].lock);
+    PoolMutexFree(&pool->lock);
+    PoolConditionFree(&pool->wake);
+    PoolConditionFree(&pool->done);
+    memset(pool, 0, sizeof(PoolStruct));
+} /* PoolFree() */
+
+/******************************************************************************/
+/* PoolFor -- call job for items 0 to count - 1 in ranges of at most grain,   */
+/* spread over the pool, and return when all are done.  Only one thread may   */
+/* call it at a time.                                                         */
+/******************************************************************************/
+void PoolFor(PoolStruct *pool, int count, int grain, PoolJobFunc job, void *context)
+{
+    int i;
+
+    if (count <= 0)
+        return;
+    if (grain < 1)
+        grain = 1;
+    if (pool == NULL || pool->threads == 1 || count <= grain)
+    {
+        job(context, 0, count);
+        return;
+    }
+
+    PoolLock(&pool->lock);
+    pool->job = job;
+    pool->context = context;
+    pool->grain = grain;
+    for (i = 0; i < pool->threads; i++)
+    {
+        pool->shares[i].next = (int) ((long long) count * i / pool->threads);
+        pool->shares[i].end = (int) ((long long) count * (i + 1) / pool->threads);
+    } /* for i */
+    pool->running = pool->threads - 1;
+    pool->generation++;
+    PoolSignalAll(&pool->wake);
+    PoolUnlock(&pool->lock);
+
+    RunShare(pool, 0);
+
+    PoolLock(&pool->lock);
+    while (pool->running != 0)
+        PoolWait(&pool->done, &pool->lock);
+    PoolUnlock(&pool->lock);
+} /* PoolFor() */
+
+/* ranges taken by stealing since PoolInit(), a measure of imbalance */
+unsigned long PoolSteals(const PoolStruct *pool)
+{
+    unsigned long steals = 0;
+    int i;
+
+    for (i = 0; i < pool->threads; i++)
+        steals += pool->shares[i].steals;
+    return(steals);
+} /* PoolSteals() */
@@ -0,0 +1,67 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcpool.h -- work-stealing thread pool for independent tile jobs          */
+/******************************************************************************/
+
+#ifndef WCPOOL_H
+#define WCPOOL_H
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#define POOL_MAX_THREADS 64
+#define POOL_LINE        64     /* bytes; keeps each share on a cache line of its own */
+
+/* one call does items [first, last) */
+typedef void (*PoolJobFunc)(void *context, int first, int last);
+
+#ifdef _WIN32
+typedef CRITICAL_SECTION   PoolMutex;
+typedef CONDITION_VARIABLE PoolCondition;
+typedef HANDLE             PoolThread;
+#else
+typedef pthread_mutex_t    PoolMutex;
+typedef pthread_cond_t     PoolCondition;
+typedef pthread_t          PoolThread;
+#endif
+
+struct PoolStructTag;
+
+/* the items one thread has left; others steal from the end */
+typedef struct PoolShareStructTag {
+    struct PoolStructTag *pool;
+    PoolMutex lock;
+    int next;
+    int end;
+    unsigned long steals;       /* ranges this thread took from others */
+    char pad[POOL_LINE];
+} PoolShareStruct;
+
+typedef struct PoolStructTag {
+    int threads;                /* the caller included */
+    PoolThread workers[POOL_MAX_THREADS - 1];
+    PoolShareStruct shares[POOL_MAX_THREADS];
+    PoolMutex lock;             /* guards the fields below */
+    PoolCondition wake;
+    PoolCondition done;
+    unsigned long generation;   /* one per PoolFor() */
+    int running;                /* workers not yet through this generation */
+    int stop;
+    PoolJobFunc job;
+    void *context;
+    int grain;
+} PoolStruct;
+
+int  PoolCpuCount(void);
+int  PoolInit(PoolStruct *pool, int threads);
+void PoolFree(PoolStruct *pool);
+void PoolFor(PoolStruct *pool, int count, int grain, PoolJobFunc job, void *context);
+unsigned long PoolSteals(const PoolStruct *pool);
+
+#endif /* WCPOOL_H */
@@ -0,0 +1,659 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcrender.c -- headless renderer: clock faces to image files              */
+/*                                                                            */
+/* Usage: wcrender [options]                                                  */
+/*   -i file     clock set in WorldClock.ini format (./WorldClock.ini)        */
+/*   -t instant  first instant, Unix seconds or YYYY-MM-DDTHH:MM:SSZ (now)    */
+/*   -e instant  last instant (the first)                                     */
+/*   -s seconds  step between frames (1)                                      */
+/*   -o pattern  output file; a printf %d pattern numbers the frames, "-" is  */
+/*               stdout (a stream of images), one name for several PPM        */
+/*               frames concatenates them                                     */
+/*               (frame%06d.ppm)                                              */
+/*   -f ppm|png  image format (from the output name, else ppm)                */
+/*   -v          stack the clocks vertically                                  */
+/*   -c          print each frame's checksum instead of writing images        */
+/*   -n          render only, for timing                                      */
+/*   -S          simulate: run the tick scheduler on a simulated clock from   */
+/*               the first instant to the last and render each tick it fires, */
+/*               as WM_TIMER does, instead of stepping by -s                  */
+/*   -j ms       with -S, fire each timer up to ms late (0..999, 0)           */
+/*   -x          verify every frame: each clock against the C library's       */
+/*               gmtime() and localtime(), -S ticks for skipped or repeated   */
+/*               seconds, and once a minute the incrementally drawn frame     */
+/*               against a full redraw; exits 1 on any mismatch               */
+/*   -T          render on a second thread, as the Windows render thread      */
+/*               does, and output only the latest finished frame each time   */
+/*               the main thread asks, so frames may be skipped; with -x,     */
+/*               a stress test of the hand-off (build with -pthread, and      */
+/*               -fsanitize=thread to check it)                               */
+/*   -P threads  draw the tiles of each frame on a pool of this many threads, */
+/*               0 for one per processor (1); the images are the same for     */
+/*               any number                                                   */
+/*   -z percent  scale the clock faces, 100..800 (100); labels keep the       */
+/*               bitmap font's size                                           */
+/* A frame rate summary goes to stderr.                                       */
+/*                                                                            */
+/* -S with -n runs a simulated year of WM_TIMER ticks in seconds, e.g.        */
+/*   wcrender -S -x -n -t 2024-01-01 -e 2024-12-31T23:59:59                   */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "clockreg.h"
+#include "wcsetup.h"
+#include "wclayout.h"
+#include "wcframe.h"
+#include "wcimage.h"
+#include "ticksched.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#define AtomicStore(target, value) InterlockedExchange((target), (value))
+#define AtomicLoad(target)         InterlockedCompareExchange((target), 0, 0)
+#else
+#include <pthread.h>
+#define AtomicStore(target, value) __atomic_store_n((target), (value), __ATOMIC_RELEASE)
+#define AtomicLoad(target)         __atomic_load_n((target), __ATOMIC_ACQUIRE)
+#endif
+
+typedef struct RenderOptionsStructTag {
+    const char *iniFile;
+    int64_t start;
+    int64_t end;
+    int64_t step;
+    const char *output;
+    ImageFormat format;
+    int vertical;
+    int checksums;
+    int renderOnly;
+    int simulate;
+    int jitterMs;
+    int verify;
+    int threaded;
+    int poolThreads;
+    int scale;
+} RenderOptionsStruct;
+
+static ClockRegistryStruct registry;
+static ClockLayoutStruct tiles;
+static GlyphAtlasStruct atlas;
+static FrameStruct rendered;            /* single-threaded */
+static FrameExchangeStruct exchange;    /* -T */
+static PoolStruct tilePool;             /* -P */
+static FrameBufferStruct fullFrame;     /* -x: the same instant drawn from scratch */
+static FrameBufferStruct savedFrame;    /* -x: the last frame of the previous minute */
+static int32_t *referenceOffsets;       /* -x: per clock, from the C library */
+static int64_t *referenceMinutes;       /* the UTC minute they are for */
+static int32_t *referenceSeconds;       /* local second of the day at that minute */
+static long mismatches;
+
+static int Usage(void)
+{
+    fprintf(stderr, "usage: wcrender [-i file] [-t instant] [-e instant] [-s seconds]\n"
+                    "                [-o pattern] [-f ppm|png] [-v] [-c] [-n] [-S [-j ms]] [-x] [-T]\n"
+                    "                [-P threads] [-z percent]\n");
+    return(2);
+} /* Usage() */
+
+static int ParseOptions(int argc, char *argv[], RenderOptionsStruct *options)
+{
+    const char *dot;
+    int i, formatGiven = 0;
+
+    options->iniFile = "./WorldClock.ini";
+    options->start = (int64_t) time(NULL);
+    options->end = INT64_MIN;
+    options->step = 1;
+    options->output = "frame%06d.ppm";
+    options->format = IMAGE_PPM;
+    options->vertical = 0;
+    options->checksums = 0;
+    options->renderOnly = 0;
+    options->simulate = 0;
+    options->jitterMs = 0;
+    options->verify = 0;
+    options->threaded = 0;
+    options->poolThreads = 1;
+    options->scale = SEG_SCALE_ONE;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (argv[i][0] != '-' || argv[i][1] == '\0' || argv[i][2] != '\0')
+            return(0);
+        switch (argv[i][1])
+        {
+            case 'v': options->vertical = 1; continue;
+            case 'c': options->checksums = 1; continue;
+            case 'n': options->renderOnly = 1; continue;
+            case 'S': options->simulate = 1; continue;
+            case 'x': options->verify = 1; continue;
+            case 'T': options->threaded = 1; continue;
+        } /* switch flag */
+        if (i + 1 >= argc)
+            return(0);
+        switch (argv[i][1])
+        {
+            case 'i':
+                options->iniFile = argv[++i];
+                break;
+            case 't':
+                if (!TickParseInstant(argv[++i], &options->start))
+                    return(0);
+                break;
+            case 'e':
+                if (!TickParseInstant(argv[++i], &options->end))
+                    return(0);
+                break;
+            case 's':
+                options->step = strtoll(argv[++i], NULL, 10);
+                if (options->step <= 0)
+                    return(0);
+                break;
+            case 'j':
+                options->jitterMs = atoi(argv[++i]);
+                if (options->jitterMs < 0 || options->jitterMs > 999)
+                    return(0);
+                break;
+            case 'P':
+                options->poolThreads = atoi(argv[++i]);
+                if (options->poolThreads < 0 || options->poolThreads > POOL_MAX_THREADS)
+                    return(0);
+                break;
+            case 'z':
+                options->scale = atoi(argv[++i]);
+                if (options->scale < SEG_SCALE_MIN || options->scale > SEG_SCALE_MAX)
+                    return(0);
+                break;
+            case 'o':
+                options->output = argv[++i];
+                break;
+            case 'f':
+                i++;
+                if (strcmp(argv[i], "png") == 0)
+                    options->format = IMAGE_PNG;
+                else if (strcmp(argv[i], "ppm") == 0)
+                    options->format = IMAGE_PPM;
+                else
+                    return(0);
+                formatGiven = 1;
+                break;
+            default:
+                return(0);
+        } /* switch option */
+    } /* for i */
+
+    if (options->end == INT64_MIN)
+        options->end = options->start;
+    if (options->end < options->start)
+        return(0);
+    dot = strrchr(options->output, '.');
+    if (!formatGiven && dot != NULL && strcmp(dot, ".png") == 0)
+        options->format = IMAGE_PNG;
+    return(1);
+} /* ParseOptions() */
+
+/* bring every clock to the instant, redrawing only changed digits */
+static int RenderInstant(FrameStruct *frame, int64_t instant)
+{
+    TickSnapshotStruct tick;
+
+    TickTakeSnapshot(&tick, instant);
+    return(FrameRender(frame, &registry, &tiles, &atlas, &tick, 1, &tilePool));
+} /* RenderInstant() */
+
+/******************************************************************************/
+/* Simulation (-S): the scheduler worldclock.c runs, on a clock that jumps    */
+/* straight to each timer expiry, so ticks cost only the rendering.           */
+/******************************************************************************/
+typedef struct SimulationStructTag {
+    TickSimClockStruct clock;
+    TickSchedulerStruct scheduler;
+    uint32_t seed;              /* for -j, fixed so runs repeat exactly */
+} SimulationStruct;
+
+/* the instants to render, and what became of them */
+typedef struct ProducerStructTag {
+    const RenderOptionsStruct *options;
+    SimulationStruct simulation;
+    int64_t instant;
+    long frames;
+    int failed;
+    volatile long done;         /* -T: set by the render thread at the end */
+    volatile long stop;         /* -T: set by the main thread to end early */
+} ProducerStruct;
+
+/* the instant painted at startup, before the first timer */
+static int64_t FirstInstant(const RenderOptionsStruct *options, SimulationStruct *sim)
+{
+    if (options->simulate)
+    {
+        TickSimClockInit(&sim->clock, options->start * NS_PER_SECOND);
+        TickSchedInit(&sim->scheduler, &sim->clock.source, 1);
+        sim->seed = 1;
+    }
+    return(options->start);
+} /* FirstInstant() */
+
+static int64_t NextInstant(const RenderOptionsStruct *options, SimulationStruct *sim, int64_t instant)
+{
+    int64_t waitNs;
+
+    if (!options->simulate)
+        return(instant + options->step);
+    waitNs = (int64_t) TickSchedArm(&sim->scheduler) * NS_PER_MS;
+    if (options->jitterMs > 0)
+    {
+        /* fire up to jitterMs early or late, as Windows timers do */
+        sim->seed = sim->seed * 1103515245u + 12345u;
+        waitNs += ((int64_t) ((sim->seed >> 8) % (2 * options->jitterMs + 1)) - options->jitterMs) * NS_PER_MS;
+        if (waitNs < 0)
+            waitNs = 0;
+    }
+    TickSimClockAdvance(&sim->clock, waitNs);
+    return(TickSchedFired(&sim->scheduler));
+} /* NextInstant() */
+
+/******************************************************************************/
+/* Verification (-x)                                                          */
+/******************************************************************************/
+static void Mismatch(int64_t instant, const char *what, int index)
+{
+    if (mismatches++ < 10)
+        fprintf(stderr, "wcrender: at %lld %s%s%s\n", (long long) instant, what,
+                index >= 0 ? " for " : "", index >= 0 ? ClockRegLabel(&registry, index) : "");
+} /* Mismatch() */
+
+/* a zone clock's offset at instant according to the C library */
+static int32_t ReferenceOffset(int index, int64_t instant)
+{
+#ifdef _WIN32
+    return(ClockRegOffsetAt(&registry, index, instant));   /* no independent zone source */
+#else
+    static char currentTz[1024];
+    char tz[1024];
+    time_t t = (time_t) instant;
+    struct tm *parts;
+
+    snprintf(tz, sizeof(tz), ":%s/%s", TzDefaultZoneDir(), registry.zoneNames[index]);
+    if (strcmp(tz, currentTz) != 0)
+    {
+        setenv("TZ", tz, 1);
+        tzset();
+        strcpy(currentTz, tz);
+    }
+    parts = localtime(&t);
+    if (parts == NULL)
+        return(0);
+    return((int32_t) (TickDaysFromCivil(parts->tm_year + 1900LL, parts->tm_mon + 1, parts->tm_mday) * SECONDS_PER_DAY +
+                      parts->tm_hour * 3600 + parts->tm_min * 60 + parts->tm_sec - instant));
+#endif
+} /* ReferenceOffset() */
+
+/* local second of the day at instant with the given offset, by gmtime() */
+static int32_t ReferenceSecondOfDay(int64_t instant, int32_t offset)
+{
+    time_t local = (time_t) (instant + offset);
+    struct tm *parts = gmtime(&local);
+
+    if (parts == NULL)
+        return(-1);
+    return(parts->tm_hour * 3600 + parts->tm_min * 60 + parts->tm_sec);
+} /* ReferenceSecondOfDay() */
+
+/* the C library is slow, so each clock is looked up once per UTC minute */
+static void ReferenceMinute(int index, int64_t minute)
+{
+    referenceMinutes[index] = minute;
+    if (registry.zones[index] == NULL)
+        referenceOffsets[index] = registry.gmtOffsets[index];
+    else
+        referenceOffsets[index] = ReferenceOffset(index, minute);
+    referenceSeconds[index] = ReferenceSecondOfDay(minute, referenceOffsets[index]);
+} /* ReferenceMinute() */
+
+/******************************************************************************/
+/* VerifyClock -- compare what a clock shows with the C library.  Within a    */
+/* minute the reference time is counted on from the minute's lookup; on a     */
+/* disagreement the instant itself is looked up, in case a zone transition    */
+/* fell inside the minute, before it counts as a mismatch.                    */
+/******************************************************************************/
+static void VerifyClock(int index, int64_t instant, uint64_t shown)
+{
+    int64_t minute = instant - ((instant % 60) + 60) % 60;
+    int32_t secondOfDay, offset;
+
+    if (referenceMinutes[index] != minute)
+        ReferenceMinute(index, minute);
+    secondOfDay = referenceSeconds[index] + (int32_t) (instant - minute);
+    if (secondOfDay >= SECONDS_PER_DAY)
+        secondOfDay -= SECONDS_PER_DAY;
+    if (referenceSeconds[index] >= 0 &&
+        shown == SegFaceMask(secondOfDay / 3600, secondOfDay / 60 % 60, secondOfDay % 60))
+        return;
+    offset = (registry.zones[index] == NULL) ? registry.gmtOffsets[index] : ReferenceOffset(index, instant);
+    secondOfDay = ReferenceSecondOfDay(instant, offset);
+    if (secondOfDay < 0 ||
+        shown != SegFaceMask(secondOfDay / 3600, secondOfDay / 60 % 60, secondOfDay % 60))
+        Mismatch(instant, "wrong time shown", index);
+} /* VerifyClock() */
+
+static int FramesEqual(const FrameBufferStruct *a, const FrameBufferStruct *b)
+{
+    int y;
+
+    for (y = 0; y < a->height; y++)
+    {
+        if (memcmp(a->pixels + (size_t) y * a->stride, b->pixels + (size_t) y * b->stride,
+                   (size_t) a->width * sizeof(uint32_t)) != 0)
+            return(0);
+    } /* for y */
+    return(1);
+} /* FramesEqual() */
+
+/* is b the same as a outside area? */
+static int SameOutside(const FrameBufferStruct *a, const FrameBufferStruct *b, const LayoutRectStruct *area)
+{
+    const uint32_t *rowA, *rowB;
+    int y, left, right;
+
+    for (y = 0; y < a->height; y++)
+    {
+        rowA = a->pixels + (size_t) y * a->stride;
+        rowB = b->pixels + (size_t) y * b->stride;
+        left = right = a->width;
+        if (y >= area->top && y < area->bottom && area->left < area->right)
+        {
+            left = area->left;
+            right = area->right;
+        }
+        if (memcmp(rowA, rowB, (size_t) left * sizeof(uint32_t)) != 0 ||
+            memcmp(rowA + right, rowB + right, (size_t) (a->width - right) * sizeof(uint32_t)) != 0)
+            return(0);
+    } /* for y */
+    return(1);
+} /* SameOutside() */
+
+/******************************************************************************/
+/* VerifyFrame -- every clock's time; the order of frames; and once a minute  */
+/* the pixels against a full redraw, and the changed area against the frame   */
+/* before, kept from the end of the previous minute.                          */
+/******************************************************************************/
+static void VerifyFrame(const RenderOptionsStruct *options, const FrameStruct *frame)
+{
+    static int64_t previousInstant;
+    static uint32_t previousSequence, savedSequence;
+    int64_t instant = frame->utcSeconds;
+    int i;
+
+    for (i = 0; i < registry.count; i++)
+        VerifyClock(i, instant, frame->masks[i]);
+    if (previousSequence != 0)
+    {
+        if (frame->sequence <= previousSequence)
+            Mismatch(instant, "frame published out of order", -1);
+        else if (options->threaded ? instant <= previousInstant : options->simulate && instant != previousInstant + 1)
+            Mismatch(instant, instant > previousInstant + 1 ? "tick skipped a second" : "tick repeated a second", -1);
+    }
+    previousInstant = instant;
+    previousSequence = frame->sequence;
+
+    if (((instant % 60) + 60) % 60 == 0 || frame->sequence == 1)
+    {
+        for (i = 0; i < registry.count; i++)
+            FrameDrawTile(&fullFrame, &registry, &tiles, &atlas, i, frame->masks[i]);
+        if (!FramesEqual(&fullFrame, &frame->surface))
+            Mismatch(instant, "incremental frame differs from a full redraw", -1);
+        if (savedSequence == frame->sequence - 1 && !SameOutside(&savedFrame, &frame->surface, &frame->changed))
+            Mismatch(instant, "frame changed outside its changed area", -1);
+    }
+    savedSequence = 0;
+    if (((instant % 60) + 60) % 60 == 59)
+    {
+        memcpy(savedFrame.pixels, frame->surface.pixels, (size_t) savedFrame.stride * savedFrame.height * sizeof(uint32_t));
+        savedSequence = frame->sequence;
+    }
+} /* VerifyFrame() */
+
+static FILE *OpenFrame(const RenderOptionsStruct *options, long frameNumber, FILE *shared)
+{
+    char path[1024];
+    FILE *file;
+
+    if (strcmp(options->output, "-") == 0)
+        return(stdout);
+    if (strchr(options->output, '%') == NULL)
+    {
+        if (shared != NULL)
+            return(shared);
+        return(fopen(options->output, "wb"));
+    }
+    if (snprintf(path, sizeof(path), options->output, frameNumber) >= (int) sizeof(path))
+        return(NULL);
+    file = fopen(path, "wb");
+    if (file == NULL)
+        fprintf(stderr, "wcrender: cannot create %s\n", path);
+    return(file);
+} /* OpenFrame() */
+
+
+/* write, print or just verify one finished frame; returns 0 on failure */
+static int OutputFrame(const RenderOptionsStruct *options, const FrameStruct *frame, long frameNumber,
+                       ImageWriterStruct *writer, FILE **shared)
+{
+    FILE *file;
+    int ok;
+
+    if (options->verify)
+        VerifyFrame(options, frame);
+    if (options->checksums)
+    {
+        printf("%lld %08lx\n", (long long) frame->utcSeconds, (unsigned long) ImageChecksum(&frame->surface));
+        return(1);
+    }
+    if (options->renderOnly)
+        return(1);
+    file = OpenFrame(options, frameNumber, *shared);
+    if (file == NULL)
+        return(0);
+    ok = ImageWrite(writer, file, &frame->surface, options->format);
+    if (!ok)
+        fprintf(stderr, "wcrender: write failed\n");
+    if (file != stdout && strchr(options->output, '%') == NULL)
+        *shared = file;
+    else if (file != stdout)
+        fclose(file);
+    return(ok);
+} /* OutputFrame() */
+
+/******************************************************************************/
+/* -T: the render thread.  It draws every instant and publishes it; the main  */
+/* thread takes whichever frame is latest when it is ready for one.           */
+/******************************************************************************/
+#ifdef _WIN32
+static DWORD WINAPI ProducerThread(LPVOID parameter)
+#else
+static void *ProducerThread(void *parameter)
+#endif
+{
+    ProducerStruct *producer = (ProducerStruct *) parameter;
+    const RenderOptionsStruct *options = producer->options;
+
+    for (producer->instant = FirstInstant(options, &producer->simulation);
+         producer->instant <= options->end && !AtomicLoad(&producer->stop);
+         producer->instant = NextInstant(options, &producer->simulation, producer->instant))
+    {
+        if (!RenderInstant(FrameBack(&exchange), producer->instant))
+        {
+            producer->failed = 1;
+            break;
+        }
+        FramePublish(&exchange);
+        producer->frames++;
+    } /* for instant */
+    AtomicStore(&producer->done, 1);
+    return(0);
+} /* ProducerThread() */
+
+int main(int argc, char *argv[])
+{
+    RenderOptionsStruct options;
+    ProducerStruct producer;
+    ImageWriterStruct writer;
+    FrameStruct *frame;
+    FILE *shared = NULL;
+    int64_t startNs, elapsedNs;
+    uint32_t lastSequence = 0;
+    long presented = 0;
+    int i, finished;
+    int result = 0;
+#ifdef _WIN32
+    HANDLE thread;
+#else
+    pthread_t thread;
+#endif
+
+    if (!ParseOptions(argc, argv, &options))
+        return(Usage());
+    if (options.format == IMAGE_PNG && strchr(options.output, '%') == NULL && strcmp(options.output, "-") != 0 &&
+        options.end > options.start && !options.checksums && !options.renderOnly)
+    {
+        fprintf(stderr, "wcrender: several PNG frames need a %%d pattern in -o\n");
+        return(2);
+    }
+
+    ClockRegInit(&registry, 0);
+    if (!SetupLoadClocks(&registry, options.iniFile, "wcrender") ||
+        !SegAtlasInitScaled(&atlas, options.scale,
+                            clockDefaultTheme.litColor, clockDefaultTheme.darkColor, clockDefaultTheme.backColor))
+    {
+        fprintf(stderr, "wcrender: out of memory\n");
+        return(1);
+    }
+    LayoutInit(&tiles, registry.count, options.vertical,
+               SegScaled(CLOCK_DISPLAY_WIDTH, options.scale), SegScaled(CLOCK_DISPLAY_HEIGHT, options.scale));
+    if (options.verify)
+    {
+        referenceOffsets = (int32_t *) malloc(registry.count * sizeof(int32_t));
+        referenceMinutes = (int64_t *) malloc(registry.count * sizeof(int64_t));
+        referenceSeconds = (int32_t *) malloc(registry.count * sizeof(int32_t));
+        if (referenceOffsets == NULL || referenceMinutes == NULL || referenceSeconds == NULL ||
+            !SegFrameBufferInit(&fullFrame, tiles.width, tiles.height) ||
+            !SegFrameBufferInit(&savedFrame, tiles.width, tiles.height))
+        {
+            fprintf(stderr, "wcrender: out of memory\n");
+            return(1);
+        }
+        for (i = 0; i < registry.count; i++)
+            referenceMinutes[i] = INT64_MIN;
+    }
+    FrameInit(&rendered);
+    FrameExchangeInit(&exchange);
+    PoolInit(&tilePool, options.poolThreads > 0 ? options.poolThreads : PoolCpuCount());
+    ImageWriterInit(&writer);
+    producer.options = &options;
+    producer.frames = 0;
+    producer.failed = 0;
+    producer.done = 0;
+    producer.stop = 0;
+
+    startNs = tickSystemClock.monotonicNs(tickSystemClock.context);
+    if (!options.threaded)
+    {
+        for (producer.instant = FirstInstant(&options, &producer.simulation); producer.instant <= options.end;
+             producer.instant = NextInstant(&options, &producer.simulation, producer.instant))
+        {
+            if (!RenderInstant(&rendered, producer.instant))
+            {
+                producer.failed = 1;
+                break;
+            }
+            rendered.sequence = (uint32_t) ++producer.frames;
+            if (!OutputFrame(&options, &rendered, presented++, &writer, &shared))
+            {
+                result = 1;
+                break;
+            }
+        } /* for instant */
+    }
+    else
+    {
+#ifdef _WIN32
+        thread = CreateThread(NULL, 0, ProducerThread, &producer, 0, NULL);
+        if (thread == NULL)
+#else
+        if (pthread_create(&thread, NULL, ProducerThread, &producer) != 0)
+#endif
+        {
+            fprintf(stderr, "wcrender: cannot start the render thread\n");
+            return(1);
+        }
+        do
+        { /* check for the end before taking the frame, so the last one is not missed */
+            finished = (int) AtomicLoad(&producer.done);
+            frame = FrameLatest(&exchange);
+            if (frame == NULL || frame->sequence == lastSequence)
+                continue;
+            lastSequence = frame->sequence;
+            if (!OutputFrame(&options, frame, presented++, &writer, &shared))
+            {
+                AtomicStore(&producer.stop, 1);
+                result = 1;
+                break;
+            }
+        } while (!finished);
+#ifdef _WIN32
+        WaitForSingleObject(thread, INFINITE);
+        CloseHandle(thread);
+#else
+        pthread_join(thread, NULL);
+#endif
+    }
+    elapsedNs = tickSystemClock.monotonicNs(tickSystemClock.context) - startNs;
+    if (shared != NULL)
+        fclose(shared);
+    if (producer.failed)
+    {
+        fprintf(stderr, "wcrender: out of memory\n");
+        result = 1;
+    }
+
+    fprintf(stderr, "wcrender: %ld frames of %dx%d in %.3f s, %.0f frames/s\n",
+            producer.frames, tiles.width, tiles.height, elapsedNs / 1e9,
+            elapsedNs > 0 ? producer.frames * 1e9 / elapsedNs : 0.0);
+    if (options.threaded)
+        fprintf(stderr, "wcrender: %ld frames taken by the main thread\n", presented);
+    if (tilePool.threads > 1)
+        fprintf(stderr, "wcrender: tiles drawn on %d threads, %lu ranges stolen\n",
+                tilePool.threads, PoolSteals(&tilePool));
+    if (options.simulate)
+        fprintf(stderr, "wcrender: %lu simulated timer ticks, %lu early, lateness mean %.3f ms max %.3f ms\n",
+                (unsigned long) producer.simulation.scheduler.jitter.ticks,
+                (unsigned long) producer.simulation.scheduler.jitter.earlyTicks,
+                TickSchedAverageLateNs(&producer.simulation.scheduler) / 1e6,
+                producer.simulation.scheduler.jitter.maxLateNs / 1e6);
+    if (options.verify)
+    {
+        fprintf(stderr, "wcrender: verified %ld frames, %ld mismatches\n", presented, mismatches);
+        if (mismatches != 0)
+            result = 1;
+    }
+
+    ImageWriterFree(&writer);
+    FrameFree(&rendered);
+    FrameExchangeFree(&exchange);
+    PoolFree(&tilePool);
+    SegFrameBufferFree(&fullFrame);
+    SegFrameBufferFree(&savedFrame);
+    free(referenceOffsets);
+    free(referenceMinutes);
+    free(referenceSeconds);
+    SegAtlasFree(&atlas);
+    ClockRegFree(&registry);
+    TzFreeAllZones();
+    return(result);
+} /* main() */
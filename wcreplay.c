@@ -0,0 +1,205 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcreplay.c -- reads a segment stream back and prints the clocks          */
+/*                                                                            */
+/* Usage: wcreplay [options] [source]                                         */
+/*   source      a stream as wcterm -o writes it: a file, - or nothing for    */
+/*               stdin, or unix:path to connect to wcterm -o unix:path        */
+/*   -n clocks   clocks printed per record (all)                              */
+/*   -q          print only the summary                                       */
+/* Prints one line per record: the instant, then each clock's label and the   */
+/* digits its segments show, as a remote display would light them.  A         */
+/* summary of records, keyframes and bytes goes to stderr at the end.         */
+/* Build with the portable sources:                                           */
+/*   cc -O2 -o wcreplay wcreplay.c wcstream.c segrender.c ticktime.c          */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wcstream.h"
+#include "ticktime.h"
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#else
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+#define REPLAY_UNIX_PREFIX "unix:"
+
+typedef struct ReplayOptionsStructTag {
+    const char *source;
+    int clocks;                 /* printed per record, -1 for all */
+    int quiet;
+} ReplayOptionsStruct;
+
+static int Usage(void)
+{
+    fprintf(stderr, "usage: wcreplay [-n clocks] [-q] [file|-|unix:path]\n");
+    return(2);
+} /* Usage() */
+
+static int ParseOptions(int argc, char *argv[], ReplayOptionsStruct *options)
+{
+    int i;
+
+    options->source = "-";
+    options->clocks = -1;
+    options->quiet = 0;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (argv[i][0] != '-' || argv[i][1] == '\0')
+        {
+            if (i != argc - 1)
+                return(0);
+            options->source = argv[i];
+            break;
+        }
+        if (argv[i][2] != '\0')
+            return(0);
+        switch (argv[i][1])
+        {
+            case 'n':
+                if (i + 1 >= argc)
+                    return(0);
+                options->clocks = atoi(argv[++i]);
+                if (options->clocks < 0)
+                    return(0);
+                break;
+            case 'q':
+                options->quiet = 1;
+                break;
+            default:
+                return(0);
+        } /* switch option */
+    } /* for i */
+    return(1);
+} /* ParseOptions() */
+
+/* the stream to read: a file, stdin, or a connection to a serving wcterm */
+static FILE *OpenSource(const char *source)
+{
+#ifndef _WIN32
+    struct sockaddr_un address;
+    FILE *file;
+    int connection;
+#endif
+
+    if (strcmp(source, "-") == 0)
+    {
+#ifdef _WIN32
+        _setmode(_fileno(stdin), _O_BINARY);
+#endif
+        return(stdin);
+    }
+    if (strncmp(source, REPLAY_UNIX_PREFIX, strlen(REPLAY_UNIX_PREFIX)) != 0)
+        return(fopen(source, "rb"));
+#ifdef _WIN32
+    fprintf(stderr, "wcreplay: no Unix sockets on Windows\n");
+    return(NULL);
+#else
+    source += strlen(REPLAY_UNIX_PREFIX);
+    if (strlen(source) >= sizeof(address.sun_path))
+        return(NULL);
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, source);
+    connection = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (connection < 0)
+        return(NULL);
+    if (connect(connection, (struct sockaddr *) &address, sizeof(address)) != 0 ||
+        (file = fdopen(connection, "rb")) == NULL)
+    {
+        close(connection);
+        return(NULL);
+    }
+    return(file);
+#endif
+} /* OpenSource() */
+
+/* the digit a digit slot's segments show, blank if none, ? if no digit */
+static char DigitOf(unsigned int segments)
+{
+    int digit;
+
+    if (segments == 0)
+        return(' ');
+    for (digit = 0; digit < 10; digit++)
+    {
+        if (segDigitBitmap[digit] == segments)
+            return((char) ('0' + digit));
+    } /* for digit */
+    return('?');
+} /* DigitOf() */
+
+/* the instant, then label and face of each clock, as the stream has them now */
+static void PrintRecord(const StreamReaderStruct *reader, int clocks)
+{
+    TickSnapshotStruct tick;
+    int32_t year, month, day;
+    uint64_t mask;
+    int i, slot;
+
+    TickTakeSnapshot(&tick, reader->utcSeconds);
+    TickCivilDate(tick.dayNumber, &year, &month, &day);
+    printf("%04d-%02d-%02dT%02d:%02d:%02dZ", (int) year, (int) month, (int) day,
+           (int) (tick.secondOfDay / 3600), (int) (tick.secondOfDay / 60 % 60), (int) (tick.secondOfDay % 60));
+    if (clocks < 0 || clocks > reader->count)
+        clocks = reader->count;
+    for (i = 0; i < clocks; i++)
+    {
+        mask = reader->masks[i];
+        printf("  %s ", reader->labels[i]);
+        for (slot = 0; slot < reader->digits; slot++)
+        {
+            putchar(DigitOf((unsigned int) (mask >> (slot * SEG_MASK_DIGIT_BITS)) & 0x7f));
+            if ((slot & 1) && slot < reader->digits - 1)
+                putchar(((mask >> (SEG_MASK_DIGIT_BITS * reader->digits + slot / 2)) & 1) ? ':' : ' ');
+        } /* for slot */
+    } /* for i */
+    putchar('\n');
+    fflush(stdout);             /* a live stream is watched as it comes */
+} /* PrintRecord() */
+
+int main(int argc, char *argv[])
+{
+    ReplayOptionsStruct options;
+    StreamReaderStruct reader;
+    FILE *file;
+    int64_t first = 0;
+    int found;
+
+    if (!ParseOptions(argc, argv, &options))
+        return(Usage());
+    if ((file = OpenSource(options.source)) == NULL)
+    {
+        fprintf(stderr, "wcreplay: cannot open %s\n", options.source);
+        return(1);
+    }
+
+    StreamReaderInit(&reader);
+    while ((found = StreamRead(&reader, file)) != STREAM_END)
+    {
+        if (found == STREAM_KEYFRAME && reader.keyframes == 1)
+            first = reader.utcSeconds;
+        if (!options.quiet)
+            PrintRecord(&reader, options.clocks);
+    } /* while */
+
+    fprintf(stderr, "wcreplay: %lu records, %lu of them keyframes, %llu bytes",
+            reader.keyframes + reader.updates, reader.keyframes, (unsigned long long) reader.bytes);
+    if (reader.keyframes > 0 && reader.utcSeconds > first)
+        fprintf(stderr, ", %.1f a second", (double) reader.bytes / (double) (reader.utcSeconds - first));
+    if (reader.skipped > 0)
+        fprintf(stderr, ", %lu skipped", reader.skipped);
+    fprintf(stderr, "\n");
+    if (file != stdin)
+        fclose(file);
+    StreamReaderFree(&reader);
+    return(0);
+} /* main() */
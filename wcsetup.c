@@ -0,0 +1,46 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcsetup.c -- the clock list of WorldClock.ini, for the portable tools    */
+/******************************************************************************/
+
+#include <stdio.h>
+#include "wcconfig.h"
+#include "wcsetup.h"
+
+/******************************************************************************/
+/* SetupLoadClocks -- add the clocks of [ClockData] to reg the way            */
+/* worldclock.c reads them, or a GMT clock if there are none.  Problems are   */
+/* reported on stderr as from program.  Returns 0 if no clock could be added. */
+/******************************************************************************/
+int SetupLoadClocks(ClockRegistryStruct *reg, const char *iniFile, const char *program)
+{
+    ConfigStruct config;
+    char key[32];
+    const char *label, *zone;
+    int i, numClocks, gmtOffset;
+
+    ConfigInit(&config);
+    if (!ConfigLoad(&config, iniFile))
+        fprintf(stderr, "%s: cannot read %s, showing GMT\n", program, iniFile);
+    numClocks = ConfigGetInt(&config, "ClockData", "NumClocks", 0);
+    ClockRegReserve(reg, numClocks);
+    for (i = 1; i <= numClocks; i++)
+    {
+        sprintf(key, "Clock%dName", i);
+        label = ConfigGetString(&config, "ClockData", key, "");
+        if (label[0] == '\0')
+            break;
+        sprintf(key, "Clock%dOffset", i);
+        gmtOffset = ConfigGetInt(&config, "ClockData", key, 24);
+        sprintf(key, "Clock%dZone", i);
+        zone = ConfigGetString(&config, "ClockData", key, "");
+        if (ClockRegAdd(reg, label, ClockRegHoursOffset(gmtOffset), zone) == CLOCK_HANDLE_NONE)
+            break;
+        if (zone[0] != '\0' && reg->zones[reg->count - 1] == NULL)
+            fprintf(stderr, "%s: unknown zone %s, using the GMT offset\n", program, zone);
+    } /* for i */
+    if (reg->count == 0)
+        ClockRegAdd(reg, "GMT", 0, "");
+    ConfigFree(&config);
+    return(reg->count > 0);
+} /* SetupLoadClocks() */
@@ -0,0 +1,13 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcsetup.h -- the clock list of WorldClock.ini, for the portable tools    */
+/******************************************************************************/
+
+#ifndef WCSETUP_H
+#define WCSETUP_H
+
+#include "clockreg.h"
+
+int SetupLoadClocks(ClockRegistryStruct *reg, const char *iniFile, const char *program);
+
+#endif /* WCSETUP_H */
@@ -0,0 +1,276 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcstats.c -- low-overhead counters and histograms for the hot paths      */
+/*                                                                            */
+/* Each thread records into its own shard, found through a thread-local       */
+/* pointer, so recording takes no lock and no atomic operation: a counter is  */
+/* one add, a histogram sample a bit scan and four adds.  Readers merge the   */
+/* shards; a value being written at that moment may be missed until the next  */
+/* snapshot, which is fine for statistics.                                    */
+/******************************************************************************/
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "wcstats.h"
+#include "ticksched.h"
+
+#if defined(_MSC_VER)
+#define STATS_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define STATS_THREAD_LOCAL _Thread_local
+#else
+#define STATS_THREAD_LOCAL __thread
+#endif
+
+int statsEnabled = 1;
+
+static StatsShardStruct shards[STATS_MAX_SHARDS + 1];  /* the last is shared by late threads */
+static volatile long shardsTaken = 0;
+static STATS_THREAD_LOCAL StatsShardStruct *threadShard;
+
+static const char *const counterNames[STAT_COUNTER_COUNT] = {
+    "Ticks", "Early ticks", "Paints", "Invalidated rectangles", "GDI calls"
+};
+
+static const char *const histogramNames[STAT_HISTOGRAM_COUNT] = {
+    "Timer lateness (us)", "Paint time (us)", "Pixels invalidated per tick", "GDI calls per tick"
+};
+
+static StatsShardStruct *ThreadShard(void)
+{
+    long index;
+
+    if (threadShard != NULL)
+        return(threadShard);
+#ifdef _WIN32
+    index = InterlockedIncrement(&shardsTaken) - 1;
+#else
+    index = __atomic_add_fetch(&shardsTaken, 1, __ATOMIC_SEQ_CST) - 1;
+#endif
+    threadShard = &shards[index < STATS_MAX_SHARDS ? index : STATS_MAX_SHARDS];
+    return(threadShard);
+} /* ThreadShard() */
+
+int64_t StatsNowNs(void)
+{
+    return(tickSystemClock.monotonicNs(tickSystemClock.context));
+} /* StatsNowNs() */
+
+void StatsCount(StatCounter counter, uint64_t amount)
+{
+    if (statsEnabled)
+        ThreadShard()->counters[counter] += amount;
+} /* StatsCount() */
+
+static int BucketOf(uint64_t value)
+{
+    int bucket = 0;
+
+    while (value != 0 && bucket < STATS_BUCKETS - 1)
+    {
+        value >>= 1;
+        bucket++;
+    } /* while */
+    return(bucket);
+} /* BucketOf() */
+
+static void Record(StatsHistogramStruct *histogram, uint64_t value)
+{
+    histogram->count++;
+    histogram->sum += value;
+    if (value > histogram->max)
+        histogram->max = value;
+    histogram->buckets[BucketOf(value)]++;
+} /* Record() */
+
+void StatsRecord(StatHistogram histogram, uint64_t value)
+{
+    if (statsEnabled)
+        Record(&ThreadShard()->histograms[histogram], value);
+} /* StatsRecord() */
+
+/* a timer tick, lateNs after its deadline, negative when early */
+void StatsTick(int64_t lateNs)
+{
+    StatsShardStruct *shard;
+
+    if (!statsEnabled)
+        return;
+    shard = ThreadShard();
+    shard->counters[STAT_TICKS]++;
+    if (lateNs < 0)
+        shard->counters[STAT_EARLY_TICKS]++;
+    Record(&shard->histograms[STAT_TIMER_LATE_US], (uint64_t) (lateNs < 0 ? -lateNs : lateNs) / 1000);
+} /* StatsTick() */
+
+/* accumulate into the tick in progress; StatsEndFrame() records the totals */
+void StatsFrameArea(uint64_t pixels)
+{
+    StatsShardStruct *shard;
+
+    if (!statsEnabled)
+        return;
+    shard = ThreadShard();
+    shard->frameArea += pixels;
+    shard->counters[STAT_INVALIDATIONS]++;
+} /* StatsFrameArea() */
+
+void StatsGdiCalls(uint64_t calls)
+{
+    StatsShardStruct *shard;
+
+    if (!statsEnabled)
+        return;
+    shard = ThreadShard();
+    shard->frameGdiCalls += calls;
+    shard->counters[STAT_GDI_CALLS] += calls;
+} /* StatsGdiCalls() */
+
+/******************************************************************************/
+/* StatsEndFrame -- close the tick in progress.  Called as the next tick      */
+/* starts, so a tick's frame includes the paints it caused.                   */
+/******************************************************************************/
+void StatsEndFrame(void)
+{
+    StatsShardStruct *shard;
+
+    if (!statsEnabled)
+        return;
+    shard = ThreadShard();
+    Record(&shard->histograms[STAT_FRAME_AREA], shard->frameArea);
+    Record(&shard->histograms[STAT_FRAME_GDI_CALLS], shard->frameGdiCalls);
+    shard->frameArea = 0;
+    shard->frameGdiCalls = 0;
+} /* StatsEndFrame() */
+
+void StatsSnapshot(StatsSnapshotStruct *snapshot)
+{
+    const StatsShardStruct *shard;
+    int s, i, b;
+
+    memset(snapshot, 0, sizeof(StatsSnapshotStruct));
+    for (s = 0; s <= STATS_MAX_SHARDS; s++)
+    {
+        shard = &shards[s];
+        for (i = 0; i < STAT_COUNTER_COUNT; i++)
+            snapshot->counters[i] += shard->counters[i];
+        for (i = 0; i < STAT_HISTOGRAM_COUNT; i++)
+        {
+            snapshot->histograms[i].count += shard->histograms[i].count;
+            snapshot->histograms[i].sum += shard->histograms[i].sum;
+            if (shard->histograms[i].max > snapshot->histograms[i].max)
+                snapshot->histograms[i].max = shard->histograms[i].max;
+            for (b = 0; b < STATS_BUCKETS; b++)
+                snapshot->histograms[i].buckets[b] += shard->histograms[i].buckets[b];
+        } /* for i */
+    } /* for s */
+} /* StatsSnapshot() */
+
+/******************************************************************************/
+/* StatsPercentile -- an upper bound for the percentile: the top of the       */
+/* bucket it falls in, or the maximum if that is lower.                       */
+/******************************************************************************/
+uint64_t StatsPercentile(const StatsHistogramStruct *histogram, int percent)
+{
+    uint64_t rank, seen = 0, top;
+    int b;
+
+    if (histogram->count == 0)
+        return(0);
+    rank = (histogram->count * (uint64_t) percent + 99) / 100;
+    if (rank == 0)
+        rank = 1;
+    for (b = 0; b < STATS_BUCKETS; b++)
+    {
+        seen += histogram->buckets[b];
+        if (seen >= rank)
+        {
+            top = (b == 0) ? 0 : ((uint64_t) 1 << b) - 1;
+            return(top < histogram->max ? top : histogram->max);
+        }
+    } /* for b */
+    return(histogram->max);
+} /* StatsPercentile() */
+
+/* snprintf() at *used, keeping text terminated when it fills up */
+static void Append(char *text, size_t size, size_t *used, const char *format, ...)
+{
+    va_list args;
+    int n;
+
+    va_start(args, format);
+    n = vsnprintf(text + *used, size - *used, format, args);
+    va_end(args);
+    if (n > 0)
+        *used += ((size_t) n < size - *used) ? (size_t) n : size - *used - 1;
+} /* Append() */
+
+size_t StatsFormat(const StatsSnapshotStruct *snapshot, char *text, size_t size)
+{
+    const StatsHistogramStruct *histogram;
+    size_t used = 0;
+    int i;
+
+    if (size == 0)
+        return(0);
+    text[0] = '\0';
+    for (i = 0; i < STAT_COUNTER_COUNT; i++)
+        Append(text, size, &used, "%s: %llu\n", counterNames[i], (unsigned long long) snapshot->counters[i]);
+    for (i = 0; i < STAT_HISTOGRAM_COUNT; i++)
+    {
+        histogram = &snapshot->histograms[i];
+        Append(text, size, &used,
+               "\n%s\n  count %llu  mean %llu  p50 <= %llu  p90 <= %llu  p99 <= %llu  max %llu\n",
+               histogramNames[i], (unsigned long long) histogram->count,
+               (unsigned long long) (histogram->count ? histogram->sum / histogram->count : 0),
+               (unsigned long long) StatsPercentile(histogram, 50),
+               (unsigned long long) StatsPercentile(histogram, 90),
+               (unsigned long long) StatsPercentile(histogram, 99),
+               (unsigned long long) histogram->max);
+    } /* for i */
+    return(used);
+} /* StatsFormat() */
+
+/******************************************************************************/
+/* StatsDump -- write the report and the raw buckets to path.                 */
+/* Returns nonzero on success.                                                */
+/******************************************************************************/
+int StatsDump(const char *path)
+{
+    StatsSnapshotStruct snapshot;
+    char text[2048];
+    FILE *file;
+    int i, b, ok;
+
+    StatsSnapshot(&snapshot);
+    StatsFormat(&snapshot, text, sizeof(text));
+    file = fopen(path, "w");
+    if (file == NULL)
+        return(0);
+    fputs(text, file);
+    fputs("\nBuckets (upper bound: count)\n", file);
+    for (i = 0; i < STAT_HISTOGRAM_COUNT; i++)
+    {
+        fprintf(file, "%s:", histogramNames[i]);
+        for (b = 0; b < STATS_BUCKETS; b++)
+        {
+            if (snapshot.histograms[i].buckets[b] != 0)
+                fprintf(file, " %llu:%llu", b == 0 ? 0ULL : (1ULL << b) - 1,
+                        (unsigned long long) snapshot.histograms[i].buckets[b]);
+        } /* for b */
+        fputc('\n', file);
+    } /* for i */
+    ok = !ferror(file);
+    return(fclose(file) == 0 && ok);
+} /* StatsDump() */
+
+/* start over; values recorded at the same moment by other threads may survive */
+void StatsReset(void)
+{
+    memset(shards, 0, sizeof(shards));
+} /* StatsReset() */
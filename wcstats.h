@@ -0,0 +1,68 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcstats.h -- low-overhead counters and histograms for the hot paths      */
+/******************************************************************************/
+
+#ifndef WCSTATS_H
+#define WCSTATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define STATS_BUCKETS    32     /* bucket b holds values in [2^(b-1), 2^b) */
+#define STATS_MAX_SHARDS 16
+
+typedef enum {
+    STAT_TICKS,
+    STAT_EARLY_TICKS,
+    STAT_PAINTS,
+    STAT_INVALIDATIONS,
+    STAT_GDI_CALLS,
+    STAT_COUNTER_COUNT
+} StatCounter;
+
+typedef enum {
+    STAT_TIMER_LATE_US,         /* |fired - deadline| per tick */
+    STAT_PAINT_US,              /* one WM_PAINT */
+    STAT_FRAME_AREA,            /* pixels invalidated per tick */
+    STAT_FRAME_GDI_CALLS,       /* GDI calls per tick, paints included */
+    STAT_HISTOGRAM_COUNT
+} StatHistogram;
+
+typedef struct StatsHistogramStructTag {
+    uint64_t count;
+    uint64_t sum;
+    uint64_t max;
+    uint64_t buckets[STATS_BUCKETS];
+} StatsHistogramStruct;
+
+/* what one thread records; only that thread writes it */
+typedef struct StatsShardStructTag {
+    uint64_t counters[STAT_COUNTER_COUNT];
+    StatsHistogramStruct histograms[STAT_HISTOGRAM_COUNT];
+    uint64_t frameArea;         /* the tick in progress */
+    uint64_t frameGdiCalls;
+} StatsShardStruct;
+
+typedef struct StatsSnapshotStructTag {
+    uint64_t counters[STAT_COUNTER_COUNT];
+    StatsHistogramStruct histograms[STAT_HISTOGRAM_COUNT];
+} StatsSnapshotStruct;
+
+extern int statsEnabled;
+
+int64_t StatsNowNs(void);
+void    StatsCount(StatCounter counter, uint64_t amount);
+void    StatsRecord(StatHistogram histogram, uint64_t value);
+void    StatsTick(int64_t lateNs);
+void    StatsFrameArea(uint64_t pixels);
+void    StatsGdiCalls(uint64_t calls);
+void    StatsEndFrame(void);
+
+void     StatsSnapshot(StatsSnapshotStruct *snapshot);
+uint64_t StatsPercentile(const StatsHistogramStruct *histogram, int percent);
+size_t   StatsFormat(const StatsSnapshotStruct *snapshot, char *text, size_t size);
+int      StatsDump(const char *path);
+void     StatsReset(void);
+
+#endif /* WCSTATS_H */
@@ -0,0 +1,565 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcstream.c -- compact stream of segment masks for remote displays        */
+/*                                                                            */
+/* A display at the other end needs only the segments to light, so that is    */
+/* all that is sent, and only what changed since the last record.  Clocks     */
+/* whose offsets are whole minutes tick their seconds and minutes in step,    */
+/* so the changed clocks are grouped by the segments that flip: a thousand    */
+/* clocks ticking a second is one group of one digit for all of them.         */
+/* Keyframes send every mask, once per distinct mask, and every label; they   */
+/* are what a reader joining late starts from.                                */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "wcstream.h"
+
+#define STREAM_HEADER_ROOM 16   /* type and payload length, before the payload */
+#define STREAM_VARINT_MAX  10
+
+/* mask bits of colon n on a face of digits slots */
+#define STREAM_COLON_SHIFT(digits) (SEG_MASK_DIGIT_BITS * (digits))
+
+/* what a payload is read from; ok drops to 0 at the first byte too many */
+typedef struct StreamCursorStructTag {
+    const unsigned char *at;
+    const unsigned char *end;
+    int ok;
+} StreamCursorStruct;
+
+static size_t PutVarint(unsigned char *out, uint64_t value)
+{
+    size_t length = 0;
+
+    while (value >= 0x80)
+    {
+        out[length++] = (unsigned char) (value | 0x80);
+        value >>= 7;
+    }
+    out[length++] = (unsigned char) value;
+    return(length);
+} /* PutVarint() */
+
+static size_t VarintLength(uint64_t value)
+{
+    size_t length = 1;
+
+    while (value >= 0x80)
+    {
+        value >>= 7;
+        length++;
+    }
+    return(length);
+} /* VarintLength() */
+
+static uint64_t Zigzag(int64_t value)
+{
+    return(value < 0 ? ((uint64_t) -(value + 1) << 1) | 1 : (uint64_t) value << 1);
+} /* Zigzag() */
+
+static int64_t Unzigzag(uint64_t value)
+{
+    return((value & 1) ? -(int64_t) (value >> 1) - 1 : (int64_t) (value >> 1));
+} /* Unzigzag() */
+
+/******************************************************************************/
+/* Writer                                                                     */
+/******************************************************************************/
+
+void StreamWriterInit(StreamWriterStruct *writer, int keyframeEvery)
+{
+    memset(writer, 0, sizeof(StreamWriterStruct));
+    writer->keyframeEvery = keyframeEvery;
+    writer->keyframeWanted = 1;
+} /* StreamWriterInit() */
+
+void StreamWriterFree(StreamWriterStruct *writer)
+{
+    free(writer->masks);
+    free(writer->labelSerials);
+    free(writer->changes);
+    free(writer->uniques);
+    free(writer->buffer);
+    StreamWriterInit(writer, writer->keyframeEvery);
+} /* StreamWriterFree() */
+
+/* the next record is a keyframe, say for a reader that just joined */
+void StreamRequestKeyframe(StreamWriterStruct *writer)
+{
+    writer->keyframeWanted = 1;
+} /* StreamRequestKeyframe() */
+
+/* room for count clocks; returns 0 when out of memory */
+static int WriterResize(StreamWriterStruct *writer, int count)
+{
+    size_t clocks = (count > 0) ? (size_t) count : 1;
+    size_t capacity = STREAM_HEADER_ROOM + 4 * STREAM_VARINT_MAX +
+                      clocks * (CLOCK_NAME_SIZE + STREAM_MASK_BYTES + 4 * STREAM_VARINT_MAX);
+    void *grown;
+
+    if ((grown = realloc(writer->masks, clocks * sizeof(uint64_t))) == NULL)
+        return(0);
+    writer->masks = (uint64_t *) grown;
+    if ((grown = realloc(writer->labelSerials, clocks * sizeof(uint32_t))) == NULL)
+        return(0);
+    writer->labelSerials = (uint32_t *) grown;
+    if ((grown = realloc(writer->changes, clocks * sizeof(StreamChangeStruct))) == NULL)
+        return(0);
+    writer->changes = (StreamChangeStruct *) grown;
+    if ((grown = realloc(writer->uniques, clocks * sizeof(int))) == NULL)
+        return(0);
+    writer->uniques = (int *) grown;
+    if ((grown = realloc(writer->buffer, capacity)) == NULL)
+        return(0);
+    writer->buffer = (unsigned char *) grown;
+    writer->capacity = capacity;
+    writer->count = count;
+    return(1);
+} /* WriterResize() */
+
+static int CompareChanges(const void *left, const void *right)
+{
+    const StreamChangeStruct *a = (const StreamChangeStruct *) left;
+    const StreamChangeStruct *b = (const StreamChangeStruct *) right;
+
+    if (a->change != b->change)
+        return(a->change < b->change ? -1 : 1);
+    return(a->index - b->index);
+} /* CompareChanges() */
+
+static size_t PutMask(unsigned char *out, uint64_t mask)
+{
+    int i;
+
+    for (i = 0; i < STREAM_MASK_BYTES; i++)
+        out[i] = (unsigned char) (mask >> (8 * i));
+    return(STREAM_MASK_BYTES);
+} /* PutMask() */
+
+/* every label and mask, the masks once each; returns the payload length */
+static size_t EncodeKeyframe(StreamWriterStruct *writer, const ClockRegistryStruct *reg, unsigned char *out)
+{
+    StreamChangeStruct *sorted = writer->changes;
+    size_t length = 0;
+    int count = reg->count, uniques = 0, i, label;
+
+    length += PutVarint(out + length, Zigzag(writer->utcSeconds));
+    length += PutVarint(out + length, SEG_FACE_DIGITS);
+    length += PutVarint(out + length, (uint64_t) count);
+    for (i = 0; i < count; i++)
+    {
+        label = reg->labelLayouts[i].length;
+        if (label > CLOCK_NAME_SIZE - 1)
+            label = CLOCK_NAME_SIZE - 1;    /* what a reader keeps; the start is in labels[] */
+        length += PutVarint(out + length, (uint64_t) label);
+        memcpy(out + length, reg->labels[i], label);
+        length += label;
+        writer->labelSerials[i] = reg->labelLayouts[i].serial;
+        writer->masks[i] = reg->shownMasks[i];
+        sorted[i].change = reg->shownMasks[i];
+        sorted[i].index = i;
+    } /* for i */
+
+    qsort(sorted, count, sizeof(StreamChangeStruct), CompareChanges);
+    for (i = 0; i < count; i++)
+    {
+        if (i > 0 && sorted[i].change != sorted[i - 1].change)
+            uniques++;
+        writer->uniques[sorted[i].index] = uniques;
+    } /* for i */
+    if (count > 0)
+        uniques++;
+    length += PutVarint(out + length, (uint64_t) uniques);
+    for (i = 0; i < count; i++)
+    {
+        if (i == 0 || sorted[i].change != sorted[i - 1].change)
+            length += PutMask(out + length, sorted[i].change);
+    } /* for i */
+    for (i = 0; i < count; i++)
+        length += PutVarint(out + length, (uint64_t) writer->uniques[i]);
+    return(length);
+} /* EncodeKeyframe() */
+
+/* the clocks in group[0 .. members), in the cheapest of the three set forms */
+static size_t EncodeSet(unsigned char *out, const StreamChangeStruct *group, int members, int count)
+{
+    size_t listLength, bitmapLength = ((size_t) count + 7) / 8, length;
+    int i, previous;
+
+    if (members == count)
+    {
+        out[0] = STREAM_SET_ALL;
+        return(1);
+    }
+    listLength = VarintLength((uint64_t) members);
+    for (i = 0, previous = -1; i < members; previous = group[i++].index)
+        listLength += VarintLength((uint64_t) (group[i].index - previous - 1));
+
+    if (listLength <= bitmapLength)
+    {
+        out[0] = STREAM_SET_LIST;
+        length = 1 + PutVarint(out + 1, (uint64_t) members);
+        for (i = 0, previous = -1; i < members; previous = group[i++].index)
+            length += PutVarint(out + length, (uint64_t) (group[i].index - previous - 1));
+        return(length);
+    }
+    out[0] = STREAM_SET_BITMAP;
+    memset(out + 1, 0, bitmapLength);
+    for (i = 0; i < members; i++)
+        out[1 + group[i].index / 8] |= (unsigned char) (1u << (group[i].index % 8));
+    return(1 + bitmapLength);
+} /* EncodeSet() */
+
+/* the clocks that changed, grouped by what changed; returns the length */
+static size_t EncodeDelta(StreamWriterStruct *writer, const ClockRegistryStruct *reg,
+                          int64_t previous, unsigned char *out)
+{
+    StreamChangeStruct *changes = writer->changes;
+    uint64_t change;
+    size_t length = 0;
+    unsigned int changed, segments;
+    int count = reg->count, changedClocks = 0, groups = 0, first, last, slot, i;
+
+    for (i = 0; i < count; i++)
+    {
+        change = writer->masks[i] ^ reg->shownMasks[i];
+        if (change == 0)
+            continue;
+        changes[changedClocks].change = change;
+        changes[changedClocks++].index = i;
+        writer->masks[i] = reg->shownMasks[i];
+    } /* for i */
+    qsort(changes, changedClocks, sizeof(StreamChangeStruct), CompareChanges);
+    for (i = 0; i < changedClocks; i++)
+        groups += (i == 0 || changes[i].change != changes[i - 1].change);
+
+    length += PutVarint(out + length, Zigzag(writer->utcSeconds - previous));
+    length += PutVarint(out + length, (uint64_t) groups);
+    for (first = 0; first < changedClocks; first = last)
+    {
+        change = changes[first].change;
+        for (last = first + 1; last < changedClocks && changes[last].change == change; last++)
+            ;
+        changed = (unsigned int) (change >> STREAM_COLON_SHIFT(SEG_FACE_DIGITS)) << SEG_FACE_DIGITS;
+        for (slot = 0; slot < SEG_FACE_DIGITS; slot++)
+        {
+            if ((change >> (slot * SEG_MASK_DIGIT_BITS)) & 0x7f)
+                changed |= 1u << slot;
+        } /* for slot */
+        out[length++] = (unsigned char) changed;
+        for (slot = 0; slot < SEG_FACE_DIGITS; slot++)
+        {
+            segments = (unsigned int) (change >> (slot * SEG_MASK_DIGIT_BITS)) & 0x7f;
+            if (segments != 0)
+                out[length++] = (unsigned char) segments;
+        } /* for slot */
+        length += EncodeSet(out + length, changes + first, last - first, count);
+    } /* for first */
+    return(length);
+} /* EncodeDelta() */
+
+/******************************************************************************/
+/* StreamEncode -- the record that brings a reader from the last one to the   */
+/* registry as ticked for utcSeconds, in writer->record and writer->length.   */
+/* It is a keyframe when asked for, when the clocks or their labels changed,  */
+/* or keyframeEvery seconds after the last one; writer->keyframe says which.  */
+/* Returns 0 when out of memory.                                              */
+/******************************************************************************/
+int StreamEncode(StreamWriterStruct *writer, const ClockRegistryStruct *reg, int64_t utcSeconds)
+{
+    unsigned char header[STREAM_HEADER_ROOM], *payload;
+    int64_t previous = writer->utcSeconds;
+    size_t length, headerLength;
+    int keyframe = writer->keyframeWanted, i;
+
+    if (reg->count != writer->count || writer->buffer == NULL)
+    {
+        if (!WriterResize(writer, reg->count))
+            return(0);
+        keyframe = 1;
+    }
+    if (writer->keyframeEvery > 0 && utcSeconds - writer->keyframeSeconds >= writer->keyframeEvery)
+        keyframe = 1;
+    for (i = 0; i < reg->count && !keyframe; i++)
+        keyframe = (writer->labelSerials[i] != reg->labelLayouts[i].serial);
+
+    writer->utcSeconds = utcSeconds;
+    payload = writer->buffer + STREAM_HEADER_ROOM;
+    if (keyframe)
+    {
+        length = EncodeKeyframe(writer, reg, payload);
+        memcpy(header, STREAM_SYNC, STREAM_SYNC_LENGTH);
+        headerLength = STREAM_SYNC_LENGTH;
+        writer->keyframeSeconds = utcSeconds;
+        writer->keyframeWanted = 0;
+    }
+    else
+    {
+        length = EncodeDelta(writer, reg, previous, payload);
+        header[0] = STREAM_DELTA;
+        headerLength = 1;
+    }
+    headerLength += PutVarint(header + headerLength, (uint64_t) length);
+    writer->record = payload - headerLength;
+    memcpy(writer->record, header, headerLength);
+    writer->length = headerLength + length;
+    writer->keyframe = keyframe;
+    return(1);
+} /* StreamEncode() */
+
+/******************************************************************************/
+/* Reader                                                                     */
+/******************************************************************************/
+
+void StreamReaderInit(StreamReaderStruct *reader)
+{
+    memset(reader, 0, sizeof(StreamReaderStruct));
+} /* StreamReaderInit() */
+
+void StreamReaderFree(StreamReaderStruct *reader)
+{
+    free(reader->masks);
+    free(reader->labels);
+    free(reader->payload);
+    StreamReaderInit(reader);
+} /* StreamReaderFree() */
+
+static uint64_t GetVarint(StreamCursorStruct *cursor)
+{
+    uint64_t value = 0;
+    int shift;
+
+    for (shift = 0; shift < 64 && cursor->at < cursor->end; shift += 7)
+    {
+        value |= (uint64_t) (*cursor->at & 0x7f) << shift;
+        if (!(*cursor->at++ & 0x80))
+            return(value);
+    } /* for shift */
+    cursor->ok = 0;
+    return(0);
+} /* GetVarint() */
+
+static unsigned int GetByte(StreamCursorStruct *cursor)
+{
+    if (cursor->at >= cursor->end)
+    {
+        cursor->ok = 0;
+        return(0);
+    }
+    return(*cursor->at++);
+} /* GetByte() */
+
+/* a varint of at most limit, else 0 with ok cleared */
+static uint64_t GetCount(StreamCursorStruct *cursor, uint64_t limit)
+{
+    uint64_t value = GetVarint(cursor);
+
+    if (value > limit)
+    {
+        cursor->ok = 0;
+        return(0);
+    }
+    return(value);
+} /* GetCount() */
+
+static int ReadByte(StreamReaderStruct *reader, FILE *file)
+{
+    int c = getc(file);
+
+    if (c != EOF)
+        reader->bytes++;
+    return(c);
+} /* ReadByte() */
+
+/* the length and payload after a record's type; -1 at the end of file */
+static int ReadPayload(StreamReaderStruct *reader, FILE *file, StreamCursorStruct *cursor)
+{
+    uint64_t length = 0;
+    void *grown;
+    int shift, c;
+
+    cursor->at = cursor->end = reader->payload;
+    cursor->ok = 0;
+    for (shift = 0; ; shift += 7)
+    {
+        if ((c = ReadByte(reader, file)) == EOF)
+            return(-1);
+        length |= (uint64_t) (c & 0x7f) << shift;
+        if (!(c & 0x80))
+            break;
+        if (shift >= 28)
+            return(0);
+    } /* for shift */
+    if (length > STREAM_MAX_RECORD)
+        return(0);
+    if (length > reader->capacity)
+    {
+        if ((grown = realloc(reader->payload, (size_t) length)) == NULL)
+            return(0);
+        reader->payload = (unsigned char *) grown;
+        reader->capacity = (size_t) length;
+    }
+    if (fread(reader->payload, 1, (size_t) length, file) != (size_t) length)
+        return(-1);
+    reader->bytes += length;
+    cursor->at = reader->payload;
+    cursor->end = reader->payload + length;
+    cursor->ok = 1;
+    return(1);
+} /* ReadPayload() */
+
+static int ApplyKeyframe(StreamReaderStruct *reader, StreamCursorStruct *cursor)
+{
+    uint64_t mask;
+    size_t clocks, uniquesAt;
+    void *grown;
+    int count, digits, uniques, length, unique, i, j;
+
+    reader->utcSeconds = Unzigzag(GetVarint(cursor));
+    digits = (int) GetCount(cursor, 6);
+    count = (int) GetCount(cursor, STREAM_MAX_RECORD);
+    if (!cursor->ok || digits < 2 || (digits & 1))
+        return(0);
+    if ((size_t) count > (size_t) (cursor->end - cursor->at) / 2)
+        return(0);              /* each clock takes a label length and a mask index */
+    clocks = (count > 0) ? (size_t) count : 1;
+    if ((grown = realloc(reader->masks, clocks * sizeof(uint64_t))) == NULL)
+        return(0);
+    reader->masks = (uint64_t *) grown;
+    if ((grown = realloc(reader->labels, clocks * CLOCK_NAME_SIZE)) == NULL)
+        return(0);
+    reader->labels = (char (*)[CLOCK_NAME_SIZE]) grown;
+    reader->digits = digits;
+    reader->count = count;
+
+    for (i = 0; i < count; i++)
+    {
+        length = (int) GetCount(cursor, CLOCK_NAME_SIZE - 1);
+        if (!cursor->ok || cursor->end - cursor->at < length)
+            return(0);
+        memcpy(reader->labels[i], cursor->at, length);
+        reader->labels[i][length] = '\0';
+        cursor->at += length;
+    } /* for i */
+    uniques = (int) GetCount(cursor, (uint64_t) count);
+    uniquesAt = cursor->at - reader->payload;
+    if (!cursor->ok || (size_t) (cursor->end - cursor->at) < (size_t) uniques * STREAM_MASK_BYTES)
+        return(0);
+    cursor->at += (size_t) uniques * STREAM_MASK_BYTES;
+    for (i = 0; i < count; i++)
+    {
+        unique = (int) GetCount(cursor, (uint64_t) uniques - 1);
+        if (!cursor->ok || uniques == 0)
+            return(0);
+        mask = 0;
+        for (j = 0; j < STREAM_MASK_BYTES; j++)
+            mask |= (uint64_t) reader->payload[uniquesAt + (size_t) unique * STREAM_MASK_BYTES + j] << (8 * j);
+        reader->masks[i] = mask;
+    } /* for i */
+    return(1);
+} /* ApplyKeyframe() */
+
+static int ApplyDelta(StreamReaderStruct *reader, StreamCursorStruct *cursor)
+{
+    uint64_t change, groups, members, gap;
+    size_t bitmapLength = ((size_t) reader->count + 7) / 8;
+    unsigned int changed, kind;
+    int index, slot, i;
+
+    reader->utcSeconds += Unzigzag(GetVarint(cursor));
+    groups = GetCount(cursor, (uint64_t) reader->count);
+    for (; groups > 0 && cursor->ok; groups--)
+    {
+        changed = GetByte(cursor);
+        if (changed >> (reader->digits + reader->digits / 2 - 1))
+            return(0);
+        change = (uint64_t) (changed >> reader->digits) << STREAM_COLON_SHIFT(reader->digits);
+        for (slot = 0; slot < reader->digits; slot++)
+        {
+            if (changed & (1u << slot))
+                change |= (uint64_t) (GetByte(cursor) & 0x7f) << (slot * SEG_MASK_DIGIT_BITS);
+        } /* for slot */
+
+        kind = GetByte(cursor);
+        if (kind == STREAM_SET_ALL)
+        {
+            for (i = 0; i < reader->count; i++)
+                reader->masks[i] ^= change;
+        }
+        else if (kind == STREAM_SET_LIST)
+        {
+            members = GetCount(cursor, (uint64_t) reader->count);
+            for (index = -1; members > 0 && cursor->ok; members--)
+            {
+                gap = GetCount(cursor, (uint64_t) reader->count);
+                index += (int) gap + 1;
+                if (index >= reader->count)
+                    return(0);
+                reader->masks[index] ^= change;
+            } /* for members */
+        }
+        else if (kind == STREAM_SET_BITMAP && (size_t) (cursor->end - cursor->at) >= bitmapLength)
+        {
+            for (i = 0; i < reader->count; i++)
+            {
+                if (cursor->at[i / 8] & (1u << (i % 8)))
+                    reader->masks[i] ^= change;
+            } /* for i */
+            cursor->at += bitmapLength;
+        }
+        else
+            return(0);
+    } /* for groups */
+    return(cursor->ok);
+} /* ApplyDelta() */
+
+/******************************************************************************/
+/* StreamRead -- the next record from file, applied to the reader's clocks.   */
+/* Until the first keyframe, and after any record that does not make sense,   */
+/* bytes are skipped up to the next keyframe.  Returns STREAM_KEYFRAME or     */
+/* STREAM_UPDATE, or STREAM_END at the end of file.                           */
+/******************************************************************************/
+int StreamRead(StreamReaderStruct *reader, FILE *file)
+{
+    StreamCursorStruct cursor;
+    int matched = 0, c, read;
+
+    for (;;)
+    {
+        if ((c = ReadByte(reader, file)) == EOF)
+            return(STREAM_END);
+        if (matched == 0 && reader->synced && c == STREAM_DELTA)
+        {
+            if ((read = ReadPayload(reader, file, &cursor)) < 0)
+                return(STREAM_END);
+            if (read && ApplyDelta(reader, &cursor))
+            {
+                reader->updates++;
+                return(STREAM_UPDATE);
+            }
+            reader->synced = 0;
+            reader->skipped += 1 + (cursor.end - reader->payload);
+            continue;
+        }
+        if (c == STREAM_SYNC[matched])
+        {
+            if (++matched < STREAM_SYNC_LENGTH)
+                continue;
+            matched = 0;
+            if ((read = ReadPayload(reader, file, &cursor)) < 0)
+                return(STREAM_END);
+            reader->synced = (read && ApplyKeyframe(reader, &cursor));
+            if (reader->synced)
+            {
+                reader->keyframes++;
+                return(STREAM_KEYFRAME);
+            }
+            reader->skipped += STREAM_SYNC_LENGTH + (cursor.end - reader->payload);
+            continue;
+        }
+        reader->skipped += matched + (c != STREAM_SYNC[0]);
+        matched = (c == STREAM_SYNC[0]);
+        reader->synced = 0;     /* a byte out of place: whatever follows may be too */
+    } /* for ever */
+} /* StreamRead() */
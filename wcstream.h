@@ -0,0 +1,94 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcstream.h -- compact stream of segment masks for remote displays        */
+/******************************************************************************/
+
+#ifndef WCSTREAM_H
+#define WCSTREAM_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "clockreg.h"
+
+/******************************************************************************/
+/* A stream is a run of records, each a type, a varint payload length and the */
+/* payload.  Varints are unsigned LEB128; times are zigzag signed.            */
+/*                                                                            */
+/*   keyframe  "WCSK" length  utc  digits  count  count x (length, label)     */
+/*             uniques  uniques x mask  count x unique index                  */
+/*   delta     'D' length  utc - previous utc  groups                         */
+/*             groups x (changed, changed digits x xor, clock set)            */
+/*                                                                            */
+/* A mask is STREAM_MASK_BYTES little-endian bytes of a segment mask.  In a   */
+/* delta, bit n < digits of changed says digit slot n changes, and a byte of  */
+/* its segments to flip follows; bit digits + n flips colon n.  Each group    */
+/* applies to a set of clocks: STREAM_SET_ALL, STREAM_SET_LIST (a count and   */
+/* the gaps between ascending indices) or STREAM_SET_BITMAP (one bit a clock, */
+/* bit 0 of the first byte for clock 0).  A reader joining late skips to the  */
+/* next "WCSK".                                                               */
+/******************************************************************************/
+#define STREAM_SYNC            "WCSK"
+#define STREAM_SYNC_LENGTH     4
+#define STREAM_DELTA           'D'
+#define STREAM_SET_ALL         0
+#define STREAM_SET_LIST        1
+#define STREAM_SET_BITMAP      2
+#define STREAM_MASK_BYTES      6        /* 6 digits and 2 colons are 44 bits */
+#define STREAM_MAX_RECORD      (1 << 24)
+#define STREAM_KEYFRAME_EVERY  60       /* seconds, by default */
+
+/* what StreamRead() found */
+#define STREAM_END      0
+#define STREAM_KEYFRAME 1
+#define STREAM_UPDATE   2
+
+/* one clock whose mask changed, sorted by change so equal ones group */
+typedef struct StreamChangeStructTag {
+    uint64_t change;            /* old mask ^ new mask */
+    int index;
+} StreamChangeStruct;
+
+/* the sender's side: what the readers last got, and one record */
+typedef struct StreamWriterStructTag {
+    int count;                  /* clocks in the last keyframe */
+    uint64_t *masks;            /* as last sent */
+    uint32_t *labelSerials;
+    int64_t utcSeconds;         /* of the last record */
+    int64_t keyframeSeconds;    /* of the last keyframe */
+    int keyframeEvery;          /* seconds, 0 for only when needed */
+    int keyframeWanted;
+    StreamChangeStruct *changes;
+    int *uniques;               /* keyframe: each clock's mask in the table */
+    unsigned char *buffer;
+    size_t capacity;
+    unsigned char *record;      /* in buffer: the record StreamEncode() made */
+    size_t length;
+    int keyframe;               /* record is a keyframe */
+} StreamWriterStruct;
+
+/* the receiver's side: every clock as of the last record */
+typedef struct StreamReaderStructTag {
+    int synced;                 /* a keyframe was read, and nothing lost since */
+    int digits;                 /* digit slots per face */
+    int count;
+    uint64_t *masks;
+    char (*labels)[CLOCK_NAME_SIZE];
+    int64_t utcSeconds;
+    unsigned char *payload;
+    size_t capacity;
+    unsigned long keyframes;
+    unsigned long updates;
+    unsigned long skipped;      /* bytes before a keyframe, or of a broken record */
+    uint64_t bytes;             /* read in all */
+} StreamReaderStruct;
+
+void StreamWriterInit(StreamWriterStruct *writer, int keyframeEvery);
+void StreamWriterFree(StreamWriterStruct *writer);
+void StreamRequestKeyframe(StreamWriterStruct *writer);
+int  StreamEncode(StreamWriterStruct *writer, const ClockRegistryStruct *reg, int64_t utcSeconds);
+
+void StreamReaderInit(StreamReaderStruct *reader);
+void StreamReaderFree(StreamReaderStruct *reader);
+int  StreamRead(StreamReaderStruct *reader, FILE *file);
+
+#endif /* WCSTREAM_H */
@@ -0,0 +1,632 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wcterm.c -- terminal front end: big-digit clocks on an ANSI terminal     */
+/*                                                                            */
+/* Usage: wcterm [options]                                                    */
+/*   -i file     clock set in WorldClock.ini format (./WorldClock.ini)        */
+/*   -w columns  terminal width ($COLUMNS, else 80)                           */
+/*   -h rows     terminal height ($LINES, else 24); clocks that do not fit    */
+/*               are left out                                                 */
+/*   -t instant  replay from this instant instead of following the clock,     */
+/*               Unix seconds or YYYY-MM-DDTHH:MM:SSZ                         */
+/*   -e instant  last instant of the replay (the first)                       */
+/*   -s seconds  step between replayed ticks (1)                              */
+/*   -o target   write the segment stream of wcstream.h instead of drawing:   */
+/*               to a file, - for stdout, or unix:path to serve it on a Unix  */
+/*               socket to any number of readers (not on Windows)             */
+/*   -k seconds  keyframe interval of the stream (60)                         */
+/* Interrupt to stop following the clock.  A summary of the bytes written     */
+/* per tick goes to stderr at the end.                                        */
+/*                                                                            */
+/* Each clock is drawn with the segment masks of the clock registry, three    */
+/* characters square per digit, as in a WorldClock window.  The screen is     */
+/* kept as one character per cell, both as the tick wants it and as the       */
+/* terminal shows it.  After the first tick only the cells that differ are    */
+/* written, each reached by the shortest of the absolute, relative and        */
+/* overwriting cursor moves, and all of it in one write: a ticking second     */
+/* costs a few dozen bytes a clock, not a repaint.  A stream goes to every    */
+/* clock, whatever fits the terminal; a reader that connects to the socket    */
+/* is sent a keyframe with the next tick.                                     */
+/* Build with the portable sources:                                           */
+/*   cc -O2 -o wcterm wcterm.c wcsetup.c wcconfig.c clockreg.c tzone.c \     */
+/*         ticktime.c ticksched.c segrender.c bmfont.c wcstream.c             */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include "clockreg.h"
+#include "wcsetup.h"
+#include "ticksched.h"
+#include "wcstream.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
+#define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
+#endif
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+#define TERM_DIGIT_WIDTH  3
+#define TERM_FACE_WIDTH   (SEG_FACE_DIGITS * TERM_DIGIT_WIDTH + SEG_FACE_DIGITS / 2 - 1)
+#define TERM_FACE_HEIGHT  3
+#define TERM_TILE_WIDTH   (TERM_FACE_WIDTH + 2)
+#define TERM_TILE_HEIGHT  (TERM_FACE_HEIGHT + 2)   /* the face, the label and a gap */
+#define TERM_MAX_MOVE     24    /* bytes; longer than any cursor move we make */
+#define TERM_MAX_READERS  16    /* of a stream served on a socket */
+#define TERM_UNIX_PREFIX  "unix:"
+
+typedef struct TermOptionsStructTag {
+    const char *iniFile;
+    int columns;
+    int rows;
+    int replay;
+    int64_t start;
+    int64_t end;
+    int64_t step;
+    const char *target;         /* of the stream, NULL to draw on the terminal */
+    int keyframeEvery;
+} TermOptionsStruct;
+
+/* one character per cell, row by row */
+typedef struct TermScreenStructTag {
+    int width;
+    int height;
+    char *cells;                /* what this tick shows */
+    char *shown;                /* what the terminal shows */
+    int cursorRow;              /* -1 while not known */
+    int cursorColumn;
+    char *output;               /* one tick's bytes */
+    size_t length;
+} TermScreenStruct;
+
+/* where each segment of a digit goes in its 3 x 3 cells, bit 0 first */
+typedef struct TermSegmentStructTag {
+    int row;
+    int column;
+    char lit;
+} TermSegmentStruct;
+
+static const TermSegmentStruct termSegments[7] = {{0, 1, '_'},
+                                                  {1, 2, '|'},
+                                                  {2, 2, '|'},
+                                                  {2, 1, '_'},
+                                                  {2, 0, '|'},
+                                                  {1, 0, '|'},
+                                                  {1, 1, '_'}};
+
+static ClockRegistryStruct registry;
+static TermScreenStruct screen;
+static int tileColumns;                 /* tiles per row */
+static int shownClocks;                 /* the clocks that fit */
+static volatile sig_atomic_t stopRequested;
+
+/* -o: the stream and where it goes */
+static StreamWriterStruct streamWriter;
+static FILE *streamFile;                /* NULL while serving a socket */
+static const char *socketPath;
+static int listener = -1;
+static int readers[TERM_MAX_READERS];
+static int readerCount;
+
+static int Usage(void)
+{
+    fprintf(stderr, "usage: wcterm [-i file] [-w columns] [-h rows] [-t instant [-e instant] [-s seconds]]\n"
+                    "              [-o file|-|unix:path [-k seconds]]\n");
+    return(2);
+} /* Usage() */
+
+/* a size from the environment, as shells export it, or fallback if it is   */
+/* below minimum -- a terminal narrower than one tile still gets one row    */
+static int EnvironmentSize(const char *name, int minimum, int fallback)
+{
+    const char *value = getenv(name);
+    int size = (value != NULL) ? atoi(value) : 0;
+
+    return(size >= minimum ? size : fallback);
+} /* EnvironmentSize() */
+
+static int ParseOptions(int argc, char *argv[], TermOptionsStruct *options)
+{
+    int i;
+
+    options->iniFile = "./WorldClock.ini";
+    options->columns = EnvironmentSize("COLUMNS", TERM_TILE_WIDTH, 80);
+    options->rows = EnvironmentSize("LINES", TERM_TILE_HEIGHT, 24);
+    options->replay = 0;
+    options->start = 0;
+    options->end = INT64_MIN;
+    options->step = 1;
+    options->target = NULL;
+    options->keyframeEvery = STREAM_KEYFRAME_EVERY;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (argv[i][0] != '-' || argv[i][1] == '\0' || argv[i][2] != '\0' || i + 1 >= argc)
+            return(0);
+        switch (argv[i][1])
+        {
+            case 'i':
+                options->iniFile = argv[++i];
+                break;
+            case 'w':
+                options->columns = atoi(argv[++i]);
+                if (options->columns < TERM_TILE_WIDTH)
+                    return(0);
+                break;
+            case 'h':
+                options->rows = atoi(argv[++i]);
+                if (options->rows < TERM_TILE_HEIGHT)
+                    return(0);
+                break;
+            case 't':
+                if (!TickParseInstant(argv[++i], &options->start))
+                    return(0);
+                options->replay = 1;
+                break;
+            case 'e':
+                if (!TickParseInstant(argv[++i], &options->end))
+                    return(0);
+                break;
+            case 's':
+                options->step = strtoll(argv[++i], NULL, 10);
+                if (options->step <= 0)
+                    return(0);
+                break;
+            case 'o':
+                options->target = argv[++i];
+                break;
+            case 'k':
+                options->keyframeEvery = atoi(argv[++i]);
+                if (options->keyframeEvery < 0)
+                    return(0);
+                break;
+            default:
+                return(0);
+        } /* switch option */
+    } /* for i */
+
+    if (options->end == INT64_MIN)
+        options->end = options->start;
+    return(!options->replay || options->end >= options->start);
+} /* ParseOptions() */
+
+/******************************************************************************/
+/* ScreenInit -- as many whole tiles as fit the terminal, row by row.  The    */
+/* terminal is taken to be blank, with the cursor somewhere unknown.          */
+/******************************************************************************/
+static int ScreenInit(const TermOptionsStruct *options)
+{
+    int tileRows;
+    size_t cells;
+
+    tileColumns = options->columns / TERM_TILE_WIDTH;
+    if (tileColumns > registry.count)
+        tileColumns = registry.count;
+    tileRows = (registry.count + tileColumns - 1) / tileColumns;
+    if (tileRows > options->rows / TERM_TILE_HEIGHT)
+        tileRows = options->rows / TERM_TILE_HEIGHT;
+    shownClocks = tileRows * tileColumns;
+    if (shownClocks > registry.count)
+        shownClocks = registry.count;
+    if (shownClocks < registry.count)
+        fprintf(stderr, "wcterm: only %d of %d clocks fit\n", shownClocks, registry.count);
+
+    screen.width = tileColumns * TERM_TILE_WIDTH;
+    screen.height = tileRows * TERM_TILE_HEIGHT;
+    cells = (size_t) screen.width * screen.height;
+    screen.cells = (char *) malloc(cells);
+    screen.shown = (char *) malloc(cells);
+    screen.output = (char *) malloc(cells * (TERM_MAX_MOVE + 1) + 2 * TERM_MAX_MOVE);
+    if (screen.cells == NULL || screen.shown == NULL || screen.output == NULL)
+        return(0);
+    memset(screen.cells, ' ', cells);
+    memset(screen.shown, ' ', cells);
+    screen.cursorRow = screen.cursorColumn = -1;
+    return(1);
+} /* ScreenInit() */
+
+static void ScreenFree(void)
+{
+    free(screen.cells);
+    free(screen.shown);
+    free(screen.output);
+    memset(&screen, 0, sizeof(screen));
+} /* ScreenFree() */
+
+/******************************************************************************/
+/* DrawClock -- put the digit slots in digits of clock index into the cells,  */
+/* each with the colon to its right, and the label too when all are redrawn. */
+/******************************************************************************/
+static void DrawClock(int index, unsigned int digits)
+{
+    int top = (index / tileColumns) * TERM_TILE_HEIGHT;
+    int left = (index % tileColumns) * TERM_TILE_WIDTH + 1;
+    uint64_t mask = registry.shownMasks[index];
+    unsigned int segments;
+    char *cell, colon;
+    int slot, x, i, length;
+    const char *label;
+
+    for (slot = 0; slot < SEG_FACE_DIGITS; slot++)
+    {
+        if (!(digits & (1u << slot)))
+            continue;
+        x = left + slot * TERM_DIGIT_WIDTH + slot / 2;
+        segments = (unsigned int) (mask >> (slot * SEG_MASK_DIGIT_BITS)) & 0x7f;
+        for (i = 0; i < TERM_FACE_HEIGHT; i++)
+            memset(screen.cells + (size_t) (top + i) * screen.width + x, ' ', TERM_DIGIT_WIDTH);
+        for (i = 0; i < 7; i++)
+        {
+            if (segments & (1u << i))
+                screen.cells[(size_t) (top + termSegments[i].row) * screen.width + x + termSegments[i].column] =
+                    termSegments[i].lit;
+        } /* for i */
+        if ((slot & 1) && slot < SEG_FACE_DIGITS - 1)
+        {
+            colon = ((mask >> (SEG_MASK_COLON_SHIFT + slot / 2)) & 1) ? '.' : ' ';
+            cell = screen.cells + (size_t) top * screen.width + x + TERM_DIGIT_WIDTH;
+            cell[screen.width] = colon;
+            cell[2 * screen.width] = colon;
+        }
+    } /* for slot */
+
+    if (digits != CLOCK_DIRTY_ALL)
+        return;
+    cell = screen.cells + (size_t) (top + TERM_FACE_HEIGHT) * screen.width + left;
+    memset(cell, ' ', TERM_FACE_WIDTH);
+    label = ClockRegLabel(&registry, index);
+    length = registry.labelLayouts[index].length;
+    if (length > TERM_FACE_WIDTH)
+        length = TERM_FACE_WIDTH;
+    cell += (TERM_FACE_WIDTH - length) / 2;
+    for (i = 0; i < length; i++)  /* one byte must be one column */
+        cell[i] = (label[i] >= ' ' && label[i] <= '~') ? label[i] : '?';
+} /* DrawClock() */
+
+/* ESC [ n final, n left out when it is 1; distance 0 is no move at all */
+static int FormatRelative(char *out, int distance, char forward, char backward)
+{
+    char final = (distance > 0) ? forward : backward;
+
+    if (distance < 0)
+        distance = -distance;
+    if (distance == 0)
+        return(0);
+    if (distance == 1)
+        return(sprintf(out, "\033[%c", final));
+    return(sprintf(out, "\033[%d%c", distance, final));
+} /* FormatRelative() */
+
+/* keep candidate if it is shorter than best */
+static void KeepShorter(char *best, int *bestLength, const char *candidate, int length)
+{
+    if (length < *bestLength)
+    {
+        memcpy(best, candidate, length);
+        *bestLength = length;
+    }
+} /* KeepShorter() */
+
+/******************************************************************************/
+/* FormatMove -- the fewest bytes that take the cursor to (row, column):      */
+/* absolute, or up/down and then left/right, to the start of the row and     */
+/* right, or by writing out the cells in between again, which the terminal    */
+/* already shows.  Returns their length.                                      */
+/******************************************************************************/
+static int FormatMove(char *out, int row, int column)
+{
+    char vertical[TERM_MAX_MOVE], candidate[2 * TERM_MAX_MOVE];
+    const char *shownRow = screen.shown + (size_t) row * screen.width;
+    int bestLength, verticalLength, length, from;
+
+    if (row == 0 && column == 0)
+        bestLength = sprintf(out, "\033[H");
+    else if (column == 0)
+        bestLength = sprintf(out, "\033[%dH", row + 1);
+    else
+        bestLength = sprintf(out, "\033[%d;%dH", row + 1, column + 1);
+    if (screen.cursorRow < 0)
+        return(bestLength);
+
+    verticalLength = FormatRelative(vertical, row - screen.cursorRow, 'B', 'A');
+    from = screen.cursorColumn;
+    memcpy(candidate, vertical, verticalLength);
+    length = verticalLength + FormatRelative(candidate + verticalLength, column - from, 'C', 'D');
+    KeepShorter(out, &bestLength, candidate, length);
+    if (column > from && column - from < bestLength)
+    {
+        memcpy(candidate + verticalLength, shownRow + from, column - from);
+        KeepShorter(out, &bestLength, candidate, verticalLength + column - from);
+    }
+    candidate[verticalLength] = '\r';
+    length = verticalLength + 1 + FormatRelative(candidate + verticalLength + 1, column, 'C', 'D');
+    KeepShorter(out, &bestLength, candidate, length);
+    if (column < bestLength)
+    {
+        memcpy(candidate + verticalLength + 1, shownRow, column);
+        KeepShorter(out, &bestLength, candidate, verticalLength + 1 + column);
+    }
+    return(bestLength);
+} /* FormatMove() */
+
+/******************************************************************************/
+/* ScreenDiff -- the bytes that bring the terminal from shown to cells, in    */
+/* screen.output.  Returns their number.                                      */
+/******************************************************************************/
+static size_t ScreenDiff(void)
+{
+    int row, column;
+    size_t at;
+
+    screen.length = 0;
+    for (row = 0; row < screen.height; row++)
+    {
+        for (column = 0; column < screen.width; column++)
+        {
+            at = (size_t) row * screen.width + column;
+            if (screen.cells[at] == screen.shown[at])
+                continue;
+            if (row != screen.cursorRow || column != screen.cursorColumn)
+                screen.length += FormatMove(screen.output + screen.length, row, column);
+            screen.output[screen.length++] = screen.cells[at];
+            screen.shown[at] = screen.cells[at];
+            screen.cursorRow = row;
+            screen.cursorColumn = column + 1;
+            if (screen.cursorColumn == screen.width)
+                screen.cursorRow = -1;  /* it may or may not wrap */
+        } /* for column */
+    } /* for row */
+    return(screen.length);
+} /* ScreenDiff() */
+
+/* bring every shown clock to the instant and write what changed */
+static size_t TermTick(int64_t instant)
+{
+    TickSnapshotStruct tick;
+    int i;
+
+    TickTakeSnapshot(&tick, instant);
+    ClockRegTickAll(&registry, &tick);
+    for (i = 0; i < shownClocks; i++)
+    {
+        if (registry.dirtyDigits[i] != 0)
+            DrawClock(i, registry.dirtyDigits[i]);
+    } /* for i */
+    if (ScreenDiff() > 0)
+    {
+        fwrite(screen.output, 1, screen.length, stdout);
+        fflush(stdout);
+    }
+    return(screen.length);
+} /* TermTick() */
+
+/******************************************************************************/
+/* StreamOpen -- where -o sends the stream: a file, stdout, or a listening    */
+/* Unix socket that readers connect to.  Returns 0 if it cannot be opened.    */
+/******************************************************************************/
+static int StreamOpen(const char *target)
+{
+#ifndef _WIN32
+    struct sockaddr_un address;
+#endif
+
+    if (strncmp(target, TERM_UNIX_PREFIX, strlen(TERM_UNIX_PREFIX)) != 0)
+    {
+        if (strcmp(target, "-") != 0)
+            return((streamFile = fopen(target, "wb")) != NULL);
+        streamFile = stdout;
+#ifdef _WIN32
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        return(1);
+    }
+#ifdef _WIN32
+    fprintf(stderr, "wcterm: no Unix sockets on Windows\n");
+    return(0);
+#else
+    socketPath = target + strlen(TERM_UNIX_PREFIX);
+    if (strlen(socketPath) >= sizeof(address.sun_path))
+        return(0);
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socketPath);
+    unlink(socketPath);         /* left by an earlier run */
+    listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0 || bind(listener, (struct sockaddr *) &address, sizeof(address)) != 0 ||
+        listen(listener, TERM_MAX_READERS) != 0 || fcntl(listener, F_SETFL, O_NONBLOCK) != 0)
+        return(0);
+    signal(SIGPIPE, SIG_IGN);   /* a reader that goes away is dropped, not fatal */
+    return(1);
+#endif
+} /* StreamOpen() */
+
+static void StreamClose(void)
+{
+#ifndef _WIN32
+    while (readerCount > 0)
+        close(readers[--readerCount]);
+    if (listener >= 0)
+    {
+        close(listener);
+        unlink(socketPath);
+    }
+#endif
+    if (streamFile != NULL && streamFile != stdout)
+        fclose(streamFile);
+    StreamWriterFree(&streamWriter);
+} /* StreamClose() */
+
+#ifndef _WIN32
+/* take the readers that connected since the last tick; each wants a keyframe */
+static void AcceptReaders(void)
+{
+    int reader;
+
+    while ((reader = accept(listener, NULL, NULL)) >= 0)
+    {
+        if (readerCount == TERM_MAX_READERS || fcntl(reader, F_SETFL, O_NONBLOCK) != 0)
+        {
+            close(reader);
+            continue;
+        }
+        readers[readerCount++] = reader;
+        StreamRequestKeyframe(&streamWriter);
+    } /* while */
+} /* AcceptReaders() */
+
+/* a reader that cannot take a whole record now is dropped, not waited for */
+static void SendToReaders(const unsigned char *record, size_t length)
+{
+    int i;
+
+    for (i = 0; i < readerCount; i++)
+    {
+        if (send(readers[i], record, length, 0) == (ssize_t) length)
+            continue;
+        close(readers[i]);
+        readers[i--] = readers[--readerCount];
+    } /* for i */
+} /* SendToReaders() */
+#endif
+
+/* bring every clock to the instant and send the record of what changed */
+static size_t StreamTick(int64_t instant)
+{
+    TickSnapshotStruct tick;
+
+    TickTakeSnapshot(&tick, instant);
+    ClockRegTickAll(&registry, &tick);
+#ifndef _WIN32
+    if (listener >= 0)
+        AcceptReaders();
+#endif
+    if (!StreamEncode(&streamWriter, &registry, instant))
+    {
+        fprintf(stderr, "wcterm: out of memory\n");
+        stopRequested = 1;
+        return(0);
+    }
+    if (streamFile != NULL)
+    {
+        if (fwrite(streamWriter.record, 1, streamWriter.length, streamFile) != streamWriter.length ||
+            fflush(streamFile) != 0)
+        {
+            fprintf(stderr, "wcterm: cannot write the stream\n");
+            stopRequested = 1;
+        }
+    }
+#ifndef _WIN32
+    else
+        SendToReaders(streamWriter.record, streamWriter.length);
+#endif
+    return(streamWriter.length);
+} /* StreamTick() */
+
+static void SleepMs(uint32_t ms)
+{
+#ifdef _WIN32
+    Sleep(ms);
+#else
+    struct timespec wait;
+
+    wait.tv_sec = ms / 1000;
+    wait.tv_nsec = (long) (ms % 1000) * 1000000L;
+    nanosleep(&wait, NULL);     /* an interrupt ends it early, which is what we want */
+#endif
+} /* SleepMs() */
+
+static void RequestStop(int signalNumber)
+{
+    (void) signalNumber;
+    stopRequested = 1;
+} /* RequestStop() */
+
+int main(int argc, char *argv[])
+{
+    TermOptionsStruct options;
+    TickSchedulerStruct scheduler;
+    int64_t instant;
+    size_t bytes, firstBytes = 0, maxBytes = 0;
+    double totalBytes = 0.0;
+    long ticks = 0;
+#ifdef _WIN32
+    HANDLE console;
+    DWORD mode;
+#endif
+
+    if (!ParseOptions(argc, argv, &options))
+        return(Usage());
+    ClockRegInit(&registry, 0);
+    StreamWriterInit(&streamWriter, options.keyframeEvery);
+    if (!SetupLoadClocks(&registry, options.iniFile, "wcterm") || (options.target == NULL && !ScreenInit(&options)))
+    {
+        fprintf(stderr, "wcterm: out of memory\n");
+        return(1);
+    }
+    if (options.target != NULL && !StreamOpen(options.target))
+    {
+        fprintf(stderr, "wcterm: cannot open %s\n", options.target);
+        return(1);
+    }
+    signal(SIGINT, RequestStop);
+    if (options.target == NULL)
+    {
+#ifdef _WIN32
+        console = GetStdHandle(STD_OUTPUT_HANDLE);
+        if (GetConsoleMode(console, &mode))
+            SetConsoleMode(console, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+#endif
+        fputs("\033[?25l\033[2J", stdout);   /* hide the cursor, blank the screen */
+    }
+
+    TickSchedInit(&scheduler, &tickSystemClock, 1);
+    instant = options.replay ? options.start : (int64_t) time(NULL);
+    while (!stopRequested)
+    {
+        bytes = (options.target != NULL) ? StreamTick(instant) : TermTick(instant);
+        if (ticks++ == 0)
+            firstBytes = bytes;
+        else
+        {
+            totalBytes += (double) bytes;
+            if (bytes > maxBytes)
+                maxBytes = bytes;
+        }
+        if (options.replay)
+        {
+            if (options.end - instant < options.step)
+                break;
+            instant += options.step;
+            continue;
+        }
+        SleepMs(TickSchedArm(&scheduler));
+        if (!stopRequested)
+            instant = TickSchedFired(&scheduler);
+    } /* while */
+
+    if (options.target == NULL)
+    {
+        printf("\033[%dH\033[?25h", screen.height + 1);    /* below the clocks, cursor back */
+        fflush(stdout);
+    }
+    fprintf(stderr, "wcterm: %ld ticks, %lu bytes for the first", ticks, (unsigned long) firstBytes);
+    if (ticks > 1)
+        fprintf(stderr, ", then %.1f bytes per tick on average and %lu at most",
+                totalBytes / (ticks - 1), (unsigned long) maxBytes);
+    fprintf(stderr, "\n");
+    StreamClose();
+    ScreenFree();
+    ClockRegFree(&registry);
+    return(0);
+} /* main() */
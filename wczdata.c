@@ -0,0 +1,5263 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wczdata.c -- zone search tables, generated by wczgen from tzdata 2025b   */
+/*                                                                            */
+/* 457 zones, 1372 terms and 14593 suffixes.  Do not edit: run wczgen again.  */
+/******************************************************************************/
+
+#include "wczindex.h"
+
+static const char *const zones[457] = {
+    "Africa/Abidjan",
+    "Africa/Accra",
+    "Africa/Addis_Ababa",
+    "Africa/Algiers",
+    "Africa/Asmara",
+    "Africa/Bamako",
+    "Africa/Bangui",
+    "Africa/Banjul",
+    "Africa/Bissau",
+    "Africa/Blantyre",
+    "Africa/Brazzaville",
+    "Africa/Bujumbura",
+    "Africa/Cairo",
+    "Africa/Casablanca",
+    "Africa/Ceuta",
+    "Africa/Conakry",
+    "Africa/Dakar",
+    "Africa/Dar_es_Salaam",
+    "Africa/Djibouti",
+    "Africa/Douala",
+    "Africa/El_Aaiun",
+    "Africa/Freetown",
+    "Africa/Gaborone",
+    "Africa/Harare",
+    "Africa/Johannesburg",
+    "Africa/Juba",
+    "Africa/Kampala",
+    "Africa/Khartoum",
+    "Africa/Kigali",
+    "Africa/Kinshasa",
+    "Africa/Lagos",
+    "Africa/Libreville",
+    "Africa/Lome",
+    "Africa/Luanda",
+    "Africa/Lubumbashi",
+    "Africa/Lusaka",
+    "Africa/Malabo",
+    "Africa/Maputo",
+    "Africa/Maseru",
+    "Africa/Mbabane",
+    "Africa/Mogadishu",
+    "Africa/Monrovia",
+    "Africa/Nairobi",
+    "Africa/Ndjamena",
+    "Africa/Niamey",
+    "Africa/Nouakchott",
+    "Africa/Ouagadougou",
+    "Africa/Porto-Novo",
+    "Africa/Sao_Tome",
+    "Africa/Tripoli",
+    "Africa/Tunis",
+    "Africa/Windhoek",
+    "America/Adak",
+    "America/Anchorage",
+    "America/Anguilla",
+    "America/Antigua",
+    "America/Araguaina",
+    "America/Argentina/Buenos_Aires",
+    "America/Argentina/Catamarca",
+    "America/Argentina/Cordoba",
+    "America/Argentina/Jujuy",
+    "America/Argentina/La_Rioja",
+    "America/Argentina/Mendoza",
+    "America/Argentina/Rio_Gallegos",
+    "America/Argentina/Salta",
+    "America/Argentina/San_Juan",
+    "America/Argentina/San_Luis",
+    "America/Argentina/Tucuman",
+    "America/Argentina/Ushuaia",
+    "America/Aruba",
+    "America/Asuncion",
+    "America/Atikokan",
+    "America/Bahia",
+    "America/Bahia_Banderas",
+    "America/Barbados",
+    "America/Belem",
+    "America/Belize",
+    "America/Blanc-Sablon",
+    "America/Boa_Vista",
+    "America/Bogota",
+    "America/Boise",
+    "America/Cambridge_Bay",
+    "America/Campo_Grande",
+    "America/Cancun",
+    "America/Caracas",
+    "America/Cayenne",
+    "America/Cayman",
+    "America/Chicago",
+    "America/Chihuahua",
+    "America/Ciudad_Juarez",
+    "America/Costa_Rica",
+    "America/Coyhaique",
+    "America/Creston",
+    "America/Cuiaba",
+    "America/Curacao",
+    "America/Danmarkshavn",
+    "America/Dawson",
+    "America/Dawson_Creek",
+    "America/Denver",
+    "America/Detroit",
+    "America/Dominica",
+    "America/Edmonton",
+    "America/Eirunepe",
+    "America/El_Salvador",
+    "America/Fort_Nelson",
+    "America/Fortaleza",
+    "America/Glace_Bay",
+    "America/Goose_Bay",
+    "America/Grand_Turk",
+    "America/Grenada",
+    "America/Guadeloupe",
+    "America/Guatemala",
+    "America/Guayaquil",
+    "America/Guyana",
+    "America/Halifax",
+    "America/Havana",
+    "America/Hermosillo",
+    "America/Indiana/Indianapolis",
+    "America/Indiana/Knox",
+    "America/Indiana/Marengo",
+    "America/Indiana/Petersburg",
+    "America/Indiana/Tell_City",
+    "America/Indiana/Vevay",
+    "America/Indiana/Vincennes",
+    "America/Indiana/Winamac",
+    "America/Inuvik",
+    "America/Iqaluit",
+    "America/Jamaica",
+    "America/Juneau",
+    "America/Kentucky/Louisville",
+    "America/Kentucky/Monticello",
+    "America/Kralendijk",
+    "America/La_Paz",
+    "America/Lima",
+    "America/Los_Angeles",
+    "America/Lower_Princes",
+    "America/Maceio",
+    "America/Managua",
+    "America/Manaus",
+    "America/Marigot",
+    "America/Martinique",
+    "America/Matamoros",
+    "America/Mazatlan",
+    "America/Menominee",
+    "America/Merida",
+    "America/Metlakatla",
+    "America/Mexico_City",
+    "America/Miquelon",
+    "America/Moncton",
+    "America/Monterrey",
+    "America/Montevideo",
+    "America/Montserrat",
+    "America/Nassau",
+    "America/New_York",
+    "America/Nome",
+    "America/Noronha",
+    "America/North_Dakota/Beulah",
+    "America/North_Dakota/Center",
+    "America/North_Dakota/New_Salem",
+    "America/Nuuk",
+    "America/Ojinaga",
+    "America/Panama",
+    "America/Paramaribo",
+    "America/Phoenix",
+    "America/Port-au-Prince",
+    "America/Port_of_Spain",
+    "America/Porto_Velho",
+    "America/Puerto_Rico",
+    "America/Punta_Arenas",
+    "America/Rankin_Inlet",
+    "America/Recife",
+    "America/Regina",
+    "America/Resolute",
+    "America/Rio_Branco",
+    "America/Santarem",
+    "America/Santiago",
+    "America/Santo_Domingo",
+    "America/Sao_Paulo",
+    "America/Scoresbysund",
+    "America/Sitka",
+    "America/St_Barthelemy",
+    "America/St_Johns",
+    "America/St_Kitts",
+    "America/St_Lucia",
+    "America/St_Thomas",
+    "America/St_Vincent",
+    "America/Swift_Current",
+    "America/Tegucigalpa",
+    "America/Thule",
+    "America/Tijuana",
+    "America/Toronto",
+    "America/Tortola",
+    "America/Vancouver",
+    "America/Whitehorse",
+    "America/Winnipeg",
+    "America/Yakutat",
+    "Antarctica/Casey",
+    "Antarctica/Davis",
+    "Antarctica/DumontDUrville",
+    "Antarctica/Macquarie",
+    "Antarctica/Mawson",
+    "Antarctica/McMurdo",
+    "Antarctica/Palmer",
+    "Antarctica/Rothera",
+    "Antarctica/Syowa",
+    "Antarctica/Troll",
+    "Antarctica/Vostok",
+    "Arctic/Longyearbyen",
+    "Asia/Aden",
+    "Asia/Almaty",
+    "Asia/Amman",
+    "Asia/Anadyr",
+    "Asia/Aqtau",
+    "Asia/Aqtobe",
+    "Asia/Ashgabat",
+    "Asia/Atyrau",
+    "Asia/Baghdad",
+    "Asia/Bahrain",
+    "Asia/Baku",
+    "Asia/Bangkok",
+    "Asia/Barnaul",
+    "Asia/Beirut",
+    "Asia/Bishkek",
+    "Asia/Brunei",
+    "Asia/Chita",
+    "Asia/Colombo",
+    "Asia/Damascus",
+    "Asia/Dhaka",
+    "Asia/Dili",
+    "Asia/Dubai",
+    "Asia/Dushanbe",
+    "Asia/Famagusta",
+    "Asia/Gaza",
+    "Asia/Hebron",
+    "Asia/Ho_Chi_Minh",
+    "Asia/Hong_Kong",
+    "Asia/Hovd",
+    "Asia/Irkutsk",
+    "Asia/Jakarta",
+    "Asia/Jayapura",
+    "Asia/Jerusalem",
+    "Asia/Kabul",
+    "Asia/Kamchatka",
+    "Asia/Karachi",
+    "Asia/Kathmandu",
+    "Asia/Khandyga",
+    "Asia/Kolkata",
+    "Asia/Krasnoyarsk",
+    "Asia/Kuala_Lumpur",
+    "Asia/Kuching",
+    "Asia/Kuwait",
+    "Asia/Macau",
+    "Asia/Magadan",
+    "Asia/Makassar",
+    "Asia/Manila",
+    "Asia/Muscat",
+    "Asia/Nicosia",
+    "Asia/Novokuznetsk",
+    "Asia/Novosibirsk",
+    "Asia/Omsk",
+    "Asia/Oral",
+    "Asia/Phnom_Penh",
+    "Asia/Pontianak",
+    "Asia/Pyongyang",
+    "Asia/Qatar",
+    "Asia/Qostanay",
+    "Asia/Qyzylorda",
+    "Asia/Riyadh",
+    "Asia/Sakhalin",
+    "Asia/Samarkand",
+    "Asia/Seoul",
+    "Asia/Shanghai",
+    "Asia/Singapore",
+    "Asia/Srednekolymsk",
+    "Asia/Taipei",
+    "Asia/Tashkent",
+    "Asia/Tbilisi",
+    "Asia/Tehran",
+    "Asia/Thimphu",
+    "Asia/Tokyo",
+    "Asia/Tomsk",
+    "Asia/Ulaanbaatar",
+    "Asia/Urumqi",
+    "Asia/Ust-Nera",
+    "Asia/Vientiane",
+    "Asia/Vladivostok",
+    "Asia/Yakutsk",
+    "Asia/Yangon",
+    "Asia/Yekaterinburg",
+    "Asia/Yerevan",
+    "Atlantic/Azores",
+    "Atlantic/Bermuda",
+    "Atlantic/Canary",
+    "Atlantic/Cape_Verde",
+    "Atlantic/Faroe",
+    "Atlantic/Madeira",
+    "Atlantic/Reykjavik",
+    "Atlantic/South_Georgia",
+    "Atlantic/St_Helena",
+    "Atlantic/Stanley",
+    "Australia/Adelaide",
+    "Australia/Brisbane",
+    "Australia/Broken_Hill",
+    "Australia/Darwin",
+    "Australia/Eucla",
+    "Australia/Hobart",
+    "Australia/Lindeman",
+    "Australia/Lord_Howe",
+    "Australia/Melbourne",
+    "Australia/Perth",
+    "Australia/Sydney",
+    "CET",
+    "CST6CDT",
+    "EET",
+    "EST",
+    "EST5EDT",
+    "Etc/GMT",
+    "Etc/GMT+1",
+    "Etc/GMT+10",
+    "Etc/GMT+11",
+    "Etc/GMT+12",
+    "Etc/GMT+2",
+    "Etc/GMT+3",
+    "Etc/GMT+4",
+    "Etc/GMT+5",
+    "Etc/GMT+6",
+    "Etc/GMT+7",
+    "Etc/GMT+8",
+    "Etc/GMT+9",
+    "Etc/GMT-1",
+    "Etc/GMT-10",
+    "Etc/GMT-11",
+    "Etc/GMT-12",
+    "Etc/GMT-13",
+    "Etc/GMT-14",
+    "Etc/GMT-2",
+    "Etc/GMT-3",
+    "Etc/GMT-4",
+    "Etc/GMT-5",
+    "Etc/GMT-6",
+    "Etc/GMT-7",
+    "Etc/GMT-8",
+    "Etc/GMT-9",
+    "Etc/UTC",
+    "Europe/Amsterdam",
+    "Europe/Andorra",
+    "Europe/Astrakhan",
+    "Europe/Athens",
+    "Europe/Belgrade",
+    "Europe/Berlin",
+    "Europe/Bratislava",
+    "Europe/Brussels",
+    "Europe/Bucharest",
+    "Europe/Budapest",
+    "Europe/Busingen",
+    "Europe/Chisinau",
+    "Europe/Copenhagen",
+    "Europe/Dublin",
+    "Europe/Gibraltar",
+    "Europe/Guernsey",
+    "Europe/Helsinki",
+    "Europe/Isle_of_Man",
+    "Europe/Istanbul",
+    "Europe/Jersey",
+    "Europe/Kaliningrad",
+    "Europe/Kirov",
+    "Europe/Kyiv",
+    "Europe/Lisbon",
+    "Europe/Ljubljana",
+    "Europe/London",
+    "Europe/Luxembourg",
+    "Europe/Madrid",
+    "Europe/Malta",
+    "Europe/Mariehamn",
+    "Europe/Minsk",
+    "Europe/Monaco",
+    "Europe/Moscow",
+    "Europe/Oslo",
+    "Europe/Paris",
+    "Europe/Podgorica",
+    "Europe/Prague",
+    "Europe/Riga",
+    "Europe/Rome",
+    "Europe/Samara",
+    "Europe/San_Marino",
+    "Europe/Sarajevo",
+    "Europe/Saratov",
+    "Europe/Simferopol",
+    "Europe/Skopje",
+    "Europe/Sofia",
+    "Europe/Stockholm",
+    "Europe/Tallinn",
+    "Europe/Tirane",
+    "Europe/Ulyanovsk",
+    "Europe/Vaduz",
+    "Europe/Vatican",
+    "Europe/Vienna",
+    "Europe/Vilnius",
+    "Europe/Volgograd",
+    "Europe/Warsaw",
+    "Europe/Zagreb",
+    "Europe/Zurich",
+    "HST",
+    "Indian/Antananarivo",
+    "Indian/Chagos",
+    "Indian/Christmas",
+    "Indian/Cocos",
+    "Indian/Comoro",
+    "Indian/Kerguelen",
+    "Indian/Mahe",
+    "Indian/Maldives",
+    "Indian/Mauritius",
+    "Indian/Mayotte",
+    "Indian/Reunion",
+    "MET",
+    "MST",
+    "MST7MDT",
+    "PST8PDT",
+    "Pacific/Apia",
+    "Pacific/Auckland",
+    "Pacific/Bougainville",
+    "Pacific/Chatham",
+    "Pacific/Chuuk",
+    "Pacific/Easter",
+    "Pacific/Efate",
+    "Pacific/Fakaofo",
+    "Pacific/Fiji",
+    "Pacific/Funafuti",
+    "Pacific/Galapagos",
+    "Pacific/Gambier",
+    "Pacific/Guadalcanal",
+    "Pacific/Guam",
+    "Pacific/Honolulu",
+    "Pacific/Kanton",
+    "Pacific/Kiritimati",
+    "Pacific/Kosrae",
+    "Pacific/Kwajalein",
+    "Pacific/Majuro",
+    "Pacific/Marquesas",
+    "Pacific/Midway",
+    "Pacific/Nauru",
+    "Pacific/Niue",
+    "Pacific/Norfolk",
+    "Pacific/Noumea",
+    "Pacific/Pago_Pago",
+    "Pacific/Palau",
+    "Pacific/Pitcairn",
+    "Pacific/Pohnpei",
+    "Pacific/Port_Moresby",
+    "Pacific/Rarotonga",
+    "Pacific/Saipan",
+    "Pacific/Tahiti",
+    "Pacific/Tarawa",
+    "Pacific/Tongatapu",
+    "Pacific/Wake",
+    "Pacific/Wallis",
+    "WET"
+};
+
+static const char text[] =
+    "abidjan\0"
+    "accra\0"
+    "acdt\0"
+    "acre\0"
+    "acst\0"
+    "act\0"
+    "adak\0"
+    "addis ababa\0"
+    "addt\0"
+    "adelaide\0"
+    "aden\0"
+    "adt\0"
+    "aedt\0"
+    "aest\0"
+    "afghanistan\0"
+    "africa/abidjan\0"
+    "africa/accra\0"
+    "africa/addis ababa\0"
+    "africa/algiers\0"
+    "africa/asmara\0"
+    "africa/asmera\0"
+    "africa/bamako\0"
+    "africa/bangui\0"
+    "africa/banjul\0"
+    "africa/bissau\0"
+    "africa/blantyre\0"
+    "africa/brazzaville\0"
+    "africa/bujumbura\0"
+    "africa/cairo\0"
+    "africa/casablanca\0"
+    "africa/ceuta\0"
+    "africa/conakry\0"
+    "africa/dakar\0"
+    "africa/dar es salaam\0"
+    "africa/djibouti\0"
+    "africa/douala\0"
+    "africa/el aaiun\0"
+    "africa/freetown\0"
+    "africa/gaborone\0"
+    "africa/harare\0"
+    "africa/johannesburg\0"
+    "africa/juba\0"
+    "africa/kampala\0"
+    "africa/khartoum\0"
+    "africa/kigali\0"
+    "africa/kinshasa\0"
+    "africa/lagos\0"
+    "africa/libreville\0"
+    "africa/lome\0"
+    "africa/luanda\0"
+    "africa/lubumbashi\0"
+    "africa/lusaka\0"
+    "africa/malabo\0"
+    "africa/maputo\0"
+    "africa/maseru\0"
+    "africa/mbabane\0"
+    "africa/mogadishu\0"
+    "africa/monrovia\0"
+    "africa/nairobi\0"
+    "africa/ndjamena\0"
+    "africa/niamey\0"
+    "africa/nouakchott\0"
+    "africa/ouagadougou\0"
+    "africa/porto-novo\0"
+    "africa/sao tome\0"
+    "africa/timbuktu\0"
+    "africa/tripoli\0"
+    "africa/tunis\0"
+    "africa/windhoek\0"
+    "ahdt\0"
+    "ahst\0"
+    "akdt\0"
+    "akst\0"
+    "alaska\0"
+    "albania\0"
+    "aleutian\0"
+    "algeria\0"
+    "algiers\0"
+    "almaty\0"
+    "america/adak\0"
+    "america/anchorage\0"
+    "america/anguilla\0"
+    "america/antigua\0"
+    "america/araguaina\0"
+    "america/argentina/buenos aires\0"
+    "america/argentina/catamarca\0"
+    "america/argentina/comodrivadavia\0"
+    "america/argentina/cordoba\0"
+    "america/argentina/jujuy\0"
+    "america/argentina/la rioja\0"
+    "america/argentina/mendoza\0"
+    "america/argentina/rio gallegos\0"
+    "america/argentina/salta\0"
+    "america/argentina/san juan\0"
+    "america/argentina/san luis\0"
+    "america/argentina/tucuman\0"
+    "america/argentina/ushuaia\0"
+    "america/aruba\0"
+    "america/asuncion\0"
+    "america/atikokan\0"
+    "america/atka\0"
+    "america/bahia\0"
+    "america/bahia banderas\0"
+    "america/barbados\0"
+    "america/belem\0"
+    "america/belize\0"
+    "america/blanc-sablon\0"
+    "america/boa vista\0"
+    "america/bogota\0"
+    "america/boise\0"
+    "america/buenos aires\0"
+    "america/cambridge bay\0"
+    "america/campo grande\0"
+    "america/cancun\0"
+    "america/caracas\0"
+    "america/catamarca\0"
+    "america/cayenne\0"
+    "america/cayman\0"
+    "america/chicago\0"
+    "america/chihuahua\0"
+    "america/ciudad juarez\0"
+    "america/coral harbour\0"
+    "america/cordoba\0"
+    "america/costa rica\0"
+    "america/coyhaique\0"
+    "america/creston\0"
+    "america/cuiaba\0"
+    "america/curacao\0"
+    "america/danmarkshavn\0"
+    "america/dawson\0"
+    "america/dawson creek\0"
+    "america/denver\0"
+    "america/detroit\0"
+    "america/dominica\0"
+    "america/edmonton\0"
+    "america/eirunepe\0"
+    "america/el salvador\0"
+    "america/ensenada\0"
+    "america/fort nelson\0"
+    "america/fort wayne\0"
+    "america/fortaleza\0"
+    "america/glace bay\0"
+    "america/godthab\0"
+    "america/goose bay\0"
+    "america/grand turk\0"
+    "america/grenada\0"
+    "america/guadeloupe\0"
+    "america/guatemala\0"
+    "america/guayaquil\0"
+    "america/guyana\0"
+    "america/halifax\0"
+    "america/havana\0"
+    "america/hermosillo\0"
+    "america/indiana/indianapolis\0"
+    "america/indiana/knox\0"
+    "america/indiana/marengo\0"
+    "america/indiana/petersburg\0"
+    "america/indiana/tell city\0"
+    "america/indiana/vevay\0"
+    "america/indiana/vincennes\0"
+    "america/indiana/winamac\0"
+    "america/indianapolis\0"
+    "america/inuvik\0"
+    "america/iqaluit\0"
+    "america/jamaica\0"
+    "america/jujuy\0"
+    "america/juneau\0"
+    "america/kentucky/louisville\0"
+    "america/kentucky/monticello\0"
+    "america/knox in\0"
+    "america/kralendijk\0"
+    "america/la paz\0"
+    "america/lima\0"
+    "america/los angeles\0"
+    "america/louisville\0"
+    "america/lower princes\0"
+    "america/maceio\0"
+    "america/managua\0"
+    "america/manaus\0"
+    "america/marigot\0"
+    "america/martinique\0"
+    "america/matamoros\0"
+    "america/mazatlan\0"
+    "america/mendoza\0"
+    "america/menominee\0"
+    "america/merida\0"
+    "america/metlakatla\0"
+    "america/mexico city\0"
+    "america/miquelon\0"
+    "america/moncton\0"
+    "america/monterrey\0"
+    "america/montevideo\0"
+    "america/montreal\0"
+    "america/montserrat\0"
+    "america/nassau\0"
+    "america/new york\0"
+    "america/nipigon\0"
+    "america/nome\0"
+    "america/noronha\0"
+    "america/north dakota/beulah\0"
+    "america/north dakota/center\0"
+    "america/north dakota/new salem\0"
+    "america/nuuk\0"
+    "america/ojinaga\0"
+    "america/panama\0"
+    "america/pangnirtung\0"
+    "america/paramaribo\0"
+    "america/phoenix\0"
+    "america/port of spain\0"
+    "america/port-au-prince\0"
+    "america/porto acre\0"
+    "america/porto velho\0"
+    "america/puerto rico\0"
+    "america/punta arenas\0"
+    "america/rainy river\0"
+    "america/rankin inlet\0"
+    "america/recife\0"
+    "america/regina\0"
+    "america/resolute\0"
+    "america/rio branco\0"
+    "america/rosario\0"
+    "america/santa isabel\0"
+    "america/santarem\0"
+    "america/santiago\0"
+    "america/santo domingo\0"
+    "america/sao paulo\0"
+    "america/scoresbysund\0"
+    "america/shiprock\0"
+    "america/sitka\0"
+    "america/st barthelemy\0"
+    "america/st johns\0"
+    "america/st kitts\0"
+    "america/st lucia\0"
+    "america/st thomas\0"
+    "america/st vincent\0"
+    "america/swift current\0"
+    "america/tegucigalpa\0"
+    "america/thule\0"
+    "america/thunder bay\0"
+    "america/tijuana\0"
+    "america/toronto\0"
+    "america/tortola\0"
+    "america/vancouver\0"
+    "america/virgin\0"
+    "america/whitehorse\0"
+    "america/winnipeg\0"
+    "america/yakutat\0"
+    "america/yellowknife\0"
+    "amman\0"
+    "amsterdam\0"
+    "anadyr\0"
+    "anchorage\0"
+    "andorra\0"
+    "angola\0"
+    "anguilla\0"
+    "antananarivo\0"
+    "antarctica\0"
+    "antarctica/casey\0"
+    "antarctica/davis\0"
+    "antarctica/dumontdurville\0"
+    "antarctica/macquarie\0"
+    "antarctica/mawson\0"
+    "antarctica/mcmurdo\0"
+    "antarctica/palmer\0"
+    "antarctica/rothera\0"
+    "antarctica/south pole\0"
+    "antarctica/syowa\0"
+    "antarctica/troll\0"
+    "antarctica/vostok\0"
+    "antigua\0"
+    "antigua & barbuda\0"
+    "apia\0"
+    "aqtau\0"
+    "aqtobe\0"
+    "araguaina\0"
+    "arctic/longyearbyen\0"
+    "argentina\0"
+    "arizona\0"
+    "armenia\0"
+    "aruba\0"
+    "ashgabat\0"
+    "ashkhabad\0"
+    "asia/aden\0"
+    "asia/almaty\0"
+    "asia/amman\0"
+    "asia/anadyr\0"
+    "asia/aqtau\0"
+    "asia/aqtobe\0"
+    "asia/ashgabat\0"
+    "asia/ashkhabad\0"
+    "asia/atyrau\0"
+    "asia/baghdad\0"
+    "asia/bahrain\0"
+    "asia/baku\0"
+    "asia/bangkok\0"
+    "asia/barnaul\0"
+    "asia/beirut\0"
+    "asia/bishkek\0"
+    "asia/brunei\0"
+    "asia/calcutta\0"
+    "asia/chita\0"
+    "asia/choibalsan\0"
+    "asia/chongqing\0"
+    "asia/chungking\0"
+    "asia/colombo\0"
+    "asia/dacca\0"
+    "asia/damascus\0"
+    "asia/dhaka\0"
+    "asia/dili\0"
+    "asia/dubai\0"
+    "asia/dushanbe\0"
+    "asia/famagusta\0"
+    "asia/gaza\0"
+    "asia/harbin\0"
+    "asia/hebron\0"
+    "asia/ho chi minh\0"
+    "asia/hong kong\0"
+    "asia/hovd\0"
+    "asia/irkutsk\0"
+    "asia/istanbul\0"
+    "asia/jakarta\0"
+    "asia/jayapura\0"
+    "asia/jerusalem\0"
+    "asia/kabul\0"
+    "asia/kamchatka\0"
+    "asia/karachi\0"
+    "asia/kashgar\0"
+    "asia/kathmandu\0"
+    "asia/katmandu\0"
+    "asia/khandyga\0"
+    "asia/kolkata\0"
+    "asia/krasnoyarsk\0"
+    "asia/kuala lumpur\0"
+    "asia/kuching\0"
+    "asia/kuwait\0"
+    "asia/macao\0"
+    "asia/macau\0"
+    "asia/magadan\0"
+    "asia/makassar\0"
+    "asia/manila\0"
+    "asia/muscat\0"
+    "asia/nicosia\0"
+    "asia/novokuznetsk\0"
+    "asia/novosibirsk\0"
+    "asia/omsk\0"
+    "asia/oral\0"
+    "asia/phnom penh\0"
+    "asia/pontianak\0"
+    "asia/pyongyang\0"
+    "asia/qatar\0"
+    "asia/qostanay\0"
+    "asia/qyzylorda\0"
+    "asia/rangoon\0"
+    "asia/riyadh\0"
+    "asia/saigon\0"
+    "asia/sakhalin\0"
+    "asia/samarkand\0"
+    "asia/seoul\0"
+    "asia/shanghai\0"
+    "asia/singapore\0"
+    "asia/srednekolymsk\0"
+    "asia/taipei\0"
+    "asia/tashkent\0"
+    "asia/tbilisi\0"
+    "asia/tehran\0"
+    "asia/tel aviv\0"
+    "asia/thimbu\0"
+    "asia/thimphu\0"
+    "asia/tokyo\0"
+    "asia/tomsk\0"
+    "asia/ujung pandang\0"
+    "asia/ulaanbaatar\0"
+    "asia/ulan bator\0"
+    "asia/urumqi\0"
+    "asia/ust-nera\0"
+    "asia/vientiane\0"
+    "asia/vladivostok\0"
+    "asia/yakutsk\0"
+    "asia/yangon\0"
+    "asia/yekaterinburg\0"
+    "asia/yerevan\0"
+    "asmara\0"
+    "asmera\0"
+    "ast\0"
+    "astrakhan\0"
+    "asuncion\0"
+    "athens\0"
+    "atikokan\0"
+    "atka\0"
+    "atlantic\0"
+    "atlantic/azores\0"
+    "atlantic/bermuda\0"
+    "atlantic/canary\0"
+    "atlantic/cape verde\0"
+    "atlantic/faeroe\0"
+    "atlantic/faroe\0"
+    "atlantic/jan mayen\0"
+    "atlantic/madeira\0"
+    "atlantic/reykjavik\0"
+    "atlantic/south georgia\0"
+    "atlantic/st helena\0"
+    "atlantic/stanley\0"
+    "atyrau\0"
+    "auckland\0"
+    "australia\0"
+    "australia/act\0"
+    "australia/adelaide\0"
+    "australia/brisbane\0"
+    "australia/broken hill\0"
+    "australia/canberra\0"
+    "australia/currie\0"
+    "australia/darwin\0"
+    "australia/eucla\0"
+    "australia/hobart\0"
+    "australia/lhi\0"
+    "australia/lindeman\0"
+    "australia/lord howe\0"
+    "australia/melbourne\0"
+    "australia/north\0"
+    "australia/nsw\0"
+    "australia/perth\0"
+    "australia/queensland\0"
+    "australia/south\0"
+    "australia/sydney\0"
+    "australia/tasmania\0"
+    "australia/victoria\0"
+    "australia/west\0"
+    "australia/yancowinna\0"
+    "austria\0"
+    "awdt\0"
+    "awst\0"
+    "azerbaijan\0"
+    "azores\0"
+    "baghdad\0"
+    "bahamas\0"
+    "bahia\0"
+    "bahia banderas\0"
+    "bahrain\0"
+    "bajanorte\0"
+    "bajasur\0"
+    "baku\0"
+    "bamako\0"
+    "bangkok\0"
+    "bangladesh\0"
+    "bangui\0"
+    "banjul\0"
+    "barbados\0"
+    "barnaul\0"
+    "bdt\0"
+    "beirut\0"
+    "belarus\0"
+    "belem\0"
+    "belfast\0"
+    "belgium\0"
+    "belgrade\0"
+    "belize\0"
+    "benin\0"
+    "berlin\0"
+    "bermuda\0"
+    "beulah\0"
+    "bhutan\0"
+    "bishkek\0"
+    "bissau\0"
+    "blanc-sablon\0"
+    "blantyre\0"
+    "boa vista\0"
+    "bogota\0"
+    "boise\0"
+    "bolivia\0"
+    "bosnia & herzegovina\0"
+    "botswana\0"
+    "bougainville\0"
+    "bratislava\0"
+    "brazil\0"
+    "brazil/acre\0"
+    "brazil/denoronha\0"
+    "brazil/east\0"
+    "brazil/west\0"
+    "brazzaville\0"
+    "brisbane\0"
+    "britain (uk)\0"
+    "british indian ocean territory\0"
+    "broken hill\0"
+    "brunei\0"
+    "brussels\0"
+    "bst\0"
+    "bucharest\0"
+    "budapest\0"
+    "buenos aires\0"
+    "bujumbura\0"
+    "bulgaria\0"
+    "burkina faso\0"
+    "burundi\0"
+    "busingen\0"
+    "cairo\0"
+    "calcutta\0"
+    "cambodia\0"
+    "cambridge bay\0"
+    "cameroon\0"
+    "campo grande\0"
+    "canada\0"
+    "canada/atlantic\0"
+    "canada/central\0"
+    "canada/eastern\0"
+    "canada/mountain\0"
+    "canada/newfoundland\0"
+    "canada/pacific\0"
+    "canada/saskatchewan\0"
+    "canada/yukon\0"
+    "canary\0"
+    "canberra\0"
+    "cancun\0"
+    "cape verde\0"
+    "caracas\0"
+    "caribbean nl\0"
+    "casablanca\0"
+    "casey\0"
+    "cast\0"
+    "cat\0"
+    "catamarca\0"
+    "cayenne\0"
+    "cayman\0"
+    "cayman islands\0"
+    "cdt\0"
+    "center\0"
+    "central\0"
+    "central african rep.\0"
+    "cest\0"
+    "cet\0"
+    "ceuta\0"
+    "chad\0"
+    "chagos\0"
+    "chatham\0"
+    "chicago\0"
+    "chihuahua\0"
+    "chile\0"
+    "chile/continental\0"
+    "chile/easterisland\0"
+    "china\0"
+    "chisinau\0"
+    "chita\0"
+    "choibalsan\0"
+    "chongqing\0"
+    "christmas\0"
+    "christmas island\0"
+    "chst\0"
+    "chungking\0"
+    "chuuk\0"
+    "ciudad juarez\0"
+    "cocos\0"
+    "cocos (keeling) islands\0"
+    "colombia\0"
+    "colombo\0"
+    "comodrivadavia\0"
+    "comoro\0"
+    "comoros\0"
+    "conakry\0"
+    "congo (dem. rep.)\0"
+    "congo (rep.)\0"
+    "continental\0"
+    "cook islands\0"
+    "copenhagen\0"
+    "coral harbour\0"
+    "cordoba\0"
+    "costa rica\0"
+    "coyhaique\0"
+    "creston\0"
+    "croatia\0"
+    "cst\0"
+    "cst6cdt\0"
+    "cuba\0"
+    "cuiaba\0"
+    "curacao\0"
+    "cura\303\247ao\0"
+    "currie\0"
+    "cyprus\0"
+    "czech republic\0"
+    "c\303\264te d'ivoire\0"
+    "dacca\0"
+    "dakar\0"
+    "damascus\0"
+    "danmarkshavn\0"
+    "dar es salaam\0"
+    "darwin\0"
+    "davis\0"
+    "dawson\0"
+    "dawson creek\0"
+    "denmark\0"
+    "denoronha\0"
+    "denver\0"
+    "detroit\0"
+    "dhaka\0"
+    "dili\0"
+    "djibouti\0"
+    "dominica\0"
+    "dominican republic\0"
+    "douala\0"
+    "dubai\0"
+    "dublin\0"
+    "dumontdurville\0"
+    "dushanbe\0"
+    "east\0"
+    "east timor\0"
+    "east-indiana\0"
+    "easter\0"
+    "easterisland\0"
+    "eastern\0"
+    "eat\0"
+    "ecuador\0"
+    "edmonton\0"
+    "edt\0"
+    "eest\0"
+    "eet\0"
+    "efate\0"
+    "egypt\0"
+    "eire\0"
+    "eirunepe\0"
+    "el aaiun\0"
+    "el salvador\0"
+    "enderbury\0"
+    "ensenada\0"
+    "equatorial guinea\0"
+    "eritrea\0"
+    "est\0"
+    "est5edt\0"
+    "estonia\0"
+    "eswatini (swaziland)\0"
+    "etc/gmt\0"
+    "etc/gmt+0\0"
+    "etc/gmt+1\0"
+    "etc/gmt+10\0"
+    "etc/gmt+11\0"
+    "etc/gmt+12\0"
+    "etc/gmt+2\0"
+    "etc/gmt+3\0"
+    "etc/gmt+4\0"
+    "etc/gmt+5\0"
+    "etc/gmt+6\0"
+    "etc/gmt+7\0"
+    "etc/gmt+8\0"
+    "etc/gmt+9\0"
+    "etc/gmt-0\0"
+    "etc/gmt-1\0"
+    "etc/gmt-10\0"
+    "etc/gmt-11\0"
+    "etc/gmt-12\0"
+    "etc/gmt-13\0"
+    "etc/gmt-14\0"
+    "etc/gmt-2\0"
+    "etc/gmt-3\0"
+    "etc/gmt-4\0"
+    "etc/gmt-5\0"
+    "etc/gmt-6\0"
+    "etc/gmt-7\0"
+    "etc/gmt-8\0"
+    "etc/gmt-9\0"
+    "etc/gmt0\0"
+    "etc/greenwich\0"
+    "etc/uct\0"
+    "etc/universal\0"
+    "etc/utc\0"
+    "etc/zulu\0"
+    "ethiopia\0"
+    "eucla\0"
+    "europe/amsterdam\0"
+    "europe/andorra\0"
+    "europe/astrakhan\0"
+    "europe/athens\0"
+    "europe/belfast\0"
+    "europe/belgrade\0"
+    "europe/berlin\0"
+    "europe/bratislava\0"
+    "europe/brussels\0"
+    "europe/bucharest\0"
+    "europe/budapest\0"
+    "europe/busingen\0"
+    "europe/chisinau\0"
+    "europe/copenhagen\0"
+    "europe/dublin\0"
+    "europe/gibraltar\0"
+    "europe/guernsey\0"
+    "europe/helsinki\0"
+    "europe/isle of man\0"
+    "europe/istanbul\0"
+    "europe/jersey\0"
+    "europe/kaliningrad\0"
+    "europe/kiev\0"
+    "europe/kirov\0"
+    "europe/kyiv\0"
+    "europe/lisbon\0"
+    "europe/ljubljana\0"
+    "europe/london\0"
+    "europe/luxembourg\0"
+    "europe/madrid\0"
+    "europe/malta\0"
+    "europe/mariehamn\0"
+    "europe/minsk\0"
+    "europe/monaco\0"
+    "europe/moscow\0"
+    "europe/nicosia\0"
+    "europe/oslo\0"
+    "europe/paris\0"
+    "europe/podgorica\0"
+    "europe/prague\0"
+    "europe/riga\0"
+    "europe/rome\0"
+    "europe/samara\0"
+    "europe/san marino\0"
+    "europe/sarajevo\0"
+    "europe/saratov\0"
+    "europe/simferopol\0"
+    "europe/skopje\0"
+    "europe/sofia\0"
+    "europe/stockholm\0"
+    "europe/tallinn\0"
+    "europe/tirane\0"
+    "europe/tiraspol\0"
+    "europe/ulyanovsk\0"
+    "europe/uzhgorod\0"
+    "europe/vaduz\0"
+    "europe/vatican\0"
+    "europe/vienna\0"
+    "europe/vilnius\0"
+    "europe/volgograd\0"
+    "europe/warsaw\0"
+    "europe/zagreb\0"
+    "europe/zaporozhye\0"
+    "europe/zurich\0"
+    "faeroe\0"
+    "fakaofo\0"
+    "falkland islands\0"
+    "famagusta\0"
+    "faroe\0"
+    "faroe islands\0"
+    "fiji\0"
+    "finland\0"
+    "fort nelson\0"
+    "fort wayne\0"
+    "fortaleza\0"
+    "france\0"
+    "freetown\0"
+    "french guiana\0"
+    "french polynesia\0"
+    "french s. terr.\0"
+    "funafuti\0"
+    "gabon\0"
+    "gaborone\0"
+    "galapagos\0"
+    "gambia\0"
+    "gambier\0"
+    "gaza\0"
+    "gb\0"
+    "gb-eire\0"
+    "gdt\0"
+    "general\0"
+    "georgia\0"
+    "germany\0"
+    "ghana\0"
+    "gibraltar\0"
+    "glace bay\0"
+    "gmt\0"
+    "gmt+0\0"
+    "gmt+1\0"
+    "gmt+10\0"
+    "gmt+11\0"
+    "gmt+12\0"
+    "gmt+2\0"
+    "gmt+3\0"
+    "gmt+4\0"
+    "gmt+5\0"
+    "gmt+6\0"
+    "gmt+7\0"
+    "gmt+8\0"
+    "gmt+9\0"
+    "gmt-0\0"
+    "gmt-1\0"
+    "gmt-10\0"
+    "gmt-11\0"
+    "gmt-12\0"
+    "gmt-13\0"
+    "gmt-14\0"
+    "gmt-2\0"
+    "gmt-3\0"
+    "gmt-4\0"
+    "gmt-5\0"
+    "gmt-6\0"
+    "gmt-7\0"
+    "gmt-8\0"
+    "gmt-9\0"
+    "gmt0\0"
+    "godthab\0"
+    "goose bay\0"
+    "grand turk\0"
+    "greece\0"
+    "greenland\0"
+    "greenwich\0"
+    "grenada\0"
+    "gst\0"
+    "guadalcanal\0"
+    "guadeloupe\0"
+    "guam\0"
+    "guatemala\0"
+    "guayaquil\0"
+    "guernsey\0"
+    "guinea\0"
+    "guinea-bissau\0"
+    "guyana\0"
+    "haiti\0"
+    "halifax\0"
+    "harare\0"
+    "harbin\0"
+    "havana\0"
+    "hawaii\0"
+    "hdt\0"
+    "hebron\0"
+    "helsinki\0"
+    "hermosillo\0"
+    "hkst\0"
+    "hkt\0"
+    "ho chi minh\0"
+    "hobart\0"
+    "honduras\0"
+    "hong kong\0"
+    "hongkong\0"
+    "honolulu\0"
+    "hovd\0"
+    "hst\0"
+    "hungary\0"
+    "iceland\0"
+    "idt\0"
+    "india\0"
+    "indian/antananarivo\0"
+    "indian/chagos\0"
+    "indian/christmas\0"
+    "indian/cocos\0"
+    "indian/comoro\0"
+    "indian/kerguelen\0"
+    "indian/mahe\0"
+    "indian/maldives\0"
+    "indian/mauritius\0"
+    "indian/mayotte\0"
+    "indian/reunion\0"
+    "indiana\0"
+    "indiana-starke\0"
+    "indianapolis\0"
+    "indonesia\0"
+    "inuvik\0"
+    "iqaluit\0"
+    "iran\0"
+    "iraq\0"
+    "ireland\0"
+    "irkutsk\0"
+    "isle of man\0"
+    "israel\0"
+    "ist\0"
+    "istanbul\0"
+    "italy\0"
+    "jakarta\0"
+    "jamaica\0"
+    "jan mayen\0"
+    "japan\0"
+    "jayapura\0"
+    "jersey\0"
+    "jerusalem\0"
+    "johannesburg\0"
+    "johnston\0"
+    "jordan\0"
+    "jst\0"
+    "juba\0"
+    "jujuy\0"
+    "juneau\0"
+    "kabul\0"
+    "kaliningrad\0"
+    "kamchatka\0"
+    "kampala\0"
+    "kanton\0"
+    "karachi\0"
+    "kashgar\0"
+    "kathmandu\0"
+    "katmandu\0"
+    "kazakhstan\0"
+    "kdt\0"
+    "kentucky\0"
+    "kenya\0"
+    "kerguelen\0"
+    "khandyga\0"
+    "khartoum\0"
+    "kiev\0"
+    "kigali\0"
+    "kinshasa\0"
+    "kiribati\0"
+    "kiritimati\0"
+    "kirov\0"
+    "knox\0"
+    "knox in\0"
+    "kolkata\0"
+    "korea (north)\0"
+    "korea (south)\0"
+    "kosrae\0"
+    "kralendijk\0"
+    "krasnoyarsk\0"
+    "kst\0"
+    "kuala lumpur\0"
+    "kuching\0"
+    "kuwait\0"
+    "kwajalein\0"
+    "kyiv\0"
+    "kyrgyzstan\0"
+    "la paz\0"
+    "la rioja\0"
+    "lagos\0"
+    "laos\0"
+    "latvia\0"
+    "lebanon\0"
+    "lesotho\0"
+    "lhi\0"
+    "liberia\0"
+    "libreville\0"
+    "libya\0"
+    "liechtenstein\0"
+    "lima\0"
+    "lindeman\0"
+    "lisbon\0"
+    "lithuania\0"
+    "ljubljana\0"
+    "lome\0"
+    "london\0"
+    "longyearbyen\0"
+    "lord howe\0"
+    "los angeles\0"
+    "louisville\0"
+    "lower princes\0"
+    "luanda\0"
+    "lubumbashi\0"
+    "lusaka\0"
+    "luxembourg\0"
+    "macao\0"
+    "macau\0"
+    "maceio\0"
+    "macquarie\0"
+    "madagascar\0"
+    "madeira\0"
+    "madrid\0"
+    "magadan\0"
+    "mahe\0"
+    "majuro\0"
+    "makassar\0"
+    "malabo\0"
+    "malawi\0"
+    "malaysia\0"
+    "maldives\0"
+    "mali\0"
+    "malta\0"
+    "managua\0"
+    "manaus\0"
+    "manila\0"
+    "maputo\0"
+    "marengo\0"
+    "mariehamn\0"
+    "marigot\0"
+    "marquesas\0"
+    "marshall islands\0"
+    "martinique\0"
+    "maseru\0"
+    "matamoros\0"
+    "mauritania\0"
+    "mauritius\0"
+    "mawson\0"
+    "mayotte\0"
+    "mazatlan\0"
+    "mbabane\0"
+    "mcmurdo\0"
+    "mdt\0"
+    "melbourne\0"
+    "mendoza\0"
+    "menominee\0"
+    "merida\0"
+    "mest\0"
+    "met\0"
+    "metlakatla\0"
+    "mexico\0"
+    "mexico city\0"
+    "mexico/bajanorte\0"
+    "mexico/bajasur\0"
+    "mexico/general\0"
+    "michigan\0"
+    "micronesia\0"
+    "midway\0"
+    "minsk\0"
+    "miquelon\0"
+    "mmt\0"
+    "mogadishu\0"
+    "moldova\0"
+    "monaco\0"
+    "moncton\0"
+    "mongolia\0"
+    "monrovia\0"
+    "montenegro\0"
+    "monterrey\0"
+    "montevideo\0"
+    "monticello\0"
+    "montreal\0"
+    "montserrat\0"
+    "morocco\0"
+    "moscow\0"
+    "mountain\0"
+    "mozambique\0"
+    "msd\0"
+    "msk\0"
+    "mst\0"
+    "mst7mdt\0"
+    "muscat\0"
+    "myanmar (burma)\0"
+    "nairobi\0"
+    "namibia\0"
+    "nassau\0"
+    "nauru\0"
+    "navajo\0"
+    "nddt\0"
+    "ndjamena\0"
+    "ndt\0"
+    "nepal\0"
+    "netherlands\0"
+    "new caledonia\0"
+    "new salem\0"
+    "new york\0"
+    "new zealand\0"
+    "newfoundland\0"
+    "niamey\0"
+    "nicaragua\0"
+    "nicosia\0"
+    "niger\0"
+    "nigeria\0"
+    "nipigon\0"
+    "niue\0"
+    "nome\0"
+    "norfolk\0"
+    "norfolk island\0"
+    "noronha\0"
+    "north\0"
+    "north dakota\0"
+    "north macedonia\0"
+    "northern mariana islands\0"
+    "norway\0"
+    "nouakchott\0"
+    "noumea\0"
+    "novokuznetsk\0"
+    "novosibirsk\0"
+    "nst\0"
+    "nsw\0"
+    "nuuk\0"
+    "nz\0"
+    "nz-chat\0"
+    "nzdt\0"
+    "nzst\0"
+    "ojinaga\0"
+    "oman\0"
+    "omsk\0"
+    "oral\0"
+    "oslo\0"
+    "ouagadougou\0"
+    "pacific\0"
+    "pacific/apia\0"
+    "pacific/auckland\0"
+    "pacific/bougainville\0"
+    "pacific/chatham\0"
+    "pacific/chuuk\0"
+    "pacific/easter\0"
+    "pacific/efate\0"
+    "pacific/enderbury\0"
+    "pacific/fakaofo\0"
+    "pacific/fiji\0"
+    "pacific/funafuti\0"
+    "pacific/galapagos\0"
+    "pacific/gambier\0"
+    "pacific/guadalcanal\0"
+    "pacific/guam\0"
+    "pacific/honolulu\0"
+    "pacific/johnston\0"
+    "pacific/kanton\0"
+    "pacific/kiritimati\0"
+    "pacific/kosrae\0"
+    "pacific/kwajalein\0"
+    "pacific/majuro\0"
+    "pacific/marquesas\0"
+    "pacific/midway\0"
+    "pacific/nauru\0"
+    "pacific/niue\0"
+    "pacific/norfolk\0"
+    "pacific/noumea\0"
+    "pacific/pago pago\0"
+    "pacific/palau\0"
+    "pacific/pitcairn\0"
+    "pacific/pohnpei\0"
+    "pacific/ponape\0"
+    "pacific/port moresby\0"
+    "pacific/rarotonga\0"
+    "pacific/saipan\0"
+    "pacific/samoa\0"
+    "pacific/tahiti\0"
+    "pacific/tarawa\0"
+    "pacific/tongatapu\0"
+    "pacific/truk\0"
+    "pacific/wake\0"
+    "pacific/wallis\0"
+    "pacific/yap\0"
+    "pago pago\0"
+    "pakistan\0"
+    "palau\0"
+    "palestine\0"
+    "palmer\0"
+    "panama\0"
+    "pangnirtung\0"
+    "papua new guinea\0"
+    "paraguay\0"
+    "paramaribo\0"
+    "paris\0"
+    "pdt\0"
+    "perth\0"
+    "peru\0"
+    "petersburg\0"
+    "philippines\0"
+    "phnom penh\0"
+    "phoenix\0"
+    "pitcairn\0"
+    "pkst\0"
+    "pkt\0"
+    "podgorica\0"
+    "pohnpei\0"
+    "poland\0"
+    "ponape\0"
+    "pontianak\0"
+    "port moresby\0"
+    "port of spain\0"
+    "port-au-prince\0"
+    "porto acre\0"
+    "porto velho\0"
+    "porto-novo\0"
+    "portugal\0"
+    "prague\0"
+    "prc\0"
+    "pst\0"
+    "pst8pdt\0"
+    "puerto rico\0"
+    "punta arenas\0"
+    "pyongyang\0"
+    "qatar\0"
+    "qostanay\0"
+    "queensland\0"
+    "qyzylorda\0"
+    "rainy river\0"
+    "rangoon\0"
+    "rankin inlet\0"
+    "rarotonga\0"
+    "recife\0"
+    "regina\0"
+    "resolute\0"
+    "reunion\0"
+    "reykjavik\0"
+    "riga\0"
+    "rio branco\0"
+    "rio gallegos\0"
+    "riyadh\0"
+    "roc\0"
+    "rok\0"
+    "romania\0"
+    "rome\0"
+    "rosario\0"
+    "rothera\0"
+    "russia\0"
+    "rwanda\0"
+    "r\303\251union\0"
+    "saigon\0"
+    "saipan\0"
+    "sakhalin\0"
+    "salta\0"
+    "samara\0"
+    "samarkand\0"
+    "samoa\0"
+    "samoa (american)\0"
+    "samoa (western)\0"
+    "san juan\0"
+    "san luis\0"
+    "san marino\0"
+    "santa isabel\0"
+    "santarem\0"
+    "santiago\0"
+    "santo domingo\0"
+    "sao paulo\0"
+    "sao tome\0"
+    "sao tome & principe\0"
+    "sarajevo\0"
+    "saratov\0"
+    "saskatchewan\0"
+    "sast\0"
+    "saudi arabia\0"
+    "scoresbysund\0"
+    "senegal\0"
+    "seoul\0"
+    "serbia\0"
+    "seychelles\0"
+    "shanghai\0"
+    "shiprock\0"
+    "sierra leone\0"
+    "simferopol\0"
+    "singapore\0"
+    "sitka\0"
+    "skopje\0"
+    "slovakia\0"
+    "slovenia\0"
+    "sofia\0"
+    "solomon islands\0"
+    "somalia\0"
+    "south\0"
+    "south africa\0"
+    "south georgia\0"
+    "south georgia & the south sandwich islands\0"
+    "south pole\0"
+    "south sudan\0"
+    "spain\0"
+    "srednekolymsk\0"
+    "sri lanka\0"
+    "sst\0"
+    "st barthelemy\0"
+    "st helena\0"
+    "st johns\0"
+    "st kitts\0"
+    "st kitts & nevis\0"
+    "st lucia\0"
+    "st maarten (dutch)\0"
+    "st martin (french)\0"
+    "st pierre & miquelon\0"
+    "st thomas\0"
+    "st vincent\0"
+    "stanley\0"
+    "stockholm\0"
+    "sudan\0"
+    "suriname\0"
+    "svalbard & jan mayen\0"
+    "sweden\0"
+    "swift current\0"
+    "switzerland\0"
+    "sydney\0"
+    "syowa\0"
+    "syria\0"
+    "tahiti\0"
+    "taipei\0"
+    "taiwan\0"
+    "tajikistan\0"
+    "tallinn\0"
+    "tanzania\0"
+    "tarawa\0"
+    "tashkent\0"
+    "tasmania\0"
+    "tbilisi\0"
+    "tegucigalpa\0"
+    "tehran\0"
+    "tel aviv\0"
+    "tell city\0"
+    "thailand\0"
+    "thimbu\0"
+    "thimphu\0"
+    "thule\0"
+    "thunder bay\0"
+    "tijuana\0"
+    "timbuktu\0"
+    "tirane\0"
+    "tiraspol\0"
+    "togo\0"
+    "tokelau\0"
+    "tokyo\0"
+    "tomsk\0"
+    "tonga\0"
+    "tongatapu\0"
+    "toronto\0"
+    "tortola\0"
+    "trinidad & tobago\0"
+    "tripoli\0"
+    "troll\0"
+    "truk\0"
+    "tucuman\0"
+    "tunis\0"
+    "tunisia\0"
+    "turkey\0"
+    "turkmenistan\0"
+    "turks & caicos is\0"
+    "tuvalu\0"
+    "uct\0"
+    "uganda\0"
+    "ujung pandang\0"
+    "ukraine\0"
+    "ulaanbaatar\0"
+    "ulan bator\0"
+    "ulyanovsk\0"
+    "united arab emirates\0"
+    "united states\0"
+    "universal\0"
+    "uruguay\0"
+    "urumqi\0"
+    "us minor outlying islands\0"
+    "us/alaska\0"
+    "us/aleutian\0"
+    "us/arizona\0"
+    "us/central\0"
+    "us/east-indiana\0"
+    "us/eastern\0"
+    "us/hawaii\0"
+    "us/indiana-starke\0"
+    "us/michigan\0"
+    "us/mountain\0"
+    "us/pacific\0"
+    "us/samoa\0"
+    "ushuaia\0"
+    "ust-nera\0"
+    "utc\0"
+    "uzbekistan\0"
+    "uzhgorod\0"
+    "vaduz\0"
+    "vancouver\0"
+    "vanuatu\0"
+    "vatican\0"
+    "vatican city\0"
+    "venezuela\0"
+    "vevay\0"
+    "victoria\0"
+    "vienna\0"
+    "vientiane\0"
+    "vietnam\0"
+    "vilnius\0"
+    "vincennes\0"
+    "virgin\0"
+    "virgin islands (uk)\0"
+    "virgin islands (us)\0"
+    "vladivostok\0"
+    "volgograd\0"
+    "vostok\0"
+    "w-su\0"
+    "wake\0"
+    "wallis\0"
+    "wallis & futuna\0"
+    "warsaw\0"
+    "wast\0"
+    "wat\0"
+    "west\0"
+    "western sahara\0"
+    "wet\0"
+    "whitehorse\0"
+    "wib\0"
+    "winamac\0"
+    "windhoek\0"
+    "winnipeg\0"
+    "wit\0"
+    "wita\0"
+    "yakutat\0"
+    "yakutsk\0"
+    "yancowinna\0"
+    "yangon\0"
+    "yap\0"
+    "ydt\0"
+    "yekaterinburg\0"
+    "yellowknife\0"
+    "yemen\0"
+    "yerevan\0"
+    "yst\0"
+    "yukon\0"
+    "zagreb\0"
+    "zambia\0"
+    "zaporozhye\0"
+    "zimbabwe\0"
+    "zulu\0"
+    "zurich\0"
+    "\303\205land islands\0";
+
+static const uint16_t termOffsets[1373] = {
+        0,     8,    14,    19,    24,    29,    33,    38,    50,    55,
+       64,    69,    73,    78,    83,    95,   110,   123,   142,   157,
+      171,   185,   199,   213,   227,   241,   257,   276,   293,   306,
+      324,   337,   352,   365,   386,   402,   416,   432,   448,   464,
+      478,   498,   510,   525,   541,   555,   571,   584,   602,   614,
+      628,   646,   660,   674,   688,   702,   717,   734,   750,   765,
+      781,   795,   813,   832,   850,   866,   882,   897,   910,   926,
+      931,   936,   941,   946,   953,   961,   970,   978,   986,   993,
+     1006,  1024,  1041,  1057,  1075,  1106,  1134,  1167,  1193,  1217,
+     1244,  1270,  1301,  1325,  1352,  1379,  1405,  1431,  1445,  1462,
+     1479,  1492,  1506,  1529,  1546,  1560,  1575,  1596,  1614,  1629,
+     1643,  1664,  1686,  1707,  1722,  1738,  1756,  1772,  1787,  1803,
+     1821,  1843,  1865,  1881,  1900,  1918,  1934,  1949,  1965,  1986,
+     2001,  2022,  2037,  2053,  2070,  2087,  2104,  2124,  2141,  2161,
+     2180,  2198,  2216,  2232,  2250,  2269,  2285,  2304,  2322,  2340,
+     2355,  2371,  2386,  2405,  2434,  2455,  2479,  2506,  2532,  2554,
+     2580,  2604,  2625,  2640,  2656,  2672,  2686,  2701,  2729,  2757,
+     2773,  2792,  2807,  2820,  2840,  2859,  2881,  2896,  2912,  2927,
+     2943,  2962,  2980,  2997,  3013,  3031,  3046,  3065,  3085,  3102,
+     3118,  3136,  3155,  3172,  3191,  3206,  3223,  3239,  3252,  3268,
+     3296,  3324,  3355,  3368,  3384,  3399,  3419,  3438,  3454,  3476,
+     3499,  3518,  3538,  3558,  3579,  3599,  3620,  3635,  3650,  3667,
+     3686,  3702,  3723,  3740,  3757,  3779,  3797,  3818,  3835,  3849,
+     3871,  3888,  3905,  3922,  3940,  3959,  3981,  4001,  4015,  4035,
+     4051,  4067,  4083,  4101,  4116,  4135,  4152,  4168,  4188,  4194,
+     4204,  4211,  4221,  4229,  4236,  4245,  4258,  4269,  4286,  4303,
+     4329,  4350,  4368,  4387,  4405,  4424,  4446,  4463,  4480,  4498,
+     4506,  4524,  4529,  4535,  4542,  4552,  4572,  4582,  4590,  4598,
+     4604,  4613,  4623,  4633,  4645,  4656,  4668,  4679,  4691,  4705,
+     4720,  4732,  4745,  4758,  4768,  4781,  4794,  4806,  4819,  4831,
+     4845,  4856,  4872,  4887,  4902,  4915,  4926,  4940,  4951,  4961,
+     4972,  4986,  5001,  5011,  5023,  5035,  5052,  5067,  5077,  5090,
+     5104,  5117,  5131,  5146,  5157,  5172,  5185,  5198,  5213,  5227,
+     5241,  5254,  5271,  5289,  5302,  5314,  5325,  5336,  5349,  5363,
+     5375,  5387,  5400,  5418,  5435,  5445,  5455,  5471,  5486,  5501,
+     5512,  5526,  5541,  5554,  5566,  5578,  5592,  5607,  5618,  5632,
+     5647,  5666,  5678,  5692,  5705,  5717,  5731,  5743,  5756,  5767,
+     5778,  5797,  5814,  5830,  5842,  5856,  5871,  5888,  5901,  5913,
+     5932,  5945,  5952,  5959,  5963,  5973,  5982,  5989,  5998,  6003,
+     6012,  6028,  6045,  6061,  6081,  6097,  6112,  6131,  6148,  6167,
+     6190,  6209,  6226,  6233,  6242,  6252,  6266,  6285,  6304,  6326,
+     6345,  6362,  6379,  6395,  6412,  6426,  6445,  6465,  6485,  6501,
+     6515,  6531,  6552,  6568,  6585,  6604,  6623,  6638,  6659,  6667,
+     6672,  6677,  6688,  6695,  6703,  6711,  6717,  6732,  6740,  6750,
+     6758,  6763,  6770,  6778,  6789,  6796,  6803,  6812,  6820,  6824,
+     6831,  6839,  6845,  6853,  6861,  6870,  6877,  6883,  6890,  6898,
+     6905,  6912,  6920,  6927,  6940,  6949,  6959,  6966,  6972,  6980,
+     7001,  7010,  7023,  7034,  7041,  7053,  7070,  7082,  7094,  7106,
+     7115,  7128,  7159,  7171,  7178,  7187,  7191,  7201,  7210,  7223,
+     7233,  7242,  7255,  7263,  7272,  7278,  7287,  7296,  7310,  7319,
+     7332,  7339,  7355,  7370,  7385,  7401,  7421,  7436,  7456,  7469,
+     7476,  7485,  7492,  7503,  7511,  7524,  7535,  7541,  7546,  7550,
+     7560,  7568,  7575,  7590,  7594,  7601,  7609,  7630,  7635,  7639,
+     7645,  7650,  7657,  7665,  7673,  7683,  7689,  7707,  7726,  7732,
+     7741,  7747,  7758,  7768,  7778,  7795,  7800,  7810,  7816,  7830,
+     7836,  7860,  7869,  7877,  7892,  7899,  7907,  7915,  7933,  7946,
+     7958,  7971,  7982,  7996,  8004,  8015,  8025,  8033,  8041,  8045,
+     8053,  8058,  8065,  8073,  8082,  8089,  8096,  8111,  8126,  8132,
+     8138,  8147,  8160,  8174,  8181,  8187,  8194,  8207,  8215,  8225,
+     8232,  8240,  8246,  8251,  8260,  8269,  8288,  8295,  8301,  8308,
+     8323,  8332,  8337,  8348,  8361,  8368,  8381,  8389,  8393,  8401,
+     8410,  8414,  8419,  8423,  8429,  8435,  8440,  8449,  8458,  8470,
+     8480,  8489,  8507,  8515,  8519,  8527,  8535,  8556,  8564,  8574,
+     8584,  8595,  8606,  8617,  8627,  8637,  8647,  8657,  8667,  8677,
+     8687,  8697,  8707,  8717,  8728,  8739,  8750,  8761,  8772,  8782,
+     8792,  8802,  8812,  8822,  8832,  8842,  8852,  8861,  8875,  8883,
+     8897,  8905,  8914,  8923,  8929,  8946,  8961,  8978,  8992,  9007,
+     9023,  9037,  9055,  9071,  9088,  9104,  9120,  9136,  9154,  9168,
+     9185,  9201,  9217,  9236,  9252,  9266,  9285,  9297,  9310,  9322,
+     9336,  9353,  9367,  9385,  9399,  9412,  9429,  9442,  9456,  9470,
+     9485,  9497,  9510,  9527,  9541,  9553,  9565,  9579,  9597,  9613,
+     9628,  9646,  9660,  9673,  9690,  9705,  9719,  9735,  9752,  9768,
+     9781,  9796,  9810,  9825,  9842,  9856,  9870,  9888,  9902,  9909,
+     9917,  9934,  9944,  9950,  9964,  9969,  9977,  9989, 10000, 10010,
+    10017, 10026, 10040, 10057, 10073, 10082, 10088, 10097, 10107, 10114,
+    10122, 10127, 10130, 10138, 10142, 10150, 10158, 10166, 10172, 10182,
+    10192, 10196, 10202, 10208, 10215, 10222, 10229, 10235, 10241, 10247,
+    10253, 10259, 10265, 10271, 10277, 10283, 10289, 10296, 10303, 10310,
+    10317, 10324, 10330, 10336, 10342, 10348, 10354, 10360, 10366, 10372,
+    10377, 10385, 10395, 10406, 10413, 10423, 10433, 10441, 10445, 10457,
+    10468, 10473, 10483, 10493, 10502, 10509, 10523, 10530, 10536, 10544,
+    10551, 10558, 10565, 10572, 10576, 10583, 10592, 10603, 10608, 10612,
+    10624, 10631, 10640, 10650, 10659, 10668, 10673, 10677, 10685, 10693,
+    10697, 10703, 10723, 10737, 10754, 10767, 10781, 10798, 10810, 10826,
+    10843, 10858, 10873, 10881, 10896, 10909, 10919, 10926, 10934, 10939,
+    10944, 10952, 10960, 10972, 10979, 10983, 10992, 10998, 11006, 11014,
+    11024, 11030, 11039, 11046, 11056, 11069, 11078, 11085, 11089, 11094,
+    11100, 11107, 11113, 11125, 11135, 11143, 11150, 11158, 11166, 11176,
+    11185, 11196, 11200, 11209, 11215, 11225, 11234, 11243, 11248, 11255,
+    11264, 11273, 11284, 11290, 11295, 11303, 11311, 11325, 11339, 11346,
+    11357, 11369, 11373, 11386, 11394, 11401, 11411, 11416, 11427, 11434,
+    11443, 11449, 11454, 11461, 11469, 11477, 11481, 11489, 11500, 11506,
+    11520, 11525, 11534, 11541, 11551, 11561, 11566, 11573, 11586, 11596,
+    11608, 11619, 11633, 11640, 11651, 11658, 11669, 11675, 11681, 11688,
+    11698, 11709, 11717, 11724, 11732, 11737, 11744, 11753, 11760, 11767,
+    11776, 11785, 11790, 11796, 11804, 11811, 11818, 11825, 11833, 11843,
+    11851, 11861, 11878, 11889, 11896, 11906, 11917, 11927, 11934, 11942,
+    11951, 11959, 11967, 11971, 11981, 11989, 11999, 12006, 12011, 12015,
+    12026, 12033, 12045, 12062, 12077, 12092, 12101, 12112, 12119, 12125,
+    12134, 12138, 12148, 12156, 12163, 12171, 12180, 12189, 12200, 12210,
+    12221, 12232, 12241, 12252, 12260, 12267, 12276, 12287, 12291, 12295,
+    12299, 12307, 12314, 12330, 12338, 12346, 12353, 12359, 12366, 12371,
+    12380, 12384, 12390, 12402, 12416, 12426, 12435, 12447, 12460, 12467,
+    12477, 12485, 12491, 12499, 12507, 12512, 12517, 12525, 12540, 12548,
+    12554, 12567, 12583, 12608, 12615, 12626, 12633, 12646, 12658, 12662,
+    12666, 12671, 12674, 12682, 12687, 12692, 12700, 12705, 12710, 12715,
+    12720, 12732, 12740, 12753, 12770, 12791, 12807, 12821, 12836, 12850,
+    12868, 12884, 12897, 12914, 12932, 12948, 12968, 12981, 12998, 13015,
+    13030, 13049, 13064, 13082, 13097, 13115, 13130, 13144, 13157, 13173,
+    13188, 13206, 13220, 13237, 13253, 13268, 13289, 13307, 13322, 13336,
+    13351, 13366, 13384, 13397, 13410, 13425, 13437, 13447, 13456, 13462,
+    13472, 13479, 13486, 13498, 13515, 13524, 13535, 13541, 13545, 13551,
+    13556, 13567, 13579, 13590, 13598, 13607, 13612, 13616, 13626, 13634,
+    13641, 13648, 13658, 13671, 13685, 13700, 13711, 13723, 13734, 13743,
+    13750, 13754, 13758, 13766, 13778, 13791, 13801, 13807, 13816, 13827,
+    13837, 13849, 13857, 13870, 13880, 13887, 13894, 13903, 13911, 13921,
+    13926, 13937, 13950, 13957, 13961, 13965, 13973, 13978, 13986, 13994,
+    14001, 14008, 14017, 14024, 14031, 14040, 14046, 14053, 14063, 14069,
+    14086, 14102, 14111, 14120, 14131, 14144, 14153, 14162, 14176, 14186,
+    14195, 14215, 14224, 14232, 14245, 14250, 14263, 14276, 14284, 14290,
+    14297, 14308, 14317, 14326, 14339, 14350, 14360, 14366, 14373, 14382,
+    14391, 14397, 14413, 14421, 14427, 14440, 14454, 14497, 14508, 14520,
+    14526, 14540, 14550, 14554, 14568, 14578, 14587, 14596, 14613, 14622,
+    14641, 14660, 14681, 14691, 14702, 14710, 14720, 14726, 14735, 14756,
+    14763, 14777, 14789, 14796, 14802, 14808, 14815, 14822, 14829, 14840,
+    14848, 14857, 14864, 14873, 14882, 14890, 14902, 14909, 14918, 14928,
+    14937, 14944, 14952, 14958, 14970, 14978, 14987, 14994, 15003, 15008,
+    15016, 15022, 15028, 15034, 15044, 15052, 15060, 15078, 15086, 15092,
+    15097, 15105, 15111, 15119, 15126, 15139, 15157, 15164, 15168, 15175,
+    15189, 15197, 15209, 15220, 15230, 15251, 15265, 15275, 15283, 15290,
+    15316, 15326, 15338, 15349, 15360, 15376, 15387, 15397, 15415, 15427,
+    15439, 15450, 15459, 15467, 15476, 15480, 15491, 15500, 15506, 15516,
+    15524, 15532, 15545, 15555, 15561, 15570, 15577, 15587, 15595, 15603,
+    15613, 15620, 15640, 15660, 15672, 15682, 15689, 15694, 15699, 15706,
+    15722, 15729, 15734, 15738, 15743, 15758, 15762, 15773, 15777, 15785,
+    15794, 15803, 15807, 15812, 15820, 15828, 15839, 15846, 15850, 15854,
+    15868, 15880, 15886, 15894, 15898, 15904, 15911, 15918, 15929, 15938,
+    15943, 15950, 15965
+};
+
+static const uint16_t zoneStarts[1373] = {
+        0,     1,     2,     4,     5,     8,     9,    10,    11,    12,
+       13,    14,    22,    28,    35,    36,    37,    38,    39,    40,
+       41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+       51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+       61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+       71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+       81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
+       91,    93,    99,   105,   106,   107,   108,   109,   110,   111,
+      112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+      122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+      132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+      142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+      152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+      162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+      172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+      182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+      192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+      202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+      212,   213,   214,   215,   216,   217,   218,   219,   220,   221,
+      222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
+      232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+      242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
+      252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+      262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
+      272,   273,   274,   275,   276,   277,   278,   279,   280,   281,
+      282,   283,   284,   285,   286,   287,   288,   298,   299,   300,
+      301,   302,   303,   304,   305,   306,   307,   308,   309,   310,
+      311,   312,   313,   314,   315,   316,   317,   329,   330,   331,
+      332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
+      342,   343,   344,   345,   346,   347,   348,   349,   350,   351,
+      352,   353,   354,   355,   356,   357,   358,   359,   360,   361,
+      362,   363,   364,   365,   366,   367,   368,   369,   370,   371,
+      372,   373,   374,   375,   376,   377,   378,   379,   380,   381,
+      382,   383,   384,   385,   386,   387,   388,   389,   390,   391,
+      392,   393,   394,   395,   396,   397,   398,   399,   400,   401,
+      402,   403,   404,   405,   406,   407,   408,   409,   410,   411,
+      412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
+      422,   423,   424,   425,   426,   427,   428,   429,   430,   431,
+      432,   433,   434,   435,   466,   467,   468,   469,   470,   471,
+      472,   473,   474,   475,   476,   477,   478,   479,   480,   481,
+      482,   483,   484,   485,   486,   498,   499,   500,   501,   502,
+      503,   504,   505,   506,   507,   508,   509,   510,   511,   512,
+      513,   514,   515,   516,   517,   518,   519,   520,   521,   522,
+      523,   524,   525,   526,   527,   528,   529,   530,   531,   532,
+      533,   534,   535,   536,   537,   538,   539,   540,   541,   543,
+      544,   545,   546,   547,   548,   549,   550,   551,   552,   553,
+      554,   555,   556,   557,   558,   559,   560,   561,   562,   563,
+      564,   565,   566,   567,   583,   584,   585,   586,   587,   588,
+      589,   590,   591,   592,   593,   594,   600,   601,   602,   603,
+      604,   605,   606,   607,   608,   609,   610,   611,   612,   613,
+      614,   637,   638,   639,   640,   641,   642,   643,   644,   645,
+      646,   647,   648,   649,   650,   651,   652,   653,   655,   666,
+      667,   668,   669,   670,   708,   709,   711,   712,   751,   790,
+      791,   792,   793,   794,   795,   796,   800,   801,   802,   804,
+      805,   806,   807,   808,   809,   810,   812,   813,   814,   815,
+      816,   817,   818,   819,   820,   821,   822,   823,   825,   826,
+      827,   828,   829,   830,   831,   832,   833,   834,   835,   873,
+      874,   875,   876,   877,   878,   879,   881,   882,   883,   884,
+      885,   886,   887,   888,   889,   890,   891,   892,   893,   894,
+      895,   896,   897,   898,   899,   900,   901,   902,   903,   904,
+      905,   906,   907,   908,   909,   910,   911,   913,   925,   927,
+      928,   947,   971,   996,   997,   998,   999,  1000,  1001,  1002,
+     1003,  1004,  1005,  1006,  1037,  1038,  1039,  1040,  1041,  1042,
+     1043,  1044,  1045,  1046,  1047,  1048,  1049,  1050,  1051,  1052,
+     1053,  1054,  1055,  1056,  1057,  1058,  1059,  1060,  1061,  1062,
+     1063,  1064,  1065,  1066,  1067,  1068,  1069,  1070,  1071,  1072,
+     1073,  1074,  1075,  1076,  1077,  1078,  1079,  1080,  1081,  1082,
+     1083,  1084,  1085,  1086,  1087,  1088,  1089,  1090,  1091,  1092,
+     1093,  1094,  1095,  1096,  1097,  1098,  1099,  1100,  1101,  1102,
+     1103,  1104,  1105,  1106,  1107,  1108,  1109,  1110,  1111,  1112,
+     1113,  1114,  1115,  1116,  1117,  1118,  1119,  1120,  1121,  1122,
+     1123,  1124,  1125,  1126,  1127,  1128,  1129,  1130,  1131,  1132,
+     1133,  1134,  1135,  1136,  1137,  1138,  1139,  1140,  1141,  1142,
+     1143,  1144,  1145,  1146,  1147,  1148,  1149,  1150,  1151,  1152,
+     1153,  1154,  1155,  1158,  1159,  1160,  1161,  1162,  1163,  1164,
+     1165,  1166,  1167,  1168,  1170,  1171,  1172,  1174,  1175,  1176,
+     1177,  1199,  1200,  1201,  1202,  1203,  1204,  1205,  1206,  1207,
+     1208,  1209,  1210,  1211,  1212,  1213,  1214,  1215,  1216,  1217,
+     1218,  1219,  1220,  1221,  1222,  1223,  1224,  1225,  1226,  1227,
+     1228,  1229,  1230,  1231,  1232,  1236,  1237,  1238,  1240,  1241,
+     1242,  1243,  1244,  1245,  1246,  1247,  1248,  1249,  1250,  1251,
+     1252,  1253,  1254,  1255,  1256,  1257,  1258,  1259,  1260,  1261,
+     1262,  1263,  1264,  1265,  1266,  1267,  1268,  1271,  1272,  1274,
+     1277,  1278,  1279,  1280,  1281,  1282,  1283,  1284,  1285,  1286,
+     1287,  1288,  1289,  1297,  1298,  1299,  1303,  1304,  1305,  1306,
+     1307,  1308,  1309,  1310,  1311,  1316,  1317,  1318,  1319,  1320,
+     1321,  1322,  1323,  1324,  1325,  1326,  1327,  1328,  1329,  1330,
+     1331,  1332,  1333,  1334,  1335,  1336,  1337,  1338,  1339,  1340,
+     1341,  1348,  1349,  1351,  1352,  1353,  1354,  1355,  1356,  1357,
+     1358,  1361,  1362,  1363,  1364,  1365,  1366,  1367,  1368,  1369,
+     1370,  1371,  1373,  1374,  1375,  1376,  1377,  1378,  1379,  1380,
+     1381,  1382,  1383,  1384,  1385,  1386,  1387,  1388,  1389,  1390,
+     1391,  1392,  1393,  1394,  1395,  1396,  1397,  1398,  1399,  1400,
+     1401,  1402,  1403,  1404,  1405,  1406,  1407,  1408,  1409,  1410,
+     1411,  1412,  1413,  1414,  1415,  1416,  1417,  1418,  1419,  1420,
+     1422,  1423,  1424,  1425,  1426,  1427,  1428,  1429,  1430,  1431,
+     1432,  1433,  1435,  1436,  1437,  1438,  1439,  1440,  1441,  1442,
+     1443,  1444,  1445,  1460,  1461,  1462,  1463,  1464,  1465,  1466,
+     1467,  1479,  1480,  1481,  1482,  1483,  1484,  1487,  1488,  1489,
+     1490,  1491,  1492,  1493,  1494,  1495,  1497,  1498,  1499,  1500,
+     1501,  1502,  1503,  1504,  1505,  1506,  1508,  1509,  1520,  1531,
+     1554,  1555,  1556,  1557,  1558,  1559,  1560,  1561,  1562,  1563,
+     1564,  1565,  1566,  1567,  1568,  1569,  1570,  1572,  1573,  1574,
+     1575,  1576,  1577,  1578,  1579,  1580,  1581,  1582,  1583,  1584,
+     1585,  1588,  1589,  1590,  1591,  1592,  1593,  1594,  1595,  1596,
+     1597,  1598,  1599,  1600,  1602,  1604,  1605,  1606,  1607,  1608,
+     1609,  1610,  1612,  1613,  1614,  1615,  1616,  1617,  1618,  1619,
+     1620,  1621,  1622,  1623,  1624,  1625,  1626,  1627,  1628,  1629,
+     1630,  1631,  1632,  1633,  1634,  1635,  1636,  1637,  1638,  1639,
+     1640,  1641,  1642,  1643,  1644,  1645,  1646,  1647,  1648,  1649,
+     1650,  1651,  1652,  1653,  1654,  1655,  1656,  1657,  1658,  1659,
+     1661,  1662,  1663,  1664,  1666,  1667,  1668,  1669,  1682,  1683,
+     1684,  1685,  1686,  1687,  1688,  1689,  1690,  1691,  1692,  1693,
+     1694,  1695,  1696,  1697,  1698,  1699,  1700,  1701,  1702,  1705,
+     1706,  1707,  1720,  1721,  1722,  1723,  1724,  1725,  1726,  1727,
+     1728,  1729,  1730,  1731,  1732,  1733,  1734,  1735,  1736,  1737,
+     1738,  1739,  1740,  1741,  1742,  1743,  1744,  1745,  1746,  1747,
+     1773,  1774,  1775,  1776,  1777,  1778,  1779,  1780,  1781,  1782,
+     1783,  1784,  1785,  1786,  1787,  1788,  1789,  1790,  1791,  1792,
+     1793,  1794,  1795,  1796,  1797,  1801,  1802,  1803,  1804,  1805,
+     1806,  1807,  1808,  1809,  1810,  1811,  1812,  1813,  1814,  1815,
+     1816,  1817,  1818,  1819,  1820,  1821,  1822,  1823,  1824,  1825,
+     1828,  1829,  1830,  1832,  1833,  1834,  1835,  1836,  1837,  1838,
+     1839,  1840,  1841,  1842,  1843,  1844,  1845,  1846,  1847,  1848,
+     1849,  1850,  1851,  1852,  1853,  1854,  1855,  1856,  1857,  1858,
+     1859,  1860,  1861,  1862,  1863,  1864,  1865,  1866,  1867,  1868,
+     1869,  1870,  1871,  1872,  1873,  1874,  1875,  1876,  1877,  1878,
+     1879,  1880,  1881,  1882,  1883,  1884,  1885,  1886,  1887,  1888,
+     1889,  1890,  1891,  1892,  1893,  1894,  1895,  1896,  1897,  1898,
+     1899,  1901,  1902,  1903,  1904,  1905,  1934,  1935,  1936,  1937,
+     1939,  1940,  1941,  1942,  1943,  1944,  1945,  1946,  1947,  1948,
+     1949,  1950,  1951,  1952,  1953,  1954,  1956,  1957,  1958,  1959,
+     1960,  1961,  1962,  1963,  1964,  1965,  1966,  1967,  1968,  1969,
+     1970,  1971,  1972,  1973,  1974,  1975,  1976,  1977,  1978,  1979,
+     1980,  1981,  1982,  1995,  2005,  2006,  2014,  2015,  2017,  2018,
+     2019,  2020,  2021,  2023,  2024,  2025,  2026,  2027,  2028,  2030,
+     2031,  2032,  2033,  2034,  2040,  2041,  2042,  2043,  2044,  2045,
+     2046,  2047,  2048
+};
+
+static const uint16_t termZones[2048] = {
+        0,     1,   300,   302,   173,   300,   302,   303,   310,    52,
+        2,   107,   300,   208,    74,   106,   107,   114,   140,   148,
+      188,   291,   199,   301,   305,   306,   308,   310,   199,   301,
+      305,   306,   307,   308,   310,   241,     0,     1,     2,     3,
+        4,    42,     5,     6,     7,     8,     9,    10,    11,    12,
+       13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+       23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+       33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+       43,    44,    45,    46,    47,    48,     0,    49,    50,    51,
+       53,    52,    53,    53,   128,   145,   154,   179,   195,    53,
+      128,   145,   154,   179,   195,    53,   392,    52,     3,     3,
+      209,    52,    53,    54,    55,    56,    57,    58,    58,    59,
+       60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+       70,    71,    52,    72,    73,    74,    75,    76,    77,    78,
+       79,    80,    57,    81,    82,    83,    84,    58,    85,    86,
+       87,    88,    89,   161,    59,    90,    91,    92,    93,    94,
+       95,    96,    97,    98,    99,   100,   101,   102,   103,   189,
+      104,   117,   105,   106,   159,   107,   108,   109,   110,   111,
+      112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+      122,   123,   124,   117,   125,   126,   127,    60,   128,   129,
+      130,   118,   131,   132,   133,   134,   129,   135,   136,   137,
+      138,   139,   140,   141,   142,    62,   143,   144,   145,   146,
+      147,   148,   149,   150,   190,   151,   152,   153,   190,   154,
+      155,   156,   157,   158,   159,   160,   161,   126,   162,   163,
+      165,   164,   173,   166,   167,   168,   194,   169,   170,   171,
+      172,   173,    59,   189,   174,   175,   176,   177,   178,    98,
+      179,   180,   181,   182,   183,   184,   185,   186,   187,   188,
+      190,   189,   190,   191,   192,   167,   193,   194,   195,   101,
+      210,   344,   211,    53,   345,    33,    54,   403,   196,   197,
+      198,   200,   201,   202,   203,   204,   205,   206,   196,   197,
+      198,   199,   200,   201,   202,   203,   419,   204,   205,   206,
+       55,    55,   418,   212,   213,    56,   207,    57,    58,    59,
+       60,    61,    62,    63,    64,    65,    66,    67,    68,   163,
+      289,    69,   214,   214,   208,   209,   210,   211,   212,   213,
+      214,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+      223,   246,   224,   281,   271,   271,   225,   227,   226,   227,
+      228,   229,   230,   231,   232,   271,   233,   234,   235,   236,
+      237,   362,   238,   239,   240,   241,   242,   243,   282,   244,
+      244,   245,   246,   247,   248,   249,   250,   251,   251,   252,
+      253,   254,   255,   256,   257,   258,   259,   260,   261,   262,
+      263,   264,   265,   266,   287,   267,   234,   268,   269,   270,
+      271,   272,   273,   274,   275,   276,   277,   240,   278,   278,
+      279,   280,   253,   281,   281,   282,   283,   284,   285,   286,
+      287,   288,   289,     4,    42,    54,    55,    69,    74,    77,
+       94,   100,   106,   107,   108,   109,   110,   114,   131,   135,
+      139,   140,   147,   148,   151,   165,   167,   176,   180,   182,
+      183,   184,   185,   188,   191,   291,   346,    70,   347,    71,
+       52,   114,   290,   291,   292,   293,   294,   294,   349,   295,
+      296,   297,   298,   299,   215,   419,   199,   300,   301,   302,
+      303,   304,   305,   306,   307,   308,   309,   310,   310,   300,
+      301,   302,   310,   305,   303,   304,   305,   307,   306,   307,
+      308,   303,   310,   309,   301,   300,   310,   305,   308,   309,
+      302,   396,   309,   309,   218,   290,   216,   152,    72,    73,
+      217,   189,   142,   218,     5,   219,   227,     6,     7,    74,
+      220,    52,   154,   221,   374,    75,   369,   351,   348,    76,
+       47,   349,   291,   156,   278,   222,     8,    77,     9,    78,
+       79,    80,   132,   385,    22,   420,   350,    56,    72,    75,
+       78,    82,    93,   102,   105,   136,   138,   155,   166,   170,
+      173,   174,   177,   173,   155,   177,   138,    10,   301,   369,
+      404,   302,   223,   351,    52,   154,   359,   361,   363,   369,
+      352,   353,    57,    11,   389,    46,    11,   354,    12,   246,
+      261,    81,    19,    82,    71,    77,    81,    92,    96,    97,
+      101,   104,   106,   107,   114,   125,   126,   148,   169,   171,
+      172,   181,   186,   190,   192,   193,   194,   114,   194,   190,
+      101,   181,   192,   171,   193,   292,   310,    83,   293,    84,
+      131,    13,   196,    25,    27,     9,    11,    22,    23,    25,
+       27,    28,    34,    35,    37,    51,    58,    85,    86,    86,
+       73,    76,    81,    83,    87,    88,    89,    90,   103,   111,
+      115,   118,   119,   120,   121,   123,   124,   126,   129,   130,
+      137,   141,   143,   144,   146,   149,   156,   157,   158,   160,
+      169,   172,   187,   194,   251,   271,   274,   312,   157,    87,
+      194,     6,     3,    14,    49,    50,   207,   311,   344,   345,
+      348,   349,   350,   351,   353,   354,   356,   358,   367,   368,
+      370,   371,   372,   375,   377,   378,   379,   380,   382,   384,
+      385,   388,   390,   392,   394,   395,   396,   397,   399,   400,
+      401,     3,    14,    49,    50,   207,   311,   344,   345,   348,
+      349,   350,   351,   353,   354,   356,   358,   367,   368,   370,
+      371,   372,   375,   377,   378,   379,   380,   382,   384,   385,
+      388,   390,   392,   394,   395,   396,   397,   399,   400,   401,
+       14,    43,   404,   421,    87,    88,    91,   168,   175,   423,
+      175,   423,   271,   282,   355,   224,   281,   271,   405,   405,
+      431,   450,   271,   422,    89,   406,   406,    79,   225,    58,
+      407,   407,    15,    29,    34,    10,   175,   449,   356,   161,
+       59,    90,    91,    92,   400,    73,    76,    81,    83,    87,
+       88,    89,    90,   103,   111,   115,   118,   120,   121,   123,
+      124,   126,   130,   137,   141,   143,   144,   146,   149,   156,
+      157,   158,   160,   169,   171,   172,   186,   187,   194,   251,
+      271,   274,   312,   312,   115,    93,    94,    94,   305,   231,
+      256,   380,     0,   227,    16,   226,    95,    17,   303,   197,
+       96,    97,   356,   155,    98,    99,   227,   228,    18,   100,
+      176,    19,   229,   357,   198,   230,   177,   228,   117,   423,
+      423,   153,   190,     2,     4,    17,    18,    25,    26,    27,
+       40,    42,   403,   407,   412,   112,   428,   101,    83,    99,
+      108,   117,   119,   120,   121,   122,   123,   124,   126,   127,
+      129,   130,   152,   153,   164,   190,   315,    12,   210,   221,
+      226,   231,   232,   233,   256,   313,   347,   352,   355,   360,
+      362,   364,   366,   373,   374,   376,   381,   387,   389,   391,
+      397,    12,    49,   210,   221,   226,   231,   232,   233,   256,
+      313,   347,   352,   355,   360,   362,   364,   366,   373,   374,
+      376,   381,   387,   389,   391,   397,   424,    12,   357,   102,
+       20,   103,   433,   189,    36,     4,    71,    81,    83,    86,
+       99,   108,   117,   118,   119,   120,   121,   122,   123,   124,
+      126,   127,   129,   130,   137,   143,   144,   152,   153,   161,
+      164,   169,   172,   176,   190,   314,   315,   315,   391,    39,
+      316,   316,   317,   318,   319,   320,   321,   322,   323,   324,
+      325,   326,   327,   328,   316,   329,   330,   331,   332,   333,
+      334,   335,   336,   337,   338,   339,   340,   341,   342,   316,
+      316,   343,   343,   343,   343,     2,   304,   344,   345,   346,
+      347,   369,   348,   349,   350,   351,   352,   353,   354,   355,
+      356,   357,   358,   359,   360,   361,   362,   363,   364,   366,
+      365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
+      375,   376,   256,   377,   378,   379,   380,   381,   382,   383,
+      384,   385,   386,   387,   388,   389,   390,   391,   392,   355,
+      393,   366,   394,   395,   396,   397,   398,   399,   400,   366,
+      401,   294,   425,   299,   231,   294,   294,   426,   360,   104,
+      117,   105,   378,    21,    85,   429,   438,   451,   408,   427,
+       31,    22,   428,     7,   429,   232,   369,   369,   431,   450,
+      146,   276,   349,   354,     1,   358,   106,     0,     1,     5,
+        7,     8,    15,    16,    21,    32,    41,    45,    46,    48,
+       95,   296,   298,   316,   357,   359,   361,   363,   369,   316,
+      317,   318,   319,   320,   321,   322,   323,   324,   325,   326,
+      327,   328,   316,   329,   330,   331,   332,   333,   334,   335,
+      336,   337,   338,   339,   340,   341,   342,   316,   159,   107,
+      108,   347,    95,   159,   178,   188,   316,   109,   431,   450,
+      430,   110,   431,   111,   112,   359,    15,     8,   113,   164,
+      114,    23,   271,   115,   432,    52,   233,   360,   116,   235,
+      235,   234,   305,   187,   235,   235,   432,   236,    52,   402,
+      432,   353,     0,   296,   232,   233,   240,   246,   403,   404,
+      405,   406,   407,   408,   409,   410,   411,   412,   413,   117,
+      118,   119,   120,   121,   122,   123,   124,   118,   117,   238,
+      239,   253,   262,   125,   126,   277,   216,   357,   237,   361,
+      240,   232,   233,   240,   246,   357,   362,   382,   238,   127,
+      349,   279,   239,   363,   240,    24,   432,   210,   279,    25,
+       60,   128,   241,   364,   242,    26,   433,   243,   282,   244,
+      244,   209,   212,   213,   215,   260,   265,   266,   270,   129,
+      130,    42,   408,   245,    27,   366,    28,    29,   433,   434,
+      452,   434,   365,   118,   118,   246,   263,   270,   435,   131,
+      247,   263,   270,   248,   249,   250,   436,   366,   222,   132,
+       61,    30,   284,   381,   221,    38,   307,    41,    31,    49,
+      394,   133,   306,   367,   397,   368,    32,   369,   207,   307,
+      134,   129,   135,    33,    34,    35,   370,   251,   251,   136,
+      199,   403,   295,   371,   252,   409,   437,   253,    36,     9,
+      248,   249,   410,     5,   372,   137,   138,   254,    37,   119,
+      373,   139,   438,   436,   437,   140,    38,   141,    45,   411,
+      200,   412,   142,    39,   201,    73,    80,    81,    88,    89,
+       98,   101,   116,   125,   142,   156,   157,   158,   160,   416,
+      308,    62,   143,   144,   414,   414,   145,    73,    83,    88,
+       89,   116,   141,   142,   144,   146,   149,   160,   189,   146,
+      189,   142,   146,    99,   422,   435,   447,   439,   374,   147,
+       41,    40,   355,   375,   148,   236,   281,    41,   379,   149,
+      150,   130,   190,   151,    13,   376,    98,   101,    37,   355,
+      364,   365,   366,   374,   376,   381,   387,   391,   397,   398,
+      355,   364,   365,   366,   374,   376,   381,   387,   391,   397,
+      398,    73,    80,    81,    88,    89,    92,    96,    97,    98,
+      101,   104,   116,   125,   142,   156,   157,   158,   160,   163,
+      186,   193,   415,   416,   416,   255,   287,    42,    51,   152,
+      440,    98,   181,    43,   181,   244,   344,   443,   158,   153,
+      419,   421,   181,    44,   137,   256,    44,    30,   190,   441,
+      154,   442,   442,   155,   303,   156,   157,   158,   388,   450,
+      377,    45,   443,   257,   258,   181,   310,   159,   419,   421,
+      201,   419,   201,   419,   160,   255,   259,   260,   377,    46,
+      134,   192,   418,   419,   420,   421,   422,   423,   424,   433,
+      425,   426,   427,   428,   429,   430,   431,   432,   432,   433,
+      434,   435,   436,   437,   438,   439,   440,   441,   442,   443,
+      444,   445,   446,   447,   430,   448,   449,   450,   444,   451,
+      452,   453,   448,   454,   455,   448,   444,   243,   445,   232,
+      233,   202,   161,   126,   420,   448,    70,   162,   378,    96,
+       97,   104,   125,   128,   134,   145,   179,   189,   192,   193,
+      254,   417,   309,   133,   120,   254,   261,   163,   446,   243,
+      243,   379,   447,   399,   430,   262,   448,   165,   164,   173,
+      166,    47,   290,   295,   367,   380,   271,    96,    97,   104,
+      125,   128,   134,   145,   179,   189,   192,   193,   254,   417,
+      417,   167,   168,   263,   264,   265,   301,   266,   194,   287,
+      169,   449,   170,   171,   172,   413,   296,   381,   173,    63,
+      267,   274,   270,   352,   382,    59,   203,   211,   220,   224,
+      237,   242,   245,   247,   252,   257,   258,   259,   268,   273,
+      280,   283,   285,   286,   288,   346,   364,   365,   376,   383,
+      386,   393,   398,    28,   413,   234,   450,   268,    64,   383,
+      269,   444,   444,   418,    65,    66,   384,   189,   174,   175,
+      176,   177,    48,    48,   385,   386,   171,    24,    38,    39,
+       51,   267,   178,    16,   270,   348,   409,   271,    98,    21,
+      387,   272,   179,   388,   350,   368,   389,   430,    40,   300,
+       24,   297,   297,   419,    25,    14,   292,   371,   273,   225,
+      439,   444,   180,   298,   181,   182,   182,   183,   135,   139,
+      147,   184,   185,   299,   390,    27,   162,   207,   390,   186,
+      401,   310,   204,   226,   451,   274,   274,   230,   391,    17,
+      452,   275,   305,   276,   187,   277,   240,   121,   219,   278,
+      278,   188,   190,   189,     0,   392,   355,    32,   425,   279,
+      280,   453,   453,   190,   191,   165,    49,   205,   448,    67,
+       50,    50,   362,   214,   108,   427,   343,    26,   253,   366,
+      387,   281,   281,   393,   229,    52,    53,    80,    87,    98,
+       99,   117,   118,   119,   120,   121,   122,   123,   124,   128,
+      129,   130,   134,   143,   145,   153,   154,   156,   157,   158,
+      163,   179,   195,   432,   343,   150,   282,   439,   454,    53,
+       52,   163,    87,   117,   153,   432,   118,    99,    98,   134,
+      444,    68,   283,   343,   269,   275,   366,   394,   192,   424,
+      395,   395,    84,   122,   308,   396,   284,   234,   397,   123,
+      167,   191,   184,   285,   398,   206,   376,   454,   455,   455,
+      399,    43,     6,    10,    19,    29,    30,    31,    33,    36,
+       43,    44,    47,    48,    51,     3,    14,   138,   290,   292,
+      294,   295,   309,   367,   456,    20,     3,    14,   290,   292,
+      294,   295,   367,   456,   193,   238,   262,   124,    51,   194,
+      239,   253,   262,   195,   286,   302,   287,   448,   128,   195,
+      288,   101,   208,   289,    53,    96,   128,   154,   179,   195,
+      193,   400,    35,   366,    23,   343,   401,   373
+};
+
+static const uint16_t suffixes[14593] = {
+     4513, 15144, 15712,  6986, 14743, 14669, 14604, 14203, 14467, 15068,
+    14074, 12321,  7920, 14632, 14650,  7841, 11316,  7938, 11330,  8543,
+     7122, 15634, 15654, 14091,   425,  8451,    43,   135,  3512, 13705,
+    14432,  7616,  1099,  1657,  7216,  2831, 11599, 15236, 14255,  3571,
+    13783,  5725, 14912,  1519,  6722,  4515,  3859, 14556,  5823, 15213,
+     1681,  2211,  2245,  4030,  7305, 10187, 10390, 14965,  3678, 13929,
+    15146, 12405,  5042, 10614,  2526,  3079, 12039, 14922, 15539,  2015,
+     8200,  3972, 14768,  8116, 12559,  3281,  3309,  3337,  3770, 14167,
+    15241,   375,  8163,  7249, 15714,  1291, 13940,  6181, 14445, 14459,
+     1699,  7324, 10032,  8499, 13507,  1856,  7987,  6201, 14570,  6988,
+     6320,  7165,  6459, 11590,  2769, 11299,  7135,  3613, 13863, 15153,
+     3715, 14136,  7787, 12532,  7581,  7851,  7962,  9925,  9955, 11869,
+    12599, 14404, 14488, 15307, 15956, 15626, 15646, 14745,  3881, 14580,
+     1346, 14105,  1835,  7822,  3898, 14589, 14598,  5061, 10644, 14543,
+    14332,  3915, 14615,  1373, 14114,  5281, 11378, 14624, 12572,  9231,
+    10967, 12591,  9589, 14123, 14643,  6124, 11017, 14749,  5046, 10618,
+    15292, 14671, 13280, 13662,  2153,  9981, 14606, 13503,  7520,  7142,
+     9228, 10964,  3466, 13675, 15298, 13200, 13441,  5788, 15180,  3790,
+    14179,  2802, 11429,  5465, 13584, 14662,  4440, 14502, 10046,  2872,
+    11624, 14205,  7624,  7926,  8101,  8278,  1894,  8009,  3552, 13772,
+     1237, 11436,  3592, 13842, 10063, 15750,   378,  8166,  3348, 12419,
+     2114,  8460, 14479, 14473,  3469, 13678, 15257, 14513, 10066,  7148,
+    14469,  3932, 14683,  8341, 15070,   860, 14189, 14198,  2263, 10400,
+     3531, 13716,  6074,  7496,  3950, 14693,  1607,  6952,  2173,  9993,
+     3217, 12429, 12438,  4514, 15145, 15713,  6987, 14744, 14670, 14605,
+    14204, 14468, 15069,  8118, 14075, 12322,  7921, 14633, 14651,  7842,
+    11317,  7939, 11331,  8544,  7123, 15635, 15655, 14092,  7126,  7931,
+     7944,  8554, 11323, 11337, 12328, 14084, 14100, 14639, 14658, 15638,
+    15658,  7850,  8571, 10199,  8581, 10205,  8591, 10211,  8602, 10218,
+     8613, 10225,  8624, 10232,  8634, 10238,  8644, 10244,  8654, 10250,
+     8664, 10256,  8674, 10262,  8684, 10268,  8694, 10274,  8704, 10280,
+     8714, 10286,  8724, 10292,  8735, 10299,  8746, 10306,  8757, 10313,
+     8768, 10320,  8779, 10327,  8789, 10333,  8799, 10339,  8809, 10345,
+     8819, 10351,  8829, 10357,  8839, 10363,  8849, 10369,  3488, 13689,
+    10515, 12676, 10132,  8352, 15367,  5850, 15470,   844, 13728,  3491,
+    13692,  1588,  6932, 10888, 15407, 15690,  7628, 10071,  7925, 10065,
+     7930,  7943,   101,   116,  7047,  6261,  1000,   129,  6275,  4627,
+    15318, 15328,   148,  4637,  4649,  8935,  4660,  1013,  8952,  1031,
+    10709,  1048, 12747,  4672,  4683,  1064,  1082,  1113,  1141,  1174,
+     1200,  1224,  1251,  1277,  1308,  1332,  1359,  1386,  1412, 15340,
+     1438,  4695,  4709,   163,   177,  8967,  1452,  8984,  1469,  1486,
+     7345,  4724, 12760,  6020,  4736,  1499,  1513,  4749, 12051, 12068,
+     4762,   191,  4772,   205,   219,  1536,  4785,  4798,  1553,  8998,
+     9013,  1567,  9029,  6036,  3288,  4810,   233,  1582,   247,  1603,
+     1621,  1636, 12777,  9043,   263,  6294,  6313,  4823,  9061,  9077,
+     9094,  1092,  1650,   282,  9110,   299,  4835,  1671,  1693,  6053,
+     6335,  1714,  6069,  1729,   312,  4279,  1123,  1745,  1763,  1779,
+     3316,  7361, 15351,   330, 10729, 12798,  1794,  1810,  9126,  4849,
+     4860,  4876, 10743,  4891, 12814,  1828, 10760,  4906,  1151, 10773,
+      343,  7694,  9142,  1850,  1184,  1872,  1888,  1907,  1925,  1941,
+     1956,  6354,  4919,   358,  4930,  1972,   371,  6371,  4296,  1993,
+     2008,  7059,  2029,  2044,  4944,  4955,   392,  2060,   408,  4965,
+     9160,  4313,  4976,  7076, 15362, 12828,  7712,  7376, 15378,  2077,
+    12843,  2094,   422,  2111, 12857,  2131,  6388,  6089, 12875,  4990,
+     6105, 12891,  2148,  2168,  2187,   438, 12904,   454, 12921, 12939,
+     5005, 12083,  9174,  2205,  8559,  8567,  8577,  8587,  8598,  8609,
+     8620,  8630,  8640,  8650,  8660,  8670,  8680,  8690,  8700,  8710,
+     8720,  8731,  8742,  8753,  8764,  8775,  8785,  8795,  8805,  8815,
+     8825,  8835,  8845,  8855,  2223,  2239,  2257,  8864,  2276, 12955,
+     2292, 12975,  2311,  2329,  9191,  2347,  2362,   470,  5015,  2378,
+    15389,  5027,  9207,  2393,  5039,  6404,  5056, 12988,  5071, 15399,
+     2412,  2441,  2462,  2486,  2513,  2539,  2561,  2587,  2420,  2611,
+     2632,  2647,  5081,  9223,  5094,  9242,  5108,  2663,  6120,  5121,
+     9258,  5135,   484, 13005,   504,  1210,  2679,  2693,  5150,  9272,
+     5161,   516, 13022,  5176,  5189,  5202,  5217,  2708,  2736, 10787,
+     5231,   531,  9291,   547,   561, 13037,  9303,  2449,  2764,  5245,
+    13056,  2780,  5258,  5275,  5293,  5306, 13071,  9316,  2799,  1234,
+      577,  6421,   590,  2814,  6435,  9328,  9342,   608,  9359,  4558,
+     6454,  2827,  2717,  2847,  2866,   620,   634,   652,  9373,  5318,
+     5329,  2888,  4339,  6139,  9391,  5340, 10804, 13089,  5353,   666,
+    10816,  9405,  2903,  2919,  5367,   680,  2470,  9418,  2934, 13104,
+     2950,   694,  2969, 10832,  4360, 10849,  2987,   708,  4378,  6474,
+     1261,  3004,  3020,  3038,  3053,  3072, 15417, 13122,  9435,  3092,
+      723,  9448,  3109,   740,  3125,  3143,  2745,  3162,  3179,  9462,
+     7391, 15429,  5379,   756,  3198, 13137,   771,  3344,  3213,  7407,
+      787,  5391,  9476,  3230, 13151,  3246, 13164,  3259,  6494,  3275,
+     3303,  3331,   801, 13180,  5404,  5422,  6510,  3362,  3375,  5439,
+     5449,  9491,   819,  7427, 15441, 13195, 13213,  4397,  3391,  3406,
+     3426,  9503,  6524,  2494,  5459,  3445, 13227,  9516, 13244, 13260,
+     5475, 13275,  3461,  3483,  3506,  3525,   838,  9533,  3545,  3565,
+     5490,  5505,  5516,  6540,  5530,  3586,  5545,  3606, 13296,  3627,
+     3642,  3657, 10864,  6156,  9547,  3674,  1287,  5558,  9559,  3693,
+     4415,  5570, 13314,  5582,  1318,  9571,  5596, 13329, 15452,  1342,
+     1369,  9585,  3709,  3730,  3747,  3764,  3786,   856,  9603,  9619,
+     7442,  3804,  5611,  5622,  3825,  9634,  5636,  3842,  9652,  9666,
+     6561,  6175,  4434,  5651,  3856,  6198,  3878,  3895,  3912,  3929,
+     3947,  6217,  9679,  3966,  6577,  4456, 13343,  5670,  9696, 13358,
+     5682,  6594,  5696,  3988,  5709,  5721,  2521,  5735,  5747,  4008,
+     4022,  4042,   872,  9711,  9725,  5760,  5771, 13373,  4058,  4074,
+      888,  4473, 13391,  1396,   903,  8878,  5782,  5801,  5818,  9741,
+     8886,  5834,  1422,  5846,  8900,  9758,  9774,  4090,  9787,  2547,
+     6613,  9802,  5860,  9816,  2569,  4108,  5875,  9831,  4490, 13404,
+    13417,  9848,  6632,  7088,  4123,  2595,   916,  4142,  4159,  5892,
+     6647,  5905, 13432,  5917,  4175,  5936,  7462,  9862,  9876,  8908,
+     9894,  8572,  8593,  8705,  8726,  8859, 10200, 10213, 10281, 10294,
+    10375,  8582,  8604,  8715,  8737, 10206, 10220, 10287, 10301,  8592,
+     8725, 10212, 10293,  8603,  8736, 10219, 10300,  8614,  8747, 10226,
+    10307,  8758, 10314,  8769, 10321,  8615,  8625,  8748,  8780, 10227,
+    10233, 10308, 10328,  8635,  8759,  8790, 10239, 10315, 10334,  8645,
+     8770,  8800, 10245, 10322, 10340,  8655,  8810, 10251, 10346,  8522,
+     8665,  8820, 10257, 10352,  8048,  8675,  8830, 10263, 10358, 12302,
+     8685,  8840, 10269, 10364, 13761,  8695,  8850, 10275, 10370,    12,
+       48,   121,   140,   169,   183,   291,   322,   335,   414,   508,
+      523,   569,   626,   658,   748,   779,   951,   959,   976,  1039,
+     1055,  1073,  1132,  1165,  1191,  1242,  1268,  1323,  1429,  1443,
+     1490,  1504,  1612,  1627,  1754,  1819,  1879,  1898,  1947,  2068,
+     2139,  2196,  2283,  2320,  2353,  2384,  2670,  2818,  2910,  3011,
+     3044,  3063,  3266,  3382,  3397,  3648,  3847,  3920,  3999,  4049,
+     4081,  4227,  4234,  4243,  4267,  4422,  4461,  4504,  4522,  4527,
+     4550,  4580,  4588,  4596,  4602,  4843,  4854,  4924,  4949,  4999,
+     5009,  5115,  5129,  5170,  5239,  5252,  5373,  5398,  5539,  5854,
+     5950,  5957,  6001,  6043,  6146,  6188,  6207,  6250,  6343,  6393,
+     6602,  6621,  6657,  6665,  6715,  6896,  6957,  6964,  6978,  6999,
+     7008,  7032,  7068,  7231,  7240,  7285,  7294,  7337,  7483,  7533,
+     7558,  7643,  7681,  7730,  7745,  7867,  7890,  8002,  8013,  8039,
+     8056,  8063,  8130,  8223,  8244,  8267,  8293,  8359,  8487,  8505,
+     8513,  8533,  8921,  8927,  8959,  9053,  9351,  9410,  9483,  9525,
+     9551,  9577,  9671,  9808,  9942, 10008, 10038, 10055, 10112, 10125,
+    10156, 10170, 10439, 10481, 10507, 10528, 10563, 10701, 10879, 10917,
+    11004, 11012, 11037, 11092, 11133, 11141, 11213, 11232, 11262, 11309,
+    11441, 11459, 11487, 11504, 11523, 11549, 11559, 11638, 11656, 11715,
+    11774, 11794, 11802, 11816, 11915, 11987, 12004, 12024, 12110, 12154,
+    12178, 12187, 12344, 12378, 12414, 12475, 12483, 12497, 12546, 12565,
+    12581, 12631, 12698, 12751, 13186, 13305, 13334, 13364, 13484, 13513,
+    13624, 13835, 13878, 13892, 13924, 13971, 13992, 13999, 14006, 14044,
+    14051, 14067, 14261, 14295, 14364, 14380, 14389, 14395, 14419, 14438,
+    14452, 14548, 14576, 14620, 14800, 14806, 14855, 14862, 14880, 14900,
+    14976, 15032, 15058, 15117, 15173, 15324, 15347, 15374, 15457, 15465,
+    15474, 15553, 15568, 15575, 15720, 15756, 15810, 15837, 15916,  4512,
+     6985, 14466, 14073, 11315, 11329, 14090,  3570, 13782,  1518,  6721,
+     7248,  3714, 14135, 12598, 14331,  5280, 11377, 13502,  2801, 11428,
+     1893,  8008,  1236, 11435,  1606,  6951, 12327, 10514, 10887, 15406,
+      100,   115,  6260,   999,   128,  6274,  4626,   147,  4636,  4648,
+     4659,  1012,  1030,  1047,  4671,  4682,  1063,  1081,  1112,  1140,
+     1173,  1199,  1223,  1250,  1276,  1307,  1331,  1358,  1385,  1411,
+     1437,  4694,  4708,   162,   176,  1451,  1468,  1485,  7344,  4723,
+     4735,  1498,  1512,  4748,  4761,   190,  4771,   204,   218,  1535,
+     4784,  4797,  1552,  1566,  3287,  4809,   232,  1581,   246,  1602,
+     1620,  1635,   262,  6293,  6312,  4822,  1091,  1649,   281,   298,
+     4834,  1670,  1692,  6334,  1713,  1728,   311,  4278,  1122,  1744,
+     1762,  1778,  3315,  7360,   329,  1793,  1809,  4848,  4859,  4875,
+     4890,  1827,  4905,  1150,   342,  1849,  1183,  1871,  1887,  1906,
+     1924,  1940,  1955,  6353,  4918,   357,  4929,  1971,   370,  6370,
+     4295,  1992,  2007,  2028,  2043,  4943,  4954,   391,  2059,   407,
+     4964,  4312,  4975,  7375,  2076,  2093,   421,  2110,  2130,  6387,
+     4989,  2147,  2167,  2186,   437,   453,  5004,  2204,  2222,  2238,
+     2256,  2275,  2291,  2310,  2328,  2346,  2361,   469,  5014,  2377,
+     5026,  2392,  5038,  6403,  5055,  5070,  2411,  2440,  2461,  2485,
+     2512,  2538,  2560,  2586,  2419,  2610,  2631,  2646,  5080,  5093,
+     5107,  2662,  5120,  5134,   483,   503,  1209,  2678,  2692,  5149,
+     5160,   515,  5175,  5188,  5201,  5216,  2707,  2735,  5230,   530,
+      546,   560,  2448,  2763,  5244,  2779,  5257,  5274,  5292,  5305,
+     2798,  1233,   576,  6420,   589,  2813,  6434,   607,  6453,  2826,
+     2846,  2865,   619,   633,   651,  5317,  5328,  2887,  4338,  5339,
+     5352,   665,  2902,  2918,  5366,   679,  2469,  2933,  2949,   693,
+     2968,  4359,  2986,   707,  4377,  6473,  1260,  3003,  3019,  3037,
+     3052,  3071,  3091,   722,  3108,   739,  3124,  3142,  3161,  3178,
+     7390,  5378,   755,  3197,   770,  3343,  3212,  7406,   786,  5390,
+     3229,  3245,  3258,  6493,  3274,  3302,  3330,   800,  5403,  5421,
+     6509,  3361,  3374,  5438,  5448,   818,  7426,  4396,  3390,  3405,
+     3425,  6523,  2493,  5458,  3444,  5474,  3460,  3482,  3505,  3524,
+      837,  3544,  3564,  5489,  5504,  5515,  6539,  5529,  3585,  5544,
+     3605,  3626,  3641,  3656,  3673,  1286,  5557,  3692,  4414,  5569,
+     5581,  1317,  5595,  1341,  1368,  3708,  3729,  3746,  3763,  3785,
+      855,  7441,  3803,  5610,  5621,  3824,  5635,  3841,  6560,  4433,
+     5650,  3855,  3877,  3894,  3911,  3928,  3946,  3965,  6576,  4455,
+     5669,  5681,  6593,  5695,  3987,  5708,  5720,  2520,  5734,  5746,
+     4007,  4021,  4041,   871,  5759,  5770,  4057,  4073,   887,  4472,
+     1395,   902,  5781,  5800,  5817,  5833,  1421,  5845,  4089,  2546,
+     6612,  5859,  2568,  4107,  5874,  4489,  6631,  4122,  2594,   915,
+     4141,  4158,  5891,  6646,  5904,  5916,  4174,  5935,  7461,   426,
+     8452,   382,  8170,  5804, 15199, 14626,  5808, 15203,  2229, 10382,
+    15239,    46,   138,  1945,  8061,    44,   136,  4618,  4715,   711,
+    11953,  4608,  4700,  3718, 14139, 14258,     0,   102,   316,  7527,
+     1590,  6934,   670, 11756, 10083,   456, 10089,  5152, 11108, 15933,
+     2601, 15782,  1960,  5320,  8068, 11670,  1733,  7506,  5331, 11676,
+     4921,  8127,     8,   117,    14,  2208, 10184, 12574,  2890, 11682,
+     5180, 11153,  7429, 12733, 15443, 12741, 12754, 12771, 12792, 12808,
+    12822, 12837, 12851, 12869, 12885, 12898, 12915, 12933, 12949, 12969,
+    12982, 12999, 13016, 13031, 13050, 13065, 13083, 13098, 13116, 13131,
+    13145, 13158, 13174, 13189, 13207, 13221, 13238, 13254, 13269, 13290,
+    13308, 13323, 13337, 13352, 13367, 13385, 13398, 13411, 13426,  9452,
+    12159,  4341, 11689,    19,  3513,  7048, 13706,    24,    29,  6262,
+     4620,  4717,  4742,  6700,  7647,  9282,  9839, 11122, 15679, 15066,
+     1833,  7820,  2137,  2281,  7335,  8485, 10437,  7342,  7358,  7373,
+     7388,  7404,  7424,  7439,  7459, 11699,    33,  1001, 10447, 12958,
+     5344, 11727,  1160,  7885,    38,   130,    50,  6866,  9019,  6141,
+    11710,    55,  6276,  2295, 10459,    64,  4628,  6783,  5562, 13953,
+      727, 12141,  5878, 15662,  2119,  8396,  8465,  1541,  6807,   824,
+    12724,  9393, 11718,    69,  9776, 15501,  4206,  4663, 11343, 13061,
+       73, 10975,  6091,  9903,    78,    83, 14433,    95,   110,   123,
+      142,   157,   171,   185,   199,   213,   227,   241,   257,   276,
+      293,   306,   324,   337,   352,   365,   386,   402,   416,   432,
+      448,   464,   478,   498,   510,   525,   541,   555,   571,   584,
+      602,   614,   628,   646,   660,   674,   688,   702,   717,   734,
+      750,   765,   781,   795,   813,   832,   850,   866,   882,   897,
+      910,  7617, 10076, 12908,  3380, 12696,  5342, 11725,   822, 12722,
+    11701,  1020,  4217,  7977,  9149,  4738,  6696,  1799,  3753,  7669,
+    13202, 13443, 14158, 15074, 13197, 13438,   579,  7652, 10102, 10732,
+    11444, 12927,  9864, 15905,  2907, 11799, 12472,  1067,  4544, 13518,
+     9536, 13745,  4994,  9937,  3293,  6902,  6704, 15752,   926, 10806,
+    11733,  1501,  6712,  1515,  6718, 13345, 14809,  4751,  6733,   931,
+     1816,  7678,  4969,  5629,  8298, 14314,  1427, 15463,  2667, 11009,
+    15148,    59,  6280,  5572, 14018, 10568, 15393,  6682, 14930,  3472,
+     4754,  6736,  7397, 12272, 13681, 14522, 15435,  7119,  1070,  4547,
+    15192,  7014, 12782,  3588, 13838, 13316, 14025,  5672, 14816,  1912,
+     8019,  1100,  1658,  7217, 13232, 13602,   301,  7273,   758, 12331,
+     5310, 11397, 10531,   427,  8453, 14823, 11403, 13074,  6741, 12053,
+     6751, 12070,  9607, 14218, 14830, 12362, 11738, 13091,    35,  1003,
+     5483, 13655,   656,  4947,  8242, 11654,  9910, 12877,   360,  8133,
+     5110, 10999,  5355, 11745,  3058, 12019,   805, 12618,   936, 13406,
+    15695,  5584, 14032,  5967,  8972, 11188, 14377, 13448,   195,  6766,
+    12561,  3283,  3311,  3339,   347,  7910,   941,  4764,  6759,  4161,
+    15813,  5894, 15821,  3169,  5452,  7367,  7606,  7704,  7955,  8894,
+    10147, 10454, 12089, 12238, 12387, 12712, 12965, 13740, 14281, 15272,
+    15357,  7614,  8497,  1854,  7985,   412,   521,  2318,  8291, 10479,
+    11139,  5278, 11375,   380,  8168,   668, 11754, 12441, 10098, 12923,
+      946, 15319, 13215, 13457, 11761, 11768,   953, 14737, 10449, 12960,
+     4837,  7279, 10818, 11777, 12407, 11405, 13076,  3350,  5141, 11051,
+    12421,  2783, 11348, 13463,   961, 15329,  2192, 10004,   970,   149,
+      978,   551, 11251, 11786,  6247, 14416,  6257,  6271,  6290,  6309,
+     6331,  6350,  6367,  6384,  6400,  6417,  6431,  6450,  6470,  6490,
+     6506,  6520,  6536,  6557,  6573,  6590,  6609,  6628,  6643,  2364,
+    10537,  5587, 14035,  9274, 11114,  9918, 11866,  1293, 13942,  9698,
+    14841, 13419, 15700, 15707,   986,  4638,  4399, 13473,  3996, 14897,
+     4866,  7752,  1320,  9407, 11791, 14041,  9179, 10176, 15160,  2650,
+    10928,  2116,  8462, 10994,   383,  4201,  7662,  8171,  8943, 10470,
+    12804, 12978, 15592,  3395, 13482,  2599, 15780,  4992,  9935,  2665,
+    11007,   193,  6764,  9573, 14047,  1127,  1749,  7553,  3430, 13527,
+     5598, 14054,  6706,  4932,  8139, 10108, 15912, 10115, 12941, 12279,
+     7288,  1673,  7297,  5163, 11126, 14731,   775, 12374,   993,  1006,
+     1024,  1041,  1057,  1075,  1106,  1134,  1167,  1193,  1217,  1244,
+     1270,  1301,  1325,  1352,  1379,  1405,  1431,  1445,  1462,  1479,
+     1492,  1506,  1529,  1546,  1560,  1575,  1596,  1614,  1629,  1643,
+     1664,  1686,  1707,  1722,  1738,  1756,  1772,  1787,  1803,  1821,
+     1843,  1865,  1881,  1900,  1918,  1934,  1949,  1965,  1986,  2001,
+     2022,  2037,  2053,  2070,  2087,  2104,  2124,  2141,  2161,  2180,
+     2198,  2216,  2232,  2250,  2269,  2285,  2304,  2322,  2340,  2355,
+     2371,  2386,  2405,  2434,  2455,  2479,  2506,  2532,  2554,  2580,
+     2604,  2625,  2640,  2656,  2672,  2686,  2701,  2729,  2757,  2773,
+     2792,  2807,  2820,  2840,  2859,  2881,  2896,  2912,  2927,  2943,
+     2962,  2980,  2997,  3013,  3031,  3046,  3065,  3085,  3102,  3118,
+     3136,  3155,  3172,  3191,  3206,  3223,  3239,  3252,  3268,  3296,
+     3324,  3355,  3368,  3384,  3399,  3419,  3438,  3454,  3476,  3499,
+     3518,  3538,  3558,  3579,  3599,  3620,  3635,  3650,  3667,  3686,
+     3702,  3723,  3740,  3757,  3779,  3797,  3818,  3835,  3849,  3871,
+     3888,  3905,  3922,  3940,  3959,  3981,  4001,  4015,  4035,  4051,
+     4067,  4083,  4101,  4116,  4135,  4152,  4168, 14076,  7311,   790,
+    12462, 12339,  4188,  4650,  9425, 11839, 13331, 14064, 15454, 14070,
+    14087,  2973, 11899,   518, 11136,  1695,  7320,  4194,  8936,     5,
+       92,   107,   967,  1349,  1402,  1476,  1784,  2994,  4191,  4653,
+     4869,  5346,  5714,  5942,  5970,  5995,  6442,  6685,  6909,  7453,
+     7572,  7755,  8975,  9233,  9793, 10936, 10969, 11027, 11082, 11193,
+    11424, 11531, 11729, 11948, 12098, 12702, 13319, 13453, 14028, 14108,
+    14242, 14517, 14723, 14826, 14837, 14906, 15102, 15136, 15335, 15424,
+    15488, 15529, 15891,  5821, 15211, 15537,  7579,  1344, 14103,  1371,
+    14112,  9587, 14121,  6122, 11015, 14747,  7518,  7140,  7622,  8276,
+     7146, 14082, 10707, 10727, 10741, 10758, 10771, 10785, 10802, 10814,
+    10830, 10847, 10862,  2351,  2382,  4047,  7006,  8357,  9349, 10036,
+    10168, 10526, 10561, 10877, 11557, 14974, 15372, 12596, 10885, 15404,
+     2417,  2446,  2467,  2491,  2518,  2544,  2566,  2592,  7333,  7340,
+     7356,  7371,  7386,  7402,  7422,  7437,  7457,  4204,  4661,  2905,
+    11797,  5481, 13653, 10452, 12963,  3393, 13480,  4248, 10713,  2425,
+     2616, 10900,  4250, 10715,  6055,  7470,  2921, 11805,  5521, 13811,
+     5805, 15200,  4981,  8327,  6337,  7477,  5098,  9246, 10986,  1585,
+     6929,   319,  7530, 10012,  1014,  4211,  3681, 13932,  4092, 15507,
+     6649, 15829,  1716,  7486,  5603,  6238,  6548,  7417,  7722,  7791,
+     8377,  9973, 10419, 10689, 10948, 12443, 12456, 12536, 12766, 13637,
+    13823, 14059, 14785, 14933,  9922, 15953,  2260, 10397,  8551,   623,
+    11635, 14003, 15170,  5790, 15182,  1702,  7327,  1521,  6724,  4221,
+     8953,  7585,  7855,  7966,  9929,  9959, 11873, 12397, 12603, 14408,
+    14492, 15311, 15960, 15630, 15650,  5208,  5222, 11171, 11180, 14481,
+     5234, 11227,   713,  5867,  6300,  7111,  9715, 11955, 14990, 15583,
+     5497,  5793, 13797, 15185,  2832, 11600,  5625, 14310,  4774,  6771,
+     6779,  3408, 13487,  4229,  5907, 15840,  5547, 13850,   207,  6790,
+     1032,  4236,   956,  6599, 11546, 11912, 13968, 14852, 14877,  5369,
+    11812,    87,   221,  6797, 14545,  3608, 13858,  6220, 14704, 12316,
+     1974,  8148,   488, 11059, 11464,  6743, 12055,  9745, 15223,  3711,
+    14132,  4245, 10710,  4258,  4269,  4286,  4303,  4329,  4350,  4368,
+     4387,  4405,  4424,  4446,  4463,  4480,  3732, 14145,  3749, 14154,
+     6006,  7349,  6015,  6031,  6048,  6064,  6084,  6100,  6115,  6134,
+     6151,  6170,  6193,  6212,  1049,  4498,  4506,  3766, 14163, 11144,
+    13024,   250,  6942, 15517, 10162, 14849,  1962,  5322,  8070,  8079,
+    11672,  3788, 14177,   858, 14187, 14196,  9912, 12879, 11450, 13434,
+    15847, 10100, 12925, 11025, 13264, 13644,  6071,  7493,  7204,  9098,
+     4524, 12748,  2427,  2618, 10902,  5641, 14354,  9878, 15919, 13380,
+    15040, 13499,  5125, 11033,   682, 11819, 10941,  4529,  4673,  4535,
+     4684,  2334, 10487,   362,  5195,  5360,  5509,  5811,  8135,  9182,
+    10179, 11163, 11706, 11750, 13804, 15206, 12319,   373,  8161,   167,
+     5948,  9575, 14049, 15754, 15237, 14256,  1731,  7504,  5178, 11151,
+    12470,  1065,  4542, 13516,  9605, 14216,  3428, 13525,   472, 10545,
+     9621, 14225, 13360, 14858,  1538,  6804,  5017, 10552,  1858,  7989,
+     4517,  4565, 11579,  1129,  1751,  7555,  4552,  4261,  4272,  4289,
+     4306,  4332,  4353,  4371,  4390,  4408,  4427,  4449,  4466,  4483,
+    14740,   474, 10547,  3735, 14148,  3572, 13784,  2472, 11826,  7195,
+     9082,  1838,  7825,  4572,  1083,  1114,  1142,  1175,  1201,  1225,
+     1252,  1278,  1309,  1333,  1360,  1387,  1413,  7237, 12593,  7512,
+     3432, 13529,  4345, 11693,  9420, 11834,  2936, 11844,  9591, 14125,
+     3697, 13981,  9505, 13536,  4252, 10717,  4582, 15341,  8211,  5600,
+    14056, 10891, 15410,  1977,  8151,  4590,  4787,  6813,  6107,  9945,
+     9951, 13298, 13871, 11852, 13106,  9850, 15723, 11862,  5266, 11364,
+     6408, 10627,  5112, 11001, 14627,  3861, 14558, 14645,  2952, 11879,
+      534, 11236,  1439,  4598,  6834,  6373,  8175,  6057,  7472, 10681,
+     1526,  1735,  3576,  3937,  6708,  6729,  7508,  7775, 10637, 10751,
+    11858, 13112, 13788, 14688,  7785,   567, 11260,   314,  7525, 11703,
+     4934,  8141,   696, 11890,  4281,  7536,  4604,  4696,  5191, 11159,
+      641, 11646,  5684, 14865,  4613,  4710,  4623,  4633,  4645,  4656,
+     4668,  4679,  4691,  4705,  4720,  4732,  4745,  4758,  4768,  4781,
+     4794,  4806,  4819,  4831,  4845,  4856,  4872,  4887,  4902,  4915,
+     4926,  4940,  4951,  4961,  4972,  4986,  5001,  5011,  5023,  5035,
+     5052,  5067,  5077,  5090,  5104,  5117,  5131,  5146,  5157,  5172,
+     5185,  5198,  5213,  5227,  5241,  5254,  5271,  5289,  5302,  5314,
+     5325,  5336,  5349,  5363,  5375,  5387,  5400,  5418,  5435,  5445,
+     5455,  5471,  5486,  5501,  5512,  5526,  5541,  5554,  5566,  5578,
+     5592,  5607,  5618,  5632,  5647,  5666,  5678,  5692,  5705,  5717,
+     5731,  5743,  5756,  5767,  5778,  5797,  5814,  5830,  5842,  5856,
+     5871,  5888,  5901,  5913,  5932,   948, 15321,  7444, 14233,  6596,
+    14874,   164,  5945,   178,  5952,  5261, 11359,  7251,  9729, 14997,
+     5357, 11747,  3200, 12347,  5959,  6849,  7078,  7542,  8333,  9003,
+    14246, 15730,  8338,  8349, 15364,  8362, 12830,  7714,  8369,  7378,
+     8382, 15380,  5963,  8968,  1453,  5973,  6753, 12072,  3188,  4165,
+     4610,  4702,  5384,  7547,  8390, 12249, 12311, 12679, 15735, 15817,
+     5250, 11307,  1125,  1747,  7551,  2971, 11897, 13378, 15038,  5507,
+     5809, 13802, 15204,  7447, 14236,  8425, 12846,  2314, 10475,  5921,
+    15857, 15246, 15260,  7659, 12801,  5982,  8985,  5204, 11167, 11269,
+    11280, 13045,  8036,  9789, 15525, 15533,  1470,  5989,  8538,  7025,
+     9046,  1487,  5167,  5998, 11130,  3060, 12021,  2991, 11945,  6003,
+     7346,  6012,  6028,  6045,  6061,  6081,  6097,  6112,  6131,  6148,
+     6167,  6190,  6209,  5219, 11177,  5825, 15215,  8492,  9623, 14227,
+    15520, 11455,   989,  4641,  4725,  6226,   238,  2698,  3203,  4532,
+     4676,  4729,  5333,  6230,  6924,  7738,  9133, 10520, 11104, 11678,
+    12350, 13217, 13459, 15013,  3489, 13690,  6233, 12761, 14251,  4790,
+     6816,  3792, 14181, 11907, 10834, 11918, 12354, 13139,  2923, 11807,
+     6242,  6252,  6266,  6285,  6304,  6326,  6345,  6362,  6379,  6395,
+     6412,  6426,  6445,  6465,  6485,  6501,  6515,  6531,  6552,  6568,
+     6585,  6604,  6623,  6638,  6659,  7030,  9051, 12360,  2380, 10559,
+     1162,  7887,  6162, 13916,   269,  7099,  4298,  8182,  5726, 14913,
+     1982,  8156,  9853, 15726, 13362, 14860, 10566, 15391,  6667, 11763,
+     1995,  4362,  8188, 11928,  2010,  8195,  6672,  2368, 10541,  1683,
+     2213,  2247,  2551,  4032,  5523,  7307, 10189, 10392, 12116, 12612,
+    13127, 13521, 13813, 14967, 15280, 15558,  5123, 11031,  2332, 10485,
+     6126, 11019, 14751,  1765,  7561,  1781,  7569,  7576,  2175,  9995,
+    10851, 11935, 11770,  2804, 11431,  5007, 10123, 11186,  2989, 11943,
+     6677,  7036,  7043,  7055,  7072,  7084,  8547,  6021,  6688,   266,
+     7096,  8076,  2230,  9868, 10128, 10383, 15775, 15909, 15240, 10131,
+       47,   139,   507,  1190,  1442,  1878,  1946,  4601,  8001,  8055,
+     8062, 11091,  5807, 15202,    45,   137,   710, 11952, 15932,  4619,
+     4716,  1540,  6806,  4737,  6695, 15073,  6703,  1500,  6711,  1514,
+     6717,  4750,  6732,  4968,  8297,  6681,  6740, 12052,  6750, 12069,
+     4763,  6758,  4865,  7751,   192,  6763,  1520,  6723,   712,  6299,
+     7110, 11954,  4773,  6770,  6778,   206,  6789,   955,   220,  6796,
+    11463,  1537,  6803,  4516, 14739,  4786,  6812,  6407, 10626,  3860,
+    14557,   640, 11645,  4609,  4701, 11268,  5824, 15214,  1682,  2212,
+     2246,  4031,  7306, 10188, 10391, 14966,  7515,  6820,  4539,  4688,
+     4983,  8329,  7516,  4799,  6824, 15482,  3719, 14140,  6831,  1554,
+     6839,  6845,  8999,  6853,  6861,  9014,  1568,  6870,  6877, 11483,
+     6883,  9030,  6037,  6890,  6339,  7479,  3289,  6898,  6905,   762,
+    12335,  7865, 10110, 12342, 14259, 14293, 15914,     1,   103, 10117,
+    12943,  5698, 14883,  5019, 10554, 12281,  5429, 12652,  4811,  6912,
+      234,  6920, 10516,  1583,  6927,   317,  7528,   248,  6940,  8106,
+     8283,  8303,  9163,  9346, 11554,  1591,  6935,   671,  3435,  4912,
+     7874, 11757, 13532,  1604,  6949,  7290,  1622,  6959,  1637,  6966,
+     6972,  9332, 10084, 11537,   457, 10090,  6980,  7001,  7010, 12778,
+     1860,  7991,  9379, 11663,  6478, 11974,   396,  8254,  9177, 10174,
+     3679, 13930,  7023,  9044,  7034,  7041,  7053,  7070,  7082,   264,
+     7094,   593, 11491,  1675,  7299,  6295,  7106,  7115,  7128,  6314,
+     7159,  5030, 10578,  4824,  7171,  7178,  9062,  7187,  5740, 14941,
+     7191,  9078,  4519,  7201,  9095,  1093,  1651,  7210,   283,  7223,
+      876, 14981,  5100,  5153,  9248, 10988, 11109,  7233,   637, 11642,
+      288,  7228,   493,  2501,  5927, 11064, 13562, 15863,  7242, 12323,
+     7255,  8475, 12863,  7263,  9111, 15934, 13286, 13668, 11502,  4567,
+    11581,  3811, 14269,  2602,  6010,  7353,  7434,  8109,  8286,  8903,
+    12738, 13752, 13959, 15448, 15478, 15783,  1587,  6931, 12746, 12759,
+     6019,  6035, 12776,  6052,  6068, 12797, 12813, 12827, 12842, 12856,
+     6088, 12874,  6104, 12890, 12903, 12920, 12938,  8558,  8566,  8576,
+     8586,  8597,  8608,  8619,  8629,  8639,  8649,  8659,  8669,  8679,
+     8689,  8699,  8709,  8719,  8730,  8741,  8752,  8763,  8774,  8784,
+     8794,  8804,  8814,  8824,  8834,  8844,  8854,  8863, 12954, 12974,
+    12987,  6119, 13004, 13021, 13036, 13055, 13070,  4557,  6138, 13088,
+    13103, 13121, 13136, 13150, 13163, 13179, 13194, 13212, 13226, 13243,
+    13259, 13274, 13295,  6155, 13313, 13328,  6174,  6197,  6216, 13342,
+    13357, 13372, 13390,  8877,  8885,  8899, 13403, 13416, 13431,  8907,
+      321,  1131,  1753,  1897,  2067,  2669,  4266,  4923,  7532,  7557,
+     8012,  8129,  8266,  9524, 11011, 13623, 14437,    99,   114,   998,
+      127,   146,  1011,  1029,  1046,  1062,  1080,  1111,  1139,  1172,
+     1198,  1222,  1249,  1275,  1306,  1330,  1357,  1384,  1410,  1436,
+      161,   175,  1450,  1467,  1484,  1497,  1511,   189,   203,   217,
+     1534,  1551,  1565,   231,  1580,   245,  1601,  1619,  1634,   261,
+     1648,   280,   297,  1669,  1691,  1712,  1727,   310,  4277,  1743,
+     1761,  1777,   328,  1792,  1808,  1826,   341,  1848,  1870,  1886,
+     1905,  1923,  1939,  1954,   356,  1970,   369,  4294,  1991,  2006,
+     2027,  2042,   390,  2058,   406,  4311,  2075,  2092,   420,  2109,
+     2129,  2146,  2166,  2185,   436,   452,  2203,  2221,  2237,  2255,
+     2274,  2290,  2309,  2327,  2345,  2360,   468,  2376,  2391,  2410,
+     2439,  2460,  2484,  2511,  2537,  2559,  2585,  2609,  2630,  2645,
+     2661,   482,   502,  2677,  2691,   514,  2706,  2734,   529,   545,
+      559,  2762,  2778,  2797,   575,   588,  2812,   606,  2825,  2845,
+     2864,   618,   632,   650,  2886,  4337,   664,  2901,  2917,   678,
+     2932,  2948,   692,  2967,  4358,  2985,   706,  4376,  3002,  3018,
+     3036,  3051,  3070,  3090,   721,  3107,   738,  3123,  3141,  3160,
+     3177,   754,  3196,   769,  3211,   785,  3228,  3244,  3257,  3273,
+     3301,  3329,   799,  3360,  3373,   817,  4395,  3389,  3404,  3424,
+     3443,  3459,  3481,  3504,  3523,   836,  3543,  3563,  3584,  3604,
+     3625,  3640,  3655,  3672,  3691,  4413,  3707,  3728,  3745,  3762,
+     3784,   854,  3802,  3823,  3840,  4432,  3854,  3876,  3893,  3910,
+     3927,  3945,  3964,  4454,  3986,  4006,  4020,  4040,   870,  4056,
+     4072,   886,  4471,   901,  4088,  4106,  4488,  4121,   914,  4140,
+     4157,  4173,  1798,  7668, 15147, 13231, 13601,   300,  7272,  4836,
+     7278, 12406,  7287,  1672,  7296,  7310,  1694,  7319,  9792, 15528,
+    15536,  7621,  8275, 14081,  7332,  7339,  7355,  7370,  7385,  7401,
+     7421,  7436,  7456, 10451, 12962,  6054,  7469,  6336,  7476,  1715,
+     7485,  1961,  5321,  8069, 11671,  6070,  7492, 11705,  1730,  7503,
+    12469,  7511,  1734,  7507,   313,  7524,  4280,  7535,  7541,  5383,
+     7546, 12310,  1124,  1746,  7550,  5332, 11677,  1764,  7560,  1780,
+     7568,  7575,  4922,  8128, 12256,     9,   118,    15,  7590,  8049,
+     3496, 10014, 10410, 13697,  2209, 10185,  7144, 12575,  2891, 11683,
+    10686,  2751, 12226,  2573, 15606,  3954, 14697,  3317,  7594,  7362,
+     7601, 15352,  7609,  2877, 11629,  7630,  7635,   331,  7639,  8872,
+     9899, 10430, 15947, 10030, 14486, 10044,  8099, 10061, 14637, 14656,
+     7645,  7650, 10730,  7193,  9080, 12677,  7657, 12799,  5165, 11128,
+    14300,  7449, 14238,  5181, 11154,  5043, 10615,  1795,  7665, 12094,
+    15420,  1811,  7673,  7683,  7689,  7707,  7726,  5296, 11388,  7732,
+     9127,  4850,  7741,  4861,  7747,  4877,  7758,  1016,  4213,   807,
+    12620,  7768, 10744,  7778,  7795, 11509,  4892,  7800,  7810, 12815,
+     3918, 14618,  3630, 13882,  7430, 12734, 15444, 12742, 12755, 12772,
+    12793, 12809, 12823, 12838, 12852, 12870, 12886, 12899, 12916, 12934,
+    12950, 12970, 12983, 13000, 13017, 13032, 13051, 13066, 13084, 13099,
+    13117, 13132, 13146, 13159, 13175, 13190, 13208, 13222, 13239, 13255,
+    13270, 13291, 13309, 13324, 13338, 13353, 13368, 13386, 13399, 13412,
+    13427,  3993, 14894,  1457,  5977, 14210,  2527,  3080, 12040, 14923,
+    15540,  1829,  7816,  3832, 14323,  9683, 14713,  6235, 12763, 11205,
+     2714,  2742,  6391,  8925,  4380, 11960,  3555,  3683,  9453, 12030,
+    12160, 12257, 13775, 13934,  3077, 12037, 12049, 12066, 12081,  7830,
+    10761,  7836,  7860,  4907,  7869,  1152,  7877,  7892, 10774,  7899,
+      344,  7907,  7915,  7933,  7695,  7946,  7958,  7971,  9143,  1851,
+     7982,  1185,  1873,  7996,  3806, 14264,  7832, 10763,  7838, 15150,
+     5394,  9479, 12479,  1889,  8004,  4094, 15509,  9466, 12263,  6651,
+    15831,  1908,  8015,  4342, 11690,    10,   119,    20,  3514,  7049,
+    13707,  2016,  8201,  1926,  8025,  8033, 12103,    25,  8041,  8045,
+       30,  6263,  8880, 15165,  4554,  4263,  4274,  4291,  4308,  4334,
+     4355,  4373,  4392,  4410,  4429,  4451,  4468,  4485,  3113, 12166,
+     6616, 15563,  8394,  8053,  1942,  8058,  1399, 15099,  1718,  7488,
+     1957,  8065,  8073,  3973, 14769,  6355,  8082,  4936,  8143,  4839,
+     7281,  8089,  8096,  8111,  3816,  4621,  4718,  4743,  5075,  5605,
+     6240,  6550,  6701,  7419,  7648,  7724,  7793,  8379,  9283,  9397,
+     9766,  9840,  9975, 10421, 10671, 10691, 10950, 11123, 11722, 12289,
+    12445, 12458, 12538, 12768, 13639, 13825, 14061, 14274, 14787, 14935,
+    15498, 15680, 14742, 15067, 15235,  6458, 11589,  9924, 15955,  1834,
+     7821, 15256,  2262, 10399,  8117,  8553,   625,  2138,  2282,  3043,
+     4521,  5538,  6042,  6895,  7336,  8486, 10438, 11637, 12003, 13834,
+    14005, 15172,  7343,  7359,  7374,  7389,  7405,  7425,  7440,  7460,
+     4920,  8126,  4741,  6699, 15065,  1832,  7819, 11700,    34,  1002,
+      359,  8132, 12560,  3282,  3310,  3338, 10448, 12959,  4200,  8942,
+     4931,  8138,  5345, 11081, 11728, 14516, 14722,  5792, 15184,  1973,
+     8147,  7203,  9097,   372,  8160,  6372,  8174,  1161,  7886,  4297,
+     8181,  1994,  8187,  2009,  8194,    39,   131,    51, 12367,    61,
+     1704,  6078,  6282,  6867,  7329,  7500,  9020,  6142, 11711,    56,
+     6277,  2296, 10460,  7922,  6439, 11528,    65,  4629, 14759,  8207,
+     7060,  8215,  2030,  8225,  3151, 12217,  4027, 14962,  1523,  6726,
+     8472, 12860,  6784,  2045,  8232,  1678,  7302,  9519, 13618,  5563,
+    13954,  4945,  8240,   920, 15788,  7260, 14253,  7292, 10699,  7138,
+    10705, 10725, 10739, 10756, 10769, 10783, 10800, 10812, 10828, 10845,
+    10860,  8355, 10875, 15370, 10883, 15402,  2415,  2444,  2465,  2489,
+     2516,  2542,  2564,  2590,  2423,  2614, 10898,  2787, 11352,  4956,
+     8246,    40,   132,   728, 12142, 10820, 11779,  5879, 15663,   773,
+    12372,     3,   105,   393,  8251,  7415, 12454,  2079,  8402,  5655,
+    14529,  6580, 14791,  4384, 11964,  1188,  1876,  7999,  3771, 14168,
+     2061,  8260,  8269,  9363, 11569, 10911, 12410, 12577,  2120,  8397,
+     8466,  4223,  8955,  1542,  6808,   409,  8288,   825, 12725, 12151,
+     1265,  3008, 11984,  9394, 11719,  1156,  7881,  7587,  7857,  7968,
+     9931,  9961, 11875, 12399, 12605, 14410, 14494, 15313, 15962, 15632,
+    15652,    16,    52,    70,    75,   928,   938,  6669,  6821,  7591,
+     8050,  8411,  8524, 10139, 10573, 10694, 11197, 11968, 12304, 12368,
+    12381, 12684, 13542, 13763, 15851,  2226, 10379,  5210,  5224, 11173,
+    11182,  4966,  8295,  8301,  9161,  4314,  8308, 10634,  4320,  8314,
+     4977,  8323, 14634,  9777, 15502, 12114, 13125, 14483,  5236, 11229,
+     4207,  4664,    22,    62,   255,   274,   462,   476,   600,   612,
+      715,   864,  1022,  1573,  1641,  1705,  1770,  1916,  2102,  2178,
+     2302,  2727,  2857,  2960,  3029,  3250,  3497,  3516,  3633,  3665,
+     4013,  4133,  4186,  4219,  4327,  4348,  4444,  4540,  4689,  4984,
+     5645,  5869,  6079,  6095,  6110,  6283,  6302,  6360,  6463,  6483,
+     6748,  6868,  6875,  6947,  6970,  7021,  7051,  7104,  7113,  7330,
+     7501,  7566,  7687,  8023,  8087,  8124,  8321,  8330,  8427,  8438,
+     8447,  9021,  9539,  9563,  9658,  9717,  9886,  9907,  9948,  9998,
+    10015, 10095, 10136, 10411, 10466, 10549, 10808, 10856, 10894, 11344,
+    11498, 11564, 11594, 11617, 11696, 11735, 11887, 11940, 11957, 11979,
+    11997, 12060, 12285, 12510, 12515, 12789, 12848, 13062, 13155, 13266,
+    13408, 13470, 13646, 13698, 13709, 13748, 13885, 13901, 13976, 14193,
+    14213, 14337, 14358, 14371, 14506, 14733, 14956, 14992, 15195, 15413,
+    15585, 15697, 15771, 15878, 15927, 15936, 14668, 14202,  1680,  2210,
+     2244,  7304, 10186, 10389,  8115,  9954,  9227, 10963, 14472,  6073,
+     7495,  8934,  8951,  8966,  8983,  8997,  9012,  9028,  9042,  9060,
+     9076,  9093,  9109,  9125,  7693,  9141,  9159,  7711,  9173,  9190,
+     9206,  9222,  9241,  9257,  9271,  9290,  9302,  9315,  9327,  9341,
+     9358,  9372,  9390,  9404,  9417,  9434,  9447,  9461,  9475,  9490,
+     9502,  9515,  9532,  9546,  9558,  9570,  9584,  9602,  9618,  9633,
+     9651,  9665,  9678,  9695,  9710,  9724,  9740,  9757,  9773,  9786,
+     9801,  9815,  9830,  9847,  9861,  9875,  9893,  8504,  8512, 10506,
+    12630, 13185, 13512, 11314, 11328, 10513,  3168, 12237, 12440,  7517,
+     7145,  4564, 11578,  7077,  8332,  8337,  8348, 15363,  8361, 12829,
+     7713,  8368,  7377,  8381, 15379,  8389,  2697, 11103,  9867, 15908,
+    11462,  5029, 10577, 10409,  8098, 11508,  3629, 13881,  8393, 15234,
+    15255, 14758,  2078,  8401,  5654, 14528, 12409, 12576,    74,  8410,
+     8523,  3028, 11996, 10408,  2018,  8203,  7844, 10415,  6543, 13818,
+     8867, 10425,  8414,  8419,   441, 10019,  8423, 12844,  4149, 15800,
+    14279,  3644, 13888,  1296, 13945,  6993, 12195,  3990, 14891,  8429,
+     9423, 11837,  4128, 15766,  5711, 14903,  4828,  5675,  7175, 13250,
+    13631, 14819, 11407, 11516, 13078,  2892, 11684,  6143, 11712,  8435,
+    10133,  2095,  8440,  4800,  6825,   923,  2019,  4816,  6917,  8204,
+    15791,  5919, 15855, 15483,  5657, 14531,  3720, 10976, 14141,   423,
+     8449,  5723, 14910,  2112,  8458, 15551,    57,  6278, 10687, 10946,
+     6832, 15011,  6476, 11972,  1555,  6840,  3865, 14562, 10793, 11220,
+     6203, 14572,  2835, 11603,  6846,  9000,  6854,  6862,  9015,  3533,
+    13718,  7845,  1569,  6871,  2523, 14919, 14302,  2752, 12227,  4177,
+    15869,  3097, 12129, 14676,  2297, 10461,  7183,  9067,  9209, 10584,
+     2155,  9983,  1557,  3352,  3737,  5143,  6842, 11053, 12423, 14150,
+     7923,  2316, 10477,  6440, 11529,  9377, 11661, 15881, 15242,  3867,
+    14564,    66,  4569,  4630,  6128,  7269,  7979,  9117,  9151, 10795,
+    11021, 11222, 11583, 14753, 14760, 15883, 14630,  6318,  7163,   777,
+     6205, 12376, 14574,  2135,  2279,  8483, 10435,  3574, 13786, 10028,
+    10042, 10059, 14654,  8470, 12858,  2785, 11350,  1263,  3006, 11982,
+    14277, 12193, 10143, 12085, 15546,  2474, 11828,  5467, 13586,  7974,
+     9146,  4593, 14386,  6878, 15131,  3449, 13593, 10416,  8208,  9805,
+    15572,  1767,  7563,  2574, 15607,  3022, 11990,  7061,  8216,  1095,
+     1653,  7212,  5985,  8988,  2132,  8480,  6544, 13819, 11512,  3955,
+     3977,  5688, 14698, 14773, 14869,  7701,  7952,  3318,  7595,  5863,
+    15579,  4575,  1086,  1117,  1145,  1178,  1204,  1228,  1255,  1281,
+     1312,  1336,  1363,  1390,  1416,  7363,  7602, 15353,  7610, 11201,
+     2710,  2738,  2031,  8226,  8868, 10426, 11210,  3152, 12218, 14334,
+     6183, 10151, 14447, 14461,  5613, 14285,  7626,  7928,  7941, 12385,
+     2100,  8445,  8103,  8280,  8489,  2034,  3321,  3596,  4098,  4402,
+     7598,  8229,  8365, 10119, 12488, 12833, 12945, 13476, 13846, 15513,
+     4028, 14963,  2870, 11622,   181,  4420,  5852,  5955, 13990, 15472,
+    10145, 12087,  1524,  6727,  6679, 14291,  8473, 12861,  4198,  8940,
+     6076,  7498,  5938, 15887, 10789, 11216,   973, 11484, 12494,   995,
+     1008,  1026,  1043,  1059,  1077,  1108,  1136,  1169,  1195,  1219,
+     1246,  1272,  1303,  1327,  1354,  1381,  1407,  1433,  1447,  1464,
+     1481,  1494,  1508,  1531,  1548,  1562,  1577,  1598,  1616,  1631,
+     1645,  1666,  1688,  1709,  1724,  1740,  1758,  1774,  1789,  1805,
+     1823,  1845,  1867,  1883,  1902,  1920,  1936,  1951,  1967,  1988,
+     2003,  2024,  2039,  2055,  2072,  2089,  2106,  2126,  2143,  2163,
+     2182,  2200,  2218,  2234,  2252,  2271,  2287,  2306,  2324,  2342,
+     2357,  2373,  2388,  2407,  2436,  2457,  2481,  2508,  2534,  2556,
+     2582,  2606,  2627,  2642,  2658,  2674,  2688,  2703,  2731,  2759,
+     2775,  2794,  2809,  2822,  2842,  2861,  2883,  2898,  2914,  2929,
+     2945,  2964,  2982,  2999,  3015,  3033,  3048,  3067,  3087,  3104,
+     3120,  3138,  3157,  3174,  3193,  3208,  3225,  3241,  3254,  3270,
+     3298,  3326,  3357,  3370,  3386,  3401,  3421,  3440,  3456,  3478,
+     3501,  3520,  3540,  3560,  3581,  3601,  3622,  3637,  3652,  3669,
+     3688,  3704,  3725,  3742,  3759,  3781,  3799,  3820,  3837,  3851,
+     3873,  3890,  3907,  3924,  3942,  3961,  3983,  4003,  4017,  4037,
+     4053,  4069,  4085,  4103,  4118,  4137,  4154,  4170, 14078,  3040,
+    12000,  5923, 15859,  7717,  8372,  8507, 14782, 12394,  6884,  9031,
+    10159,  2395, 10593,  6038,  6891,  7381,  8385, 15383, 12588, 15747,
+    14097,  9194, 10495,  6092,  9904,  7313,  9639, 14343, 10068,  6340,
+     7480, 14328,  3185, 12246, 14665,  3130, 12204,  7150,   153,   982,
+     8891, 15269,  2498, 13559,  9260, 11040,  6526, 13546,  3548, 13768,
+      698, 11892, 13552,  5137, 11047,  6990,  1103,  1661,  2577,  2837,
+     2878,  6025,  6692,  7220, 10823, 11605, 11630, 11782, 13576, 14305,
+    15248, 15262, 15610,   376,  8164, 11856, 13110,   491, 11062, 13284,
+    13666,  3809, 14267,  6785, 10052, 10914, 12107,  3659, 13895, 11470,
+       79,  6634,  7090,  7197,  7206,  7631,  8415,  8515,  9084,  9100,
+    12007, 15739,  8519, 15744, 14094, 13465,  1928,  8027,  8527,  8535,
+     3617,  7636,  8420, 12012, 13867, 15759,  8556,  8564,  8574,  8584,
+     8595,  8606,  8617,  8627,  8637,  8647,  8657,  8667,  8677,  8687,
+     8697,  8707,  8717,  8728,  8739,  8750,  8761,  8772,  8782,  8792,
+     8802,  8812,  8822,  8832,  8842,  8852,  8861,  8875,  8883,  8897,
+     8905,  2496, 13557, 12391,  8914,  3055, 12016, 15589,   442, 10020,
+     2046,  8233,  5413, 12641,  6389,  8923,  3290,  6899, 10866, 13904,
+     8929,  8946,  8961,  8978,  8992,  9007,  9023,  9037,  9055,  9071,
+     9088,  9104,  9120,  9136,  9154,  9168,  9185,  9201,  9217,  9236,
+     9252,  9266,  9285,  9297,  9310,  9322,  9336,  9353,  9367,  9385,
+     9399,  9412,  9429,  9442,  9456,  9470,  9485,  9497,  9510,  9527,
+     9541,  9553,  9565,  9579,  9597,  9613,  9628,  9646,  9660,  9673,
+     9690,  9705,  9719,  9735,  9752,  9768,  9781,  9796,  9810,  9825,
+     9842,  9856,  9870,  9888,   332,  7640,   963, 15331,  9294, 11245,
+     5940, 15889,  2549, 15556,  3148, 12214,   595, 11493, 14608,  9609,
+    14220, 12403, 13505,  3346, 12417,  3215, 12427, 12436,  7451, 14240,
+     7409, 12448, 12027,  3074, 12034, 12046, 12063, 12078,   792,  3133,
+     4283,  6223,  6582,  7538,  9198,  9263, 10499, 11043, 12207, 12464,
+    14707, 14793, 15123, 14298,  6158, 13912,  1840,  7827,  2194, 10006,
+    15548,  9230, 10966,  3468, 13677,  6090,  9902,  9909, 12876,  9917,
+     4991,  9934,  6106,  9944,  9950,  7250,  6848,  9002,  8424, 12845,
+     2367, 10540,  3632,  4185, 13884, 15877,  9638, 14342,    84,  9669,
+    14393,  7432, 12736, 15446, 12744, 12757, 12774, 12795, 12811, 12825,
+    12840, 12854, 12872, 12888, 12901, 12918, 12936, 12952, 12972, 12985,
+    13002, 13019, 13034, 13053, 13068, 13086, 13101, 13119, 13134, 13148,
+    13161, 13177, 13192, 13210, 13224, 13241, 13257, 13272, 13293, 13311,
+    13326, 13340, 13355, 13370, 13388, 13401, 13414, 13429,  9964, 12892,
+     9969,  9914, 12881, 12520, 13168, 12528,  2149,  9977,  2169,  9989,
+     2188, 10000,  7411, 12450, 10010,   439, 10017, 10026, 10040, 10057,
+    14652, 14434,    96,   111,   124,   143,   158,   172,   186,   200,
+      214,   228,   242,   258,   277,   294,   307,   325,   338,   353,
+      366,   387,   403,   417,   433,   449,   465,   479,   499,   511,
+      526,   542,   556,   572,   585,   603,   615,   629,   647,   661,
+      675,   689,   703,   718,   735,   751,   766,   782,   796,   814,
+      833,   851,   867,   883,   898,   911,  7618,  3970, 14766, 10073,
+    12905, 10077, 12909, 15715,   496,  2504,  3417,  4150,  4885,  4900,
+     5065,  5300,  5499,  5795,  5930,  7766,  7808,  9383, 10648, 10657,
+    11067, 11392, 11667, 13496, 13565, 13799, 15187, 15801, 15866, 15306,
+     5060, 10643,  5787, 15179,  7849,  3381,  5238,  9550, 11231, 12697,
+    13304, 13877, 13923, 15031,  4607,  4699, 10082,   455, 10088,  5343,
+    11726,   726, 12140,   823, 12723,  7013, 12781, 13739, 14280, 10097,
+    12922,   550, 11250,  1292, 13941,  3995, 14896, 10107, 10114, 12940,
+    12097, 15423, 15169,  5640, 14353,  5194, 11162,  7236, 10680, 11702,
+    13377, 15037,  5006, 10122, 10127, 10130, 10138,  1021,  4218,  1679,
+     7303,  2834, 11602,  7268,  7978,  9116,  9150, 10142, 12084,  4574,
+     1085,  1116,  1144,  1177,  1203,  1227,  1254,  1280,  1311,  1335,
+     1362,  1389,  1415,  6182, 10150, 14446, 14460, 12487,   972, 12493,
+    10158,  5627, 14312, 10166,    85,  4739,  6697,  6186, 10154, 14450,
+    14464,  9175, 10172,   151,   980,  4112, 15616, 15623, 15643,  3645,
+    13889,  6856,  4896,  7804,  4776,  6773, 10653,  2206, 10182,  6781,
+     8560, 10192,  8568, 10196,  8578, 10202,  8588, 10208,  8599, 10215,
+     8610, 10222,  8621, 10229,  8631, 10235,  8641, 10241,  8651, 10247,
+     8661, 10253,  8671, 10259,  8681, 10265,  8691, 10271,  8701, 10277,
+     8711, 10283,  8721, 10289,  8732, 10296,  8743, 10303,  8754, 10310,
+     8765, 10317,  8776, 10324,  8786, 10330,  8796, 10336,  8806, 10342,
+     8816, 10348,  8826, 10354,  8836, 10360,  8846, 10366,  8856, 10372,
+     3410, 13489,  1800,  2476,  3754,  3776,  7670, 11830, 13203, 13444,
+    14159, 14173, 15005, 15075,  7918,  7936, 13198, 13439,  2224, 10377,
+     9835, 15675,  4231, 12174,  3235,  5574,  5909, 12503, 14020, 15842,
+     5549, 13852,  2240, 10385,  9520, 13619,  9762, 15494,   580,  1297,
+     7653, 10103, 10733, 11445, 12928, 13946,  2939, 11847,  1624,  6961,
+      828, 12728,  6994,  4881,  7762,  9280,  9837, 11120, 15677,  6864,
+     9017,  2258, 10395,  1700,  7325,  9865, 15906, 10406, 10413,  8865,
+    10423,  2277, 10433, 12196, 10441,  1053,  2908,  4502, 11800, 12473,
+     4510, 10445, 12956,  2293, 10457,  1068,  4545, 10468, 12976,  2312,
+    10473, 13519, 15278,  2330, 10483,  3991, 14892,  9537, 13746, 10791,
+    11218,  9192, 10493,   209,  6792, 10033,  1034,  4238,  8500, 10502,
+    13508, 10509,  4995,  9938,  2348, 10523,  5495, 13795,  4562, 11576,
+     8430, 11419,  3294,  5050,  5469,  5564,  6499,  6529,  6566,  6787,
+     6903,  8873,  9900, 10431, 10622, 12552, 13549, 13588, 13955, 14425,
+    15948, 14431, 12558,  3280,  3308,  3336,  6180, 14444, 14458, 10031,
+     7134, 14487, 12571,  4439, 14501, 10045,  8100, 10062, 14478, 14512,
+    11322, 11336, 14638, 14657,  3265,  7067,  8222, 12545,  2228, 10381,
+     4617,  4714,  7646,  7976,  9148,  7651, 10731,  5628, 14313, 14929,
+     1911,  8018, 10530,  4946,  8241,  2363, 10536,  5586, 14034, 11865,
+     7661, 12803,  6705,  9424, 11838,  5969,  8974, 10167,  4980,  8326,
+     5233, 11226,  5624, 14309,    86,   487, 11058, 15753,   471, 10544,
+     5016, 10551,  1857,  7988,  7194,  9081,   533, 11235,   566, 11259,
+    12678,  7658, 12800,  5166, 11129,  2379, 10558,  1981,  8155, 10565,
+    15390,  4740,  6698,   927, 10572, 10807, 11734, 14471,  5028, 10576,
+     3864, 14561,  6202, 14571, 14301,  9208, 10583,  5984,  8987,  4419,
+    13989, 12393,  2394, 10592, 12587,  6989,  7450, 14239,  4606,  4698,
+     5193, 11161,  9761, 15493,   643,  5182,  6423, 11155, 11478, 11648,
+     5044, 10616,  1502,  6713,  1516,  6719,  1796,  7666, 12095, 15421,
+     1812,  7674,  7684,  7690,  7708, 13568,  6321,  7166,  5737, 14938,
+     5749, 14945,  7727,  5297, 11389,  8916,  3827, 14318,  7733,  9128,
+     4851,  7742,  4125, 15763, 13346, 14810,  4814,  6915,  5686, 14867,
+     4615,  4712, 10603, 10608,  5206, 11169,  5461, 13580, 13247, 13628,
+     3884, 14583, 11071, 13008,  3535, 11474, 13720,  5040, 10612,  6405,
+    10624,   921, 15789,  3447, 13591,  4862,  7748,  9685, 14715,  3934,
+    14685, 10631,  5057, 10640, 10650,  4878,  7759, 10659, 12989,  1017,
+     4214,  4129, 15767,   808, 12621,  5072, 10668,  6460, 11591,  4752,
+     6734,  5712, 14904,  7769, 10745,  7779,   932,  7796, 10673, 11190,
+    11510,   731,  5753, 12145, 14949,  1817,  7679,  1814,  7676,  1425,
+    15461, 11544,  4010, 14953,  4024, 14959, 10677,  4893,  7801,  6906,
+     7811, 12816,  9884, 15925,   211,   400,   553,   644,   763,   895,
+     4829,  4959,  4970,  5183,  5630,  5676,  5703,  5840,  6424,  6794,
+     7176,  7261,  8249,  8258,  8299,  9215,  9967, 10080, 10534, 10570,
+    10590, 11156, 11253, 11271, 11282, 11479, 11649, 11765, 11788, 12336,
+    12895, 12912, 13047, 13251, 13349, 13632, 14315, 14813, 14820, 14888,
+    15084, 15288, 15395,  8542, 14254, 14542,  5045, 10617,   747,   958,
+      975,  1164,  1428,  1503,  3919,  4526,  4595,  5397,  6187,  6249,
+     6601,  6620,  6664,  6714,  6977,  7239,  7293,  7866,  7889,  8038,
+     8532,  8920,  9482,  9670, 10054, 10111, 10155, 10700, 10916, 11458,
+    11486, 11548, 11773, 11914, 12109, 12177, 12186, 12343, 12413, 12482,
+    12496, 12580, 12750, 13970, 13998, 14260, 14294, 14379, 14388, 14394,
+    14418, 14451, 14619, 14805, 14854, 14879, 15116, 15464, 15567, 15915,
+     6984, 14465,  1517,  6720,  6259,  6273,  4625,  4635,  4647,  4658,
+     4670,  4681,  4693,  4707,  4722,  4734,  4747,  4760,  4770,  4783,
+     4796,  4808,  6292,  6311,  4821,  4833,  6333,  4847,  4858,  4874,
+     4889,  4904,  6352,  4917,  4928,  6369,  4942,  4953,  4963,  4974,
+     6386,  4988,  5003,  5013,  5025,  5037,  6402,  5054,  5069,  5079,
+     5092,  5106,  5119,  5133,  5148,  5159,  5174,  5187,  5200,  5215,
+     5229,  5243,  5256,  5273,  5291,  5304,  6419,  6433,  6452,  5316,
+     5327,  5338,  5351,  5365,  6472,  5377,  5389,  6492,  5402,  5420,
+     6508,  5437,  5447,  6522,  5457,  5473,  5488,  5503,  5514,  6538,
+     5528,  5543,  5556,  5568,  5580,  5594,  5609,  5620,  5634,  6559,
+     5649,  6575,  5668,  5680,  6592,  5694,  5707,  5719,  5733,  5745,
+     5758,  5769,  5780,  5799,  5816,  5832,  5844,  6611,  5858,  5873,
+     6630,  5890,  6645,  5903,  5915,  5934,  1944,  8060,  3752, 14157,
+     8496,   789, 12461,   966, 15334,  7139, 10706, 10726, 10740, 10757,
+    10770, 10784, 10801, 10813, 10829, 10846, 10861,  8356, 10035, 10876,
+    15371, 12595, 10884, 15403,  2416,  2445,  2466,  2490,  2517,  2543,
+     2565,  2591,  5480, 13652,  2424,  2615, 10899,  5866, 15582, 15774,
+     4864,  7750, 11267,  7514, 11482, 12341,  5428, 12651,  3434, 13531,
+      395,  8253,  9176, 10173,   592, 11490, 11501,  6009,  7352,  7433,
+     8108,  8285, 12737, 15447, 12745, 12758,  6018,  6034, 12775,  6051,
+     6067, 12796, 12812, 12826, 12841, 12855,  6087, 12873,  6103, 12889,
+    12902, 12919, 12937, 12953, 12973, 12986,  6118, 13003, 13020, 13035,
+    13054, 13069,  4556,  6137, 13087, 13102, 13120, 13135, 13149, 13162,
+    13178, 13193, 13211, 13225, 13242, 13258, 13273, 13294,  6154, 13312,
+    13327,  6173,  6196,  6215, 13341, 13356, 13371, 13389, 13402, 13415,
+    13430,  1896,  2066,  2668,  4265,  8011,  8265,  9523, 11010, 13622,
+    14436,    98,   113,   997,   126,   145,  1010,  1028,  1045,  1061,
+     1079,  1110,  1138,  1171,  1197,  1221,  1248,  1274,  1305,  1329,
+     1356,  1383,  1409,  1435,   160,   174,  1449,  1466,  1483,  1496,
+     1510,   188,   202,   216,  1533,  1550,  1564,   230,  1579,   244,
+     1600,  1618,  1633,   260,  1647,   279,   296,  1668,  1690,  1711,
+     1726,   309,  4276,  1742,  1760,  1776,   327,  1791,  1807,  1825,
+      340,  1847,  1869,  1885,  1904,  1922,  1938,  1953,   355,  1969,
+      368,  4293,  1990,  2005,  2026,  2041,   389,  2057,   405,  4310,
+     2074,  2091,   419,  2108,  2128,  2145,  2165,  2184,   435,   451,
+     2202,  2220,  2236,  2254,  2273,  2289,  2308,  2326,  2344,  2359,
+      467,  2375,  2390,  2409,  2438,  2459,  2483,  2510,  2536,  2558,
+     2584,  2608,  2629,  2644,  2660,   481,   501,  2676,  2690,   513,
+     2705,  2733,   528,   544,   558,  2761,  2777,  2796,   574,   587,
+     2811,   605,  2824,  2844,  2863,   617,   631,   649,  2885,  4336,
+      663,  2900,  2916,   677,  2931,  2947,   691,  2966,  4357,  2984,
+      705,  4375,  3001,  3017,  3035,  3050,  3069,  3089,   720,  3106,
+      737,  3122,  3140,  3159,  3176,   753,  3195,   768,  3210,   784,
+     3227,  3243,  3256,  3272,  3300,  3328,   798,  3359,  3372,   816,
+     4394,  3388,  3403,  3423,  3442,  3458,  3480,  3503,  3522,   835,
+     3542,  3562,  3583,  3603,  3624,  3639,  3654,  3671,  3690,  4412,
+     3706,  3727,  3744,  3761,  3783,   853,  3801,  3822,  3839,  4431,
+     3853,  3875,  3892,  3909,  3926,  3944,  3963,  4453,  3985,  4005,
+     4019,  4039,   869,  4055,  4071,   885,  4470,   900,  4087,  4105,
+     4487,  4120,   913,  4139,  4156,  4172,  1797,  7667,  9791, 15527,
+    15535,  7620,  8274, 14080, 12468, 10685,  2750, 12225,  8871,  9898,
+    10429, 15946, 14485, 12093, 15419,  3554, 12029, 13774,  3076, 12036,
+    12048, 12065, 12080, 15149,  5393,  9478, 12478, 12102,  6615, 15562,
+     9396, 11721,  3042, 12002, 15064,    60,  6281,  3150, 12216,  1677,
+     7301,     2,   104, 10693, 12113, 13124,  4347,  6359,  8086, 11695,
+    11507,  9422, 11836,  9804, 15571,  5862, 15578, 10118, 12944, 14327,
+    14664,   152,   981, 15588,  9293, 11244,  2366, 10539,  3631,  4184,
+    13883, 15876,  7431, 12735, 15445, 12743, 12756, 12773, 12794, 12810,
+    12824, 12839, 12853, 12871, 12887, 12900, 12917, 12935, 12951, 12971,
+    12984, 13001, 13018, 13033, 13052, 13067, 13085, 13100, 13118, 13133,
+    13147, 13160, 13176, 13191, 13209, 13223, 13240, 13256, 13271, 13292,
+    13310, 13325, 13339, 13354, 13369, 13387, 13400, 13413, 13428,  3969,
+    14765,  9549, 13922,   549, 11249,  3994, 14895, 12096, 15422, 12486,
+    12492,  3234,  5573, 12502, 14019,  2938, 11846,  1052,  4501,  4509,
+     1813,  7675, 10569, 15394,  6683,  9965, 12893,  2788, 11353,  4044,
+    14971,  2637,  6164, 10923, 13918, 14832,  1472,  5991,  2337,  7038,
+    10490,  7045,  7057,  7074,  7086,  5371, 11814, 14931,  8549,  7685,
+     7691,  7709,  4957,  8247, 13569,  5699, 14884,  6322,  7167,  1036,
+     4240,   271,   597,  2724,  2854,  4324,  7018,  7101,  8318, 11495,
+    11614, 12786,  2400, 10598,  9818, 15596,  2816, 11521, 11278, 13043,
+    15930,  5738, 14939,   874, 14979,  9636, 14340,  8343,  5750, 14946,
+     2770,  3473,  4113,  4755,  5020,  5589,  6376,  6737,  6880,  6887,
+     7398,  8178,  8305,  9034,  9165, 10555, 11300, 11408, 11517, 12273,
+    13079, 13682, 14037, 14523, 15436, 15617, 14648,  7120,  3611, 13861,
+    15624, 15644,  1071,  3646,  4548,  4578,  6997,  7728, 13890,  7246,
+     1089,  1120,  1148,  1181,  1207,  1231,  1258,  1284,  1315,  1339,
+     1366,  1393,  1419,  3378, 12694,  2597, 15778, 14729,  7736,  9131,
+     5925, 15861,  3494, 13695,  2571, 15604,  3952, 14695,  2875, 11627,
+    14208,  6437, 11526,   918, 15786, 10697,  7136, 10703, 10723, 10737,
+    10754, 10767, 10781, 10798, 10810, 10826, 10843, 10858,  8353, 10873,
+    15368, 10881, 15400,  2413,  2442,  2463,  2487,  2514,  2540,  2562,
+     2588,  2421,  2612, 10896, 10909, 13468, 15193,  8502, 10504, 13510,
+    10511,  3026, 11994,  7699,  7950, 13574,  4883,  4898,  5298,  7764,
+     7806, 11390, 15304,  7847,  5638, 14351,  7266,  9114,  3774, 14171,
+     9278, 11118,  5048, 10620,  8540,  2064,  8263,  8272, 15062,  9276,
+    11116,  2955, 11882,  9212, 10587,  9970,  3614, 13864,  9701, 14844,
+     6654, 15834,  4144, 15795,  9593, 14127, 15294,   563, 11256,  9437,
+    12120,  2633, 10919,  7015, 12783,  3589, 13839,  2893,  3699, 11685,
+    13983,  3676, 13927,  1289, 13938,  1239, 11438,  1458,  5978, 10869,
+    13907, 14013,  8917, 13317, 14026, 14211,  4147, 15798,  5673, 14817,
+     3232, 12500,   891, 15080, 13571,  3828, 14319,  2648, 10926,  1913,
+     2957,  8020, 11884, 12282,  3094, 12126, 14673,  6144, 11713, 10934,
+     9713, 14988, 10939,  9727, 14995, 15244,  8122,  8436, 10134, 10944,
+     1101,  1659,  7218,  4110, 15614, 15621, 15641, 11265, 11274, 13039,
+     5082, 10952, 13233, 13603,   302,  7274,   759, 12332,  9305, 11285,
+     5430, 12653,  3412, 13491,  2096,  8441,  4801,  6826,   907,  1376,
+     2431,  2622,  4300,  8184,  9507, 10906, 13422, 13538, 14117, 14610,
+    15108, 15154, 15703, 15710,    41,   133,  3716, 14137,  6297,  7108,
+     9330, 11535,  1639,  6968,  7132,  4812,  6913,   729, 12143,  5701,
+    14886, 15114,  7734,  9129,  7719,  7788,  8374, 12533,  7582,  7852,
+     7963,  9926,  9956, 11870, 12600, 14405, 14489, 15308, 15957, 15627,
+    15647,  7027,  9048,  9224, 10960, 10972,   235,  6921, 10517, 10979,
+     1609,  6954,    89, 13450, 14834, 15133, 15485,  5095,  9243, 10983,
+     7771, 10747,  7781,  2721,  2851, 11611,  2050,  2653,  5311,  8237,
+    10931, 11398, 15804,  4852,  7743, 15808,  7117, 10992, 11910, 13229,
+    13599, 15232, 15253,  4126, 15764, 11542, 10532, 13347, 14811, 11276,
+    13041,  7130, 10837, 11921,  3844, 14361,  7153,  8509,  3900, 14591,
+    14600,  2528,  3081, 12041, 14924, 15541, 14779,  1830,  7817, 12508,
+    13153,  6857,   428,  8454,  9821, 10839, 11923, 15599,  5728,  9319,
+    11413, 14915,  1158,  7883,  3594, 13844,  8889, 15267, 10821, 11780,
+     6975,  4254, 10719,  8119,  5880, 15664, 14824,  3451, 13595,  5560,
+    13951,  1571,  6873,  4584, 15343,  1241, 11440,  5109, 10998, 11404,
+    13075,  2664, 11006,   774, 12373,     4,   106,  6684,  6121, 11014,
+    14746,  9348, 11556,  6742, 12054, 11024,  6752, 12071,  6161, 13915,
+     5122, 11030,  9657, 14370,  9259, 11039,  5136, 11046,  9608, 14219,
+     9966, 12894,   394,  8252, 14831,  3377, 12693,  2789, 11354, 12363,
+      485, 11056,  3882, 14581, 11069, 13006, 11078, 11085,  1347, 14106,
+     4045, 14972,  1836,  7823,   505, 11089,  9344, 11552,  1211,  2680,
+    11094,   223,  6799,   285,  7225,  2694, 11100,  5784, 15176, 11739,
+    13092,  1213,  2682, 11096,    36,   924,  1004,  2020,  2267,  2638,
+     2790,  3221,  3366,  3833,  4496,  4779,  4817,  5088,  5269,  5416,
+     5433,  5443,  5484,  5664,  5776,  5886,  5899,  6165,  6776,  6918,
+     7814,  8205,  8213,  9440,  9750, 10404, 10924, 10958, 11355, 11367,
+    12123, 12293, 12433, 12523, 12644, 12656, 12669, 12708, 12819, 13171,
+    13395, 13656, 13919, 13963, 14324, 14538, 15026, 15095, 15228, 15670,
+    15687, 15792, 15826, 12531,  7961,  7125, 15637,   657,   950,  1489,
+     3846,  4948,  5169,  6000,  8243, 11132, 11655, 14363, 14547, 15323,
+     5151, 11107,  9273, 11113,  5162, 11125,   517, 11135,  1475,  5994,
+     5602, 14058, 11143, 13023,  9911, 12878,   361,  8134,  5177, 11150,
+     5111, 11000,  5190, 11158,  5356, 11746,  5249, 11306,  7446, 14235,
+     5920, 15856,  5203, 11166,  3059, 12020,  5218, 11176, 11185,   806,
+    12619,   937, 11196, 10893, 13407, 15412, 15696,  7843,  4815,  6916,
+    15010,  6317,  7162,  5687, 14868, 11200,  2709,  2737, 11209, 10788,
+    11215, 15122,  4616,  4713,  5585, 14033,  5968,  8973,  5232, 11225,
+      532, 11234,  9684, 14714, 11189,  9214, 10589, 14378,  9292, 11243,
+      548, 11248,  3610, 13860,  7245,  4897,  7805,   562, 11255, 11264,
+    11273, 13038,  9304, 11284, 13449, 14833, 15484,  3899, 14590, 14599,
+     6160, 13914,  6236, 12764,  9920, 15129,  4182, 15874,  2450, 11290,
+     2765, 11295,   196,  6767,  4777,  6774,  1473,  5992,  5246, 11303,
+     5658, 14532,  7465, 15900,  5062, 10645, 10654,  9654, 14367, 11311,
+    11325, 11339, 13057, 12562,  3284,  3312,  3340, 15190,  2781, 11346,
+     5259, 11357,   348,  7911, 15142,  1979,  8153,   942, 10604, 11369,
+    13608, 10609, 13613,   878, 14983,  4765,  6760,  5276, 11373,  5294,
+    11386,  4162, 15814,  5084,  5895, 10954, 15822,  5307, 11394,  5409,
+    12637, 11401, 13072, 11206,  2715,  2743,  9317, 11411,  5763, 15018,
+    11416,   225,  2338,  3170,  3721,  4478,  4792,  5102,  5155,  5453,
+     5616,  6324,  6801,  6818,  7039,  7169,  7368,  7522,  7607,  7705,
+     7956,  8895,  9250,  9644,  9733, 10148, 10455, 10491, 10977, 10990,
+    11111, 12090, 12239, 12388, 12713, 12966, 13741, 14142, 14282, 14288,
+    14348, 15001, 15090, 15273, 15358,   424,  8450,  7615,  5724, 14911,
+     2525, 14921,  8498,  1855,  7986, 11868,  2113,  8459,  7046,  7058,
+     7075,  7087,   413,   522,  1038,  2319,  3062,  4080,  4233,  4242,
+     5372,  6392,  8292,  8926, 10480, 11140, 11815, 12023, 15057, 15552,
+     5279, 11376,  2800, 11427,  1235, 11434,   381,  8169,  5803, 15198,
+      669, 11755,  2207, 10183,  6782,  5877, 15661,   578, 11443,  3292,
+     6901,    58,  6279,  3057, 12018,  2993, 11947,  5820, 15210,  1584,
+     6928,   318,  7529,  6237,  6547,  7416,  7721,  7790,  8376,  9972,
+    10418, 10688, 10947, 12442, 12455, 12535, 12765, 13636, 13822, 14784,
+    14932,  9921, 15952,  8550,  7584,  7854,  7965,  9928,  9958, 11872,
+    12396, 12602, 14407, 14491, 15310, 15959, 15629, 15649, 14544,  6005,
+     7348,  6014,  6030,  6047,  6063,  6083,  6099,  6114,  6133,  6150,
+     6169,  6192,  6211,   249,  6941, 11449, 10099, 12924,  6833,   947,
+    15320, 11454, 13216, 13458, 15012,  7029,  9050, 11762, 11769,   954,
+    14738,  6477, 11973, 10450, 12961,  4838,  7280, 10819, 11778, 12150,
+      273,   599,  2726,  2856,  4012,  4326,  4443,  7020,  7103,  7686,
+     8320, 11497, 11616, 12788, 14505, 14955,  9226, 10962,  7692,  7710,
+    11461, 12408,  1295, 13944, 11406, 13077,  1556,  3351,  5142,  6841,
+    11052, 12422,  3866, 14563, 10794, 11221,  6204, 14573,  2784, 11349,
+    14333,  2836, 11604, 14304, 11469, 13464,  3616, 13866,   962, 15330,
+     6222, 14706,  2193, 10005,  6847,  9001,  7235,   971,   150,   979,
+     6855,  9834, 15674,  6863,  9016,  6422, 11477,  3534, 13719,   552,
+      894,  4958,  8248, 11252, 11787, 15083,  6248, 12176, 14417,  6258,
+     6272,  6291,  6310,  6332,  6351,  6368,  6385,  6401,  6418,  6432,
+     6451,  6471,  6491,  6507,  6521,  6537,  6558,  6574,  6591,  6610,
+     6629,  6644, 11481,   591, 11489, 11500,  8107,  8284, 11506,  2365,
+    10538,  2815, 11520,  5588,  6886,  8304,  9033,  9164, 14036,  6436,
+    11525,  7846,  9275, 11115,  9700, 14843, 13570,  2430,  2621, 10905,
+    13421, 15702, 15709,  9329, 11534,  5700, 14885, 11541,  6974,  1570,
+     6872,  9347, 11555,  9343, 11551, 12522, 13170, 12530,  5248, 11305,
+     9919,  4477,  6323,  7168, 15089,  2524, 14920, 11867,  1037,  4241,
+      272,   598,  2725,  2855,  4325,  7019,  7102,  8319, 11496, 11615,
+    12787,  1294, 13943, 14303,  9699, 14842, 13420, 15701, 15708,  2401,
+     2753, 10599, 12228,  4178, 15870,  9687, 14717,   987,  4639,  4400,
+    13474,  9819, 15597,  2402,  2754,  3794,  9494, 10600, 12229, 12717,
+    14183,  7862,  4909,  7871,   609, 11561, 14399,  1592,  3098,  6936,
+    12130, 14677,  9360, 11566,  4559, 11573,  6455, 11586,  5535, 13831,
+     2828, 11596,  2718,  2848, 11608,  2298, 10462, 14374, 14383,  2867,
+    11619,  4179, 15871,  3997, 14898,  7184,  9068,  4867,  7753,  9210,
+    10585,  2156,  9984,  1321,  9408, 11792, 14042,  9180, 10177,  8911,
+    10665, 12995, 15161, 15940,   621, 11633,   635, 11640,  3916, 14616,
+     1374, 14115,  2651, 10929, 10663, 12993,  5282, 11379,   653, 11651,
+     3662, 13898,  9374, 11658,  2117,  8463, 10995,  9743, 15221, 15302,
+     5660, 14534, 10049,   384,   539,  1558,  3353,  3738,  4202,  5144,
+     6843,  6859,  7663,  8172,  8944,  9688, 10471, 11054, 11241, 12424,
+    12805, 12979, 14151, 14718, 15593,  5464, 13583,  7924,  2817,  3396,
+    11522, 13483, 12326, 14625,  2600, 15781,  5319, 11669,  5330, 11675,
+    12573,  2889, 11681,  4340, 11688, 11698,  6140, 11709,  9392, 11717,
+     5341, 11724,  4993,  9936, 10805, 11732,  2666, 11008, 11737, 13090,
+     5354, 11744,   194,  6765,  2317, 10478,   667, 11753, 11760, 11767,
+    10817, 11776, 11785, 14415,  9406, 11790,  1401,  1783,  4190,  4652,
+     6441,  7571,  9232, 10968, 11530, 12701, 15101,  7578,  2904, 11796,
+     2920, 11804,  5207,  5221, 11170, 11179,  6598, 13967, 14876,  5368,
+    11811, 10161,   681, 11818, 12318,   166,  5947,  9574, 14048,  1128,
+     1750,  7554,  2471, 11825, 12592,  3431, 13528,  9419, 11833,  2935,
+    11843,  9590, 14124,  8210,  5599, 14055,  1976,  8150, 11851, 13105,
+    11861, 14644,  2951, 11878,  3936,  6707,  7774, 10750, 14687,  7784,
+     4933,  8140,   695, 11889,  2970, 11896, 11279, 13044,   988,  4640,
+    11906, 10833, 11917,  4361, 11927,  6125, 11018, 14750, 10850, 11934,
+     2988, 11942,   709, 11951, 15931,   639, 11644,  7864, 10109, 15913,
+    10116, 12942, 12280,  4911,  7873,  7289,  9378, 11662,  1674,  7298,
+     5739, 14940,   875, 14980,   287,  7227,  5164, 11127,  4379, 11959,
+    11967, 12303,   611,   863,  3249,  9562, 11563, 12514, 13975, 14192,
+    14732, 14201, 12629, 13184,  6475, 11971, 15882,   776, 12375,  1262,
+     3005, 11981,  4592, 15130,  3021, 11989,  4401, 13475,   180,  5954,
+      994,  1007,  1025,  1042,  1058,  1076,  1107,  1135,  1168,  1194,
+     1218,  1245,  1271,  1302,  1326,  1353,  1380,  1406,  1432,  1446,
+     1463,  1480,  1493,  1507,  1530,  1547,  1561,  1576,  1597,  1615,
+     1630,  1644,  1665,  1687,  1708,  1723,  1739,  1757,  1773,  1788,
+     1804,  1822,  1844,  1866,  1882,  1901,  1919,  1935,  1950,  1966,
+     1987,  2002,  2023,  2038,  2054,  2071,  2088,  2105,  2125,  2142,
+     2162,  2181,  2199,  2217,  2233,  2251,  2270,  2286,  2305,  2323,
+     2341,  2356,  2372,  2387,  2406,  2435,  2456,  2480,  2507,  2533,
+     2555,  2581,  2605,  2626,  2641,  2657,  2673,  2687,  2702,  2730,
+     2758,  2774,  2793,  2808,  2821,  2841,  2860,  2882,  2897,  2913,
+     2928,  2944,  2963,  2981,  2998,  3014,  3032,  3047,  3066,  3086,
+     3103,  3119,  3137,  3156,  3173,  3192,  3207,  3224,  3240,  3253,
+     3269,  3297,  3325,  3356,  3369,  3385,  3400,  3420,  3439,  3455,
+     3477,  3500,  3519,  3539,  3559,  3580,  3600,  3621,  3636,  3651,
+     3668,  3687,  3703,  3724,  3741,  3758,  3780,  3798,  3819,  3836,
+     3850,  3872,  3889,  3906,  3923,  3941,  3960,  3982,  4002,  4016,
+     4036,  4052,  4068,  4084,  4102,  4117,  4136,  4153,  4169, 14077,
+     3039, 11999,  7312, 12006, 12011,  3054, 12015, 12026,  3073, 12033,
+    12045, 12062, 12077,   791, 12463,  9637, 14341, 12340, 12092, 15418,
+    12101, 12112, 13123,  3025, 11993,  3773, 14170,  5047, 10619,  2063,
+     8262,  8271, 15293,  9436, 12119,  3093, 12125, 14672, 15243,  4189,
+     4651, 12134,  9426, 11840, 13332, 14065, 15455, 14071, 14088,  1154,
+     7879,   724, 12138, 12148, 14401,  9449, 12156,  3110, 12163, 12171,
+      741, 12180,  4316,  8310, 12189,  3126, 12200,  3144, 12210,  2746,
+    12221,  2080,  8403,  3163, 12232,  3180, 12241,  8344, 13281, 13663,
+     7894, 10776, 12252,  2974,  7901, 11900,  9463, 12260,  2397, 10595,
+     7392, 12267, 15430, 12276,   519, 11137,  5751, 14947,  1696,  7321,
+     5284, 11381,  5838, 15286, 12287,  5441,  5662,  5774, 12291, 12706,
+    14536, 15024, 12295, 12299,  4195,  8937,  8561, 10193, 12135,  8569,
+    10197,  8579, 10203,  8589, 10209,  8600, 10216,  8611, 10223,  8622,
+    10230,  8632, 10236,  8642, 10242,  8652, 10248,  8662, 10254,  8672,
+    10260,  8682, 10266,  8692, 10272,  8702, 10278,  8712, 10284,  8722,
+    10290,  8733, 10297,  8744, 10304,  8755, 10311,  8766, 10318,  8777,
+    10325,  8787, 10331,  8797, 10337,  8807, 10343,  8817, 10349,  8827,
+    10355,  8837, 10361,  8847, 10367,  8857, 10373,  6040,  6893,  4381,
+    11961,  5380, 12307,  3868, 14565, 12314,     6,    67,    93,   108,
+      430,   446,   968,  1350,  1403,  1460,  1477,  1594,  1720,  1785,
+     1932,  1984,  1999,  2085,  2159,  2771,  2995,  3100,  3116,  3237,
+     3474,  4114,  4192,  4366,  4570,  4631,  4654,  4756,  4870,  5021,
+     5033,  5347,  5552,  5576,  5590,  5715,  5911,  5943,  5971,  5980,
+     5996,  6129,  6377,  6443,  6686,  6738,  6881,  6888,  6910,  6938,
+     7270,  7317,  7383,  7399,  7454,  7467,  7490,  7573,  7756,  7980,
+     8031,  8158,  8179,  8192,  8306,  8387,  8408,  8456,  8976,  9035,
+     9118,  9152,  9166,  9234,  9334,  9365,  9427,  9703,  9794,  9987,
+    10024, 10086, 10556, 10581, 10796, 10871, 10937, 10970, 11022, 11028,
+    11076, 11083, 11148, 11194, 11223, 11301, 11409, 11425, 11467, 11518,
+    11532, 11539, 11571, 11584, 11730, 11841, 11932, 11949, 12099, 12132,
+    12169, 12274, 12505, 12703, 13013, 13028, 13080, 13235, 13320, 13454,
+    13605, 13683, 13855, 13909, 14015, 14022, 14029, 14038, 14109, 14243,
+    14518, 14524, 14679, 14724, 14754, 14761, 14827, 14838, 14846, 14907,
+    15103, 15137, 15336, 15385, 15425, 15437, 15489, 15530, 15618, 15844,
+    15884, 15892, 15902, 14631, 14649,  7121,  5822, 15212, 15538,  2014,
+     8199,  6319,  7164,  3612, 13862,  7580, 14403, 15625, 15645,  1345,
+    14104,  1372, 14113, 12590,  9588, 14122,  6123, 11016, 14748,  7519,
+     7141,  7623,  8277, 15749,  7147, 14083, 14099, 10708, 10728, 10742,
+    10759, 10772, 10786, 10803, 10815, 10831, 10848, 10863,   778,  1072,
+     2352,  2383,  3647,  4048,  4549,  4579,  4587,  6206,  6656,  6998,
+     7007,  7729,  8358,  9350,  9807, 10037, 10169, 10527, 10562, 10878,
+    11558, 12377, 13891, 14575, 14975, 15346, 15373, 15574, 15719, 15836,
+     7247, 12597, 10886, 15405,  1090,  1121,  1149,  1182,  2418,  1208,
+     2447,  1232,  2468,  1259,  2492,  1285,  1316,  1340,  1367,  2519,
+     1394,  1420,  2545,  2567,  2593,  9451, 12158,  2136,  2280,  7334,
+     8484, 10436,  7341,  7357,  7372,  7387,  7403,  7423,  7438,  7458,
+     4205,  4662, 10075, 12907,  3379, 12695,  2906, 11798,   757, 12330,
+     5482, 13654,   346,  7909, 10453, 12964, 15591,  3394, 13481,  2598,
+    15779, 14730, 12338,  4249, 10714, 13263, 13643,  2426,  2617, 10901,
+     4251, 10716,  6056,  7471,  3575, 13787,  3199, 12346,  7737,  9132,
+     4789,  6815, 12353, 13138,  2922, 11806, 12359,  5522, 13812,  5806,
+    15201,  4982,  8328,  6338,  7478,  5099,  9247, 10987,  5926, 15862,
+     1586,  6930,   320,  7531,  3495, 10013, 13696,  2572, 15605,  3953,
+    14696,  2876, 11628, 10029, 10043, 10060, 14655,  1015,  4212,  1456,
+     5976, 14209,  3682, 13933,  4093, 15508,  6650, 15830,  3112, 12165,
+     1717,  7487,  3815,  5604,  6239,  6549,  7418,  7723,  7792,  8378,
+     9974, 10420, 10690, 10949, 12444, 12457, 12537, 12767, 13638, 13824,
+    14060, 14273, 14786, 14934,  9923, 15954,  2261, 10398,  8552,   624,
+    11636, 14004, 15171,  5791, 15183, 12366,  1703,  7328,  6438, 11527,
+     4026, 14961,  1522,  6725,  8471, 12859,   919, 15787,  7259, 10698,
+     7137, 10704, 10724, 10738, 10755, 10768, 10782, 10799, 10811, 10827,
+    10844, 10859,  8354, 10874, 15369, 10882, 15401,  2414,  2443,  2464,
+     2488,  2515,  2541,  2563,  2589,  2422,  2613, 10897,  2786, 11351,
+      772, 12371,  7414, 12453,  9362, 11568, 10910,  4222,  8954,  1264,
+     3007, 11983,  7586,  7856,  7967,  9930,  9960, 11874, 12398, 12604,
+    14409, 14493, 15312, 15961, 15631, 15651, 12380,  5209,  5223, 11172,
+    11181, 10633, 14482,  5235, 11228,   461,   714,  1769,  2177,  5868,
+     6301,  6482,  7112,  7565,  9716,  9997, 10094, 11956, 11978, 13469,
+    14336, 14991, 15194, 15584,  8503, 10505, 13511, 10512,  2696, 11102,
+     3027, 11995, 14278, 12194,  4827,  7174,  5656, 14530,  2154,  9982,
+     7700,  7951, 12384,  2099,  8444,  5851, 15471, 10144, 12086,  2576,
+    13575, 15609,   490, 11061, 10051, 10913, 12106, 12390,  5412, 12640,
+    14607, 12402, 13504,  3345, 12416,  3214, 12426, 12435,  7408, 12447,
+     6581, 14792, 15547,  3416,  4884,  4899,  5064,  5299,  5498,  5794,
+     7765,  7807, 10647, 10656, 11391, 13495, 13798, 15186, 15305,  5059,
+    10642,  5786, 15178,  7848, 13303, 13876, 15030,  5639, 14352, 10679,
+    13376, 15036,  2833, 11601,  7267,  9115,  5626, 14311,  4895,  7803,
+     4775,  6772, 10652,  6780,  3409, 13488,  2475,  3775, 11829, 14172,
+     7917,  7935,  4230, 12173,  5908, 15841,  5548, 13851,  4880,  7761,
+     9279, 11119,   208,  6791,  1033,  4237,  5494, 13794,  4561, 11575,
+     5049,  5468, 10621, 13587,  3264,  7066,  8221, 12544,  7975,  9147,
+     8541,   957,  4594,  6600,  8531, 11547, 11913, 12412, 12579, 13969,
+    14387, 14853, 14878,  6983,   788, 12460,  2065,  8264,  8273, 12467,
+     5392,  9477, 12477, 15063,  4183, 15875, 12485, 12491,  5370, 11813,
+     6879,  9277, 11117, 10868, 13906, 14012,  4146, 15797,  3231, 12499,
+     2956, 11883,  3411, 13490,   906, 15107, 15113,    88, 15132, 15231,
+    15252, 12507, 13152,  9820, 15598,  8888, 15266,  3450, 13594,   222,
+     6798, 14546,  9213, 10588,  3609, 13859,  7521,  9971, 10417,  3615,
+    13865,  6221, 14705, 12317,  8209,  1975,  8149,  9702, 14845,  6655,
+     9806, 15573, 15835,  1768,  7564,  2575, 15608,   489, 11060,  4145,
+    15796,  9594, 14128, 10661, 12991,  5462, 13581,  3247, 12512,  3023,
+    11991, 11465, 15295, 12517, 13165, 12525,  3260,  7062,  8217, 12540,
+     6744, 12056,  6495, 12548, 12554,  3276,  3304,  3332, 12567, 11318,
+    12583, 12608,  1096,  1654,  7213,   802, 12615, 12626, 13181,   845,
+    13729,  5405, 12633,  5423, 12646,  9746, 15224,  2451, 11291,  2766,
+    11296,  5263, 11361, 13248, 13629,   743, 12182,  3885,  5986,  8989,
+    14584,  2133,  8481,  9196, 10497,   564, 11257,  9438, 12121,  6545,
+    13820, 12658, 11513, 11072, 13009,  6511, 12662,  3956,  3978,  5689,
+    14699, 14774, 14870,  3568, 13780,  3712, 14133,  7395, 12270, 15433,
+     7702,  7953,  4246, 10711,  4259,  4270,  4287,  4304,  4330,  4351,
+     4369,  4388,  4406,  4425,  4447,  4464,  4481,  3733, 14146,  4318,
+     8312, 12191,  3319,  7596,  3128, 12202,  3146, 12212,  3750, 14155,
+     5478, 13650,  5864, 15580,  6007,  7350,  6016,  6032,  6049,  6065,
+     6085,  6101,  6116,  6135,  6152,  6171,  6194,  6213,  2748, 12223,
+     1050,  4499,  4507,  4576,  1087,  1118,  1146,  1179,  1205,  1229,
+     1256,  1282,  1313,  1337,  1364,  1391,  1417,  7697,  7948,  4063,
+    15048,  3767, 14164,  2082,  8405, 11145, 13025,  7364,  7603, 15354,
+     7611,  3165, 12234,  3182, 12243, 11202,  2711,  2739,   251,  6943,
+    15518,  3363, 12666,  2634, 10920,  2032,  8227,  7016, 12784,  8869,
+    10427, 10163,  3590, 13840, 11211, 12671, 12674, 14850, 12682, 12687,
+      197,   304,   672,   686,   848,  1801,  1963,  2403,  2477,  2755,
+     2894,  3153,  3436,  3536,  3556,  3684,  3700,  3755,  3777,  3795,
+     4065,  4256,  4385,  4913,  5323,  5765,  6768,  7253,  7276,  7671,
+     7875,  7897,  8071,  8080,  9454,  9495,  9595,  9611,  9915, 10601,
+    10721, 10779, 11475, 11673, 11686, 11742, 11758, 11823, 11831, 11965,
+    12031, 12161, 12198, 12219, 12230, 12258, 12364, 12718, 12882, 13095,
+    13204, 13445, 13533, 13721, 13732, 13776, 13935, 13984, 14129, 14160,
+    14174, 14184, 14222, 15006, 15020, 15050, 15076,  7919,  7937,  3511,
+    13704,  3677, 13928,  5041, 10613,  3078, 12038,  3769, 14166,  1290,
+    13939,  1698,  7323, 13199, 13440,  3789, 14178,  3551, 13771,   859,
+    14188, 14197,  3530, 13715,   843, 13727, 12050, 12067, 12082, 13333,
+    14066, 15456, 14072, 14089,  1605,  6950,  8035,  1189,  1877,  8000,
+    15072,  6406, 10625,  4538,  4687,   761, 12334, 13958, 12255,  7143,
+     3831, 14322,  9682, 14712,  7831, 10762,  7837,  9765, 15497,  9518,
+    13617,  7291,  1155,  7880,  2225, 10378,  6094,  6109,  9906,  9947,
+     9953,   922, 15790,  3448, 13592,  9229, 10965,  3467, 13676,  9668,
+    14392,  9913, 12880,   725, 12139, 15004,  1623,  6960,  9836, 15676,
+      486, 11057, 13246, 13627,  3883, 14582, 11070, 13007,  4863,  7749,
+     8121,  1638,  6967,  2049,  8236,  1240, 11439,  3376, 12692,  4495,
+     4778,  5885,  6775, 13962, 15669, 15686,  7960,  1474,  5993, 15009,
+     6316,  7161,  5408, 12636,  5762, 15017,  9643,  9732, 14347, 15000,
+     4079,  4232, 15056, 13635, 12149,  4442, 14504,  9833, 15673,   893,
+    15082, 12175,  2429,  2620, 10904,  6973, 12521, 13169, 12529,  5247,
+    11304,  4476, 15088,  9686, 14716,  7861,  4908,  7870, 14398, 10662,
+    12992,  3661, 13897,  5659, 14533, 10048,  5463, 13582, 14414, 12700,
+    13966,  3935, 14686,  7863,  4910,  7872,   610,   862,  3248,  9561,
+    11562, 12513, 13974, 14191, 14200,  3024, 11992,  3772, 14169,  2062,
+     8261,  8270,  1153,  7878, 14400,  7893, 10775,  7900,  5440,  5773,
+    12705, 15023,  1459,  1593,  1931,  1998,  2084,  2158,  3099,  3115,
+     3236,  4365,  5032,  5551,  5575,  5910,  5979,  6937,  7316,  7466,
+     8030,  8191,  8407,  9333,  9364,  9986, 10085, 10580, 10870, 11075,
+    11147, 11466, 11538, 11570, 11931, 12131, 12168, 12504, 13012, 13027,
+    13854, 13908, 14014, 14021, 14678, 15843, 15901,  2013,  8198, 14402,
+     4586, 15345,  9450, 12157,   345,  7908, 13262, 13642,  3111, 12164,
+     9361, 11567, 10632,   460, 10093, 14335, 10912, 12105,  5063, 10646,
+    10655,  5058, 10641, 13302, 13875, 15029, 13375, 15035, 10651,  7916,
+     7934, 12172,  4879,  7760,  5493, 13793,  4560, 11574,  3263,  7065,
+     8220, 12543,  8530, 12411, 12578, 10660, 12990,   742, 12181,  4317,
+     8311, 12190,  3127, 12201,  3145, 12211,  5477, 13649,  2747, 12222,
+     7696,  7947,  4062, 15047,  2081,  8404,  3164, 12233,  3181, 12242,
+     7959,  5550,  7315, 13853,  2241, 10386,  8932,  8949,  8964,  8981,
+     8995,  9010,  9026,  9040,  9058,  9074,  9091,  9107,  9123,  9139,
+     9157,  9171,  9188,  9204,  9220,  9239,  9255,  9269,  9288,  9300,
+     9313,  9325,  9339,  9356,  9370,  9388,  9402,  9415,  9432,  9445,
+     9459,  9473,  9488,  9500,  9513,  9530,  9544,  9556,  9568,  9582,
+     9600,  9616,  9631,  9649,  9663,  9676,  9693,  9708,  9722,  9738,
+     9755,  9771,  9784,  9799,  9813,  9828,  9845,  9859,  9873,  9891,
+     7972,  9144,  8918,  9655, 14368,  9641, 14345,  2121,  5827,  8345,
+     8398,  8467, 15217, 15296,  1018,  4215,  5450, 12710,  1852,  7983,
+     6456, 11587,  5536, 13832, 11079,  1186,  1874,  7997,  5643, 14356,
+    11312, 11326,  6023,  6690, 13282, 13664,  3807, 14265, 12518, 13166,
+    12526,  6184, 10152, 14448, 14462,  6618, 15565,  8494,  9521, 13620,
+     3219, 12431,  7895, 10777, 12253,  9763, 15495,   458, 10091,  3261,
+     7063,  8218, 12541,  4060, 15045,  2975,  7902, 11901,  9880, 15921,
+     4224,  8956,  4130, 15768, 13277, 13659,  2150,  9978,  3463, 13672,
+     2170,  9990,  3485, 13686,  2189, 10001,  6745, 12057,  6496, 12549,
+    12555,  3277,  3305,  3333, 12568, 11319, 12584,  3508, 13701,  3527,
+    13712,   840, 13724,  4076, 15053, 13735, 12609,  7155,   581,  1298,
+     1543,  2977,  6809,  7654,  7833,  7904, 10104, 10734, 10764, 11446,
+    11451, 11903, 12929, 13947,  7839,  1097,  1655,  7214,  2829, 11597,
+    15151,  3695, 13979,  9464, 12261,  2242, 10387,  5395,  9480, 12480,
+     5426, 12649,  2398, 10596,  9492, 12715,  6981, 11340, 13058,  1890,
+     8005,  5518, 13808,  4492,  5882, 15666, 15683,  2940, 11848,  1625,
+     6962, 12563,  3285,  3313,  3341,  4417, 13987, 11472, 13300, 13873,
+     7002,   809, 12622, 10853, 11937,   829, 12729,   820, 12720,   803,
+    12616,   410,  8289,  7011, 12779,   826, 12726,  2719,  2849, 11609,
+     5614, 14286,   537, 11239, 12627, 13182,  7412, 12451,  7393, 12268,
+    15431,  2299, 10463,  1861,  7992,  9380, 11664,  6479, 11975,  6563,
+    14422, 14428,  6177, 14441, 14455,  4436, 14498, 14475, 14509, 11333,
+      397,  8255, 15299,  4095, 15510,  9307,  9625, 11287, 14229, 12152,
+    14375,  5073, 10669, 14384,   745, 12184,  6995,   846, 13730,  5406,
+    12634,  5424, 12647,  9747, 15225,  9467, 12264,  4459, 14798,  6461,
+    11592,  2868, 11620,  6652, 15832,  4180, 15872,   444, 10022,  2452,
+    11292,  2767, 11297,  5264, 11362,  1909,  8016,  1266,  3009, 11985,
+    12277,  9882, 15923, 13435, 15848,  7627,  7929,  7942,  3998, 14899,
+     7428, 12732, 15442, 12740, 12753, 12770, 12791, 12807, 12821, 12836,
+    12850, 12868, 12884, 12897, 12914, 12932, 12948, 12968, 12981, 12998,
+    13015, 13030, 13049, 13064, 13082, 13097, 13115, 13130, 13144, 13157,
+    13173, 13188, 13206, 13220, 13237, 13253, 13268, 13289, 13307, 13322,
+    13336, 13351, 13366, 13384, 13397, 13410, 13425, 13201, 13442, 13196,
+    13437, 10101, 12926,  3471, 13680, 14521, 13447, 12386,   520, 11138,
+    13214, 13456, 13462,  4398, 13472, 11026, 13318, 14027,  3392, 13479,
+     5789, 15181,  3407, 13486, 13498, 13515,  3427, 13524,  9504, 13535,
+     3791, 14180,  2803, 11430, 13541, 13762,  2101,  2301,  8446, 10465,
+    13265, 13645, 14212,  6072,  7494,  8933,  8950,  8965,  8982,  8996,
+     9011,  9027,  9041,  9059,  9075,  9092,  9108,  9124,  9140,  9158,
+     9172,  9189,  9205,  9221,  9240,  9256,  9270,  9289,  9301,  9314,
+     9326,  9340,  9357,  9371,  9389,  9403,  9416,  9433,  9446,  9460,
+     9474,  9489,  9501,  9514,  9531,  9545,  9557,  9569,  9583,  9601,
+     9617,  9632,  9650,  9664,  9677,  9694,  9709,  9723,  9739,  9756,
+     9772,  9785,  9800,  9814,  9829,  9846,  9860,  9874,  9892,  4148,
+    15799,  5674, 13249, 13630, 14818,  5466, 13585,  7973,  9145,  6525,
+    13545, 13551,  7205,  9099,  2495, 13556, 13567,  5460, 13579,  3446,
+    13590,  5752, 14948,  4525,  8919, 12749, 14663,  3233, 12501, 13573,
+    13228, 13598,  9656, 14369, 13607, 13612,  1697,  7322,  9517, 13616,
+    13245, 13626,  9642,  9731, 14346, 14999, 13634,  4441, 14503,   892,
+    15081,  2428,  2619, 10903, 10047, 13261, 13641,  5476, 13648,  5642,
+    14355,  9879, 15920, 13276, 13658,  3462, 13671,  3484, 13685,  3507,
+    13700,  3526, 13711,   839, 13723, 13734, 13572,  9534, 13743, 13750,
+     3492, 13693,  2873, 11625, 14206,  3829, 14320,  8091, 13754, 13758,
+     8432, 13381, 15041, 13500,  8104,  8281,  3546, 13766,  3566, 13778,
+     5285, 11382,  5126, 11034,   683, 11820,  5491, 13791, 10942,  2649,
+    10927,  5506, 13801,  5839, 15287,  4882,  7763,  5517, 13807,  4530,
+     4674,  4536,  4685,  4343, 11691,  8490,  1914,  2958,  8021, 11885,
+    12283,  6541, 13816,  3095, 12127, 14674, 11854, 13108,  2335, 10488,
+     5531, 13827,   363,  1863,  2035,  2122,  3322,  3597,  4099,  4209,
+     4403,  4666,  5196,  5287,  5361,  5510,  5812,  5828,  6756,  7599,
+     7994,  8136,  8230,  8346,  8366,  8399,  8468,  9183, 10120, 10180,
+    11164, 11384, 11707, 11751, 12075, 12489, 12834, 12946, 13477, 13805,
+    13847, 15207, 15218, 15514, 12320,  4029, 14964,   374,  8162, 15297,
+     2871, 11623, 10070,    11,   120,   168,   182,   290,  4226,  4421,
+     5128,  5853,  5949,  5956,  6145,  6342,  7230,  7482,  8958,  9576,
+    11036, 11714, 13991, 14050, 15473, 15755, 14330, 15238, 14257,  1959,
+     8067,  1732,  7505,  5179, 11152,  9281,  9838, 11121, 15678,  6865,
+     9018, 11342, 13060, 10974,  1019,  4216, 12471,  1066,  4543, 13517,
+     9535, 13744,  4753,  6735, 15191,  3587, 13837,  9606, 14217,  5966,
+     8971,  5451,  7366,  7605, 10146, 12088, 12711, 15356,  7613,  1853,
+     7984,  2782, 11347,  6246,  6256,  6270,  6289,  6308,  6330,  6349,
+     6366,  6383,  6399,  6416,  6430,  6449,  6469,  6489,  6505,  6519,
+     6535,  6556,  6572,  6589,  6608,  6627,  6642,  9178, 10175,  3429,
+    13526,  5713, 10935, 14905, 10011,  3680, 13931,  2259, 10396,  1701,
+     7326,  9714, 14989,  5546, 13849,  3607, 13857, 10940,   473, 10546,
+    13297, 13870,  1525,  6728, 10636,  5260, 11358,  9728, 14996,  3187,
+    12248, 15245,  7024,  9045,  9622, 14226,  4728,  6229, 13361, 14859,
+     7035,  7042,  7054,  7071,  7083,   265,  7095,  8075,  1539,  6805,
+     6680, 14292,  5018, 10553,  1859,  7990,  4518,  8474, 12862,  4566,
+    11580, 13751,  1130,  1752,  7556,  4553,  4262,  4273,  4290,  4307,
+     4333,  4354,  4372,  4391,  4409,  4428,  4450,  4467,  4484, 14741,
+     6457, 11588,  5537, 13833,  4199,  8941, 11080,  6077,  7499,  4383,
+    11963,  1187,  1875,  7998,    21,   254,   475,  3515,  5644,  6946,
+     7050,  8123,  8437, 10135, 10548, 13708, 14357, 14667,  8511, 11313,
+    11327,  3167, 12236,  9866, 15907,  3628, 13880,  5653, 14527, 10407,
+     2017,  8202, 10414,  8866, 10424,   440, 10018,  3643, 13887, 10945,
+     3736, 14149,  2278, 10434,  3573, 13785, 10027, 10041, 10058, 14653,
+     2473, 11827,  3976, 14772,  7625,  7927,  7940,  8102,  8279,  1102,
+     1660,  6024,  6691,  7219, 13283, 13665,  3808, 14266,  3658, 13894,
+     7196,  9083,  1927,  8026, 10865, 13903,  5939, 15888,   594, 11492,
+     3132, 12206,  6157, 13911,  1839,  7826, 12519, 13167, 12527,   495,
+     2503,  5929,  9382, 11066, 11666, 13564, 15865,  4573,  1084,  1115,
+     1143,  1176,  1202,  1226,  1253,  1279,  1310,  1334,  1361,  1388,
+     1414,  6185, 10153, 14449, 14463,  4111, 15615, 15622, 15642, 10790,
+    11217, 11418, 14541,   974,  6619,  6663,  7238, 11485, 12495, 14804,
+    15566,  8495, 12594, 11266,  7513,  3433, 13530,  1895,  8010,  9522,
+    13621, 14435,    97,   112,   996,   125,   144,  1009,  1027,  1044,
+     1060,  1078,  1109,  1137,  1170,  1196,  1220,  1247,  1273,  1304,
+     1328,  1355,  1382,  1408,  1434,   159,   173,  1448,  1465,  1482,
+     1495,  1509,   187,   201,   215,  1532,  1549,  1563,   229,  1578,
+      243,  1599,  1617,  1632,   259,  1646,   278,   295,  1667,  1689,
+     1710,  1725,   308,  1741,  1759,  1775,   326,  1790,  1806,  1824,
+      339,  1846,  1868,  1884,  1903,  1921,  1937,  1952,   354,  1968,
+      367,  1989,  2004,  2025,  2040,   388,  2056,   404,  2073,  2090,
+      418,  2107,  2127,  2144,  2164,  2183,   434,   450,  2201,  2219,
+     2235,  2253,  2272,  2288,  2307,  2325,  2343,  2358,   466,  2374,
+     2389,  2408,  2437,  2458,  2482,  2509,  2535,  2557,  2583,  2607,
+     2628,  2643,  2659,   480,   500,  2675,  2689,   512,  2704,  2732,
+      527,   543,   557,  2760,  2776,  2795,   573,   586,  2810,   604,
+     2823,  2843,  2862,   616,   630,   648,  2884,   662,  2899,  2915,
+      676,  2930,  2946,   690,  2965,  2983,   704,  3000,  3016,  3034,
+     3049,  3068,  3088,   719,  3105,   736,  3121,  3139,  3158,  3175,
+      752,  3194,   767,  3209,   783,  3226,  3242,  3255,  3271,  3299,
+     3327,   797,  3358,  3371,   815,  3387,  3402,  3422,  3441,  3457,
+     3479,  3502,  3521,   834,  3541,  3561,  3582,  3602,  3623,  3638,
+     3653,  3670,  3689,  3705,  3726,  3743,  3760,  3782,   852,  3800,
+     3821,  3838,  3852,  3874,  3891,  3908,  3925,  3943,  3962,  3984,
+     4004,  4018,  4038,   868,  4054,  4070,   884,   899,  4086,  4104,
+     4119,   912,  4138,  4155,  4171,  7619, 14079,  9897, 15945,  3553,
+    13773,  9395, 11720,  3041, 12001,  1676,  7300,  4346,  6358,  8085,
+    11694,  9421, 11835,  9548, 13921,  2937, 11845, 14728,  5924, 15860,
+     3493, 13694,  2874, 11626, 14207, 15061,  9592, 14126,  3698, 13982,
+     3675, 13926,  1288, 13937,  1238, 11437,   890, 15079,  9506, 13537,
+     6296,  7107,  7718,  8373,  7770, 10746,  7780,  7116, 11909, 11275,
+    13040,  7129, 10836, 11920,  7152,  8508,  1157,  7882,  3593, 13843,
+     4253, 10718,  5559, 13950,  4583, 15342,  2266,  3220,  8212, 10403,
+    12432,  5601, 14057, 10892, 15411, 15121,  7244, 15128, 15141,  1978,
+     8152,  5083, 10953, 14783, 12395,  6885,  9032, 12325, 10160,  4591,
+     2396, 10594,  6039,  6892,  7382,  8386, 13234, 13604, 15384, 12589,
+    15748, 14098,  4788,  6814,  6481, 11977,  9195, 10496,   303,  7275,
+     7896, 10778, 11741, 12197, 13094,  8034,   760, 12333, 13957, 12254,
+     3830, 14321,  9764, 15496,  6093,  6108,  9905,  9946,  9952,  2048,
+     8235, 13961,  6315,  7160,  4475, 15087, 13965,  9560, 13973,  5031,
+    10579,   459, 10092, 12104,  3262,  7064,  8219, 12542,  4061, 15046,
+     7314,  8931,  8948,  8963,  8980,  8994,  9009,  9025,  9039,  9057,
+     9073,  9090,  9106,  9122,  9138,  9156,  9170,  9187,  9203,  9219,
+     9238,  9254,  9268,  9287,  9299,  9312,  9324,  9338,  9355,  9369,
+     9387,  9401,  9414,  9431,  9444,  9458,  9472,  9487,  9499,  9512,
+     9529,  9543,  9555,  9567,  9581,  9599,  9615,  9630,  9648,  9662,
+     9675,  9692,  9707,  9721,  9737,  9754,  9770,  9783,  9798,  9812,
+     9827,  9844,  9858,  9872,  9890,  9640, 14344,  2976,  7903, 11902,
+     3694, 13978,  4416, 13986, 13299, 13872,  9306, 11286,   744, 12183,
+     9881, 15922, 11853, 13107, 10069,  4225,  6341,  7481,  8957, 14329,
+     3186, 12247, 14666,  3975, 14771,  3131, 12205,  6357,  8084,  7151,
+      154,   983,  8892, 15270,  9851, 15724,  2499, 13560,  4131, 15769,
+     9261, 11041, 11863,  5267,  5431, 11365, 12654,  6409, 10628, 13278,
+    13660,  2151,  9979,  3464, 13673,  2171,  9991,  3486, 13687,  5113,
+    11002,  2190, 10002,  6746, 12058, 14628,  6497,  6527, 12550, 13547,
+    12556,  3278,  3306,  3334, 12569, 11320,  3862, 14559, 12585, 14646,
+     2953, 11880,  3509, 13702,  3549, 13769,  3528, 13713,   841, 13725,
+     4077, 15054,   535, 11237, 13736,  3413, 13492,   699, 11893, 12356,
+    13141, 13553,  1440,  4599, 15276, 13393, 15093,  5836, 15284,  7257,
+     4825,  7172,  2097,  8442,  6835,  8092,  5138, 11048,  7179,  9063,
+    13994,  4802,  6827,  4322,  8316, 14001, 12610,  6374,  8176,   349,
+     6058,  7156,  7473,  7912,  8477, 10682, 12865,  6991, 14008,   155,
+      582,   908,   984,  1104,  1299,  1377,  1527,  1544,  1662,  1736,
+     2432,  2578,  2623,  2838,  2879,  2925,  2978,  3577,  3886,  3903,
+     3938,  4301,  4938,  5987,  6026,  6693,  6709,  6730,  6810,  6837,
+     7185,  7221,  7509,  7588,  7655,  7776,  7834,  7858,  7905,  7969,
+     8094,  8145,  8185,  8990,  9069,  9508,  9823,  9932,  9962, 10105,
+    10638, 10735, 10752, 10765, 10824, 10841, 10907, 11447, 11452, 11606,
+    11631, 11783, 11809, 11859, 11876, 11904, 11925, 12400, 12606, 12930,
+    13113, 13423, 13539, 13577, 13789, 13948, 14118, 14306, 14411, 14495,
+    14585, 14594, 14611, 14689, 15109, 15155, 15249, 15263, 15314, 15601,
+    15611, 15704, 15963, 15143, 15711, 14603,  7840, 15633, 15653,    42,
+      134,  1098,  1656,  7215,  2830, 11598, 15152,  7786, 15291,   377,
+     8165, 15657, 10064, 15317, 15327, 15339, 15350, 15361, 15377, 15388,
+    15398, 15416, 15428, 15440, 15451,   568, 11261,  3717, 14138,   315,
+     7526,  1589,  6933, 15751,  5571, 14017, 13315, 14024,   655, 11653,
+     5583, 14031,  8893, 15271,   379,  8167,  3349,  5140, 11050, 12420,
+     1319, 14040,  2115,  8461,  9572, 14046,  5597, 14053, 13330, 14063,
+    15453, 14069, 14086,  4868,  7754,  1343, 14102,  1370, 14111,  9586,
+    14120, 14480,  3710, 14131,  3731, 14144,  3748, 14153,  3765, 14162,
+     3787, 14176,   857, 14186, 14195,  5359, 11749,  9604, 14215,  9620,
+    14224,  3696, 13980, 11857, 13111,  7443, 14232, 14245,   237,  3202,
+     6923, 10519, 12349, 14250,  9852, 15725,  6298,  7109,  9331, 11536,
+      492,  2500, 11063, 13561, 13285, 13667,  3810, 14268, 11704,  5382,
+    12309,  3805, 14263,  9465, 12262,  4935,  8142, 12288,  1640,  4132,
+     6969, 15770,  2243, 10388,  7182,  9066,  2134,  8482, 14276,  5612,
+    14284, 14290,  3184, 12245,   697, 11891,  4282,  7537,  9197,  9262,
+    10498, 11042, 14297,  6786,  7133, 11864,  4979,  8325,  5623, 14308,
+      565, 11258,  1980,  8154,  4605,  4697,  5192, 11160,   642, 11647,
+     3826, 14317,  4813,  6914,  5685, 14866,  4614,  4711,   730, 12144,
+     1424, 15460,  5702, 14887,  5396,  9481, 10053, 10915, 11772, 12108,
+    12481, 13997, 15115,  4624,  4634,  4646,  4657,  4669,  4680,  4692,
+     4706,  4721,  4733,  4746,  4759,  4769,  4782,  4795,  4807,  4820,
+     4832,  4846,  4857,  4873,  4888,  4903,  4916,  4927,  4941,  4952,
+     4962,  4973,  4987,  5002,  5012,  5024,  5036,  5053,  5068,  5078,
+     5091,  5105,  5118,  5132,  5147,  5158,  5173,  5186,  5199,  5214,
+     5228,  5242,  5255,  5272,  5290,  5303,  5315,  5326,  5337,  5350,
+     5364,  5376,  5388,  5401,  5419,  5436,  5446,  5456,  5472,  5487,
+     5502,  5513,  5527,  5542,  5555,  5567,  5579,  5593,  5608,  5619,
+     5633,  5648,  5667,  5679,  5693,  5706,  5718,  5732,  5744,  5757,
+     5768,  5779,  5798,  5815,  5831,  5843,  5857,  5872,  5889,  5902,
+     5914,  5933,  5427, 12650, 14326,  2399, 10597,  9635, 14339,  7735,
+     9130,  5637, 14350,  7265,  9113,  9211, 10586,  3843, 14360,  5087,
+     5268,  5415,  5432,  5442,  5663,  5775,  5898,  9439,  9749, 10957,
+    11366, 12122, 12292, 12643, 12655, 12707, 14537, 15025, 15227, 15825,
+      949, 15322,  7445, 14234,  9653, 14366,  6546,  7720,  7789,  8375,
+    12534, 13821,  7583,  7853,  7964,  9927,  9957, 11871, 12601, 14406,
+    14490, 15309, 15958, 15628, 15648,  7028,  9049,  9225, 10961,  9493,
+    12716, 14373, 14382,  6597, 14875,   165,  5946,   179,  5953,  6982,
+     5262, 11360,  7252,  9667, 14391, 14397,  3660, 13896, 14413,  1997,
+     2157,  4364,  8190,  9985, 11930,  2012,  8197, 11471,  6562, 14421,
+    14427,  6176, 14440, 14454,  4435, 14497, 14474, 14508, 11332,  3470,
+    13679, 14520,  9730, 14998, 11341, 13059, 10973,  5652, 14526, 14540,
+     5358, 11748,   236,  3201,  6922, 10518, 12348,  7181,  9065, 13996,
+    14550,    26,    80,   933,   943,  5960,  6635,  6674,  6850,  7079,
+     7091,  7188,  7198,  7207,  7543,  7632,  7797,  8042,  8334,  8416,
+     8516,  9004,  9085,  9101, 10442, 10605, 10674, 10980, 11086, 11370,
+    12008, 12296, 12659, 12689, 13609, 13755, 14247, 14551, 15731, 15740,
+    15895,  3857, 14554,  6199, 14568,  3879, 14578,  3896, 14587, 14596,
+     3913, 14613, 14622, 14641, 14660,  3930, 14681,  8339,  3948, 14691,
+     8350, 15365,  5848, 15468,  8520,  8046, 12300, 13759,  1610,  4997,
+     6955,  9940,  1891,  8006,    90, 11191, 11422, 13451, 14835, 15134,
+    15486,  5519, 13809,  5096,  9244, 10984,  6218, 14702, 10889, 15408,
+    15258, 11514,  8363, 12831,  4196,  8938,  7715,  8370,  7379,  8383,
+    15381, 15745, 14095, 13466,  7772, 10748,  7782,  9680, 14710,  4493,
+     5883, 15667, 15684,  1929,  8028, 11073, 13010,  8528,  5964,  8969,
+     6244,  6254,  6268,  6287,  6306,  6328,  6347,  6364,  6381,  6397,
+     6414,  6428,  6447,  6467,  6487,  6503,  6517,  6533,  6554,  6570,
+     6587,  6606,  6625,  6640,  6661, 15691, 14514, 14720,  1454,  5974,
+     3813, 14271,  6754, 12073, 14726, 14735,  2722,  2852, 11612,  6512,
+    12663,  7004,  8536,  8545, 14756,  3967, 14763, 14777,  6578, 14789,
+     4457, 14796, 14802,    17,    27,    31,    53,    71,    76,    81,
+      811,   929,   934,   939,   944,  2051,  2654,  2941,  3189,  3618,
+     3957,  3979,  4166,  4611,  4703,  4804,  5312,  5385,  5690,  5961,
+     6264,  6410,  6636,  6670,  6675,  6822,  6829,  6851,  7080,  7092,
+     7189,  7199,  7208,  7544,  7548,  7592,  7633,  7637,  7798,  8043,
+     8051,  8238,  8335,  8391,  8412,  8417,  8421,  8433,  8517,  8525,
+     8562,  8881,  9005,  9086,  9102, 10140, 10194, 10443, 10574, 10606,
+    10610, 10629, 10675, 10695, 10932, 10981, 11087, 11198, 11371, 11399,
+    11849, 11969, 12009, 12013, 12136, 12250, 12297, 12305, 12312, 12369,
+    12382, 12624, 12660, 12680, 12685, 12690, 13543, 13610, 13614, 13756,
+    13764, 13868, 14248, 14552, 14700, 14775, 14871, 15166, 15732, 15736,
+    15741, 15760, 15805, 15818, 15852, 15896,  3858, 14555,  3971, 14767,
+     6200, 14569,  3880, 14579,  3897, 14588, 14597,  3914, 14614, 14623,
+    14642, 13279, 13661,  2152,  9980,  3465, 13674, 14661,  3931, 14682,
+     8340,  3949, 14692,  2172,  9992,  8570, 10198,  8580, 10204,  8590,
+    10210,  8601, 10217,  8612, 10224,  8623, 10231,  8633, 10237,  8643,
+    10243,  8653, 10249,  8663, 10255,  8673, 10261,  8683, 10267,  8693,
+    10273,  8703, 10279,  8713, 10285,  8723, 10291,  8734, 10298,  8745,
+    10305,  8756, 10312,  8767, 10319,  8778, 10326,  8788, 10332,  8798,
+    10338,  8808, 10344,  8818, 10350,  8828, 10356,  8838, 10362,  8848,
+    10368,  3487, 13688,  8351, 15366,  5849, 15469,  8858, 10374,  8521,
+     8047, 12301, 13760,   334,  1322,  1611,  1626,  4842,  4853,  4998,
+     5114,  5251,  6956,  6963,  7284,  7642,  7744,  9409,  9941, 11003,
+    11308, 11793, 12564, 14043, 15809,  3569, 13781,  3713, 14134,  1892,
+     8007,  3286,  3314,  3342, 13344, 14808,  7396, 12271, 15434,  7118,
+     5671, 14815, 14822, 14829,  7703,  7954,  2191, 10003,  9697, 14840,
+    10993,  1126,  1748,  7552,  2972, 11898,    91,  6908, 11192, 11423,
+    13452, 14836, 15135, 15487,  4247, 10712,  5520, 13810,  5097,  9245,
+    10985, 11911,  6219, 14703, 14848, 13379, 15039,  5508,  5810,  9181,
+    10178, 13803, 15205, 13359, 14857,  4260,  4271,  4288,  4305,  4331,
+     4352,  4370,  4389,  4407,  4426,  4448,  4465,  4482,  3734, 14147,
+    10890, 15409,  5683, 14864,  6595, 14873,  4164, 15816, 15259,  4531,
+     4675,  5697, 14882,  8902, 15477,  8557,  8565,  8575,  8585,  8596,
+     8607,  8618,  8628,  8638,  8648,  8658,  8668,  8678,  8688,  8698,
+     8708,  8718,  8729,  8740,  8751,  8762,  8773,  8783,  8793,  8803,
+     8813,  8823,  8833,  8843,  8853,  8862,  8876,  8884,  8898,  8906,
+    13230, 13600, 14636,  7448, 14237,  4319,  8313,  3664,  6747,  8426,
+    10855, 11939, 12059, 12847, 13900,  8114, 15233, 15254,  3989, 14890,
+     4127, 15765,  5710, 14902, 11515,  5722, 14909,  2522, 14918,  2315,
+    10476, 14629, 12192, 11511,  3320,  7597,  8364, 12832,  4197,  8939,
+     5922, 15858,  7716,  8371,  7380,  8384, 15382, 15746, 14096, 10067,
+     3129, 12203,  7149,  2497, 13558, 15247, 15261,  3147, 12213,  6498,
+     6528,  6565, 12551, 13548, 14424, 14430, 12557,  3279,  3307,  3335,
+     6179, 14443, 14457, 12570,  4438, 14500, 14477, 14511, 11321, 11335,
+     2227, 10380, 14928,  7660, 12802, 14470,  3863, 14560,  5983,  8986,
+     4418, 13988, 12392, 12586,  5736, 14937,  5748, 14944,  8915,  5205,
+    11168, 11473,  3933, 14684, 11543,  4009, 14952,  4023, 14958,   399,
+     8257, 10079, 10533, 11270, 11281, 12911, 13046, 13348, 14812,  8037,
+     3751, 14156,   965, 15333,  5479, 13651,  5865, 15581,  6008,  7351,
+     6017,  6033,  6050,  6066,  6086,  6102,  6117,  4555,  6136,  6153,
+     6172,  6195,  6214,  4264,  4275,  4292,  4309,  4335,  4356,  4374,
+     4393,  4411,  4430,  4452,  4469,  4486,  9790, 15526, 15534,  2749,
+    12224,  1051,  4500,  4508,  4043, 14970,  1471,  5990, 11277, 13042,
+      873, 14978,  8342, 14647,  4577,  1088,  1119,  1147,  1180,  1206,
+     1230,  1257,  1283,  1314,  1338,  1365,  1392,  1418, 13467,  7698,
+     7949,  8539,  2954, 11881,  9712, 14987,  9726, 14994,  7131,  7026,
+     9047, 10838, 11922,  1488,  3845,  5168,  5999, 11131, 14362,  3061,
+    12022,  3056, 12017,  2992, 11946,  6004,  7347,  6013,  6029,  6046,
+     6062,  6082,  6098,  6113,  6132,  6149,  6168,  6191,  6210, 15301,
+     5220, 11178,  7773, 10749,  7783, 15590,   685,  4064, 11822, 15049,
+     3510, 13703,  3768, 14165,  3550, 13770,  3529, 13714,   842, 13726,
+    15071,  4537,  4686,  9681, 14711, 15003,  4494,  5884, 15668, 15685,
+    15008,  5761, 15016,  4078, 15055,   861, 14190, 14199,  5772, 15022,
+     1930,  2083,  3114,  8029,  8406, 11074, 11146, 12167, 13011, 13026,
+    13301, 13874, 15028, 13374, 15034,  8529,  5826, 15216,  6617, 15564,
+     8493,  4059, 15044,  4075, 15052,  7154,   536, 11238,  9624, 14228,
+      443, 10021,  5965,  8970,  7365,  7604, 15355,  7612,  6245,  6255,
+     6269,  6288,  6307,  6329,  6348,  6365,  6382,  6398,  6415,  6429,
+     6448,  6468,  6488,  6504,  6518,  6534,  6555,  6571,  6588,  6607,
+     6626,  6641,  8510,  3166, 12235,  6662, 15060,   889, 15078,  2047,
+     8234,  4474, 15086, 13392, 15092,  3902, 14593, 14602,  3183, 12244,
+     5086,  5414,  5897, 10956, 12642, 15824,  7003,   810, 12623,  4841,
+     7283, 10854, 11938,  3901, 14592, 14601,   879, 14984, 15521, 11203,
+     2712,  2740,  1397, 15097, 13737, 15717,  3414, 13493,   904, 15105,
+    15111,  2264, 10401, 15119, 15126, 15139, 15157, 11456,   990,  2529,
+     3082,  4642, 12042, 14925, 15542,  4726,  6227,   252,  6944, 14780,
+      239,   700,   732,   830,   880,  2699,  3204,  4533,  4677,  4730,
+     4766,  5211,  5225,  5334,  5741,  5754,  6231,  6761,  6925,  7739,
+     8912,  9134, 10521, 10666, 11105, 11174, 11183, 11679, 11894, 12146,
+    12351, 12357, 12730, 12996, 13142, 13218, 13382, 13460, 13554, 14942,
+    14950, 14985, 15014, 15042, 15162, 15522, 15692, 15941,  3490, 13691,
+     1054,  1818,  2909,  4503,  7680, 11801, 12474,  4511, 13501, 10446,
+    12957,  2294, 10458,  8395,   821, 12721,  1815,  7677,  1426, 15462,
+     1069,  4546,   804, 12617,   411,  8290,  5277, 11374, 10469, 12977,
+     1348, 14107,  4046, 14973,   622, 11634, 11545,  1837,  7824,  4344,
+    11692,  2313, 10474,  8491, 15519, 13520, 15279,  2331, 10484,   506,
+     1441,  4600,  8054, 11090,  4967,  8296,  8105,  8282,  8302,  9162,
+     9345, 11553,   636, 11641,  7192,  9079,  5295, 11387,  3917, 14617,
+     3992, 14893,  6234, 12762, 11204,  2713,  2741,  6390,  8924,  8879,
+    15164,  1398, 15098,  4520,  6041,  6894,  1831,  7818, 14515, 14721,
+     7202,  9096, 14252,  1915,  2959,  8022,  9538, 11886, 12284, 12509,
+    13154, 13747,  6542, 13817, 15550, 10792, 11219,  3096, 12128, 14675,
+     1094,  1652,  7211,  9193, 10494,  3547, 13767, 11855, 13109,  7012,
+    12780, 13738, 15168,   827, 12727, 15277,   210,  6793,  1943,  8059,
+    10034,  2336, 10489,  1035,  4239,  8501, 10503, 13509, 10510,  1375,
+    14116,  2720,  2850, 11610,  2652, 10930,   284,  7224,  5783, 15175,
+     1212,  2681, 11095,  3365,  7813, 12668, 12818, 13394, 15094,  7124,
+    15636,  7464, 15899, 15189,   877, 14982,   224,  4791,  5101,  5154,
+     5615,  6800,  6817,  9249, 10989, 11110, 14287,  5802, 15197,  3291,
+     6900,  5819, 15209,  4011, 14954,  7234,  3793, 14182,  8910, 10664,
+    12994, 15939,  9742, 15220,   538,  6858, 11240,  1400, 15100,   638,
+    11643,   286,  7226, 12628, 13183,  4315,  8309,  5283, 11380,  5837,
+    15285,   429,  1719,  7489,  8455, 15718, 10074, 12906,  1455,  5975,
+     3814, 14272,  4025, 14960,  7258,  7413, 12452,  2695, 11101,  4826,
+     7173,  2098,  8443,  3415, 13494,  5785, 15177, 10678,  4894,  7802,
+    10867, 13905, 14011,   905, 15106, 15112, 15230, 15251,  8887, 15265,
+     3567, 13779,  7394, 12269, 15432,  2300, 10464,  1862,  5286,  6755,
+     7993, 11383, 12074,   289,  5127,  7229, 11035,  1958,  8066, 10635,
+     8074,  4382, 11962,   494,  2502,  5928,  9381, 11065, 11665, 13563,
+    15864,  9896, 15944, 14727, 11908, 10835, 11919,  2265, 10402, 15120,
+     7243, 15127, 15140, 12324,  6480, 11976, 11740, 13093,  8930,  8947,
+     8962,  8979,  8993,  9008,  9024,  9038,  9056,  9072,  9089,  9105,
+     9121,  9137,  9155,  9169,  9186,  9202,  9218,  9237,  9253,  9267,
+     9286,  9298,  9311,  9323,  9337,  9354,  9368,  9386,  9400,  9413,
+     9430,  9443,  9457,  9471,  9486,  9498,  9511,  9528,  9542,  9554,
+     9566,  9580,  9598,  9614,  9629,  9647,  9661,  9674,  9691,  9706,
+     9720,  9736,  9753,  9769,  9782,  9797,  9811,  9826,  9843,  9857,
+     9871,  9889,  3974, 14770,  6356,  8083, 12355, 13140, 15275,  5835,
+    15283,  7256,  4321,  8315,  8476, 12864,  2924,  4937,  6836,  8093,
+     8144,  9822, 10840, 11808, 11924, 15600, 15290, 15656, 15316, 15326,
+    15338, 15349, 15360, 15376, 15387, 15397, 15415, 15427, 15439, 15450,
+      654, 11652,  5139, 11049,  5381, 12308,  4978,  8324,  1423, 15459,
+     7264,  9112,  7180,  9064, 13995,  5847, 15467,  4996,  9939,  6243,
+     6253,  6267,  6286,  6305,  6327,  6346,  6363,  6380,  6396,  6413,
+     6427,  6446,  6466,  6486,  6502,  6516,  6532,  6553,  6569,  6586,
+     6605,  6624,  6639,  6660,  4803,  6828,   333,  7641,  6907,  4163,
+    15815,  8901, 15476, 14635,  3663, 13899,  6564, 14423, 14429,  6178,
+    14442, 14456,  4437, 14499, 14476, 14510, 11334,   398,  8256, 10078,
+    12910,   964, 15332, 15300,   684, 11821,  5085,  5896, 10955, 15823,
+     4840,  7282, 15716,  3364,  7812, 12667, 12817, 15158,  4096, 15511,
+     2635, 10921,  5308, 11395,  9375, 11659,  1214,  2683, 11097,  2349,
+    10524,  9778, 15503, 15480,  9759, 15491,  5410, 12638,  5729,  9295,
+     9308,  9320,  9626, 11246, 11288, 11414, 14230, 14916,  7031,  9052,
+    12153,  1159,  7884,  2118,  8464,  9775, 15500, 12361, 14376, 14736,
+    15159,  5941, 15890,  2381, 10560,  4091, 15506, 15516,  9788, 15524,
+    15532,  2550, 15557,  5074, 10670,  3532, 13717, 15545, 14385,  2033,
+     3595,  4097,  8228, 13845, 15512,  6075,  7497,  8890, 15268, 10822,
+    11781,  2548, 15555,   746,  1163,  6976,  7888, 11457, 12185,  6614,
+    15561,  3149, 12215,  9803, 15570,  5861, 15577, 15587,  2636,  6163,
+    10922, 13917,   270,   596,  2723,  2853,  4323,  7017,  7100,  8317,
+    11494, 11613, 12785,  9817, 15595,  6996,  2570, 15603,  3951, 14694,
+     4109, 15613, 15620, 15640,  4299,  8183, 14609,  1608,  6953,  5727,
+    14914,  5876, 15660,  1983,  8157,   847,  4255,  9610, 10720, 13731,
+    14221,  8120,  5407, 12635,  9832, 15672,  5425, 12648,  4491,  5881,
+    15665, 15682,  9748, 15226,  6513,  9468,  9854, 12265, 12664, 15727,
+    12404, 13506,  3347, 12418,  3216, 12428, 12437, 15689,  4460, 13363,
+    14799, 14861, 10567, 15392,  5309, 11396, 11402, 13073, 13405, 15694,
+    13418, 15699, 15706,  7452, 14241, 14825,  7005, 14002,  9849, 15722,
+    15729, 15734,  8537, 12115, 12611, 13126,  2174,  9994,  8546,  6668,
+     6462, 11593, 15935, 14757,  2869, 11621,  6633,  7089, 15738, 15743,
+    14093, 15758,  7410, 12449,  4124, 15762, 11764, 15773,  8870, 10428,
+    14484,  3968, 14764,  6375,  8177,  2596, 15777,   917, 15785,  6653,
+    15833,  4143, 15794, 15803, 15807, 14778,  4181, 15873,   445, 10023,
+     1996,  4363,  8189, 11929,  2011,  8196,  6673,  2369,  2453,  3452,
+    10542, 11293, 13596,  2768, 11298,  9376, 11660, 12028,  3075, 12035,
+    12047, 12064, 12079,   350,   793,   991,  1215,  1684,  2214,  2248,
+     2530,  2552,  2684,  3083,  3134,  3869,  4033,  4284,  4643,  5524,
+     6059,  6224,  6583,  7157,  7308,  7474,  7539,  7913,  8478,  9199,
+     9264, 10164, 10190, 10393, 10500, 10683, 10996, 11044, 11098, 11207,
+    12043, 12117, 12208, 12465, 12613, 12866, 13128, 13287, 13522, 13669,
+    13814, 14566, 14708, 14794, 14926, 14968, 15124, 15281, 15543, 15559,
+     3591, 13841,  2716,  2744, 11212, 11503,  5561, 13952,  4160, 15812,
+     5893, 15820,  2350, 10525,  6648, 15828,  5496, 13796,  5906, 15839,
+    12315,  9744, 15222, 13433, 15846,  5124, 11032,  2333, 10486,  5265,
+    11363, 14299,  6579, 14790, 15850,  9885, 15926,  4563, 11577,  5918,
+    15854,  4176, 15868, 15880,  4568,  6127, 11020, 11582, 14752,  1766,
+     7562,  5937, 15886,  5237, 11230,  1910,  8017, 15303,  9318, 11412,
+     6159, 13913,  5534, 13830,  1782,  7570,  7577,  5661, 14535,  2176,
+     9996, 10050,  5764, 15019,  5492, 13792,  3218, 12430, 10852, 11936,
+     4458, 14797,  8090,  8431,  4208,  4665,  4727,  6228,   253,  6945,
+    11417, 14803, 11771, 15894,  3812, 14270,  7463, 15898, 11420,  5532,
+    13828,  1841,  2805,  7828,  9779, 11432, 12672, 15504, 12675,  1267,
+     2195,  3010,  5008, 10007, 10124, 11986,  9863, 15904, 11187, 15911,
+    12278, 14851,  9877, 15918,  2990, 11944,   268,  7098, 15481, 12683,
+     1572,  6874, 12439,  8097,  6992,  6678, 14781,  9760, 15492,  9883,
+    15924,  7037,  7044,  7056,  7073,  7085,  8548, 15929,  5411, 12639,
+     4585, 15344,  6022,  6689, 12688, 11421, 15549,  8909, 15938,  9895,
+    15943,  5533, 13829,   267,  7097, 15951,  8078, 14010,  8113, 15950,
+     8077, 14009,  8112
+};
+
+static const uint16_t suffixTerms[14593] = {
+      270,  1285,  1339,   469,  1238,  1231,  1227,  1190,  1216,  1276,
+     1179,  1012,   557,  1229,  1230,   550,   896,   558,   897,   626,
+      480,  1331,  1332,  1180,    36,   617,     7,    17,   210,  1135,
+     1214,   526,    84,   110,   488,   173,   929,  1294,  1195,   213,
+     1144,   365,  1257,   102,   436,   270,   229,  1223,   372,  1292,
+      111,   141,   143,   238,   497,   759,   791,  1263,   219,  1160,
+     1285,  1023,   315,   819,   157,   187,   981,  1258,  1321,   130,
+      586,   235,  1240,   577,  1040,   199,   200,   201,   224,  1187,
+     1294,    33,   582,   491,  1339,    91,  1161,   399,  1215,  1216,
+      112,   499,   741,   621,  1113,   121,   562,   400,  1224,   469,
+      408,   482,   416,   928,   169,   894,   481,   215,  1152,  1285,
+      221,  1184,   544,  1037,   522,   550,   560,   730,   733,   961,
+     1042,  1211,  1216,  1299,  1371,  1331,  1332,  1238,   230,  1225,
+       93,  1181,   120,   548,   231,  1226,  1227,   316,   822,  1221,
+     1203,   232,  1228,    94,  1182,   332,   902,  1229,  1041,   682,
+      852,  1042,   707,  1183,  1230,   396,   859,  1238,   315,   819,
+     1299,  1231,  1095,  1132,   138,   736,  1227,  1113,   514,   481,
+      682,   852,   208,  1133,  1299,  1090,  1106,   370,  1289,   225,
+     1188,   171,   908,   346,  1122,  1231,   265,  1217,   742,   175,
+      931,  1190,   526,   557,   576,   595,   123,   564,   212,  1143,
+       89,   909,   214,  1150,   743,  1344,    33,   582,   201,  1024,
+      136,   618,  1216,  1216,   208,  1133,  1295,  1218,   743,   481,
+     1216,   233,  1232,   602,  1276,    64,  1189,  1190,   144,   792,
+      211,  1136,   393,   512,   234,  1233,   107,   465,   139,   737,
+      195,  1025,  1026,   270,  1285,  1339,   469,  1238,  1231,  1227,
+     1190,  1216,  1276,   577,  1179,  1012,   557,  1229,  1230,   550,
+      896,   558,   897,   626,   480,  1331,  1332,  1180,   480,   557,
+      558,   626,   896,   897,  1012,  1179,  1180,  1229,  1230,  1331,
+     1332,   550,   628,   761,   629,   762,   630,   763,   631,   764,
+      632,   765,   633,   766,   634,   767,   635,   768,   636,   769,
+      637,   770,   638,   771,   639,   772,   640,   773,   641,   774,
+      642,   775,   643,   776,   644,   777,   645,   778,   646,   779,
+      647,   780,   648,   781,   649,   782,   650,   783,   651,   784,
+      652,   785,   653,   786,   654,   787,   655,   788,   209,  1134,
+      805,  1052,   752,   603,  1304,   374,  1313,    63,  1137,   209,
+     1134,   106,   463,   843,  1307,  1336,   526,   743,   557,   743,
+      557,   558,    15,    16,   474,   405,    79,    17,   406,   282,
+     1300,  1301,    18,   283,   284,   664,   285,    80,   665,    81,
+      831,    82,  1062,   286,   287,    83,    84,    85,    86,    87,
+       88,    89,    90,    91,    92,    93,    94,    95,    96,  1302,
+       97,   288,   289,    19,    20,   666,    98,   667,    99,   100,
+      501,   290,  1063,   390,   291,   101,   102,   292,   982,   983,
+      293,    21,   294,    22,    23,   103,   295,   296,   104,   668,
+      669,   105,   670,   391,   199,   297,    24,   106,    25,   107,
+      108,   109,  1064,   671,    26,   407,   408,   298,   672,   673,
+      674,    84,   110,    27,   675,    28,   299,   111,   112,   392,
+      409,   113,   393,   114,    29,   257,    85,   115,   116,   117,
+      200,   502,  1303,    30,   832,  1065,   118,   119,   676,   300,
+      301,   302,   833,   303,  1066,   120,   834,   304,    86,   835,
+       31,   536,   677,   121,    87,   122,   123,   124,   125,   126,
+      127,   410,   305,    32,   306,   128,    33,   411,   258,   129,
+      130,   475,   131,   132,   307,   308,    34,   133,    35,   309,
+      678,   259,   310,   476,  1304,  1067,   537,   503,  1305,   134,
+     1068,   135,    36,   136,  1069,   137,   412,   394,  1070,   311,
+      395,  1071,   138,   139,   140,    37,  1072,    38,  1073,  1074,
+      312,   984,   679,   141,   627,   628,   629,   630,   631,   632,
+      633,   634,   635,   636,   637,   638,   639,   640,   641,   642,
+      643,   644,   645,   646,   647,   648,   649,   650,   651,   652,
+      653,   654,   655,   656,   142,   143,   144,   657,   145,  1075,
+      146,  1076,   147,   148,   680,   149,   150,    39,   313,   151,
+     1306,   314,   681,   152,   315,   413,   316,  1077,   317,  1307,
+      153,   154,   155,   156,   157,   158,   159,   160,   153,   161,
+      162,   163,   318,   682,   319,   683,   320,   164,   396,   321,
+      684,   322,    40,  1078,    41,    88,   165,   166,   323,   685,
+      324,    42,  1079,   325,   326,   327,   328,   167,   168,   836,
+      329,    43,   686,    44,    45,  1080,   687,   154,   169,   330,
+     1081,   170,   331,   332,   333,   334,  1082,   688,   171,    89,
+       46,   414,    47,   172,   415,   689,   690,    48,   691,   275,
+      416,   173,   167,   174,   175,    49,    50,    51,   692,   335,
+      336,   176,   260,   397,   693,   337,   837,  1083,   338,    52,
+      838,   694,   177,   178,   339,    53,   155,   695,   179,  1084,
+      180,    54,   181,   839,   261,   840,   182,    55,   262,   417,
+       90,   183,   184,   185,   186,   187,  1308,  1085,   696,   188,
+       56,   697,   189,    57,   190,   191,   168,   192,   193,   698,
+      504,  1309,   340,    58,   194,  1086,    59,   201,   195,   505,
+       60,   341,   699,   196,  1087,   197,  1088,   198,   418,   199,
+      200,   201,    61,  1089,   342,   343,   419,   202,   203,   344,
+      345,   700,    62,   506,  1310,  1090,  1091,   263,   204,   205,
+      206,   701,   420,   156,   346,   207,  1092,   702,  1093,  1094,
+      347,  1095,   208,   209,   210,   211,    63,   703,   212,   213,
+      348,   349,   350,   421,   351,   214,   352,   215,  1096,   216,
+      217,   218,   841,   398,   704,   219,    91,   353,   705,   220,
+      264,   354,  1097,   355,    92,   706,   356,  1098,  1311,    93,
+       94,   707,   221,   222,   223,   224,   225,    64,   708,   709,
+      507,   226,   357,   358,   227,   710,   359,   228,   711,   712,
+      422,   399,   265,   360,   229,   400,   230,   231,   232,   233,
+      234,   401,   713,   235,   423,   266,  1099,   361,   714,  1100,
+      362,   424,   363,   236,   364,   365,   157,   366,   367,   237,
+      238,   239,    65,   715,   716,   368,   369,  1101,   240,   241,
+       66,   267,  1102,    95,    67,   658,   370,   371,   372,   717,
+      659,   373,    96,   374,   660,   718,   719,   242,   720,   158,
+      425,   721,   375,   722,   159,   243,   376,   723,   268,  1103,
+     1104,   724,   426,   477,   244,   160,    68,   245,   246,   377,
+      427,   378,  1105,   379,   247,   380,   508,   725,   726,   661,
+      727,   628,   630,   641,   643,   656,   761,   763,   774,   776,
+      789,   629,   631,   642,   644,   762,   764,   775,   777,   630,
+      643,   763,   776,   631,   644,   764,   777,   632,   645,   765,
+      778,   646,   779,   647,   780,   632,   633,   645,   648,   765,
+      766,   778,   781,   634,   646,   649,   767,   779,   782,   635,
+      647,   650,   768,   780,   783,   636,   651,   769,   784,   624,
+      637,   652,   770,   785,   569,   638,   653,   771,   786,  1010,
+      639,   654,   772,   787,  1142,   640,   655,   773,   788,     1,
+        7,    16,    17,    19,    20,    27,    29,    30,    35,    41,
+       42,    45,    49,    51,    57,    59,    73,    74,    76,    81,
+       82,    83,    85,    86,    87,    89,    90,    92,    96,    97,
+      100,   101,   107,   108,   115,   119,   122,   123,   126,   133,
+      137,   140,   145,   147,   149,   151,   164,   172,   177,   183,
+      185,   186,   198,   203,   204,   217,   228,   232,   236,   239,
+      241,   252,   253,   254,   256,   264,   266,   269,   270,   271,
+      274,   276,   277,   278,   279,   299,   300,   305,   307,   311,
+      312,   320,   321,   324,   329,   330,   339,   341,   351,   374,
+      381,   382,   388,   391,   397,   399,   400,   404,   409,   412,
+      424,   425,   427,   428,   435,   458,   465,   466,   468,   469,
+      470,   472,   475,   489,   490,   495,   496,   500,   510,   515,
+      519,   529,   534,   538,   540,   551,   553,   563,   564,   567,
+      570,   571,   578,   588,   591,   594,   596,   603,   620,   621,
+      622,   625,   662,   663,   665,   671,   690,   694,   699,   702,
+      704,   706,   712,   721,   731,   738,   741,   742,   748,   750,
+      755,   757,   796,   801,   804,   806,   811,   830,   842,   845,
+      857,   858,   861,   868,   873,   874,   883,   885,   889,   895,
+      909,   912,   916,   918,   920,   923,   924,   932,   934,   941,
+      949,   952,   953,   955,   965,   974,   976,   979,   986,   992,
+      995,   996,  1014,  1019,  1023,  1029,  1030,  1032,  1038,  1040,
+     1041,  1045,  1055,  1062,  1089,  1096,  1098,  1100,  1111,  1113,
+     1127,  1149,  1153,  1155,  1159,  1165,  1168,  1169,  1170,  1175,
+     1176,  1178,  1195,  1199,  1206,  1208,  1209,  1210,  1212,  1214,
+     1215,  1221,  1224,  1228,  1243,  1244,  1250,  1251,  1253,  1255,
+     1264,  1272,  1275,  1282,  1288,  1300,  1302,  1304,  1311,  1312,
+     1313,  1322,  1324,  1325,  1339,  1344,  1352,  1355,  1366,   270,
+      469,  1216,  1179,   896,   897,  1180,   213,  1144,   102,   436,
+      491,   221,  1184,  1042,  1203,   332,   902,  1113,   171,   908,
+      123,   564,    89,   909,   107,   465,  1012,   805,   843,  1307,
+       15,    16,   405,    79,    17,   406,   282,    18,   283,   284,
+      285,    80,    81,    82,   286,   287,    83,    84,    85,    86,
+       87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+       97,   288,   289,    19,    20,    98,    99,   100,   501,   290,
+      291,   101,   102,   292,   293,    21,   294,    22,    23,   103,
+      295,   296,   104,   105,   199,   297,    24,   106,    25,   107,
+      108,   109,    26,   407,   408,   298,    84,   110,    27,    28,
+      299,   111,   112,   409,   113,   114,    29,   257,    85,   115,
+      116,   117,   200,   502,    30,   118,   119,   300,   301,   302,
+      303,   120,   304,    86,    31,   121,    87,   122,   123,   124,
+      125,   126,   127,   410,   305,    32,   306,   128,    33,   411,
+      258,   129,   130,   131,   132,   307,   308,    34,   133,    35,
+      309,   259,   310,   503,   134,   135,    36,   136,   137,   412,
+      311,   138,   139,   140,    37,    38,   312,   141,   142,   143,
+      144,   145,   146,   147,   148,   149,   150,    39,   313,   151,
+      314,   152,   315,   413,   316,   317,   153,   154,   155,   156,
+      157,   158,   159,   160,   153,   161,   162,   163,   318,   319,
+      320,   164,   321,   322,    40,    41,    88,   165,   166,   323,
+      324,    42,   325,   326,   327,   328,   167,   168,   329,    43,
+       44,    45,   154,   169,   330,   170,   331,   332,   333,   334,
+      171,    89,    46,   414,    47,   172,   415,    48,   416,   173,
+      174,   175,    49,    50,    51,   335,   336,   176,   260,   337,
+      338,    52,   177,   178,   339,    53,   155,   179,   180,    54,
+      181,   261,   182,    55,   262,   417,    90,   183,   184,   185,
+      186,   187,   188,    56,   189,    57,   190,   191,   192,   193,
+      504,   340,    58,   194,    59,   201,   195,   505,    60,   341,
+      196,   197,   198,   418,   199,   200,   201,    61,   342,   343,
+      419,   202,   203,   344,   345,    62,   506,   263,   204,   205,
+      206,   420,   156,   346,   207,   347,   208,   209,   210,   211,
+       63,   212,   213,   348,   349,   350,   421,   351,   214,   352,
+      215,   216,   217,   218,   219,    91,   353,   220,   264,   354,
+      355,    92,   356,    93,    94,   221,   222,   223,   224,   225,
+       64,   507,   226,   357,   358,   227,   359,   228,   422,   265,
+      360,   229,   230,   231,   232,   233,   234,   235,   423,   266,
+      361,   362,   424,   363,   236,   364,   365,   157,   366,   367,
+      237,   238,   239,    65,   368,   369,   240,   241,    66,   267,
+       95,    67,   370,   371,   372,   373,    96,   374,   242,   158,
+      425,   375,   159,   243,   376,   268,   426,   244,   160,    68,
+      245,   246,   377,   427,   378,   379,   247,   380,   508,    36,
+      617,    33,   582,   371,  1291,  1229,   371,  1291,   142,   790,
+     1294,     7,    17,   126,   571,     7,    17,   281,   289,    55,
+      970,   280,   288,   221,  1184,  1195,     0,    15,    29,   515,
+      106,   463,    52,   947,   745,    38,   746,   323,   871,  1368,
+      160,  1348,   127,   335,   572,   936,   114,   513,   336,   937,
+      305,   578,     1,    16,     2,   141,   759,  1041,   176,   938,
+      325,   876,   506,  1061,  1310,  1062,  1063,  1064,  1065,  1066,
+     1067,  1068,  1069,  1070,  1071,  1072,  1073,  1074,  1075,  1076,
+     1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,
+     1087,  1088,  1089,  1090,  1091,  1092,  1093,  1094,  1095,  1096,
+     1097,  1098,  1099,  1100,  1101,  1102,  1103,  1104,  1105,   697,
+      993,   260,   939,     3,   210,   474,  1135,     4,     5,   405,
+      281,   289,   291,   433,   530,   685,   723,   872,  1334,  1276,
+      120,   548,   137,   145,   500,   620,   796,   501,   502,   503,
+      504,   505,   506,   507,   508,   940,     6,    79,   798,  1075,
+      337,   943,    86,   553,     7,    17,     8,   454,   669,   397,
+      941,     9,   406,   146,   799,    10,   282,   443,   353,  1162,
+       56,   991,   376,  1333,   136,   608,   618,   103,   446,    62,
+     1060,   693,   942,    11,   719,  1317,   250,   285,   898,  1081,
+       12,   853,   394,   728,    13,    14,  1214,    15,    16,    17,
+       18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+       28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+       38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+       48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+       58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+       68,   526,   744,  1072,   203,  1055,   337,   943,    62,  1060,
+      940,    80,   251,   561,   677,   291,   433,   118,   223,   533,
+     1090,  1106,  1186,  1276,  1090,  1106,    46,   531,   747,   832,
+      910,  1073,   725,  1365,   177,   953,  1029,    83,   274,  1114,
+      703,  1139,   311,   731,   199,   459,   434,  1344,    69,   837,
+      944,   101,   435,   102,   436,  1099,  1245,   292,   437,    70,
+      119,   534,   309,   358,   597,  1201,    96,  1312,   164,   858,
+     1285,     9,   406,   354,  1172,   812,  1306,   431,  1259,   208,
+      292,   437,   504,  1005,  1133,  1219,  1309,   480,    83,   274,
+     1290,   471,  1064,   214,  1150,  1097,  1173,   361,  1246,   124,
+      565,    84,   110,   488,  1092,  1124,    28,   494,    58,  1013,
+      334,   904,   807,    36,   617,  1247,   905,  1082,   438,   982,
+      439,   983,   708,  1191,  1248,  1017,   945,  1083,     6,    79,
+      347,  1131,    51,   307,   591,   934,   729,  1070,    32,   579,
+      320,   857,   338,   946,   186,   979,    61,  1044,    71,  1103,
+     1337,   355,  1174,   384,   666,   880,  1208,  1107,    21,   441,
+     1040,   199,   200,   201,    31,   556,    72,   293,   440,   246,
+     1353,   377,  1354,   192,   345,   502,   525,   536,   559,   659,
+      754,   798,   984,  1001,  1021,  1058,  1075,  1138,  1197,  1296,
+     1303,   526,   621,   121,   562,    35,    42,   147,   596,   801,
+      874,   332,   902,    33,   582,    52,   947,  1026,   747,  1073,
+       73,  1300,  1091,  1108,   948,   949,    74,  1238,   798,  1075,
+      299,   495,   838,   950,  1023,   905,  1082,   201,   322,   863,
+     1024,   170,   899,  1109,    75,  1301,   140,   738,    76,    18,
+       77,    44,   888,   951,   404,  1212,   405,   406,   407,   408,
+      409,   410,   411,   412,   413,   414,   415,   416,   417,   418,
+      419,   420,   421,   422,   423,   424,   425,   426,   427,   150,
+      808,   355,  1174,   685,   872,   730,   961,    91,  1161,   714,
+     1249,  1104,  1338,  1339,    78,   283,   263,  1110,   236,  1255,
+      301,   541,    92,   694,   952,  1175,   679,   758,  1286,   163,
+      847,   136,   618,   856,    33,   249,   532,   582,   664,   800,
+     1065,  1076,  1327,   204,  1111,   160,  1348,   311,   731,   164,
+      858,    21,   441,   706,  1176,    85,   115,   519,   206,  1115,
+      356,  1177,   434,   306,   580,   748,  1366,   749,  1074,  1006,
+      496,   111,   497,   324,   873,  1237,    59,  1019,    79,    80,
+       81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
+       91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+      101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+      111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+      121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+      131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+      141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      151,   152,   153,   154,   155,   156,   157,   158,   159,   160,
+      161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
+      171,   172,   173,   174,   175,   176,   177,   178,   179,   180,
+      181,   182,   183,   184,   185,   186,   187,   188,   189,   190,
+      191,   192,   193,   194,   195,   196,   197,   198,   199,   200,
+      201,   202,   203,   204,   205,   206,   207,   208,   209,   210,
+      211,   212,   213,   214,   215,   216,   217,   218,   219,   220,
+      221,   222,   223,   224,   225,   226,   227,   228,   229,   230,
+      231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
+      241,   242,   243,   244,   245,   246,   247,  1179,   498,    60,
+     1028,  1014,   248,   284,   695,   958,  1098,  1178,  1311,  1179,
+     1180,   181,   964,    42,   874,   112,   499,   249,   664,     0,
+       14,    15,    75,    93,    95,    99,   117,   182,   248,   284,
+      301,   337,   364,   380,   384,   387,   415,   431,   460,   507,
+      521,   541,   666,   682,   720,   848,   852,   860,   866,   880,
+      907,   921,   943,   969,   985,  1056,  1097,  1107,  1173,  1181,
+     1193,  1218,  1236,  1247,  1248,  1256,  1280,  1284,  1301,  1308,
+     1315,  1320,  1362,   372,  1292,  1321,   522,    93,  1181,    94,
+     1182,   707,  1183,   396,   859,  1238,   514,   481,   526,   595,
+      481,  1179,   831,   832,   833,   834,   835,   836,   837,   838,
+      839,   840,   841,   149,   151,   239,   470,   603,   690,   741,
+      757,   806,   811,   842,   924,  1264,  1304,  1042,   843,  1307,
+      153,   154,   155,   156,   157,   158,   159,   160,   500,   501,
+      502,   503,   504,   505,   506,   507,   508,   250,   285,   177,
+      953,   347,  1131,   798,  1075,   204,  1111,   255,   831,   153,
+      161,   844,   255,   831,   392,   509,   178,   954,   350,  1147,
+      371,  1291,   310,   600,   409,   510,   319,   683,   855,   106,
+      463,    29,   515,   739,    80,   251,   219,  1160,   242,  1318,
+      427,  1355,   113,   511,   356,   403,   421,   505,   537,   544,
+      605,   735,   794,   828,   850,  1026,  1027,  1037,  1063,  1129,
+     1148,  1177,  1241,  1259,   730,  1371,   144,   792,   626,    49,
+      932,  1170,  1288,   370,  1289,   112,   499,   102,   436,   252,
+      665,   522,   550,   560,   730,   733,   961,  1022,  1042,  1211,
+     1216,  1299,  1371,  1331,  1332,   327,   328,   878,   879,  1216,
+      329,   885,    55,   375,   407,   479,   715,   970,  1266,  1326,
+      348,   370,  1145,  1289,   173,   929,   358,  1201,   294,   442,
+      443,   205,  1112,   253,   378,  1356,   352,  1151,    22,   444,
+       81,   254,    74,   424,   923,   965,  1165,  1250,  1253,   339,
+      955,    14,    23,   445,  1221,   215,  1152,   401,  1234,  1012,
+      128,   581,    40,   864,   913,   438,   982,   717,  1293,   221,
+     1184,   255,   831,   256,   257,   258,   259,   260,   261,   262,
+      263,   264,   265,   266,   267,   268,   222,  1185,   223,  1186,
+      389,   501,   390,   391,   392,   393,   394,   395,   396,   397,
+      398,   399,   400,   401,    82,   269,   270,   224,  1187,   875,
+     1079,    25,   464,  1319,   756,  1250,   127,   335,   572,   573,
+      936,   225,  1188,    64,  1189,  1190,   729,  1070,   911,  1105,
+     1357,   747,  1073,   860,  1094,  1130,   393,   512,   487,   674,
+      271,  1062,   153,   161,   844,   359,  1205,   726,  1367,  1101,
+     1273,  1113,   321,   861,    53,   956,   849,   272,   286,   273,
+      287,   148,   802,    32,   326,   338,   349,   371,   579,   679,
+      758,   877,   940,   946,  1146,  1291,  1012,    33,   582,    19,
+      381,   706,  1176,  1344,  1294,  1195,   114,   513,   325,   876,
+     1029,    83,   274,  1114,   708,  1191,   206,  1115,    39,   809,
+      709,  1192,  1100,  1251,   103,   446,   313,   810,   121,   562,
+      270,   275,   927,    85,   115,   519,   275,   256,   257,   258,
+      259,   260,   261,   262,   263,   264,   265,   266,   267,   268,
+     1238,    39,   809,   222,  1185,   213,  1144,   155,   957,   486,
+      673,   120,   548,   276,    84,    85,    86,    87,    88,    89,
+       90,    91,    92,    93,    94,    95,    96,   490,  1042,   514,
+      206,  1115,   260,   939,   695,   958,   179,   959,   707,  1183,
+      220,  1167,   701,  1116,   255,   831,   277,  1302,   587,   356,
+     1177,   843,  1307,   128,   581,   278,   295,   447,   395,   732,
+      733,  1096,  1153,   960,  1084,   724,  1340,   961,   331,   900,
+      413,   820,   320,   857,  1229,   229,  1223,  1230,   180,   962,
+       43,   886,    97,   279,   450,   411,   583,   392,   509,   827,
+      102,   114,   213,   233,   434,   436,   513,   543,   821,   833,
+      960,  1084,  1144,  1232,   544,    45,   889,    29,   515,   940,
+      306,   580,    54,   963,   257,   516,   280,   288,   326,   877,
+       50,   933,   362,  1252,   281,   289,   282,   283,   284,   285,
+      286,   287,   288,   289,   290,   291,   292,   293,   294,   295,
+      296,   297,   298,   299,   300,   301,   302,   303,   304,   305,
+      306,   307,   308,   309,   310,   311,   312,   313,   314,   315,
+      316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
+      326,   327,   328,   329,   330,   331,   332,   333,   334,   335,
+      336,   337,   338,   339,   340,   341,   342,   343,   344,   345,
+      346,   347,   348,   349,   350,   351,   352,   353,   354,   355,
+      356,   357,   358,   359,   360,   361,   362,   363,   364,   365,
+      366,   367,   368,   369,   370,   371,   372,   373,   374,   375,
+      376,   377,   378,   379,   380,    73,  1300,   507,  1193,   424,
+     1253,    19,   381,    20,   382,   331,   900,   491,   716,  1267,
+      338,   946,   194,  1015,   383,   452,   476,   517,   601,   668,
+     1194,  1341,   602,   603,  1304,   604,  1067,   537,   605,   503,
+      606,  1305,   384,   666,    98,   385,   439,   983,   193,   246,
+      280,   288,   340,   518,   607,  1002,  1011,  1052,  1342,  1353,
+      330,   895,    85,   115,   519,   181,   964,  1101,  1273,   349,
+      371,  1146,  1291,   507,  1193,   613,  1068,   147,   801,   379,
+     1359,  1294,  1295,   532,  1065,   386,   667,   327,   878,   890,
+      891,  1080,   567,   720,  1320,  1321,    99,   387,   626,   472,
+      671,   100,   324,   388,   873,   186,   979,   182,   969,   389,
+      501,   390,   391,   392,   393,   394,   395,   396,   397,   398,
+      399,   400,   401,   328,   879,   372,  1292,   621,   709,  1192,
+     1319,   912,    78,   283,   290,   402,    24,   166,   194,   272,
+      286,   290,   336,   402,   462,   539,   676,   805,   870,   937,
+     1015,  1091,  1108,  1269,   209,  1134,   403,  1063,  1195,   295,
+      447,   225,  1188,   965,   839,   966,  1016,  1086,   178,   954,
+      404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+      414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
+      424,   425,   426,   427,   428,   472,   671,  1017,   151,   811,
+       86,   553,   398,  1158,    26,   478,   258,   584,   365,  1257,
+      128,   581,   724,  1340,  1100,  1251,   812,  1306,   429,   948,
+      129,   261,   585,   967,   130,   586,   430,   150,   808,   111,
+      141,   143,   158,   238,   350,   497,   759,   791,   987,  1043,
+     1085,  1114,  1147,  1263,  1297,  1323,   321,   861,   148,   802,
+      396,   859,  1238,   116,   520,   117,   521,   522,   139,   737,
+      840,   968,   949,   171,   908,   312,   750,   880,   182,   969,
+      431,   473,   474,   475,   476,   477,   626,   390,   432,    26,
+      478,   573,   142,   725,   751,   790,  1347,  1365,  1294,   752,
+        7,    17,    41,    87,    97,   122,   126,   279,   563,   570,
+      571,   868,   371,  1291,     7,    17,    55,   970,  1368,   281,
+      289,   103,   446,   291,   433,  1276,   434,   101,   435,   102,
+      436,   292,   437,   309,   597,   431,   438,   982,   439,   983,
+      293,   440,   301,   541,    21,   441,   102,   436,    55,   407,
+      479,   970,   294,   442,   443,    22,   444,    74,    23,   445,
+      913,   103,   446,   270,  1238,   295,   447,   413,   820,   229,
+     1223,    50,   933,   280,   288,   890,   372,  1292,   111,   141,
+      143,   238,   497,   759,   791,  1263,   514,   448,   273,   287,
+      310,   600,   514,   296,   449,  1315,   221,  1184,   450,   104,
+      451,   452,   668,   453,   454,   669,   105,   455,   456,   916,
+      457,   670,   391,   458,   409,   510,   199,   459,   460,    58,
+     1013,   551,   748,  1014,  1195,  1199,  1366,     0,    15,   749,
+     1074,   363,  1254,   313,   810,  1006,   343,  1047,   297,   461,
+       24,   462,   805,   106,   463,    29,   515,    25,   464,   576,
+      595,   598,   678,   690,   924,   106,   463,    52,   206,   304,
+      552,   947,  1115,   107,   465,   496,   108,   466,   109,   467,
+      468,   689,   745,   922,    38,   746,   469,   470,   471,  1064,
+      121,   562,   692,   935,   417,   973,    34,   593,   679,   758,
+      219,  1160,   472,   671,   473,   474,   475,   476,   477,    26,
+      478,    47,   917,   111,   497,   407,   479,   480,   481,   408,
+      482,   314,   814,   298,   483,   484,   672,   485,   366,  1260,
+      486,   673,   270,   487,   674,    84,   110,   488,    27,   489,
+       65,  1265,   319,   323,   683,   855,   871,   490,    50,   933,
+       27,   489,    40,   156,   379,   864,  1120,  1359,   491,  1012,
+      492,   619,  1069,   493,   675,  1368,  1095,  1132,   918,   275,
+      927,   226,  1196,   160,   389,   501,   506,   576,   595,   660,
+     1061,  1140,  1163,  1310,  1314,  1348,   106,   463,  1062,  1063,
+      390,   391,  1064,   392,   393,  1065,  1066,  1067,  1068,  1069,
+      394,  1070,   395,  1071,  1072,  1073,  1074,   627,   628,   629,
+      630,   631,   632,   633,   634,   635,   636,   637,   638,   639,
+      640,   641,   642,   643,   644,   645,   646,   647,   648,   649,
+      650,   651,   652,   653,   654,   655,   656,   657,  1075,  1076,
+     1077,   396,  1078,  1079,  1080,  1081,  1082,   275,   397,  1083,
+     1084,  1085,  1086,  1087,  1088,  1089,  1090,  1091,  1092,  1093,
+     1094,  1095,  1096,   398,  1097,  1098,   399,   400,   401,  1099,
+     1100,  1101,  1102,   658,   659,   660,  1103,  1104,  1105,   661,
+       29,    85,   115,   123,   133,   164,   256,   305,   515,   519,
+      564,   578,   594,   702,   858,  1127,  1214,    15,    16,    79,
+       17,    18,    80,    81,    82,    83,    84,    85,    86,    87,
+       88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+       19,    20,    98,    99,   100,   101,   102,    21,    22,    23,
+      103,   104,   105,    24,   106,    25,   107,   108,   109,    26,
+      110,    27,    28,   111,   112,   113,   114,    29,   257,   115,
+      116,   117,    30,   118,   119,   120,    31,   121,   122,   123,
+      124,   125,   126,   127,    32,   128,    33,   258,   129,   130,
+      131,   132,    34,   133,    35,   259,   134,   135,    36,   136,
+      137,   138,   139,   140,    37,    38,   141,   142,   143,   144,
+      145,   146,   147,   148,   149,   150,    39,   151,   152,   153,
+      154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+      164,    40,    41,   165,   166,    42,   167,   168,    43,    44,
+       45,   169,   170,   171,    46,    47,   172,    48,   173,   174,
+      175,    49,    50,    51,   176,   260,    52,   177,   178,    53,
+      179,   180,    54,   181,   261,   182,    55,   262,   183,   184,
+      185,   186,   187,   188,    56,   189,    57,   190,   191,   192,
+      193,    58,   194,    59,   195,    60,   196,   197,   198,   199,
+      200,   201,    61,   202,   203,    62,   263,   204,   205,   206,
+      207,   208,   209,   210,   211,    63,   212,   213,   214,   215,
+      216,   217,   218,   219,   220,   264,   221,   222,   223,   224,
+      225,    64,   226,   227,   228,   265,   229,   230,   231,   232,
+      233,   234,   235,   266,   236,   237,   238,   239,    65,   240,
+      241,    66,   267,    67,   242,   243,   268,   244,    68,   245,
+      246,   247,   118,   533,  1285,  1092,  1124,    28,   494,   299,
+      495,  1023,   496,   111,   497,   498,   112,   499,   720,  1320,
+     1321,   526,   595,  1179,   500,   501,   502,   503,   504,   505,
+      506,   507,   508,   798,  1075,   392,   509,   409,   510,   113,
+      511,   127,   335,   572,   936,   393,   512,   940,   114,   513,
+     1029,   514,   114,   513,    29,   515,   257,   516,   517,   340,
+      518,  1011,    85,   115,   519,   336,   937,   116,   520,   117,
+      521,   522,   305,   578,  1003,     1,    16,     2,   523,   569,
+      209,   739,   793,  1134,   141,   759,   481,  1041,   176,   938,
+      828,   168,  1000,   159,  1329,   234,  1233,   200,   524,   502,
+      525,  1303,   526,   175,   931,   527,   528,    30,   529,   657,
+      727,   795,  1370,   741,  1216,   742,   576,   743,  1229,  1230,
+      530,   531,   832,   486,   673,  1052,   532,  1065,   324,   873,
+     1200,   507,  1193,   325,   876,   315,   819,   118,   533,   985,
+     1308,   119,   534,   535,   536,   537,   538,   333,   903,   539,
+      676,   300,   540,   301,   541,   302,   542,    80,   251,    61,
+     1044,   543,   833,   544,   545,   919,   303,   546,   547,  1066,
+      232,  1228,   216,  1154,   506,  1061,  1310,  1062,  1063,  1064,
+     1065,  1066,  1067,  1068,  1069,  1070,  1071,  1072,  1073,  1074,
+     1075,  1076,  1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,
+     1085,  1086,  1087,  1088,  1089,  1090,  1091,  1092,  1093,  1094,
+     1095,  1096,  1097,  1098,  1099,  1100,  1101,  1102,  1103,  1104,
+     1105,   236,  1255,    98,   385,  1190,   157,   187,   981,  1258,
+     1321,   120,   548,   227,  1202,   713,  1235,   403,  1063,   882,
+      167,   168,   412,   663,   262,   971,   212,   219,   697,   980,
+      993,  1003,  1143,  1160,   187,   981,   982,   983,   984,   549,
+      834,   550,   551,   304,   552,    86,   553,   554,   835,   555,
+       31,   556,   557,   558,   536,   559,   560,   561,   677,   121,
+      562,    87,   122,   563,   226,  1196,   549,   834,   550,  1285,
+      341,   699,  1030,   123,   564,   242,  1318,   698,  1004,   427,
+     1355,   124,   565,   260,   939,     1,    16,     3,   210,   474,
+     1135,   130,   586,   125,   566,   567,   986,     4,   568,   569,
+        5,   405,   658,  1287,   275,   256,   257,   258,   259,   260,
+      261,   262,   263,   264,   265,   266,   267,   268,   189,   994,
+      425,  1324,   608,   570,   126,   571,    95,  1280,   113,   511,
+      127,   572,   573,   235,  1240,   410,   574,   306,   580,   299,
+      495,   575,   576,   577,   226,   281,   289,   291,   317,   356,
+      403,   421,   433,   505,   530,   537,   544,   605,   685,   693,
+      718,   723,   735,   794,   825,   828,   850,   872,   942,  1007,
+     1026,  1027,  1037,  1063,  1129,  1148,  1177,  1196,  1241,  1259,
+     1316,  1334,  1238,  1276,  1294,   416,   928,   730,  1371,   120,
+      548,  1295,   144,   792,   577,   626,    49,   137,   145,   185,
+      270,   351,   391,   458,   500,   620,   796,   932,   976,  1149,
+     1170,  1288,   501,   502,   503,   504,   505,   506,   507,   508,
+      305,   578,   291,   433,  1276,   120,   548,   940,     6,    79,
+       32,   579,  1040,   199,   200,   201,   798,  1075,   249,   664,
+      306,   580,   337,   866,   943,  1218,  1236,   370,  1289,   128,
+      581,   487,   674,    33,   582,   411,   583,    86,   553,   258,
+      584,   129,   585,   130,   586,     7,    17,     8,  1018,     9,
+      112,   393,   406,   454,   499,   512,   669,   397,   941,     9,
+      406,   146,   799,   557,   415,   921,    10,   282,  1239,   587,
+      475,   588,   131,   589,   191,   999,   238,  1263,   102,   436,
+      619,  1069,   443,   132,   590,   111,   497,   702,  1127,   353,
+     1162,   307,   591,    68,  1349,   492,  1195,   496,   830,   481,
+      831,   832,   833,   834,   835,   836,   837,   838,   839,   840,
+      841,   603,   842,  1304,   843,  1307,   153,   154,   155,   156,
+      157,   158,   159,   160,   153,   161,   844,   170,   899,   308,
+      592,     7,    17,    56,   991,   838,   950,   376,  1333,    59,
+     1019,     0,    15,    34,   593,   505,  1027,   134,   609,   360,
+     1220,   423,  1242,   262,   971,    87,   122,   563,   224,  1187,
+      133,   594,   595,   691,   926,   845,  1023,  1041,   136,   608,
+      618,   252,   665,   103,   446,    35,   596,    62,  1060,   992,
+       90,   183,   974,   693,   942,    86,   553,   522,   550,   560,
+      730,   733,   961,  1022,  1042,  1211,  1216,  1299,  1371,  1331,
+     1332,     2,     8,    11,    12,    69,    71,   429,   448,   523,
+      569,   610,   624,   753,   813,   829,   881,   972,  1010,  1018,
+     1020,  1053,  1117,  1142,  1358,   142,   790,   327,   328,   878,
+      879,   309,   597,   598,   678,   259,   599,   821,   259,   599,
+      310,   600,  1229,   719,  1317,   987,  1085,  1216,   329,   885,
+      250,   285,     3,     9,    25,    26,    38,    39,    47,    48,
+       55,    64,    80,   105,   109,   112,   116,   124,   135,   139,
+      146,   167,   174,   180,   184,   197,   209,   210,   216,   218,
+      237,   244,   247,   251,   259,   260,   265,   273,   287,   310,
+      359,   375,   393,   394,   395,   406,   407,   410,   416,   417,
+      438,   454,   455,   464,   467,   471,   474,   478,   479,   499,
+      512,   520,   535,   565,   574,   577,   599,   600,   613,   615,
+      616,   669,   703,   705,   711,   715,   726,   728,   732,   737,
+      739,   746,   752,   793,   799,   809,   837,   840,   843,   898,
+      917,   925,   928,   930,   939,   944,   962,   968,   970,   973,
+      975,   982,  1006,  1034,  1035,  1064,  1068,  1081,  1087,  1094,
+     1103,  1109,  1130,  1134,  1135,  1139,  1154,  1156,  1166,  1189,
+     1190,  1203,  1205,  1207,  1217,  1237,  1262,  1266,  1290,  1307,
+     1326,  1337,  1346,  1360,  1367,  1368,  1231,  1190,   111,   141,
+      143,   497,   759,   791,   577,   733,   682,   852,  1216,   393,
+      512,   664,   665,   666,   667,   668,   669,   670,   671,   672,
+      673,   674,   675,   676,   536,   677,   678,   537,   679,   680,
+      681,   682,   683,   684,   685,   686,   687,   688,   689,   690,
+      691,   692,   693,   694,   695,   696,   697,   698,   699,   700,
+      701,   702,   703,   704,   705,   706,   707,   708,   709,   710,
+      711,   712,   713,   714,   715,   716,   717,   718,   719,   720,
+      721,   722,   723,   724,   725,   726,   727,   621,   622,   804,
+     1045,  1089,  1113,   896,   897,   805,   192,  1001,  1026,   514,
+      481,   275,   927,   476,   601,   602,   603,  1304,   604,  1067,
+      537,   605,   503,   606,  1305,   607,   166,   870,   725,  1365,
+      913,   314,   814,   793,   576,   919,   216,  1154,   608,  1294,
+     1295,  1239,   134,   609,   360,  1220,  1023,  1041,    12,   610,
+      624,   184,   975,   793,   130,   586,   550,   794,   421,  1148,
+      657,   795,   611,   612,    37,   740,   613,  1068,   245,  1350,
+     1197,   217,  1155,    91,  1161,   469,   997,   236,  1255,   614,
+      695,   958,   244,  1346,   364,  1256,   298,   361,   483,  1093,
+     1128,  1246,   905,   919,  1082,   176,   938,   397,   941,   615,
+      752,   135,   616,   296,   449,    68,   130,   297,   461,   586,
+     1349,   379,  1359,  1315,   360,  1220,   221,   853,  1184,    36,
+      617,   365,  1257,   136,   618,  1322,     9,   406,   828,   850,
+      450,  1269,   417,   973,   104,   451,   229,  1223,   836,   884,
+      400,  1224,   173,   929,   452,   668,   453,   454,   669,   211,
+     1136,   550,   105,   455,   157,  1258,  1200,   168,  1000,   247,
+     1360,   188,   989,  1231,   146,   799,   484,   672,   681,   815,
+      138,   736,   104,   201,   222,   322,   451,   863,  1024,  1185,
+      557,   147,   801,   415,   921,   692,   935,  1361,  1294,   229,
+     1223,    10,   275,   282,   396,   493,   561,   675,   677,   836,
+      859,   884,   927,  1238,  1239,  1361,  1229,   408,   482,    59,
+      400,  1019,  1224,   137,   145,   620,   796,   213,  1144,   741,
+      742,   743,  1230,   619,  1069,   170,   899,    90,   183,   974,
+     1197,   997,   754,   984,  1322,   155,   957,   346,  1122,   561,
+      677,   278,  1209,   456,  1284,   207,  1123,   794,   587,   721,
+     1325,   116,   520,   159,  1329,   184,   975,   475,   588,    84,
+      110,   488,   386,   667,   137,   620,   421,  1148,   919,   234,
+      235,   362,  1233,  1240,  1252,   536,   559,   200,   524,   375,
+     1326,   276,    84,    85,    86,    87,    88,    89,    90,    91,
+       92,    93,    94,    95,    96,   502,   525,  1303,   526,   882,
+      167,   168,   131,   589,   657,   795,   883,   191,   999,  1203,
+      399,   755,  1215,  1216,   357,  1198,   526,   557,   558,  1021,
+      135,   616,   576,   595,   621,   131,   200,   214,   242,   263,
+      524,   589,   604,   749,  1031,  1067,  1074,  1110,  1150,  1318,
+      238,  1263,   175,   931,    20,   264,   374,   382,  1168,  1313,
+      754,   984,   102,   436,   431,  1199,   619,  1069,   249,   664,
+      393,   512,   380,  1362,   836,   884,    76,   916,  1032,    79,
+       80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+       90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+      100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+      110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+      120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+      130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+      140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+      150,   151,   152,   153,   154,   155,   156,   157,   158,   159,
+      160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
+      170,   171,   172,   173,   174,   175,   176,   177,   178,   179,
+      180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+      190,   191,   192,   193,   194,   195,   196,   197,   198,   199,
+      200,   201,   202,   203,   204,   205,   206,   207,   208,   209,
+      210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+      220,   221,   222,   223,   224,   225,   226,   227,   228,   229,
+      230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
+      240,   241,   242,   243,   244,   245,   246,   247,  1179,   185,
+      976,   379,  1359,   537,   605,   622,  1241,  1022,   457,   670,
+      756,   152,   816,   391,   458,   503,   606,  1305,  1042,  1344,
+     1180,   680,   803,   394,   728,   498,   710,  1204,   743,   409,
+      510,  1203,   193,  1002,  1231,   190,   998,   481,    18,    77,
+      659,  1296,   156,  1120,   684,   862,   420,  1118,   212,  1143,
+       54,   963,  1119,   322,   863,   469,    84,   110,   159,   173,
+      175,   390,   432,   488,   838,   929,   931,   950,  1121,  1200,
+     1294,  1295,  1329,    33,   582,   960,  1084,    40,   864,  1095,
+     1132,   226,  1196,   443,   742,   845,   986,   218,  1156,   914,
+       13,   426,   477,   486,   487,   527,   611,   623,   673,   674,
+      977,  1343,   624,  1344,  1180,  1109,   125,   566,   625,   626,
+      215,   528,   612,   978,  1152,  1345,   627,   628,   629,   630,
+      631,   632,   633,   634,   635,   636,   637,   638,   639,   640,
+      641,   642,   643,   644,   645,   646,   647,   648,   649,   650,
+      651,   652,   653,   654,   655,   656,   657,   658,   659,   660,
+      661,   156,  1120,  1022,   662,   186,   979,  1327,    37,   740,
+      132,   590,   342,  1046,   412,   663,   199,   459,   841,  1157,
+      664,   665,   666,   667,   668,   669,   670,   671,   672,   673,
+      674,   675,   676,   677,   678,   679,   680,   681,   682,   683,
+      684,   685,   686,   687,   688,   689,   690,   691,   692,   693,
+      694,   695,   696,   697,   698,   699,   700,   701,   702,   703,
+      704,   705,   706,   707,   708,   709,   710,   711,   712,   713,
+      714,   715,   716,   717,   718,   719,   720,   721,   722,   723,
+      724,   725,   726,   727,    30,   529,    75,  1301,   686,   887,
+      380,  1362,   158,  1323,   191,   999,    47,   917,  1227,   708,
+     1191,  1023,  1113,   201,  1024,   195,  1025,  1026,   507,  1193,
+      505,  1027,   980,   187,   981,   982,   983,   984,    60,   190,
+      257,   401,   423,   516,   680,   684,   803,   862,   998,  1028,
+     1234,  1242,  1283,  1200,   398,  1158,   120,   548,   140,   738,
+     1322,   682,   852,   208,  1133,   394,   728,   729,  1070,   730,
+      311,   731,   395,   732,   733,   491,   452,   668,   613,  1068,
+      150,   808,   216,   247,  1154,  1360,   710,  1204,    14,   712,
+     1210,   506,  1061,  1310,  1062,  1063,  1064,  1065,  1066,  1067,
+     1068,  1069,  1070,  1071,  1072,  1073,  1074,  1075,  1076,  1077,
+     1078,  1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,
+     1088,  1089,  1090,  1091,  1092,  1093,  1094,  1095,  1096,  1097,
+     1098,  1099,  1100,  1101,  1102,  1103,  1104,  1105,   734,  1071,
+      735,   729,  1070,  1036,  1088,  1037,   138,   736,   139,   737,
+      140,   738,   505,  1027,   739,    37,   740,   741,   742,   743,
+     1230,  1214,    15,    16,    17,    18,    19,    20,    21,    22,
+       23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+       33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+       43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+       53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+       63,    64,    65,    66,    67,    68,   526,   235,  1240,   744,
+     1072,   744,  1072,  1339,    40,   156,   205,   245,   302,   303,
+      316,   333,   348,   370,   379,   542,   546,   692,   822,   823,
+      864,   903,   935,  1112,  1120,  1145,  1289,  1350,  1359,  1299,
+      316,   822,   370,  1289,   550,   203,   329,   704,   885,  1055,
+     1096,  1153,  1159,  1272,   280,   288,   745,    38,   746,   337,
+      943,    56,   991,    62,  1060,   471,  1064,  1138,  1197,   747,
+     1073,    44,   888,    91,  1161,   236,  1255,   748,   749,  1074,
+      985,  1308,  1288,   359,  1205,   326,   877,   490,   827,   940,
+     1101,  1273,   312,   750,   751,   752,   753,    80,   251,   111,
+      497,   173,   929,   493,   561,   675,   677,   754,   984,   276,
+       84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+       94,    95,    96,   399,   755,  1215,  1216,  1031,    76,  1032,
+      756,   358,  1201,   757,    14,   291,   433,   399,   755,  1215,
+     1216,   679,   758,    18,    77,   243,  1330,  1331,  1332,   217,
+     1155,   453,   303,   546,   294,   442,   823,   141,   759,   443,
+      627,   760,   628,   761,   629,   762,   630,   763,   631,   764,
+      632,   765,   633,   766,   634,   767,   635,   768,   636,   769,
+      637,   770,   638,   771,   639,   772,   640,   773,   641,   774,
+      642,   775,   643,   776,   644,   777,   645,   778,   646,   779,
+      647,   780,   648,   781,   649,   782,   650,   783,   651,   784,
+      652,   785,   653,   786,   654,   787,   655,   788,   656,   789,
+      205,  1112,   118,   155,   223,   224,   533,   957,  1090,  1106,
+     1186,  1187,  1268,  1276,   557,   558,  1090,  1106,   142,   790,
+      723,  1334,   253,   995,   196,   354,   378,  1033,  1172,  1356,
+      352,  1151,   143,   791,   702,  1127,   718,  1316,    46,    91,
+      531,   747,   832,   910,  1073,  1161,   179,   959,   108,   466,
+       62,  1060,   469,   302,   542,   685,   723,   872,  1334,   454,
+      669,   144,   792,   112,   499,   725,  1365,   793,   794,   657,
+      795,   145,   796,   997,   797,    82,   177,   269,   953,  1029,
+      270,   798,  1075,   146,   799,    83,   274,   800,  1076,   147,
+      801,  1114,  1297,   148,   802,   236,  1255,   703,  1139,   836,
+      884,   680,   803,    22,   444,   741,    81,   254,   621,   804,
+     1113,   805,   311,   731,   149,   806,   348,  1145,   275,   927,
+      614,   907,   199,   315,   346,   353,   418,   420,   422,   443,
+      459,   657,   727,   795,   819,  1039,  1118,  1122,  1162,  1213,
+     1370,  1214,  1040,   199,   200,   201,   399,  1215,  1216,   741,
+      481,  1216,  1041,   265,  1217,   742,   576,   743,  1216,  1218,
+      896,   897,  1229,  1230,   198,   475,   588,  1038,   142,   790,
+      281,   289,   530,   561,   677,   531,   832,   358,  1201,  1259,
+      124,   565,   807,   307,   591,   150,   808,   355,  1174,   961,
+      532,  1065,   434,   695,   958,   384,   666,   757,   310,   600,
+      329,   885,   358,  1201,    14,    40,   864,  1344,    39,   809,
+      313,   810,   121,   562,   486,   673,    43,   886,    45,   889,
+     1052,   532,  1065,   324,   873,   151,   811,   128,   581,   812,
+     1306,   291,   433,    69,   813,   837,   944,  1216,   314,   814,
+      229,  1223,   400,  1224,  1200,   681,   815,   386,   667,   264,
+     1168,  1022,   152,   816,  1042,   469,   507,  1193,   280,   288,
+      326,   877,   718,  1316,    50,   325,   414,   876,   915,   933,
+      315,   819,   101,   435,   102,   436,   118,   533,   985,  1308,
+      119,   534,   535,   536,   537,  1121,   408,   482,   366,  1260,
+      367,  1261,   538,   333,   903,   662,   227,  1202,   539,   676,
+      300,   540,   244,  1346,  1099,  1245,   297,   461,   362,  1252,
+      281,   289,   817,   818,   327,   878,   346,  1122,  1093,  1128,
+      230,  1225,   865,  1078,   211,   914,  1136,   315,   819,   413,
+      820,    68,  1349,   207,  1123,   301,   541,   713,  1235,   233,
+     1232,   821,   316,   822,   823,   302,   542,   824,  1077,    80,
+      251,   244,  1346,    61,  1044,   317,   825,   416,   928,   292,
+      437,   364,  1256,   543,   833,   544,    70,   545,   826,   880,
+      919,    56,   367,   991,  1261,   119,   534,   119,   534,    96,
+     1312,   923,   237,  1262,   238,  1263,   827,   303,   546,   460,
+      547,  1066,   726,  1367,    22,    34,    44,    50,    58,    66,
+      298,   308,   309,   325,   358,   361,   363,   373,   414,   444,
+      483,   492,   592,   593,   597,   681,   734,   744,   807,   812,
+      815,   876,   888,   890,   891,   915,   933,   948,   951,  1013,
+     1071,  1072,  1080,  1093,  1099,  1128,  1201,  1245,  1246,  1254,
+     1277,  1298,  1306,   626,  1195,  1221,   315,   819,    57,    74,
+       76,    86,    96,   101,   232,   271,   278,   341,   399,   404,
+      424,   425,   428,   435,   468,   490,   496,   551,   553,   567,
+      625,   662,   699,   712,   742,   748,   755,   830,   845,   912,
+      916,   923,   949,   965,   986,   995,   996,  1014,  1023,  1030,
+     1032,  1041,  1062,  1165,  1169,  1195,  1199,  1208,  1209,  1210,
+     1212,  1215,  1228,  1244,  1250,  1253,  1282,  1312,  1324,  1366,
+      469,  1216,   102,   436,   405,   406,   282,   283,   284,   285,
+      286,   287,   288,   289,   290,   291,   292,   293,   294,   295,
+      296,   297,   407,   408,   298,   299,   409,   300,   301,   302,
+      303,   304,   410,   305,   306,   411,   307,   308,   309,   310,
+      412,   311,   312,   313,   314,   315,   413,   316,   317,   318,
+      319,   320,   321,   322,   323,   324,   325,   326,   327,   328,
+      329,   330,   331,   332,   333,   334,   414,   415,   416,   335,
+      336,   337,   338,   339,   417,   340,   341,   418,   342,   343,
+      419,   344,   345,   420,   346,   347,   348,   349,   350,   421,
+      351,   352,   353,   354,   355,   356,   357,   358,   359,   422,
+      360,   423,   361,   362,   424,   363,   364,   365,   366,   367,
+      368,   369,   370,   371,   372,   373,   374,   425,   375,   376,
+      426,   377,   427,   378,   379,   380,   126,   571,   223,  1186,
+      621,    60,  1028,    75,  1301,   481,   831,   832,   833,   834,
+      835,   836,   837,   838,   839,   840,   841,   603,   741,   842,
+     1304,  1042,   843,  1307,   153,   154,   155,   156,   157,   158,
+      159,   160,   347,  1131,   153,   161,   844,   375,  1326,  1347,
+      301,   541,   890,   514,   916,  1014,   343,  1047,   206,  1115,
+       34,   593,   679,   758,    47,   917,   918,   389,   501,   506,
+      576,   595,  1061,  1310,  1062,  1063,   390,   391,  1064,   392,
+      393,  1065,  1066,  1067,  1068,  1069,   394,  1070,   395,  1071,
+     1072,  1073,  1074,  1075,  1076,  1077,   396,  1078,  1079,  1080,
+     1081,  1082,   275,   397,  1083,  1084,  1085,  1086,  1087,  1088,
+     1089,  1090,  1091,  1092,  1093,  1094,  1095,  1096,   398,  1097,
+     1098,   399,   400,   401,  1099,  1100,  1101,  1102,  1103,  1104,
+     1105,   123,   133,   164,   256,   564,   594,   702,   858,  1127,
+     1214,    15,    16,    79,    17,    18,    80,    81,    82,    83,
+       84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+       94,    95,    96,    97,    19,    20,    98,    99,   100,   101,
+      102,    21,    22,    23,   103,   104,   105,    24,   106,    25,
+      107,   108,   109,    26,   110,    27,    28,   111,   112,   113,
+      114,    29,   257,   115,   116,   117,    30,   118,   119,   120,
+       31,   121,   122,   123,   124,   125,   126,   127,    32,   128,
+       33,   258,   129,   130,   131,   132,    34,   133,    35,   259,
+      134,   135,    36,   136,   137,   138,   139,   140,    37,    38,
+      141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+       39,   151,   152,   153,   154,   155,   156,   157,   158,   159,
+      160,   161,   162,   163,   164,    40,    41,   165,   166,    42,
+      167,   168,    43,    44,    45,   169,   170,   171,    46,    47,
+      172,    48,   173,   174,   175,    49,    50,    51,   176,   260,
+       52,   177,   178,    53,   179,   180,    54,   181,   261,   182,
+       55,   262,   183,   184,   185,   186,   187,   188,    56,   189,
+       57,   190,   191,   192,   193,    58,   194,    59,   195,    60,
+      196,   197,   198,   199,   200,   201,    61,   202,   203,    62,
+      263,   204,   205,   206,   207,   208,   209,   210,   211,    63,
+      212,   213,   214,   215,   216,   217,   218,   219,   220,   264,
+      221,   222,   223,   224,   225,    64,   226,   227,   228,   265,
+      229,   230,   231,   232,   233,   234,   235,   266,   236,   237,
+      238,   239,    65,   240,   241,    66,   267,    67,   242,   243,
+      268,   244,    68,   245,   246,   247,   118,   533,   720,  1320,
+     1321,   526,   595,  1179,  1029,   828,   168,  1000,   657,   727,
+      795,  1370,  1216,   985,  1308,   212,   980,  1143,   187,   981,
+      982,   983,   984,  1285,   341,   699,  1030,   986,   425,  1324,
+      693,   942,   185,   976,  1276,     9,   406,   191,   999,   111,
+      497,     0,    15,   829,   987,  1085,   260,   410,   574,   939,
+      919,   695,   958,   721,  1325,   375,  1326,   749,  1074,  1203,
+     1231,    18,    77,  1327,   686,   887,   150,   808,   216,   247,
+     1154,  1360,   506,  1061,  1310,  1062,  1063,  1064,  1065,  1066,
+     1067,  1068,  1069,  1070,  1071,  1072,  1073,  1074,  1075,  1076,
+     1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,
+     1087,  1088,  1089,  1090,  1091,  1092,  1093,  1094,  1095,  1096,
+     1097,  1098,  1099,  1100,  1101,  1102,  1103,  1104,  1105,   235,
+     1240,   704,  1159,    44,   888,   236,  1255,   985,  1308,  1031,
+     1032,   196,   354,  1033,  1172,   179,   959,    82,   269,   270,
+      119,   534,   812,  1306,   431,   734,  1071,   170,   899,   239,
+     1264,   162,   398,   846,  1158,  1248,    99,   387,   148,   473,
+      802,   474,   475,   476,   477,   339,   955,  1259,   626,   535,
+      536,   537,   308,   592,  1121,   363,  1254,   408,   482,    81,
+      254,    26,    47,   167,   174,   259,   471,   478,   599,   917,
+      930,  1064,   152,   816,   722,  1328,   172,   920,   891,  1080,
+     1368,   366,  1260,    65,  1265,   710,  1204,   602,   367,  1261,
+      169,   208,   243,   292,   313,   355,   411,   437,   456,   457,
+      504,   583,   598,   670,   678,   810,   894,   905,   919,  1005,
+     1082,  1133,  1174,  1219,  1309,  1330,  1230,   480,   215,  1152,
+     1331,  1332,    83,   217,   274,   276,   469,   538,  1155,   491,
+       84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+       94,    95,    96,   203,  1055,   160,  1348,  1237,   539,   676,
+      379,  1359,   209,  1134,   159,  1329,   234,  1233,   175,   931,
+     1190,   415,   921,    68,  1349,   830,   481,   831,   832,   833,
+      834,   835,   836,   837,   838,   839,   840,   841,   603,   842,
+     1304,   843,  1307,   153,   154,   155,   156,   157,   158,   159,
+      160,   153,   161,   844,   845,  1109,  1290,   621,   804,  1113,
+      805,   184,   975,   536,   559,  1121,   302,   303,   333,   542,
+      546,   903,  1299,   550,   359,  1205,   493,   675,   224,  1187,
+      685,   872,   315,   819,   626,   133,   594,   595,  1276,   685,
+      872,   180,   962,   681,   815,   735,   215,  1152,   714,  1249,
+      427,  1355,   245,  1350,   707,  1183,  1299,    45,   889,   696,
+      988,   162,   846,   471,  1064,   214,  1150,   176,   220,   938,
+     1167,   219,  1160,    91,  1161,    89,   909,    98,   385,   841,
+     1157,  1171,   662,  1097,  1173,  1190,   245,  1350,   361,  1246,
+      196,  1033,    66,  1277,  1121,   227,  1202,   163,   847,   124,
+      180,   565,   962,  1006,   188,   989,  1231,   397,   941,   848,
+      715,  1266,   849,   716,  1267,  1294,   577,   615,   752,   850,
+       84,   110,   488,   243,  1330,  1331,  1332,   890,   891,  1080,
+      318,   851,  1092,  1124,    28,   494,    58,  1013,   687,   892,
+      343,  1047,   205,  1112,   135,   616,   296,   449,    67,    94,
+      153,   161,   258,   584,   701,   844,  1104,  1116,  1182,  1227,
+     1281,  1285,  1338,  1339,     7,    17,   221,  1184,   407,   479,
+      689,   922,   109,   467,   481,   297,   461,    56,   991,   363,
+     1254,  1282,   539,   676,   537,   544,   605,  1037,   522,   550,
+      560,   730,   733,   961,  1042,  1211,  1216,  1299,  1371,  1331,
+     1332,   472,   671,   682,   852,   853,    24,   462,   805,   854,
+      107,   465,    14,  1107,  1248,  1284,  1315,   319,   683,   855,
+      543,   833,   544,   167,   174,   930,   132,   163,   334,   590,
+      847,   904,  1351,   300,   540,  1352,   480,   856,   965,  1092,
+     1124,  1294,  1295,   244,  1346,   923,   807,  1099,  1245,   891,
+     1080,   481,   839,   966,   228,  1206,   481,   622,   231,  1226,
+     1227,   157,   187,   981,  1258,  1321,  1241,   120,   548,  1034,
+     1087,   453,    36,   617,   722,   839,   966,  1328,   365,   688,
+      906,  1257,    86,   553,   214,  1150,   659,  1296,   838,   950,
+      468,   255,   831,   577,   376,  1333,  1247,   207,  1123,   353,
+     1162,   105,   455,   277,  1302,    89,   909,   320,   857,   905,
+     1082,   164,   858,    59,  1019,     0,    15,   431,   396,   859,
+     1238,   690,   924,   438,   982,   860,   439,   983,   398,  1158,
+      321,   861,   711,  1207,   684,   862,   322,   863,   708,  1191,
+      734,  1071,    34,   593,  1248,   203,  1055,   170,   899,  1017,
+       40,   864,   230,  1225,   865,  1078,   866,   867,    93,  1181,
+      239,  1264,   120,   548,    41,   868,   690,   924,    88,   165,
+      869,    23,   445,    27,   489,   166,   870,   370,  1289,   945,
+     1083,    88,   165,   869,     6,    68,    79,   130,   144,   162,
+      170,   195,   202,   227,   268,   294,   297,   318,   331,   342,
+      343,   344,   347,   360,   369,   376,   377,   398,   442,   461,
+      547,   586,   587,   696,   717,   792,   846,   851,   899,   900,
+      988,  1008,  1025,  1036,  1046,  1047,  1050,  1057,  1066,  1088,
+     1102,  1131,  1158,  1164,  1202,  1220,  1271,  1279,  1293,  1333,
+     1335,  1349,  1354,  1037,   560,   480,  1331,    51,    73,   100,
+      228,   307,   324,   388,   591,   873,   934,  1206,  1221,  1300,
+      323,   871,   685,   872,   324,   873,    42,   874,    99,   387,
+      356,  1177,   875,  1079,   729,  1070,    32,   579,   325,   876,
+      320,   857,   326,   877,   338,   946,   330,   895,   507,  1193,
+      379,  1359,   327,   878,   186,   979,   328,   879,   880,    61,
+     1044,    71,   881,   843,  1103,  1307,  1337,   550,   297,   461,
+     1269,   408,   482,   362,  1252,   882,   167,   168,   883,   836,
+      884,  1283,   281,   289,   355,  1174,   384,   666,   329,   885,
+       43,   886,   713,  1235,   880,   681,   815,  1208,   686,   887,
+       44,   888,   215,  1152,   491,   303,   546,    45,   889,   890,
+      891,  1080,   687,   892,  1107,  1248,  1315,   231,  1226,  1227,
+      398,  1158,   403,  1063,   730,  1284,   247,  1360,   154,   893,
+      169,   894,    21,   441,   294,   442,    99,   387,   330,   895,
+      360,  1220,   508,  1364,   316,   822,   823,   711,  1207,   896,
+      897,   898,  1081,  1040,   199,   200,   201,  1290,   170,   899,
+      331,   900,    31,   556,  1285,   128,   581,    72,   817,   901,
+     1125,   818,  1126,    65,  1265,   293,   440,   332,   902,   333,
+      903,   246,  1353,   318,   377,   851,  1354,   334,   904,   342,
+     1046,   905,  1082,   882,   167,   168,   688,   906,   368,  1270,
+      907,    23,   148,   192,   221,   267,   295,   319,   323,   345,
+      357,   408,   445,   447,   473,   482,   502,   514,   525,   536,
+      559,   659,   683,   710,   716,   754,   798,   802,   853,   855,
+      871,   984,  1001,  1021,  1058,  1075,  1138,  1184,  1197,  1198,
+     1204,  1267,  1278,  1296,  1303,    36,   617,   526,   365,  1257,
+      157,  1258,   621,   121,   562,   961,   136,   618,   474,   475,
+      476,   477,    35,    42,    81,   147,   186,   241,   253,   254,
+      339,   412,   596,   663,   801,   874,   955,   979,  1275,  1322,
+      332,   902,   171,   908,    89,   909,    33,   582,   371,  1291,
+       52,   947,   141,   759,   443,   376,  1333,    46,   910,   199,
+      459,     9,   406,   186,   979,   182,   969,   372,  1292,   106,
+      463,    29,   515,   403,   421,   505,   537,   544,   605,   735,
+      794,   828,   850,  1026,  1027,  1037,  1063,  1129,  1148,  1241,
+     1259,   730,  1371,   626,   522,   550,   560,   730,   733,   961,
+     1022,  1042,  1211,  1216,  1299,  1371,  1331,  1332,  1221,   389,
+      501,   390,   391,   392,   393,   394,   395,   396,   397,   398,
+      399,   400,   401,    25,   464,   911,   747,  1073,   450,    73,
+     1300,   912,  1091,  1108,  1269,   472,   671,   948,   949,    74,
+     1238,   417,   973,   798,  1075,   299,   495,   838,   950,   992,
+       26,    47,   167,   174,   237,   259,   265,   471,   478,   535,
+      599,   917,   930,  1064,  1217,  1262,   682,   852,   536,   537,
+      913,  1023,    91,  1161,   905,  1082,   104,   201,   322,   451,
+      863,  1024,   229,  1223,   836,   884,   400,  1224,   170,   899,
+     1203,   173,   929,  1200,   914,  1109,   215,  1152,    75,  1301,
+      401,  1234,   140,   738,   452,   668,   490,    76,    18,    77,
+      453,   723,  1334,   454,   669,   414,   915,   211,  1136,    44,
+       66,   308,   592,   888,   951,  1277,   404,   995,  1212,   405,
+      406,   407,   408,   409,   410,   411,   412,   413,   414,   415,
+      416,   417,   418,   419,   420,   421,   422,   423,   424,   425,
+      426,   427,   916,    47,   917,   918,   576,   595,   919,   150,
+      808,   172,   920,   355,   457,   598,   670,   678,  1174,   415,
+      921,   550,   685,   872,   714,  1249,  1121,   153,   161,   844,
+     1104,  1338,  1339,   689,   922,   363,  1254,   923,   468,   105,
+      455,   690,   924,   690,   924,  1036,  1088,  1037,   330,   895,
+      730,   267,   408,   482,  1278,   157,  1258,   961,    81,   254,
+       26,    47,   167,   174,   259,   471,   478,   599,   917,   930,
+     1064,    91,  1161,  1200,   714,  1249,  1104,  1338,  1339,   152,
+      168,   816,  1000,   247,  1360,   713,  1235,    78,   283,   263,
+     1110,   722,  1328,   152,   168,   225,   700,   816,  1000,  1059,
+     1188,   551,   304,   552,    48,   925,  1211,   106,   188,   463,
+      989,  1231,   691,   926,   275,   927,   416,   928,   351,  1149,
+      173,   929,   167,   174,   930,   146,   799,  1208,  1209,   175,
+      931,   247,  1360,   236,  1255,   484,   672,   301,   541,   681,
+      815,   138,   736,    92,   694,   952,  1175,   679,   758,   661,
+      824,  1077,  1286,  1369,    49,   932,    50,   933,   232,  1228,
+       94,  1182,   163,   847,   824,  1077,   332,   902,    51,   934,
+      218,  1156,   692,   935,   136,   618,   856,   717,  1293,  1299,
+      360,  1220,   742,    33,    43,   104,   201,   222,   249,   322,
+      451,   453,   532,   582,   664,   713,   800,   863,   886,  1024,
+     1065,  1076,  1185,  1235,  1327,   346,  1122,   557,   172,   204,
+      920,  1111,  1012,  1229,   160,  1348,   335,   936,   336,   937,
+     1041,   176,   938,   260,   939,   940,   397,   941,   693,   942,
+      337,   943,   311,   731,   837,   944,   164,   858,   945,  1083,
+      338,   946,    21,   441,   147,   801,    52,   947,   948,   949,
+      838,   950,   951,  1212,   694,   952,    95,   117,   248,   284,
+      415,   521,   682,   852,   921,  1056,  1280,   522,   177,   953,
+      178,   954,   327,   328,   878,   879,   424,  1165,  1253,   339,
+      955,   756,    53,   956,  1012,    19,   381,   706,  1176,    85,
+      115,   519,   155,   957,  1042,   206,  1115,   695,   958,   179,
+      959,   707,  1183,   587,   356,  1177,   128,   581,   960,  1084,
+      961,  1230,   180,   962,   233,   434,   543,   833,  1232,   544,
+      306,   580,    54,   963,   181,   964,   891,  1080,    78,   283,
+      965,   839,   966,   261,   967,   396,   859,  1238,   840,   968,
+      182,   969,    55,   970,  1368,    50,   933,   551,   748,  1366,
+      749,  1074,  1006,   304,   552,   496,   692,   935,   111,   497,
+      366,  1260,    65,  1265,    27,   489,   324,   873,   262,   971,
+      972,  1010,    48,    64,   197,   705,   925,  1035,  1166,  1189,
+     1237,  1190,  1045,  1089,   417,   973,  1361,    59,  1019,    90,
+      183,   974,   278,  1284,   184,   975,   263,  1110,    20,   382,
+       79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+       89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+       99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+      109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
+      119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+      129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+      139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+      149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
+      159,   160,   161,   162,   163,   164,   165,   166,   167,   168,
+      169,   170,   171,   172,   173,   174,   175,   176,   177,   178,
+      179,   180,   181,   182,   183,   184,   185,   186,   187,   188,
+      189,   190,   191,   192,   193,   194,   195,   196,   197,   198,
+      199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
+      209,   210,   211,   212,   213,   214,   215,   216,   217,   218,
+      219,   220,   221,   222,   223,   224,   225,   226,   227,   228,
+      229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
+      239,   240,   241,   242,   243,   244,   245,   246,   247,  1179,
+      185,   976,   498,   977,   978,   186,   979,   980,   187,   981,
+      982,   983,   984,    60,  1028,   710,  1204,  1014,   985,  1308,
+      986,   987,  1085,   184,   975,   224,  1187,   315,   819,   133,
+      594,   595,  1299,   696,   988,   188,   989,  1231,  1294,   248,
+      284,   990,   695,   958,  1098,  1178,  1311,  1179,  1180,    86,
+      553,    56,   991,   992,  1211,   697,   993,   189,   994,   995,
+       57,   996,   259,   599,   997,   190,   998,   191,   999,   168,
+     1000,   134,   609,   192,  1001,   193,  1002,   602,  1095,  1132,
+      554,   835,  1003,   181,   555,   964,   698,  1004,   152,   816,
+      504,  1005,  1309,  1006,    42,   874,   367,  1261,   112,   499,
+      332,   902,   373,  1298,  1007,   344,   360,   369,  1008,  1057,
+     1220,  1271,  1009,  1010,   249,   664,   627,   760,   990,   628,
+      761,   629,   762,   630,   763,   631,   764,   632,   765,   633,
+      766,   634,   767,   635,   768,   636,   769,   637,   770,   638,
+      771,   639,   772,   640,   773,   641,   774,   642,   775,   643,
+      776,   644,   777,   645,   778,   646,   779,   647,   780,   648,
+      781,   649,   782,   650,   783,   651,   784,   652,   785,   653,
+      786,   654,   787,   655,   788,   656,   789,   391,   458,   262,
+      971,   340,  1011,   229,  1223,  1012,     0,    10,    14,    15,
+       36,    37,    75,    93,    95,    98,    99,   106,   113,   117,
+      125,   128,   129,   134,   138,   169,   182,   188,   189,   196,
+      208,   243,   248,   261,   275,   282,   284,   292,   301,   313,
+      314,   337,   352,   354,   355,   364,   378,   380,   384,   385,
+      387,   396,   411,   415,   431,   437,   456,   457,   460,   463,
+      493,   498,   503,   504,   507,   508,   511,   521,   541,   561,
+      566,   581,   583,   585,   598,   606,   609,   617,   666,   670,
+      675,   677,   678,   682,   689,   691,   695,   714,   720,   736,
+      740,   745,   810,   814,   836,   841,   848,   852,   859,   860,
+      865,   866,   875,   880,   884,   894,   905,   907,   913,   919,
+      921,   922,   926,   927,   943,   958,   967,   969,   985,   989,
+      994,  1005,  1033,  1056,  1078,  1079,  1082,  1092,  1097,  1107,
+     1124,  1133,  1151,  1157,  1171,  1172,  1173,  1174,  1181,  1193,
+     1218,  1219,  1231,  1236,  1238,  1239,  1247,  1248,  1249,  1256,
+     1280,  1284,  1301,  1305,  1308,  1309,  1315,  1320,  1330,  1356,
+     1361,  1362,  1364,  1229,  1230,   480,   372,  1292,  1321,   130,
+      586,   408,   482,   215,  1152,   522,  1211,  1331,  1332,    93,
+     1181,    94,  1182,  1042,   707,  1183,   396,   859,  1238,   514,
+      481,   526,   595,  1344,   481,  1179,  1180,   831,   832,   833,
+      834,   835,   836,   837,   838,   839,   840,   841,    59,    83,
+      149,   151,   217,   239,   274,   276,   277,   400,   427,   469,
+      470,   538,   603,   690,   721,   741,   757,   806,   811,   842,
+      924,  1019,  1155,  1224,  1264,  1302,  1304,  1325,  1339,  1355,
+      491,  1042,   843,  1307,    84,    85,    86,    87,   153,    88,
+      154,    89,   155,    90,   156,    91,    92,    93,    94,   157,
+       95,    96,   158,   159,   160,   697,   993,   137,   145,   500,
+      620,   796,   501,   502,   503,   504,   505,   506,   507,   508,
+      250,   285,   744,  1072,   203,  1055,   177,   953,    58,  1013,
+      347,  1131,    31,   556,   798,  1075,  1327,   204,  1111,   160,
+     1348,  1237,  1014,   255,   831,  1094,  1130,   153,   161,   844,
+      255,   831,   392,   509,   213,  1144,   194,  1015,   539,   676,
+      295,   447,  1016,  1086,   178,   954,  1017,   350,  1147,   371,
+     1291,   310,   600,   409,   510,   319,   683,   855,   379,  1359,
+      106,   463,    29,   515,   209,   739,  1134,   159,  1329,   234,
+     1233,   175,   931,   741,   742,   743,  1230,    80,   251,    98,
+      385,  1190,   219,  1160,   242,  1318,   427,  1355,   189,   994,
+      113,   511,   226,   356,   403,   421,   505,   537,   544,   605,
+      735,   794,   828,   850,  1026,  1027,  1037,  1063,  1129,  1148,
+     1177,  1196,  1241,  1259,   730,  1371,   144,   792,   626,    49,
+      932,  1170,  1288,   370,  1289,  1018,   112,   499,   415,   921,
+      238,  1263,   102,   436,   619,  1069,    68,  1349,   492,   830,
+      481,   831,   832,   833,   834,   835,   836,   837,   838,   839,
+      840,   841,   603,   842,  1304,   843,  1307,   153,   154,   155,
+      156,   157,   158,   159,   160,   153,   161,   844,   170,   899,
+       59,  1019,   505,  1027,   691,   926,   845,   252,   665,    90,
+      183,   974,   522,   550,   560,   730,   733,   961,  1022,  1042,
+     1211,  1216,  1299,  1371,  1331,  1332,  1020,   327,   328,   878,
+      879,   821,  1216,   329,   885,    38,    55,   116,   139,   375,
+      407,   417,   479,   520,   715,   737,   746,   970,   973,  1109,
+     1203,  1266,  1290,  1326,   621,   804,  1113,   805,   166,   870,
+      184,   975,  1197,   997,   298,   483,   360,  1220,   138,   736,
+      536,   559,  1021,   135,   616,   374,  1313,   754,   984,   159,
+     1121,  1329,    40,   864,   742,   845,   986,  1022,   342,  1046,
+     1227,  1023,  1113,   201,  1024,   195,  1025,  1026,   505,  1027,
+      423,  1242,  1322,   205,   302,   303,   316,   333,   348,   370,
+      542,   546,   822,   823,   903,  1112,  1145,  1289,  1299,   316,
+      822,   370,  1289,   550,  1096,  1153,  1272,   359,  1205,   827,
+     1101,  1273,   173,   929,   493,   675,   358,  1201,   303,   546,
+      294,   442,   823,   443,   205,  1112,   155,   224,   957,  1187,
+      557,   558,   253,   995,   378,  1356,   352,  1151,   302,   542,
+      685,   872,    22,   444,    81,   254,   348,  1145,   275,   927,
+      315,   346,   819,  1122,   198,   475,   588,  1038,   561,   677,
+      626,    74,   278,   424,   625,   923,   965,  1023,  1041,  1165,
+     1209,  1250,  1253,   469,    60,  1028,   133,   594,   595,  1029,
+      341,   699,  1030,  1276,   247,  1360,  1031,  1032,   339,   955,
+      456,   685,   872,   841,  1157,  1171,   245,  1350,   196,  1033,
+      180,   962,   205,  1112,    67,  1281,  1282,    14,  1284,  1294,
+     1295,  1034,  1087,   722,  1328,   659,  1296,   207,  1123,    23,
+      445,  1221,   681,   815,   215,  1152,   514,   735,   794,   215,
+     1152,   401,  1234,  1012,   587,   128,   581,   714,  1249,   427,
+      721,  1325,  1355,   116,   520,   159,  1329,    40,   864,   245,
+     1350,   707,  1183,   824,  1077,   346,  1122,   197,  1035,   184,
+      975,   913,  1299,  1036,  1088,  1037,   198,   475,   588,  1038,
+      438,   982,   418,  1039,  1040,   199,   200,   201,  1041,   896,
+     1042,  1043,    84,   110,   488,    61,  1044,  1045,  1089,    63,
+     1137,   342,  1046,   343,  1047,   717,  1293,   154,   893,   169,
+      894,   331,   900,  1093,  1128,    57,   996,   230,   386,   667,
+     1225,   137,   620,   680,   803,    45,   889,   696,   988,   421,
+     1148,  1048,   919,   865,  1078,   419,  1049,   234,   235,   362,
+     1233,  1240,  1252,   213,  1144,   221,  1184,   504,  1005,  1309,
+      536,   559,   255,   831,   256,   257,   258,   259,   260,   261,
+      262,   263,   264,   265,   266,   267,   268,   222,  1185,   259,
+      599,   997,   200,   524,   190,   998,   191,   999,   223,  1186,
+      347,  1131,   375,  1326,   389,   501,   390,   391,   392,   393,
+      394,   395,   396,   397,   398,   399,   400,   401,   168,  1000,
+       82,   269,   270,   276,    84,    85,    86,    87,    88,    89,
+       90,    91,    92,    93,    94,    95,    96,   536,   559,   240,
+     1274,   224,  1187,   134,   609,   875,  1079,   502,   525,  1303,
+      526,   192,  1001,   193,  1002,   882,   167,   168,    25,   464,
+     1319,   202,  1050,   162,   846,   131,   589,   471,  1064,   657,
+      795,   756,   214,  1150,   883,  1051,  1052,  1250,  1053,  1054,
+       21,    28,    52,    53,    63,   118,   127,   152,   155,   168,
+      176,   191,   206,   211,   212,   219,   220,   223,   224,   225,
+      240,   255,   262,   304,   335,   368,   441,   491,   494,   533,
+      552,   554,   572,   573,   697,   700,   707,   708,   729,   816,
+      831,   835,   914,   936,   938,   945,   947,   956,   957,   971,
+      980,   993,   997,   999,  1000,  1003,  1017,  1059,  1070,  1083,
+     1090,  1106,  1115,  1136,  1137,  1143,  1160,  1167,  1183,  1186,
+     1187,  1188,  1191,  1268,  1270,  1274,  1276,   557,   558,   210,
+     1135,   219,  1160,   315,   819,   187,   981,   224,  1187,    91,
+     1161,   112,   499,  1090,  1106,   225,  1188,   212,  1143,    64,
+     1189,  1190,   211,  1136,    63,  1137,   982,   983,   984,  1098,
+     1178,  1311,  1179,  1180,   107,   465,   567,    87,   122,   563,
+     1276,   413,   820,   273,   287,    58,  1013,  1163,  1003,   481,
+      227,  1202,   713,  1235,   549,   834,   550,   718,  1316,   702,
+     1127,   496,    86,   553,   142,   790,   394,   395,   728,   732,
+      733,    68,  1349,   207,  1123,   682,   852,   208,  1133,   712,
+     1210,   729,  1070,    56,   991,  1268,   108,   466,   723,  1334,
+       40,   864,  1093,  1128,   230,  1225,   865,  1078,   301,   541,
+      577,   109,   467,   132,   590,    89,   909,   203,  1055,   268,
+      294,   376,   442,  1164,  1333,  1335,   560,    99,   387,  1269,
+      408,   482,   342,  1046,   368,  1270,   710,   716,  1204,  1267,
+      241,   253,  1275,  1129,   992,   265,  1217,   723,  1334,    66,
+     1277,   995,   153,   161,   844,   468,  1036,  1088,  1037,   330,
+      895,   267,  1278,   713,  1235,   551,   304,   552,  1211,   824,
+     1077,   218,  1156,   360,  1220,   742,   346,  1122,  1212,  1056,
+     1165,   233,  1232,   551,   304,   552,    48,    64,   197,   705,
+      925,  1035,  1166,  1189,  1190,   184,   975,   224,  1187,   133,
+      594,   595,    86,   553,  1211,   554,   835,   555,   344,   369,
+     1057,  1271,    98,   106,   125,   129,   134,   138,   188,   189,
+      196,   261,   314,   352,   354,   378,   385,   463,   498,   508,
+      566,   585,   609,   689,   691,   736,   745,   814,   841,   865,
+      875,   913,   922,   926,   967,   989,   994,  1033,  1078,  1079,
+     1151,  1157,  1171,  1172,  1231,  1356,  1364,   130,   586,  1211,
+      277,  1302,   697,   993,    31,   556,  1094,  1130,   189,   994,
+      691,   926,   821,    38,   746,  1203,   845,   986,   316,   822,
+      823,   316,   822,  1096,  1153,  1272,  1101,  1273,   823,   557,
+      558,   995,   302,   542,   348,  1145,   275,   927,   198,   475,
+      588,  1038,   625,  1023,  1041,   824,  1077,    57,   996,   259,
+      599,   997,   190,   998,   191,   999,   347,  1131,   168,  1000,
+      536,   559,   240,  1274,   134,   609,   192,  1001,   193,  1002,
+      560,   352,   498,  1151,   143,   791,   664,   665,   666,   667,
+      668,   669,   670,   671,   672,   673,   674,   675,   676,   677,
+      678,   679,   680,   681,   682,   683,   684,   685,   686,   687,
+      688,   689,   690,   691,   692,   693,   694,   695,   696,   697,
+      698,   699,   700,   701,   702,   703,   704,   705,   706,   707,
+      708,   709,   710,   711,   712,   713,   714,   715,   716,   717,
+      718,   719,   720,   721,   722,   723,   724,   725,   726,   727,
+      561,   677,   662,   711,  1207,   710,  1204,   136,   372,   602,
+      608,   618,  1292,  1299,    80,   251,   345,  1058,   121,   562,
+      416,   928,   351,  1149,   866,    87,   122,   563,   359,  1205,
+      896,   897,   390,   432,  1095,  1132,   226,  1196,  1036,  1088,
+     1037,   399,   755,  1215,  1216,   425,  1324,   621,   702,  1127,
+      195,  1025,   554,   835,  1003,   718,  1316,    38,   746,   198,
+      475,   588,  1038,   240,  1274,   181,   555,   964,   726,  1367,
+      252,   665,   244,  1346,  1095,  1132,   138,   736,   208,  1133,
+      139,   737,   209,  1134,   140,   738,   438,   982,   418,  1039,
+     1040,   199,   200,   201,  1041,   896,  1042,   210,  1135,   211,
+     1136,    63,  1137,   241,  1275,  1138,  1043,   481,    46,    91,
+      103,   181,   446,   531,   549,   555,   747,   832,   834,   910,
+      911,   964,  1073,  1161,   550,    84,   110,   488,   173,   929,
+     1285,   220,  1167,   698,  1004,   143,   791,   341,   699,  1030,
+      343,  1047,   152,   816,   700,  1059,   469,   898,  1081,   123,
+      564,   350,  1147,   268,   376,  1333,  1335,   179,   959,   108,
+      466,  1040,   199,   200,   201,   264,  1168,   914,  1096,  1153,
+      470,    61,  1044,   840,   968,    62,  1060,    62,  1060,    61,
+     1044,    35,   596,   471,  1064,    62,  1060,   167,   174,   930,
+      357,  1198,    43,   886,  1045,  1089,   505,  1027,   504,  1005,
+     1309,   146,   799,   121,   562,   692,   935,   417,   973,   422,
+     1213,  1214,   399,  1215,  1216,   265,  1217,  1216,  1218,   897,
+       34,   593,  1299,   242,  1318,   687,   709,   892,  1192,   992,
+     1208,   317,   825,  1209,    57,   996,   469,    63,  1137,   342,
+     1046,   343,  1047,   717,  1293,   698,  1004,   266,  1243,   416,
+      928,   175,   931,   427,  1355,   247,  1360,    37,   740,   154,
+      893,   169,   894,   331,   900,   124,   565,    90,   183,   974,
+     1006,   726,  1367,  1105,  1357,   526,   557,   558,   236,  1255,
+      506,  1061,  1310,  1062,  1063,  1064,  1065,  1066,  1067,  1068,
+     1069,  1070,  1071,  1072,  1073,  1074,  1075,  1076,  1077,  1078,
+     1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,
+     1089,  1090,  1091,  1092,  1093,  1094,  1095,  1096,  1097,  1098,
+     1099,  1100,  1101,  1102,  1103,  1104,  1105,  1090,  1106,  1090,
+     1106,   747,  1073,   208,  1133,  1219,  1107,  1021,    42,   874,
+     1091,  1108,  1109,   263,  1110,   860,  1097,  1173,   204,  1111,
+      370,  1289,   205,  1112,  1113,  1114,   206,  1115,   701,  1116,
+      225,  1188,   171,   908,  1117,  1142,   135,   146,   616,   799,
+     1094,  1130,  1190,   393,   512,   664,   665,   666,   667,   668,
+      669,   670,   671,   672,   673,   674,   675,   676,   677,   678,
+      679,   680,   681,   682,   683,   684,   685,   686,   687,   688,
+      689,   690,   691,   692,   693,   694,   695,   696,   697,   698,
+      699,   700,   701,   702,   703,   704,   705,   706,   707,   708,
+      709,   710,   711,   712,   713,   714,   715,   716,   717,   718,
+      719,   720,   721,   722,   723,   724,   725,   726,   727,   245,
+     1350,   361,  1093,  1128,  1246,   346,  1122,   561,   677,   420,
+     1118,  1119,   487,   674,   156,  1120,  1121,   346,  1122,   207,
+     1123,   367,  1261,   271,   662,  1062,  1231,   196,  1033,  1121,
+     1092,  1124,   711,  1207,  1125,  1126,   112,   499,   702,  1127,
+     1093,  1128,   710,   716,  1204,  1267,  1129,   265,  1217,    66,
+     1277,   153,   161,   844,   742,  1094,  1130,   347,  1131,   359,
+     1205,   726,  1367,  1095,  1132,   208,  1133,   209,  1134,   210,
+     1135,   211,  1136,    63,  1137,  1138,  1121,   703,  1139,  1140,
+      209,  1134,   175,   931,  1190,   227,  1202,   575,  1141,  1142,
+      614,  1101,  1273,  1113,   576,   595,   212,  1143,   213,  1144,
+      332,   902,   321,   861,    53,   956,   348,  1145,   849,   163,
+      847,   349,  1146,   373,  1298,   302,   542,   350,  1147,   272,
+      286,   273,   287,   260,   939,   621,   124,   180,   565,   962,
+     1006,   421,  1148,   188,   989,  1231,   960,  1084,   148,   802,
+      351,  1149,    32,   121,   131,   136,   200,   214,   242,   250,
+      263,   285,   326,   332,   338,   349,   371,   372,   439,   524,
+      562,   579,   589,   602,   604,   608,   618,   679,   749,   758,
+      877,   902,   940,   946,   983,  1031,  1067,  1074,  1110,  1146,
+     1150,  1291,  1292,  1318,  1012,   238,  1263,    33,   582,  1299,
+      175,   931,   743,     1,    16,    19,    20,    27,   252,   264,
+      321,   374,   381,   382,   397,   409,   489,   510,   665,   706,
+      861,   941,  1168,  1176,  1313,  1344,  1203,  1294,  1195,   127,
+      572,   114,   513,   325,   876,   685,   723,   872,  1334,   454,
+      669,   898,  1081,   853,    80,   251,  1029,    83,   274,  1114,
+      703,  1139,   292,   437,  1290,   214,  1150,   708,  1191,   384,
+      666,   345,   502,   525,   754,   984,  1058,  1303,   526,   121,
+      562,   170,   899,   404,   405,   406,   407,   408,   409,   410,
+      411,   412,   413,   414,   415,   416,   417,   418,   419,   420,
+      421,   422,   423,   424,   425,   426,   427,   679,   758,   206,
+     1115,   364,   848,  1256,   739,   219,  1160,   144,   792,   112,
+      499,   715,  1266,   352,  1151,   215,  1152,   849,    39,   809,
+     1096,  1153,   102,   436,   821,   331,   900,   716,  1267,   193,
+     1002,  1294,   472,   671,   709,  1192,   290,   402,  1100,  1251,
+      473,   474,   475,   476,   477,    26,   478,   573,   103,   446,
+      431,  1199,   313,   810,   121,   562,   270,   619,  1069,   275,
+      927,  1140,    85,   115,   519,   275,   256,   257,   258,   259,
+      260,   261,   262,   263,   264,   265,   266,   267,   268,  1238,
+      416,   928,   351,  1149,   249,   664,   866,   393,   512,   262,
+      971,    87,   122,   563,     3,    25,    39,   210,   359,   464,
+      474,   577,   615,   752,   809,  1135,  1205,  1231,   622,   896,
+      897,   192,  1001,   725,  1365,   216,  1154,   360,  1220,   793,
+      130,   586,   794,   657,   795,    37,   740,   217,  1155,   850,
+      222,  1185,   145,   796,   213,  1144,   741,   742,   743,  1230,
+      155,   957,   235,  1240,   526,   557,   558,   576,   595,    84,
+      110,   390,   432,   488,  1095,  1132,   226,  1196,   218,  1156,
+      486,   673,   125,   566,   841,  1157,   380,  1362,    47,   917,
+      190,   998,   398,  1158,   120,   548,  1036,  1088,  1037,    40,
+      156,   379,   692,   864,   935,  1120,  1359,   276,    84,    85,
+       86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+       96,   399,   755,  1215,  1216,   243,  1330,  1331,  1332,   836,
+      884,   907,  1221,    76,   425,   428,   490,   916,  1032,  1244,
+     1324,   621,  1042,   890,   514,   206,  1115,   123,   564,   702,
+     1127,  1214,    15,    16,    79,    17,    18,    80,    81,    82,
+       83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+       93,    94,    95,    96,    97,    19,    20,    98,    99,   100,
+      101,   102,    21,    22,    23,   103,   104,   105,    24,   106,
+       25,   107,   108,   109,    26,   110,    27,    28,   111,   112,
+      113,   114,    29,   115,   116,   117,    30,   118,   119,   120,
+       31,   121,   122,   123,   124,   125,   126,   127,    32,   128,
+       33,   129,   130,   131,   132,    34,   133,    35,   134,   135,
+       36,   136,   137,   138,   139,   140,    37,    38,   141,   142,
+      143,   144,   145,   146,   147,   148,   149,   150,    39,   151,
+      152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+      162,   163,   164,    40,    41,   165,   166,    42,   167,   168,
+       43,    44,    45,   169,   170,   171,    46,    47,   172,    48,
+      173,   174,   175,    49,    50,    51,   176,    52,   177,   178,
+       53,   179,   180,    54,   181,   182,    55,   183,   184,   185,
+      186,   187,   188,    56,   189,    57,   190,   191,   192,   193,
+       58,   194,    59,   195,    60,   196,   197,   198,   199,   200,
+      201,    61,   202,   203,    62,   204,   205,   206,   207,   208,
+      209,   210,   211,    63,   212,   213,   214,   215,   216,   217,
+      218,   219,   220,   221,   222,   223,   224,   225,    64,   226,
+      227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
+      237,   238,   239,    65,   240,   241,    66,    67,   242,   243,
+      244,    68,   245,   246,   247,   526,  1179,   727,  1370,   212,
+     1143,   693,   942,   185,   976,   111,   497,   260,   410,   574,
+      939,   695,   958,   704,  1159,   179,   959,  1237,   379,  1359,
+      209,  1134,   175,   931,  1190,  1276,   707,  1183,   220,  1167,
+      219,  1160,    91,  1161,    89,   909,    66,  1277,   701,  1116,
+      407,   479,   537,   605,   543,   833,   544,   480,   965,   891,
+     1080,   481,   839,   966,   481,   622,    86,   553,   214,  1150,
+      255,   831,   353,  1162,   277,  1302,   144,   195,   587,   792,
+     1025,   356,  1177,   843,  1307,  1283,   491,  1284,  1285,   128,
+      581,   318,   851,  1241,  1022,   457,   670,  1012,   756,   278,
+      152,   816,   391,   458,   503,   606,  1092,  1124,  1305,  1042,
+     1344,  1180,   295,   447,   417,   973,   680,   803,    28,   494,
+      554,   835,   945,   997,  1083,   567,    58,  1013,  1163,  1003,
+      227,  1202,   718,  1316,   394,   395,   728,   732,   733,   132,
+      590,  1164,   408,   482,   267,  1278,  1165,   705,  1166,   314,
+      814,    38,   746,   986,   198,   475,   588,  1038,   240,  1274,
+      498,   664,   665,   666,   667,   668,   669,   670,   671,   672,
+      673,   674,   675,   676,   677,   678,   679,   680,   681,   682,
+      683,   684,   685,   686,   687,   688,   689,   690,   691,   692,
+      693,   694,   695,   696,   697,   698,   699,   700,   701,   702,
+      703,   704,   705,   706,   707,   708,   709,   710,   711,   712,
+      713,   714,   715,   716,   717,   718,   719,   720,   721,   722,
+      723,   724,   725,   726,   727,   710,  1204,   181,   555,   964,
+      220,  1167,   264,  1168,  1096,  1153,   687,   892,    57,   996,
+      726,  1367,   960,  1084,   743,   252,   409,   510,   665,  1203,
+      193,  1002,  1231,   235,  1240,   190,   998,   410,   574,   481,
+       18,    77,   659,  1296,   724,  1340,   156,  1120,   244,  1346,
+      684,   862,   961,   331,   343,   900,  1047,   413,   820,  1095,
+     1132,   138,   736,   208,  1133,   139,   737,   209,  1134,   320,
+      857,   140,   738,   438,   982,  1229,   418,   420,  1039,  1118,
+     1040,   199,   200,   201,  1041,   896,   229,  1223,  1042,  1230,
+      180,   962,   210,  1135,   212,  1143,   211,  1136,    63,  1137,
+      241,  1275,    43,   886,  1138,   205,  1112,    54,   963,  1016,
+     1086,  1119,    97,   279,  1297,  1102,  1279,   373,  1298,   492,
+      298,   483,   135,   616,   450,   575,   322,   863,   484,   672,
+     1169,   296,   449,   259,   599,  1170,  1043,   411,   583,    31,
+      392,   481,   509,   556,   619,   827,  1069,   469,  1171,    18,
+       46,    67,    77,    84,    91,    94,   102,   103,   110,   114,
+      153,   159,   161,   173,   175,   178,   181,   213,   230,   231,
+      233,   258,   306,   386,   390,   432,   434,   436,   446,   450,
+      484,   488,   513,   522,   531,   543,   549,   550,   555,   560,
+      575,   580,   584,   667,   672,   701,   722,   730,   733,   747,
+      821,   832,   833,   834,   838,   839,   844,   910,   911,   929,
+      931,   950,   954,   960,   961,   964,   966,  1022,  1042,  1073,
+     1084,  1104,  1116,  1121,  1144,  1161,  1182,  1200,  1211,  1216,
+     1225,  1226,  1227,  1232,  1281,  1285,  1294,  1295,  1299,  1328,
+     1329,  1338,  1371,  1285,  1339,  1227,   550,  1331,  1332,     7,
+       17,    84,   110,   488,   173,   929,  1285,   544,  1299,    33,
+      582,  1332,   743,  1300,  1301,  1302,  1303,  1304,  1305,  1306,
+     1307,  1308,  1309,  1310,  1311,    45,   889,   221,  1184,    29,
+      515,   106,   463,  1344,   354,  1172,  1097,  1173,    51,   934,
+      355,  1174,   659,  1296,    33,   582,   201,   322,   863,  1024,
+       92,  1175,   136,   618,   706,  1176,   356,  1177,  1098,  1178,
+     1311,  1179,  1180,   301,   541,    93,  1181,    94,  1182,   707,
+     1183,  1216,   221,  1184,   222,  1185,   223,  1186,   224,  1187,
+      225,  1188,    64,  1189,  1190,   338,   946,   708,  1191,   709,
+     1192,   220,  1167,   960,  1084,   507,  1193,  1194,    24,   194,
+      462,   805,  1015,  1195,   724,  1340,   407,   479,   689,   922,
+       40,   156,   864,  1120,  1095,  1132,   226,  1196,   940,   340,
+     1011,   226,  1196,   698,  1004,   306,   580,  1007,   109,   244,
+      467,  1346,   143,   791,   484,   672,   137,   620,  1197,   357,
+     1198,  1199,   193,  1002,    54,   963,   257,   516,   680,   684,
+      803,   862,  1200,   443,   481,   961,   310,   600,   358,  1201,
+       45,   889,   128,   581,   280,   288,   326,   877,    50,   933,
+      227,  1202,   297,   461,   362,  1252,   281,   289,    56,   991,
+       96,  1312,   363,  1254,   341,   699,   742,   845,   949,   986,
+     1030,  1169,  1282,   282,   283,   284,   285,   286,   287,   288,
+      289,   290,   291,   292,   293,   294,   295,   296,   297,   298,
+      299,   300,   301,   302,   303,   304,   305,   306,   307,   308,
+      309,   310,   311,   312,   313,   314,   315,   316,   317,   318,
+      319,   320,   321,   322,   323,   324,   325,   326,   327,   328,
+      329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+      339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+      349,   350,   351,   352,   353,   354,   355,   356,   357,   358,
+      359,   360,   361,   362,   363,   364,   365,   366,   367,   368,
+      369,   370,   371,   372,   373,   374,   375,   376,   377,   378,
+      379,   380,   343,  1047,  1203,   152,   816,   710,  1204,   539,
+      676,   359,  1205,   493,   675,   681,   815,   228,  1206,   318,
+      331,   342,   343,   344,   360,   369,   377,   696,   717,   851,
+      900,   988,  1008,  1046,  1047,  1057,  1220,  1271,  1293,  1354,
+       73,  1300,   507,  1193,   711,  1207,   421,   537,   544,   605,
+     1037,  1148,   522,   550,   560,   730,   733,   961,  1042,  1211,
+     1216,  1299,  1371,  1331,  1332,   472,   671,   682,   852,   700,
+     1059,  1208,  1209,   424,  1253,    19,   381,    20,   382,   469,
+      331,   900,   491,   712,  1210,  1211,   218,  1156,  1212,   129,
+      138,   261,   585,   736,   967,   130,   586,   914,   422,  1213,
+     1214,   399,  1215,  1216,   265,  1217,  1216,  1218,   897,   208,
+     1133,  1219,   716,  1267,   898,  1081,   853,   360,  1220,  1221,
+      338,   946,    24,   194,   462,   805,  1015,   484,   672,  1169,
+     1222,     4,    13,    70,    72,   383,   426,   430,   452,   476,
+      477,   485,   486,   487,   517,   527,   545,   568,   601,   611,
+      623,   668,   673,   674,   797,   817,   826,   854,   867,   901,
+      977,  1009,  1048,  1054,  1125,  1141,  1194,  1222,  1341,  1343,
+     1363,   229,  1223,   400,  1224,   230,  1225,   231,  1226,  1227,
+      232,  1228,  1229,  1230,  1231,   233,  1232,   602,   234,  1233,
+      603,  1304,   374,  1313,   624,   569,  1010,  1142,   107,   311,
+      465,   731,   123,   564,    14,   880,   907,  1107,  1248,  1284,
+     1315,   350,  1147,   319,   683,   855,   401,  1234,   843,  1307,
+     1295,   919,   604,  1067,   249,   664,   537,   605,   503,   606,
+     1305,  1344,  1180,  1109,   543,   833,   544,   713,  1235,   268,
+      376,  1333,  1335,   125,   566,   865,  1078,   625,   384,   666,
+      404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+      414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
+      424,   425,   426,   427,   428,  1336,  1218,  1236,    98,   385,
+      226,  1196,   439,   983,  1237,  1238,   167,   174,   930,   419,
+     1049,   470,   626,   626,  1239,   235,  1240,  1241,   423,  1242,
+      266,  1243,  1244,     2,     4,     5,     8,    11,    12,    13,
+       61,    69,    70,    71,    72,   132,   163,   179,   193,   215,
+      234,   235,   246,   280,   288,   296,   334,   340,   362,   383,
+      405,   413,   426,   429,   430,   448,   449,   452,   476,   477,
+      485,   486,   487,   517,   518,   523,   527,   528,   545,   568,
+      569,   590,   601,   607,   610,   611,   612,   614,   623,   624,
+      627,   658,   668,   673,   674,   753,   760,   797,   813,   817,
+      818,   820,   826,   829,   847,   854,   867,   881,   901,   904,
+      959,   972,   977,   978,   990,  1002,  1009,  1010,  1011,  1018,
+     1020,  1044,  1048,  1052,  1053,  1054,  1117,  1125,  1126,  1141,
+     1142,  1152,  1194,  1222,  1233,  1240,  1252,  1287,  1341,  1342,
+     1343,  1345,  1351,  1353,  1358,  1363,   229,  1223,   235,  1240,
+      400,  1224,   230,  1225,   231,  1226,  1227,   232,  1228,  1229,
+     1230,  1095,  1132,   138,   736,   208,  1133,  1231,   233,  1232,
+      602,   234,  1233,   139,   737,   628,   761,   629,   762,   630,
+      763,   631,   764,   632,   765,   633,   766,   634,   767,   635,
+      768,   636,   769,   637,   770,   638,   771,   639,   772,   640,
+      773,   641,   774,   642,   775,   643,   776,   644,   777,   645,
+      778,   646,   779,   647,   780,   648,   781,   649,   782,   650,
+      783,   651,   784,   652,   785,   653,   786,   654,   787,   655,
+      788,   209,  1134,   603,  1304,   374,  1313,   656,   789,   624,
+      569,  1010,  1142,    30,    92,   107,   108,   299,   300,   311,
+      320,   330,   465,   466,   495,   529,   540,   694,   731,   857,
+      895,   952,  1040,  1175,  1352,   213,  1144,   221,  1184,   123,
+      564,   199,   200,   201,  1099,  1245,   504,  1005,  1309,   480,
+      361,  1246,  1247,  1248,   536,   559,   140,   738,   714,  1249,
+      856,    85,   115,   519,   181,   964,    14,   460,   880,   907,
+     1107,  1248,  1284,  1315,   255,   831,   350,  1147,   319,   683,
+      855,   965,   401,  1234,  1250,  1101,  1273,   349,   371,   679,
+      758,  1146,  1291,  1100,  1251,   256,   257,   258,   259,   260,
+      261,   262,   263,   264,   265,   266,   267,   268,   222,  1185,
+      843,  1307,   362,  1252,   424,  1253,   246,  1353,  1295,   272,
+      286,   363,  1254,   660,  1314,   627,   628,   629,   630,   631,
+      632,   633,   634,   635,   636,   637,   638,   639,   640,   641,
+      642,   643,   644,   645,   646,   647,   648,   649,   650,   651,
+      652,   653,   654,   655,   656,   657,   658,   659,   660,   661,
+     1092,  1124,  1229,   507,  1193,   259,   599,   218,   438,   613,
+      840,   968,   982,  1068,  1156,   577,  1294,  1295,   236,  1255,
+      244,  1346,   364,  1256,   919,   365,  1257,   157,  1258,   147,
+      801,  1229,   997,   919,   200,   524,   604,  1067,   249,   664,
+      379,  1359,   537,   605,   503,   606,  1305,  1344,  1180,   743,
+      190,   998,   481,   156,  1120,  1294,  1295,   191,   999,   418,
+      420,   422,  1039,  1118,  1213,  1214,  1040,   199,   200,   201,
+      399,  1215,  1216,  1041,   265,  1217,  1216,  1218,   896,   897,
+      142,   790,  1259,   532,  1065,  1216,   229,  1223,   386,   667,
+      264,  1168,  1022,  1042,   366,  1260,   367,  1261,   662,   327,
+      878,   914,   233,  1232,   923,   237,  1262,   238,  1263,    34,
+      593,   744,   807,   890,   891,  1072,  1080,  1099,  1245,   567,
+      223,  1186,    75,  1301,   347,  1131,   375,  1326,   389,   501,
+      390,   391,   392,   393,   394,   395,   396,   275,   397,   398,
+      399,   400,   401,   256,   257,   258,   259,   260,   261,   262,
+      263,   264,   265,   266,   267,   268,   720,  1320,  1321,   168,
+     1000,    82,   269,   270,   239,  1264,    99,   387,   891,  1080,
+       65,  1265,   602,  1230,   276,    84,    85,    86,    87,    88,
+       89,    90,    91,    92,    93,    94,    95,    96,  1109,   536,
+      559,   626,   180,   962,   715,  1266,   716,  1267,   481,   472,
+      671,   839,   966,   100,   228,   324,   388,   873,  1206,   186,
+      979,   186,   979,   182,   969,   389,   501,   390,   391,   392,
+      393,   394,   395,   396,   397,   398,   399,   400,   401,  1299,
+      328,   879,   543,   833,   544,  1327,    53,   240,   956,  1274,
+      210,  1135,   224,  1187,   212,  1143,   211,  1136,    63,  1137,
+     1276,   273,   287,   713,  1235,  1268,   268,   376,  1333,  1335,
+     1269,   368,  1270,   241,  1275,    64,  1189,  1190,   369,  1271,
+      125,   134,   189,   566,   609,   865,   875,   994,  1078,  1079,
+     1096,  1153,  1272,  1101,  1273,   625,   372,  1292,   425,  1324,
+      621,   240,  1274,   241,  1275,   481,    43,   886,   709,  1192,
+       37,   740,   384,   666,   502,   525,  1303,   526,   404,   405,
+      406,   407,   408,   409,   410,   411,   412,   413,   414,   415,
+      416,   417,   418,   419,   420,   421,   422,   423,   424,   425,
+      426,   427,   622,   192,  1001,   428,  1276,    66,  1277,   132,
+      590,   267,  1278,  1102,  1279,   231,  1226,  1227,   193,  1002,
+      318,   342,   377,   851,  1046,  1354,   470,    61,  1044,   299,
+      495,   840,   968,   231,  1226,  1227,    65,  1265,  1319,   882,
+      167,   168,    95,  1280,  1138,  1339,   205,  1112,    67,  1281,
+     1282,   144,   792,  1283,  1284,  1285,  1286,   912,    78,   157,
+      187,   283,   981,  1258,  1321,   290,   402,    25,   464,  1241,
+       24,    54,    56,    62,    65,   166,   194,   272,   286,   290,
+      293,   327,   328,   336,   366,   367,   402,   440,   462,   539,
+      661,   676,   805,   824,   870,   878,   879,   937,   963,   991,
+     1015,  1016,  1060,  1077,  1086,  1091,  1101,  1108,  1119,  1260,
+     1261,  1265,  1269,  1273,  1286,  1319,  1336,  1369,   209,  1134,
+       82,   119,   177,   269,   534,   953,  1029,   270,  1113,   798,
+     1075,   146,   799,   608,    62,  1060,   119,   534,    96,  1312,
+       83,   274,    61,  1044,    35,   596,   332,   902,   800,  1076,
+       93,  1181,   239,  1264,    49,   932,   923,   120,   548,   260,
+      939,   147,   801,   621,  1319,  1114,  1297,   148,   802,    41,
+       97,   279,   570,   868,   309,   597,   576,   595,   598,   678,
+      690,   924,    50,   933,   486,   673,   333,   903,   232,  1228,
+      236,  1255,   403,  1063,   882,   167,   168,   412,   663,   658,
+     1287,    95,  1280,   270,   391,   458,   120,   548,  1218,  1236,
+      487,   674,  1195,   124,   180,   565,   703,   962,  1006,  1034,
+     1087,  1139,   421,  1148,  1322,   836,   884,   188,   989,  1231,
+       84,   110,   488,   680,   803,   212,  1143,   960,  1084,   471,
+     1064,  1138,  1288,    62,  1060,  1297,    22,   444,   126,   571,
+      741,   148,   802,    81,   254,   621,   804,  1113,   805,    94,
+     1182,   167,   174,   930,   163,   847,    27,   489,   370,  1289,
+       88,   165,   869,   202,   547,  1050,  1066,  1102,  1279,   480,
+     1331,   508,  1364,  1290,    65,  1265,    23,   295,   319,   323,
+      357,   445,   447,   683,   855,   871,  1198,   371,  1291,   199,
+      459,   372,  1292,   237,  1262,   490,   225,  1188,   661,   824,
+     1077,  1369,   717,  1293,    43,   453,   886,    95,  1280,    50,
+      933,    27,   489,  1045,  1089,   259,   599,   332,   902,   373,
+     1298,    36,   113,   511,   617,  1339,   744,  1072,    98,   385,
+      226,  1196,   238,  1263,   492,   505,  1027,   166,   870,   298,
+      483,   135,   616,   205,  1112,   370,  1289,   827,   303,   546,
+      841,  1157,  1171,    67,  1281,  1282,  1294,  1295,   659,  1296,
+      213,  1144,   504,  1005,  1309,   146,   799,   121,   332,   439,
+      562,   902,   983,    27,   321,   489,   861,   127,   572,   821,
+      573,   262,   971,    40,   156,   379,   692,   864,   935,  1120,
+     1359,   727,  1370,  1237,   965,   839,   966,   144,   792,  1283,
+      491,  1284,  1285,  1012,   417,   973,   945,  1083,   664,   665,
+      666,   667,   668,   669,   670,   671,   672,   673,   674,   675,
+      676,   677,   678,   679,   680,   681,   682,   683,   684,   685,
+      686,   687,   688,   689,   690,   691,   692,   693,   694,   695,
+      696,   697,   698,   699,   700,   701,   702,   703,   704,   705,
+      706,   707,   708,   709,   710,   711,   712,   713,   714,   715,
+      716,   717,   718,   719,   720,   721,   722,   723,   724,   725,
+      726,   727,   235,  1240,   410,   574,  1016,  1086,  1297,   373,
+     1298,   492,   259,   599,   619,  1069,   178,   306,   450,   575,
+      580,   722,   839,   954,   966,  1328,  1299,  1332,  1300,  1301,
+     1302,  1303,  1304,  1305,  1306,  1307,  1308,  1309,  1310,  1311,
+       51,   934,   322,   863,   340,  1011,   310,   600,    96,  1312,
+      493,   675,   484,   672,  1169,   374,  1313,   311,   731,   404,
+      405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+      415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+      425,   426,   427,   428,   296,   449,    30,   529,   460,   246,
+     1353,   660,  1314,  1229,   218,  1156,   422,  1213,  1214,   399,
+     1215,  1216,   265,  1217,  1216,  1218,   897,    34,   593,   744,
+     1072,    75,  1301,  1299,    53,   956,   318,   377,   851,  1354,
+      299,   495,  1339,   202,   547,  1050,  1066,  1286,   242,  1318,
+      162,   846,   334,   904,   692,   935,    88,   165,   869,   149,
+      806,   719,  1317,  1315,   718,  1316,   342,  1046,   365,   686,
+      687,   688,   709,   887,   892,   906,  1192,  1257,   472,   671,
+      992,    86,   553,   136,   618,   719,  1317,  1017,  1208,  1238,
+     1286,   380,  1362,   151,   811,   242,  1318,  1319,   720,  1320,
+     1321,   158,  1323,   317,   825,   211,  1136,  1322,  1209,   131,
+      214,   242,   589,  1150,  1318,   393,   512,   659,  1296,   838,
+      950,   158,  1323,    57,    86,   468,   553,   912,   996,   425,
+     1324,   191,   999,   721,  1325,   375,  1326,  1327,   162,   398,
+      846,  1158,    26,    47,   167,   174,   259,   471,   478,   599,
+      917,   930,  1064,   722,  1328,   469,   159,  1329,   234,  1233,
+      243,  1330,  1331,  1332,   258,   584,  1227,   107,   465,   365,
+     1257,   376,  1333,   128,   581,    63,   255,   708,   831,  1137,
+     1191,   577,   342,  1046,   723,  1334,   343,  1047,   268,   376,
+     1333,  1335,   717,  1293,   419,   698,   724,  1004,  1049,  1340,
+     1023,  1113,   201,  1024,   195,  1025,  1026,  1336,   266,  1100,
+     1243,  1251,   812,  1306,   334,   904,   905,  1082,  1103,  1337,
+     1104,  1338,  1339,   507,  1193,  1247,   470,  1170,   724,  1340,
+     1341,  1342,   626,   987,  1043,  1085,   139,   737,   626,   429,
+      416,   928,  1368,  1239,   175,   931,   426,   477,  1343,  1344,
+     1180,  1345,   505,  1027,   244,  1346,   948,  1347,   657,   795,
+     1216,   235,  1240,   411,   583,   160,  1348,    68,  1349,   427,
+     1355,   245,  1350,  1351,  1352,  1241,   247,  1360,    37,   740,
+      129,   261,   585,   967,   130,   586,   430,   150,   154,   207,
+      808,   893,  1123,   169,   894,   692,   935,   980,   187,   981,
+      982,   983,   984,    31,    60,    78,    88,   111,   141,   143,
+      157,   158,   165,   187,   190,   229,   238,   257,   283,   350,
+      392,   401,   423,   481,   497,   509,   516,   556,   619,   680,
+      684,   756,   759,   791,   803,   827,   856,   862,   869,   882,
+      981,   987,   998,  1028,  1043,  1069,  1085,  1095,  1114,  1132,
+     1147,  1223,  1234,  1242,  1258,  1263,  1283,  1297,  1321,  1323,
+      214,  1150,   167,   168,   883,   918,   353,  1162,   246,  1353,
+      377,  1354,   149,   806,   427,  1355,   348,  1145,   378,  1356,
+     1012,   717,  1293,  1105,  1357,   321,   861,   148,   802,   331,
+      900,  1200,   423,  1242,  1358,   726,  1367,   275,   927,   379,
+     1359,   247,  1360,  1361,   275,   396,   859,   927,  1238,   116,
+      520,   380,  1362,   329,   885,   124,   565,  1299,   688,   906,
+      398,  1158,   351,  1149,   117,   521,   522,   360,  1220,   139,
+      737,   742,   368,  1270,   348,  1145,   195,  1025,   840,   968,
+      266,  1243,   575,   614,   250,   285,   290,   402,    25,   464,
+      907,  1244,   949,  1363,   226,  1196,   508,  1364,   907,   351,
+     1149,   120,   171,   548,   719,   908,  1051,  1317,  1052,    90,
+      140,   183,   312,   738,   750,   974,   725,  1365,   880,  1366,
+     1006,  1250,   726,  1367,   182,   969,    26,   478,  1315,  1053,
+      105,   455,  1026,   576,   469,   431,  1241,   718,  1316,   726,
+     1367,   473,   474,   475,   476,   477,   626,  1368,   342,  1046,
+      277,  1302,   390,   432,  1054,   907,  1322,   661,  1369,   727,
+     1370,   351,  1149,    26,   478,  1371,   573,  1171,   577,  1371,
+      573,  1171,   577
+};
+
+const ZoneIndexStruct zoneIndex = {
+    457, zones, 1372, text, termOffsets, zoneStarts, termZones,
+    14593, suffixes, suffixTerms
+};
@@ -0,0 +1,506 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wczgen.c -- generates the zone search tables in wczdata.c                */
+/*                                                                            */
+/* Usage: wczgen [zoneinfo] > wczdata.c                                       */
+/*   zoneinfo    an installed zone directory with tzdata.zi, zone.tab and     */
+/*               iso3166.tab beside the TZif files (TZDIR, or the default)    */
+/* The zones are the ones tzdata.zi defines and the ones zone.tab lists for   */
+/* a country; every other link is an old name and becomes a term of the zone  */
+/* it leads to.  Abbreviations come from each zone's TZif file.  Run it again */
+/* when the zone data shipped with WorldClock changes.                        */
+/* Build with:                                                                */
+/*   cc -O2 -o wczgen wczgen.c tzone.c ticktime.c                             */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tzone.h"
+#include "wczindex.h"
+
+#define GEN_LINE_SIZE  1024
+#define GEN_MAX_HOPS   8        /* links of links followed */
+#define GEN_MAX_OFFSET 65535    /* the tables hold 16-bit offsets */
+
+typedef struct GenLinkStructTag {
+    char *target;
+    char *alias;
+} GenLinkStruct;
+
+typedef struct GenCountryStructTag {
+    char code[3];
+    char *name;
+} GenCountryStruct;
+
+typedef struct GenTermStructTag {
+    char *text;
+    int zone;
+} GenTermStruct;
+
+/* a growable array of any of the above */
+typedef struct GenListStructTag {
+    void *items;
+    int count;
+    int capacity;
+    size_t size;
+} GenListStruct;
+
+static char version[16] = "unknown";
+static char **zones = NULL;
+static int zoneCount = 0;
+
+static void *Grow(GenListStruct *list)
+{
+    void *items;
+
+    if (list->count == list->capacity)
+    {
+        list->capacity = list->capacity > 0 ? list->capacity * 2 : 256;
+        items = realloc(list->items, (size_t) list->capacity * list->size);
+        if (items == NULL)
+        {
+            fprintf(stderr, "wczgen: out of memory\n");
+            exit(1);
+        }
+        list->items = items;
+    }
+    return((char *) list->items + (size_t) list->count++ * list->size);
+} /* Grow() */
+
+static char *Copy(const char *text, size_t length)
+{
+    char *copy = (char *) malloc(length + 1);
+
+    if (copy == NULL)
+    {
+        fprintf(stderr, "wczgen: out of memory\n");
+        exit(1);
+    }
+    memcpy(copy, text, length);
+    copy[length] = '\0';
+    return(copy);
+} /* Copy() */
+
+static FILE *OpenData(const char *zoneDir, const char *name)
+{
+    char path[512];
+    FILE *file;
+
+    snprintf(path, sizeof(path), "%s/%s", zoneDir, name);
+    file = fopen(path, "r");
+    if (file == NULL)
+        fprintf(stderr, "wczgen: cannot open %s\n", path);
+    return(file);
+} /* OpenData() */
+
+/* the line's fields between separators, up to max of them */
+static int SplitFields(char *line, char separator, char **fields, int max)
+{
+    int count = 0;
+
+    line[strcspn(line, "\r\n")] = '\0';
+    while (count < max)
+    {
+        fields[count++] = line;
+        line = strchr(line, separator);
+        if (line == NULL)
+            break;
+        *line++ = '\0';
+    } /* while */
+    return(count);
+} /* SplitFields() */
+
+static int CompareStrings(const void *a, const void *b)
+{
+    return(strcmp(*(char *const *) a, *(char *const *) b));
+} /* CompareStrings() */
+
+static int FindZone(const char *name)
+{
+    char **found = (char **) bsearch(&name, zones, (size_t) zoneCount, sizeof(char *), CompareStrings);
+
+    return(found != NULL ? (int) (found - zones) : -1);
+} /* FindZone() */
+
+/******************************************************************************/
+/* The zones, and the links that are not zones: tzdata.zi has a line          */
+/* "Z name ..." for each zone and "L target alias" for each link.  zone.tab   */
+/* names each zone in use in a country, some of which are links.              */
+/******************************************************************************/
+static int ReadZones(const char *zoneDir, GenListStruct *links, GenListStruct *places)
+{
+    char line[GEN_LINE_SIZE];
+    char *fields[4];
+    GenListStruct names = { NULL, 0, 0, sizeof(char *) };
+    GenLinkStruct *link;
+    FILE *file;
+    int i, count;
+
+    if ((file = OpenData(zoneDir, "tzdata.zi")) == NULL)
+        return(0);
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        if (strncmp(line, "# version ", 10) == 0)
+            sscanf(line + 10, "%15s", version);
+        count = SplitFields(line, ' ', fields, 4);
+        if (strcmp(fields[0], "Z") == 0 && count >= 2 && strcmp(fields[1], "Factory") != 0)
+            *(char **) Grow(&names) = Copy(fields[1], strlen(fields[1]));
+        else if (strcmp(fields[0], "L") == 0 && count >= 3)
+        {
+            link = (GenLinkStruct *) Grow(links);
+            link->target = Copy(fields[1], strlen(fields[1]));
+            link->alias = Copy(fields[2], strlen(fields[2]));
+        }
+    } /* while */
+    fclose(file);
+
+    if ((file = OpenData(zoneDir, "zone.tab")) == NULL)
+        return(0);
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        if (line[0] == '#' || SplitFields(line, '\t', fields, 4) < 3)
+            continue;
+        *(char **) Grow(places) = Copy(fields[0], strlen(fields[0]));
+        *(char **) Grow(places) = Copy(fields[2], strlen(fields[2]));
+        *(char **) Grow(&names) = Copy(fields[2], strlen(fields[2]));
+    } /* while */
+    fclose(file);
+
+    /* sort, and drop the zone.tab names tzdata.zi already had */
+    qsort(names.items, (size_t) names.count, sizeof(char *), CompareStrings);
+    zones = (char **) names.items;
+    for (i = 0; i < names.count; i++)
+    {
+        if (zoneCount > 0 && strcmp(zones[zoneCount - 1], zones[i]) == 0)
+            free(zones[i]);
+        else
+            zones[zoneCount++] = zones[i];
+    } /* for i */
+    if (zoneCount == 0 || zoneCount > ZONE_INDEX_MAX_ZONES)
+    {
+        fprintf(stderr, "wczgen: %d zones, not 1 to %d\n", zoneCount, ZONE_INDEX_MAX_ZONES);
+        return(0);
+    }
+    return(1);
+} /* ReadZones() */
+
+static int ReadCountries(const char *zoneDir, GenListStruct *countries)
+{
+    char line[GEN_LINE_SIZE];
+    char *fields[2];
+    GenCountryStruct *country;
+    FILE *file;
+
+    if ((file = OpenData(zoneDir, "iso3166.tab")) == NULL)
+        return(0);
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        if (line[0] == '#' || SplitFields(line, '\t', fields, 2) < 2 || strlen(fields[0]) != 2)
+            continue;
+        country = (GenCountryStruct *) Grow(countries);
+        strcpy(country->code, fields[0]);
+        country->name = Copy(fields[1], strlen(fields[1]));
+    } /* while */
+    fclose(file);
+    return(1);
+} /* ReadCountries() */
+
+/* a term of the zone, written the way ZoneIndexNormalize() writes queries */
+static void AddTerm(GenListStruct *terms, const char *text, size_t length, int zone)
+{
+    GenTermStruct *term;
+    char *normal;
+    size_t i;
+
+    if (length == 0)
+        return;
+    normal = Copy(text, length);
+    for (i = 0; i < length; i++)
+    {
+        if (normal[i] >= 'A' && normal[i] <= 'Z')
+            normal[i] = (char) (normal[i] - 'A' + 'a');
+        else if (normal[i] == '_')
+            normal[i] = ' ';
+    } /* for i */
+    term = (GenTermStruct *) Grow(terms);
+    term->text = normal;
+    term->zone = zone;
+} /* AddTerm() */
+
+/* America/Argentina/Buenos_Aires gives itself, Argentina and Buenos_Aires */
+static void AddNameTerms(GenListStruct *terms, const char *name, int zone)
+{
+    const char *part, *end;
+
+    AddTerm(terms, name, strlen(name), zone);
+    part = strchr(name, '/');
+    while (part != NULL)
+    {
+        part++;
+        end = strchr(part, '/');
+        AddTerm(terms, part, end != NULL ? (size_t) (end - part) : strlen(part), zone);
+        part = end;
+    } /* while */
+} /* AddNameTerms() */
+
+static int IsWord(const char *abbr)
+{
+    return((abbr[0] >= 'A' && abbr[0] <= 'Z') || (abbr[0] >= 'a' && abbr[0] <= 'z'));
+} /* IsWord() */
+
+/* the abbreviations in force at some time since 1970, "+05" and "-00" aside */
+static void AddAbbreviations(GenListStruct *terms, const char *zoneDir, int zone)
+{
+    TzZoneStruct data;
+    int32_t i;
+    int type, used[256];
+
+    if (!TzLoadZone(&data, zoneDir, zones[zone]))
+    {
+        fprintf(stderr, "wczgen: cannot load %s, no abbreviations\n", zones[zone]);
+        return;
+    }
+    memset(used, 0, sizeof(used));
+    type = 0;
+    for (i = 0; i < data.transitionCount; i++)
+    {
+        if (data.transitionTimes[i] > 0)
+            used[data.transitionTypes[i]] = 1;
+        else
+            type = data.transitionTypes[i];
+    } /* for i */
+    used[type] = 1;
+    for (i = 0; i < data.typeCount && i < 256; i++)
+    {
+        if (used[i] && IsWord(data.types[i].abbr))
+            AddTerm(terms, data.types[i].abbr, strlen(data.types[i].abbr), zone);
+    } /* for i */
+    if (data.hasRule)
+    {
+        if (IsWord(data.rule.std.abbr))
+            AddTerm(terms, data.rule.std.abbr, strlen(data.rule.std.abbr), zone);
+        if (data.rule.hasDst && IsWord(data.rule.dst.abbr))
+            AddTerm(terms, data.rule.dst.abbr, strlen(data.rule.dst.abbr), zone);
+    }
+    TzFreeZone(&data);
+} /* AddAbbreviations() */
+
+/* the zone a link leads to, through other links if need be, or -1 */
+static int ResolveLink(const GenListStruct *links, const char *target)
+{
+    const GenLinkStruct *link = (const GenLinkStruct *) links->items;
+    int hop, i, zone;
+
+    for (hop = 0; hop < GEN_MAX_HOPS; hop++)
+    {
+        if ((zone = FindZone(target)) >= 0)
+            return(zone);
+        for (i = 0; i < links->count && strcmp(link[i].alias, target) != 0; i++)
+            ;
+        if (i == links->count)
+            return(-1);
+        target = link[i].target;
+    } /* for hop */
+    return(-1);
+} /* ResolveLink() */
+
+static int CompareTerms(const void *a, const void *b)
+{
+    const GenTermStruct *x = (const GenTermStruct *) a, *y = (const GenTermStruct *) b;
+    int order = strcmp(x->text, y->text);
+
+    return(order != 0 ? order : x->zone - y->zone);
+} /* CompareTerms() */
+
+static const char *sortText;    /* for CompareSuffixes() */
+
+static int CompareSuffixes(const void *a, const void *b)
+{
+    int x = *(const int *) a, y = *(const int *) b;
+    int order = strcmp(sortText + x, sortText + y);
+
+    return(order != 0 ? order : x - y);
+} /* CompareSuffixes() */
+
+/* a term as a C string, bytes past ASCII in octal: "Côte d'Ivoire" is UTF-8 */
+static void PrintTerm(const char *text)
+{
+    putchar('"');
+    for (; *text != '\0'; text++)
+    {
+        if ((unsigned char) *text >= 0x7f || *text == '"' || *text == '\\')
+            printf("\\%03o", (unsigned char) *text);
+        else
+            putchar(*text);
+    } /* for text */
+    printf("\\0\"");
+} /* PrintTerm() */
+
+/* a line of the header box, padded to its right edge */
+static void PrintBoxLine(const char *text)
+{
+    printf("/* %-74s */\n", text);
+} /* PrintBoxLine() */
+
+static void PrintTable(const char *name, const int *values, int count)
+{
+    int i;
+
+    printf("\nstatic const uint16_t %s[%d] = {", name, count);
+    for (i = 0; i < count; i++)
+        printf("%s%5d%s", i % 10 == 0 ? "\n    " : " ", values[i], i < count - 1 ? "," : "");
+    printf("\n};\n");
+} /* PrintTable() */
+
+int main(int argc, char *argv[])
+{
+    GenListStruct links = { NULL, 0, 0, sizeof(GenLinkStruct) };
+    GenListStruct places = { NULL, 0, 0, sizeof(char *) };
+    GenListStruct countries = { NULL, 0, 0, sizeof(GenCountryStruct) };
+    GenListStruct terms = { NULL, 0, 0, sizeof(GenTermStruct) };
+    const char *zoneDir = argc > 1 ? argv[1] : TzDefaultZoneDir();
+    GenLinkStruct *link;
+    GenCountryStruct *country;
+    GenTermStruct *term;
+    char **place;
+    char *text, line[128];
+    int *termOffsets, *zoneStarts, *termZones, *suffixes, *suffixTerms;
+    int i, j, zone, termCount = 0, zoneRefs = 0, suffixCount = 0;
+    size_t textSize = 0;
+
+    if (argc > 2 || (argc == 2 && argv[1][0] == '-'))
+    {
+        fprintf(stderr, "usage: wczgen [zoneinfo] > wczdata.c\n");
+        return(2);
+    }
+    if (!ReadZones(zoneDir, &links, &places) || !ReadCountries(zoneDir, &countries))
+        return(1);
+
+    for (zone = 0; zone < zoneCount; zone++)
+    {
+        AddNameTerms(&terms, zones[zone], zone);
+        AddAbbreviations(&terms, zoneDir, zone);
+    } /* for zone */
+    link = (GenLinkStruct *) links.items;
+    for (i = 0; i < links.count; i++)
+    {
+        if (FindZone(link[i].alias) < 0 && (zone = ResolveLink(&links, link[i].target)) >= 0)
+            AddNameTerms(&terms, link[i].alias, zone);
+    } /* for i */
+    place = (char **) places.items;
+    country = (GenCountryStruct *) countries.items;
+    for (i = 0; i + 1 < places.count; i += 2)
+    {
+        for (j = 0; j < countries.count && strcmp(country[j].code, place[i]) != 0; j++)
+            ;
+        if (j < countries.count && (zone = FindZone(place[i + 1])) >= 0)
+            AddTerm(&terms, country[j].name, strlen(country[j].name), zone);
+    } /* for i */
+
+    /* distinct (term, zone) pairs, each term's text laid down once */
+    term = (GenTermStruct *) terms.items;
+    qsort(term, (size_t) terms.count, sizeof(GenTermStruct), CompareTerms);
+    for (i = 0; i < terms.count; i++)
+        textSize += strlen(term[i].text) + 1;
+    text = (char *) malloc(textSize);
+    termOffsets = (int *) malloc(((size_t) terms.count + 1) * sizeof(int));
+    zoneStarts = (int *) malloc(((size_t) terms.count + 1) * sizeof(int));
+    termZones = (int *) malloc((size_t) terms.count * sizeof(int));
+    if (text == NULL || termOffsets == NULL || zoneStarts == NULL || termZones == NULL)
+        return(1);
+    textSize = 0;
+    for (i = 0; i < terms.count; i++)
+    {
+        if (i > 0 && CompareTerms(&term[i - 1], &term[i]) == 0)
+            continue;
+        if (i == 0 || strcmp(term[i - 1].text, term[i].text) != 0)
+        {
+            termOffsets[termCount] = (int) textSize;
+            zoneStarts[termCount++] = zoneRefs;
+            strcpy(text + textSize, term[i].text);
+            textSize += strlen(term[i].text) + 1;
+        }
+        termZones[zoneRefs++] = term[i].zone;
+    } /* for i */
+    termOffsets[termCount] = (int) textSize;
+    zoneStarts[termCount] = zoneRefs;
+
+    /* every character of every term, sorted by the rest of its term */
+    suffixes = (int *) malloc(textSize * sizeof(int));
+    if (suffixes == NULL)
+        return(1);
+    for (i = 0; i < (int) textSize; i++)
+    {
+        if (text[i] != '\0')
+            suffixes[suffixCount++] = i;
+    } /* for i */
+    sortText = text;
+    qsort(suffixes, (size_t) suffixCount, sizeof(int), CompareSuffixes);
+    suffixTerms = (int *) malloc(textSize * sizeof(int));
+    if (suffixTerms == NULL)
+        return(1);
+    for (i = 0; i < suffixCount; i++)
+    {
+        for (j = 0; termOffsets[j + 1] <= suffixes[i]; j++)
+            ;
+        suffixTerms[i] = j;
+    } /* for i */
+    if (termCount > ZONE_INDEX_MAX_TERMS)
+    {
+        fprintf(stderr, "wczgen: %d terms, not at most %d\n", termCount, ZONE_INDEX_MAX_TERMS);
+        return(1);
+    }
+    if (textSize > GEN_MAX_OFFSET || zoneRefs > GEN_MAX_OFFSET)
+    {
+        fprintf(stderr, "wczgen: %lu bytes of terms and %d zone references, not 16-bit\n",
+                (unsigned long) textSize, zoneRefs);
+        return(1);
+    }
+
+    printf("/******************************************************************************/\n");
+    PrintBoxLine("WorldClock -- A Multiple-Timezone Digital Clock");
+    sprintf(line, "  wczdata.c -- zone search tables, generated by wczgen from tzdata %s", version);
+    PrintBoxLine(line);
+    PrintBoxLine("");
+    sprintf(line, "%d zones, %d terms and %d suffixes.  Do not edit: run wczgen again.",
+            zoneCount, termCount, suffixCount);
+    PrintBoxLine(line);
+    printf("/******************************************************************************/\n\n");
+    printf("#include \"wczindex.h\"\n");
+
+    printf("\nstatic const char *const zones[%d] = {", zoneCount);
+    for (i = 0; i < zoneCount; i++)
+        printf("\n    \"%s\"%s", zones[i], i < zoneCount - 1 ? "," : "");
+    printf("\n};\n");
+
+    printf("\nstatic const char text[] =");
+    for (i = 0; i < termCount; i++)
+    {
+        printf("\n    ");
+        PrintTerm(text + termOffsets[i]);
+    } /* for i */
+    printf(";\n");
+
+    PrintTable("termOffsets", termOffsets, termCount + 1);
+    PrintTable("zoneStarts", zoneStarts, termCount + 1);
+    PrintTable("termZones", termZones, zoneRefs);
+    PrintTable("suffixes", suffixes, suffixCount);
+    PrintTable("suffixTerms", suffixTerms, suffixCount);
+
+    printf("\nconst ZoneIndexStruct zoneIndex = {\n"
+           "    %d, zones, %d, text, termOffsets, zoneStarts, termZones,\n"
+           "    %d, suffixes, suffixTerms\n};\n",
+           zoneCount, termCount, suffixCount);
+
+    for (i = 0; i < terms.count; i++)
+        free(term[i].text);
+    free(terms.items);
+    free(text);
+    free(termOffsets);
+    free(zoneStarts);
+    free(termZones);
+    free(suffixes);
+    free(suffixTerms);
+    return(0);
+} /* main() */
@@ -0,0 +1,144 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wczindex.c -- incremental search over zone names, cities and countries   */
+/*                                                                            */
+/* The tables are constant and generated (see wczgen.c), so a search needs    */
+/* no setup and allocates nothing: two binary searches bound the terms or     */
+/* suffixes the query starts, and the zones they name are ranked by how well  */
+/* their best term matched.  A keystroke costs a few microseconds.            */
+/******************************************************************************/
+
+#include <string.h>
+#include "wczindex.h"
+
+/* the query as the terms are written: lower case, '_' as a space */
+void ZoneIndexNormalize(char *normal, const char *query)
+{
+    int length = 0;
+    char c;
+
+    while (*query == ' ')
+        query++;
+    for (; *query != '\0' && length < ZONE_INDEX_MAX_QUERY - 1; query++)
+    {
+        c = *query;
+        if (c >= 'A' && c <= 'Z')
+            c = (char) (c - 'A' + 'a');
+        else if (c == '_')
+            c = ' ';
+        normal[length++] = c;
+    } /* for query */
+    normal[length] = '\0';
+} /* ZoneIndexNormalize() */
+
+/* the first of count sorted text offsets whose text does not sort before */
+/* the query, or with after, whose text sorts after it and all it starts  */
+static int Bound(const uint16_t *offsets, int count, const char *normal, size_t length, int after)
+{
+    int low = 0, high = count, middle, order;
+
+    while (low < high)
+    {
+        middle = low + (high - low) / 2;
+        order = strncmp(zoneIndex.text + offsets[middle], normal, length);
+        if (order < 0 || (after && order == 0))
+            low = middle + 1;
+        else
+            high = middle;
+    } /* while */
+    return(low);
+} /* Bound() */
+
+static void Mark(unsigned char *rank, int term, int match)
+{
+    int i, zone;
+
+    for (i = zoneIndex.zoneStarts[term]; i < zoneIndex.zoneStarts[term + 1]; i++)
+    {
+        zone = zoneIndex.termZones[i];
+        if (rank[zone] < match)
+            rank[zone] = (unsigned char) match;
+    } /* for i */
+} /* Mark() */
+
+/******************************************************************************/
+/* ZoneIndexSearch -- the zones with a term that starts with the query, or    */
+/* if substrings is nonzero that holds it anywhere.  Up to maxZones of them   */
+/* go to zones, whole-term matches first, then term prefixes, then word       */
+/* starts, then the rest, and alphabetically within each.  Returns how many   */
+/* zones matched in all.                                                      */
+/******************************************************************************/
+int ZoneIndexSearch(const char *query, int substrings, int *zones, int maxZones)
+{
+    unsigned char rank[ZONE_INDEX_MAX_ZONES];
+    unsigned char termRank[ZONE_INDEX_MAX_TERMS];
+    char normal[ZONE_INDEX_MAX_QUERY];
+    size_t length;
+    int first, last, i, term, offset, match, found = 0;
+    char before;
+
+    ZoneIndexNormalize(normal, query);
+    length = strlen(normal);
+    if (length == 0)
+        return(0);
+    memset(rank, ZONE_MATCH_NONE, (size_t) zoneIndex.zoneCount);
+
+    if (!substrings)
+    {
+        first = Bound(zoneIndex.termOffsets, zoneIndex.termCount, normal, length, 0);
+        last = Bound(zoneIndex.termOffsets, zoneIndex.termCount, normal, length, 1);
+        for (term = first; term < last; term++)
+        {
+            match = zoneIndex.text[zoneIndex.termOffsets[term] + length] == '\0' ?
+                    ZONE_MATCH_EXACT : ZONE_MATCH_PREFIX;
+            Mark(rank, term, match);
+        } /* for term */
+    }
+    else
+    {
+        /* a term holds the query many times over; mark its zones once */
+        memset(termRank, ZONE_MATCH_NONE, (size_t) zoneIndex.termCount);
+        first = Bound(zoneIndex.suffixes, zoneIndex.suffixCount, normal, length, 0);
+        last = Bound(zoneIndex.suffixes, zoneIndex.suffixCount, normal, length, 1);
+        for (i = first; i < last; i++)
+        {
+            offset = zoneIndex.suffixes[i];
+            term = zoneIndex.suffixTerms[i];
+            if (offset == zoneIndex.termOffsets[term])
+                match = zoneIndex.text[offset + length] == '\0' ? ZONE_MATCH_EXACT : ZONE_MATCH_PREFIX;
+            else
+            {
+                before = zoneIndex.text[offset - 1];
+                match = (before == ' ' || before == '/' || before == '-') ?
+                        ZONE_MATCH_WORD : ZONE_MATCH_SUBSTRING;
+            }
+            if (termRank[term] < match)
+                termRank[term] = (unsigned char) match;
+        } /* for i */
+        for (term = 0; term < zoneIndex.termCount; term++)
+        {
+            if (termRank[term] != ZONE_MATCH_NONE)
+                Mark(rank, term, termRank[term]);
+        } /* for term */
+    }
+
+    for (match = ZONE_MATCH_EXACT; match > ZONE_MATCH_NONE; match--)
+    {
+        for (i = 0; i < zoneIndex.zoneCount; i++)
+        {
+            if (rank[i] != match)
+                continue;
+            if (found < maxZones)
+                zones[found] = i;
+            found++;
+        } /* for i */
+    } /* for match */
+    return(found);
+} /* ZoneIndexSearch() */
+
+const char *ZoneIndexName(int zone)
+{
+    if (zone < 0 || zone >= zoneIndex.zoneCount)
+        return(NULL);
+    return(zoneIndex.zones[zone]);
+} /* ZoneIndexName() */
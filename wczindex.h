@@ -0,0 +1,53 @@
+/******************************************************************************/
+/* WorldClock -- A Multiple-Timezone Digital Clock                            */
+/*   wczindex.h -- incremental search over zone names, cities and countries   */
+/******************************************************************************/
+
+#ifndef WCZINDEX_H
+#define WCZINDEX_H
+
+#include <stdint.h>
+
+#define ZONE_INDEX_MAX_ZONES 1024       /* wczgen refuses more */
+#define ZONE_INDEX_MAX_TERMS 8192
+#define ZONE_INDEX_MAX_QUERY 64
+
+/* what a zone's best term has to do with the query, best last */
+#define ZONE_MATCH_NONE      0
+#define ZONE_MATCH_SUBSTRING 1          /* somewhere inside a term */
+#define ZONE_MATCH_WORD      2          /* at the start of a word of a term */
+#define ZONE_MATCH_PREFIX    3          /* at the start of a term */
+#define ZONE_MATCH_EXACT     4          /* a whole term */
+
+/******************************************************************************/
+/* The index is generated by wczgen into wczdata.c.  Terms are lower case,    */
+/* with '_' as a space: each zone's name and the parts of it after the area,  */
+/* old names linked to it, the countries it is listed for, and the            */
+/* abbreviations it has used since 1970.  The distinct terms are sorted and   */
+/* laid end to end in text, each ended by a NUL, so a prefix query is a       */
+/* binary search over termOffsets.  suffixes holds the offset of every        */
+/* character of every term, sorted by the rest of its term, so a substring    */
+/* query is a binary search too, and suffixTerms the term each lies in.       */
+/* Term t names the zones termZones[zoneStarts[t]] up to                      */
+/* termZones[zoneStarts[t + 1]].                                              */
+/******************************************************************************/
+typedef struct ZoneIndexStructTag {
+    int zoneCount;
+    const char *const *zones;           /* sorted, as they load from zoneinfo */
+    int termCount;
+    const char *text;
+    const uint16_t *termOffsets;        /* termCount + 1, the last the text size */
+    const uint16_t *zoneStarts;         /* termCount + 1 */
+    const uint16_t *termZones;
+    int suffixCount;
+    const uint16_t *suffixes;
+    const uint16_t *suffixTerms;
+} ZoneIndexStruct;
+
+extern const ZoneIndexStruct zoneIndex;
+
+void        ZoneIndexNormalize(char *normal, const char *query);
+int         ZoneIndexSearch(const char *query, int substrings, int *zones, int maxZones);
+const char *ZoneIndexName(int zone);
+
+#endif /* WCZINDEX_H */
@@ -14,21 +14,39 @@
 #include <stdio.h>
 #include "worldclock.h"
 #include "wclock.h"
+#include "ticktime.h"
+#include "ticksched.h"
+#include "gdicache.h"
+#include "wcconfig.h"
+#include "wcstats.h"
+#include "wcalarm.h"
+#include "wczindex.h"
 
 #define TIMER_ID 101
 #define TIMER_ID 101
 #define INI_FILE_NAME "./WorldClock.ini"
+#define STATS_FILE_NAME "WorldClock.stats"
+#define ZONE_LIST_SIZE 100              /* matches the Clock Setup list shows */
 
-ClockInfoListStruct *clockInfoList = NULL;
+ClockRegistryStruct clockRegistry;
 static HINSTANCE hInstance;
-static int numClocks = 0;
+static TickSchedulerStruct tickScheduler;
+static ConfigStruct wcConfig;           /* WorldClock.ini, read once at startup */
+static AlarmWheelStruct alarmWheel;     /* the alarms of [AlarmData] */
+static ClockLayoutStruct viewLayout;    /* the clocks on screen, from AdjustWindow() */
+static int viewFirst;                   /* the clock to show first */
+static int viewMaxClocks;               /* most clocks on screen, 0 for as many as fit */
+static int rotateSeconds;               /* show the next page this often, 0 never */
 HMENU popupMenu;
 HMENU positionsMenu;
-HWND AddClock(HWND parentWindow, int layout, char *data, int gmtOffset);
+ClockHandle AddClock(char *data, int gmtOffset, const char *zoneName);
 void AdjustWindow(HWND hwnd, int layout);
-int  ModifyClock(HWND clockWindow);
-void DeleteClock(HWND parentWindow, int layout, HWND clockWindow);
-void DeleteClockListEntry(HWND parentWindow, int layout, ClockInfoListStruct *deleteEntry);
+void RotateView(HWND hwnd, int layout, int64_t utcSeconds);
+int  ModifyClock(HWND ownerWindow, ClockHandle handle);
+void DeleteClock(HWND parentWindow, int layout, ClockHandle handle);
+void LoadAlarms(void);
+void SaveAlarms(void);
+void RingAlarm(void *context, const AlarmStruct *alarm, int64_t utcSeconds);
 
 LRESULT WINAPI ModifyDialogProc (HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam);
 LRESULT WINAPI AboutBoxDialogProc (HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam);
@@ -58,6 +76,7 @@ int WINAPI WinMain(HINSTANCE hInst, HINSTANCE hPrevInstance, LPSTR lpszCmdLine,
         RegisterClass (&wndclass);
     }
     RegisterClockClass(hInstance);
+    ClockRegInit(&clockRegistry, sizeof(ClockWinStruct));
 
     positionsMenu = CreatePopupMenu();
     AppendMenu(positionsMenu, MF_ENABLED | MF_STRING, WC_POS_UL,   "Upper Left");
@@ -67,6 +86,7 @@ int WINAPI WinMain(HINSTANCE hInst, HINSTANCE hPrevInstance, LPSTR lpszCmdLine,
     AppendMenu(positionsMenu, MF_SEPARATOR, 0, NULL);
     AppendMenu(positionsMenu, MF_ENABLED | MF_STRING, WC_OR_HORZ,  "Horizontal");
     AppendMenu(positionsMenu, MF_ENABLED | MF_STRING, WC_OR_VERT,  "Vertical");
+    AppendMenu(positionsMenu, MF_ENABLED | MF_STRING | MF_UNCHECKED, WC_OR_GRID,  "Grid");
 
     popupMenu = CreatePopupMenu();
     AppendMenu(popupMenu, MF_ENABLED | MF_STRING, WC_ADD,        "Add a New Clock");
@@ -74,7 +94,10 @@ int WINAPI WinMain(HINSTANCE hInst, HINSTANCE hPrevInstance, LPSTR lpszCmdLine,
     AppendMenu(popupMenu, MF_ENABLED | MF_STRING, WC_DELETE,     "Delete this Clock");
     AppendMenu(popupMenu, MF_ENABLED | MF_STRING | MF_UNCHECKED, WC_ONTOP,  "Clocks Stay on Top");
     AppendMenu(popupMenu, MF_ENABLED | MF_POPUP, (UINT_PTR) positionsMenu, "Relocate Clocks");
+    AppendMenu(popupMenu, MF_ENABLED | MF_STRING, WC_PAGE_NEXT,  "Show Next Clocks");
+    AppendMenu(popupMenu, MF_ENABLED | MF_STRING, WC_PAGE_PREV,  "Show Previous Clocks");
     AppendMenu(popupMenu, MF_ENABLED | MF_STRING, WC_SAVEDATA,   "Save Setup");
+    AppendMenu(popupMenu, MF_ENABLED | MF_STRING, WC_STATS,      "Statistics...");
     AppendMenu(popupMenu, MF_ENABLED | MF_STRING, WC_ABOUT,      "About World Clock");
     AppendMenu(popupMenu, MF_ENABLED | MF_STRING, WC_EXIT,       "Exit World Clock");
 
@@ -96,51 +119,94 @@ int WINAPI WinMain(HINSTANCE hInst, HINSTANCE hPrevInstance, LPSTR lpszCmdLine,
         TranslateMessage (&msg) ;
         DispatchMessage (&msg) ;
     }
+    GdiCacheReleaseAll();
+    AlarmWheelFree(&alarmWheel);
+    ClockRegFree(&clockRegistry);
+    ConfigFree(&wcConfig);
+    TzFreeAllZones();
     return (int) msg.wParam ;
 } /* WinMain() */
 
 LRESULT WndProc(HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
-    int i, gmtOffset;
-    char data[CLOCK_NAME_SIZE], name[CLOCK_NAME_SIZE];
-    ClockInfoListStruct *clockInfoListPtr, *clockInfoListDeletePtr;
-    ClockInfoStruct *clockInfo;
-    HWND clockWindow;
+    int i, gmtOffset, numClocks;
+    char data[CLOCK_LABEL_SIZE], name[CLOCK_NAME_SIZE];
+    char zone[TZ_NAME_SIZE];
+    ClockHandle handle;
+    TickSnapshotStruct tick;
+    HDC hdc;
+    PAINTSTRUCT ps;
+    POINT point;
     static unsigned char layout;
+    static int composite, threaded, renderThreads;
+    static int zoom, dpi;               /* clocks are drawn at zoom percent of their size at WC_DEFAULT_DPI */
+    static ClockHandle menuClock;       /* the clock right-clicked in compositor mode */
     DLGPROC aboutBoxDialogProc;
+    StatsSnapshotStruct stats;
+    char statsText[1024];
 
     switch (message)
     {
         case WM_CREATE:
-            layout = (unsigned char) GetPrivateProfileInt("WindowData", "Layout", 1, INI_FILE_NAME);
-            numClocks = GetPrivateProfileInt("ClockData", "NumClocks", 0, INI_FILE_NAME);
+            ConfigInit(&wcConfig);
+            ConfigLoad(&wcConfig, INI_FILE_NAME);   /* a missing file leaves it empty */
+            layout = (unsigned char) ConfigGetInt(&wcConfig, "WindowData", "Layout", 1);
+            numClocks = ConfigGetInt(&wcConfig, "ClockData", "NumClocks", 0);
+            composite = ConfigGetInt(&wcConfig, "WindowData", "Composite", 0) != 0;
+            threaded = ConfigGetInt(&wcConfig, "WindowData", "RenderThread", 0) != 0;
+            renderThreads = ConfigGetInt(&wcConfig, "WindowData", "RenderThreads", 1);
+            statsEnabled = ConfigGetInt(&wcConfig, "WindowData", "Stats", 1) != 0;
+            zoom = ConfigGetInt(&wcConfig, "WindowData", "Zoom", SEG_SCALE_ONE);
+            viewMaxClocks = ConfigGetInt(&wcConfig, "WindowData", "MaxVisible", 0);
+            rotateSeconds = ConfigGetInt(&wcConfig, "WindowData", "Rotate", 0);
+            hdc = GetDC(hwnd);
+            dpi = GetDeviceCaps(hdc, LOGPIXELSY);
+            ReleaseDC(hwnd, hdc);
+            ClockSetScale(MulDiv(zoom, dpi, WC_DEFAULT_DPI));
+            if (composite)
+                CompositorAttach(hwnd);
+            if (composite && threaded)
+            {
+#ifdef SHOW_SECONDS
+                threaded = CompositorStartThread(TRUE, renderThreads);
+#else
+                threaded = CompositorStartThread(FALSE, renderThreads);
+#endif
+            }
 
             if (numClocks == 0)
             {
-                AddClock(hwnd, layout, "GMT", 0);
-                numClocks = 1;
+                AddClock("GMT", 0, "");
             } /* if numClocks == 0 */
             else
             {
+                ClockRegReserve(&clockRegistry, numClocks);
                 for (i = 1; i <= numClocks; i++)
                 {
                     sprintf_s(name, CLOCK_NAME_SIZE, "Clock%dName", i);
-                    GetPrivateProfileString("ClockData", name, "", data, CLOCK_NAME_SIZE, INI_FILE_NAME);
+                    strncpy_s(data, CLOCK_LABEL_SIZE, ConfigGetString(&wcConfig, "ClockData", name, ""), _TRUNCATE);
                     if (strlen(data) == 0)
                         break;
                     sprintf_s(name, CLOCK_NAME_SIZE, "Clock%dOffset", i);
-                    gmtOffset = GetPrivateProfileInt("ClockData", name, 24, INI_FILE_NAME);
-                    AddClock(hwnd, layout, data, gmtOffset);
+                    gmtOffset = ConfigGetInt(&wcConfig, "ClockData", name, 24);
+                    sprintf_s(name, CLOCK_NAME_SIZE, "Clock%dZone", i);
+                    strncpy_s(zone, TZ_NAME_SIZE, ConfigGetString(&wcConfig, "ClockData", name, ""), _TRUNCATE);
+                    AddClock(data, gmtOffset, zone);
                 } /* for i */
             } /* if numClocks == 0 */
 
             AdjustWindow(hwnd, layout);
+            AlarmWheelInit(&alarmWheel, (int64_t) time(NULL));
+            LoadAlarms();
 
 #ifdef SHOW_SECONDS
-            if (SetTimer(hwnd, TIMER_ID, 1000, NULL) == 0)
+            TickSchedInit(&tickScheduler, &tickSystemClock, TRUE);
 #else
-            if (SetTimer(hwnd, TIMER_ID, 30000, NULL) == 0)
+            TickSchedInit(&tickScheduler, &tickSystemClock, FALSE);
 #endif
+            if (composite && threaded)
+                break;          /* the render thread keeps its own time */
+            if (SetTimer(hwnd, TIMER_ID, TickSchedArm(&tickScheduler), NULL) == 0)
             {
                 MessageBox(hwnd, "Could not allocate timer!", "Startup Failure", MB_OK | MB_ICONSTOP);
                 PostMessage(hwnd,WM_CLOSE, 0, 0L);
@@ -148,35 +214,63 @@ LRESULT WndProc(HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam)
 
             break;
 
-        case WM_TIMER:
-            clockInfoListPtr = clockInfoList;
-            while (clockInfoListPtr != NULL)
-            {
-                InvalidateRect(clockInfoListPtr->hwnd, NULL, TRUE);
-                clockInfoListPtr = clockInfoListPtr->next;
-            } /* while clockInfoListPtr != NULL */
+        case WM_TIMER: /* one snapshot per tick, shared by all clocks */
+            StatsEndFrame();    /* the previous tick's paints are done */
+            TickTakeSnapshot(&tick, TickSchedFired(&tickScheduler));
+            StatsTick(tickScheduler.jitter.lastLateNs);
+            SetTimer(hwnd, TIMER_ID, TickSchedArm(&tickScheduler), NULL); /* one-shot to the next boundary */
+            TickClocks(&tick);
+            AlarmAdvance(&alarmWheel, &clockRegistry, tick.utcSeconds, RingAlarm, hwnd);
+            RotateView(hwnd, layout, tick.utcSeconds);
             break;
 
+        case WC_FRAME_READY: /* the render thread keeps the time; alarms stay on this thread */
+            CompositorFrameReady();
+            AlarmAdvance(&alarmWheel, &clockRegistry, (int64_t) time(NULL), RingAlarm, hwnd);
+            RotateView(hwnd, layout, (int64_t) time(NULL));
+            return(0);
+
+        case WM_MOUSEWHEEL: /* a notch scrolls a clock, or a row of a grid; clock windows pass it up */
+            if (viewLayout.count >= viewLayout.total)
+                return(0);
+            viewFirst = viewLayout.first - GET_WHEEL_DELTA_WPARAM(wParam) / WHEEL_DELTA *
+                        (viewLayout.rows > 1 ? viewLayout.columns : 1);
+            AdjustWindow(hwnd, layout);
+            return(0);
+
+        case WC_ALARM: /* posted, so the message box does not hold up the wheel */
+            MessageBeep(MB_ICONEXCLAMATION);
+            MessageBox(hwnd, (char *) lParam, "World Clock Alarm", MB_ICONINFORMATION | MB_OK);
+            wfree((char *) lParam);
+            return(0);
+
+        case WM_DPICHANGED: /* only sent when per-monitor DPI aware; one atlas build at most */
+            dpi = HIWORD(wParam);
+            ClockSetScale(MulDiv(zoom, dpi, WC_DEFAULT_DPI));
+            AdjustWindow(hwnd, layout);
+            return(0);
+
         case WM_COMMAND:
             switch (wParam)
             {
                 case WC_ADD:
-                    numClocks++;
-                    clockWindow = AddClock(hwnd, layout, "GMT-Zero", 0);
-                    if (!ModifyClock(clockWindow))
-                        DeleteClock(hwnd, layout, clockWindow);
-                    else
-                        AdjustWindow(hwnd, layout);
+                    handle = AddClock("GMT-Zero", 0, "");
+                    if (handle == CLOCK_HANDLE_NONE)
+                        break;
+                    viewFirst = clockRegistry.count - 1;    /* scroll to it */
+                    AdjustWindow(hwnd, layout);
+                    if (!ModifyClock(hwnd, handle))
+                        DeleteClock(hwnd, layout, handle);
                     break;
 
-                case WC_MODIFY:
-                    clockWindow = (HWND) lParam;
-                    ModifyClock(clockWindow);
+                case WC_MODIFY: /* lParam is the clock window, or 0 from our own menu */
+                    handle = (lParam != 0) ? ClockRegFindWindow(&clockRegistry, (HWND) lParam) : menuClock;
+                    ModifyClock(hwnd, handle);
                     break;
 
                 case WC_DELETE:
-                    clockWindow = (HWND) lParam;
-                    DeleteClock(hwnd, layout, clockWindow);
+                    handle = (lParam != 0) ? ClockRegFindWindow(&clockRegistry, (HWND) lParam) : menuClock;
+                    DeleteClock(hwnd, layout, handle);
                     break;
 
                 case WC_POS_UL:
@@ -213,6 +307,17 @@ LRESULT WndProc(HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam)
                     AdjustWindow(hwnd, layout);
                     break;
 
+                case WC_OR_GRID:
+                    layout ^= OR_GRID;
+                    AdjustWindow(hwnd, layout);
+                    break;
+
+                case WC_PAGE_NEXT:
+                case WC_PAGE_PREV:
+                    viewFirst = LayoutPage(&viewLayout, wParam == WC_PAGE_NEXT);
+                    AdjustWindow(hwnd, layout);
+                    break;
+
                 case WC_ONTOP:
                     if (layout & ON_TOP)
                         layout &= ~ON_TOP;
@@ -222,25 +327,47 @@ LRESULT WndProc(HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam)
                     break;
 
                 case WC_SAVEDATA:
-                    sprintf_s(data, CLOCK_NAME_SIZE, "%d",layout);
-                    WritePrivateProfileString("WindowData", "Layout",  data, INI_FILE_NAME);
-
-                    sprintf_s(data, CLOCK_NAME_SIZE,"%d", numClocks);
-                    WritePrivateProfileString("ClockData", "NumClocks",  data, INI_FILE_NAME);
-
-                    i = 1;
-                    clockInfoListPtr = clockInfoList;
-                    while (clockInfoListPtr != NULL)
+                    ConfigSetInt(&wcConfig, "WindowData", "Layout", layout);
+                    ConfigSetInt(&wcConfig, "WindowData", "Composite", composite);
+                    ConfigSetInt(&wcConfig, "WindowData", "RenderThread", threaded);
+                    ConfigSetInt(&wcConfig, "WindowData", "RenderThreads", renderThreads);
+                    ConfigSetInt(&wcConfig, "WindowData", "Stats", statsEnabled);
+                    ConfigSetInt(&wcConfig, "WindowData", "Zoom", zoom);
+                    ConfigSetInt(&wcConfig, "WindowData", "MaxVisible", viewMaxClocks);
+                    ConfigSetInt(&wcConfig, "WindowData", "Rotate", rotateSeconds);
+
+                    /* rewrite the clock list so deleted clocks leave no stale keys */
+                    ConfigClearSection(&wcConfig, "ClockData");
+                    ConfigSetInt(&wcConfig, "ClockData", "NumClocks", clockRegistry.count);
+                    for (i = 0; i < clockRegistry.count; i++)
                     {
-                        clockInfo = (ClockInfoStruct *) (LONG_PTR) GetWindowLongPtr(clockInfoListPtr->hwnd, GWLP_USERDATA);
-                        sprintf_s(name, CLOCK_NAME_SIZE, "Clock%dName",i);
-                        WritePrivateProfileString("ClockData", name,  clockInfo->locationName, INI_FILE_NAME);
-                        sprintf_s(name, CLOCK_NAME_SIZE, "Clock%dOffset",i);
-                        sprintf_s(data, CLOCK_NAME_SIZE, "%d",clockInfo->gmtOffset);
-                        WritePrivateProfileString("ClockData", name,  data, INI_FILE_NAME);
-                        clockInfoListPtr = clockInfoListPtr->next;
-                        i++;
-                    } /* while clockInfoListPtr != NULL */
+                        sprintf_s(name, CLOCK_NAME_SIZE, "Clock%dName",i + 1);
+                        ConfigSetString(&wcConfig, "ClockData", name, ClockRegLabel(&clockRegistry, i));
+                        sprintf_s(name, CLOCK_NAME_SIZE, "Clock%dOffset",i + 1);
+                        ConfigSetInt(&wcConfig, "ClockData", name, clockRegistry.gmtOffsets[i] / 3600);
+                        sprintf_s(name, CLOCK_NAME_SIZE, "Clock%dZone",i + 1);
+                        ConfigSetString(&wcConfig, "ClockData", name, clockRegistry.zoneNames[i]);
+                    } /* for i */
+                    SaveAlarms();
+
+                    if (!ConfigSave(&wcConfig, INI_FILE_NAME))
+                        MessageBox(hwnd,
+                                   "Cannot save " INI_FILE_NAME,
+                                   "World Clock Error Message",
+                                   MB_ICONINFORMATION | MB_OK);
+                    break;
+
+                case WC_STATS:
+                    StatsSnapshot(&stats);
+                    StatsFormat(&stats, statsText, sizeof(statsText));
+                    strncat_s(statsText, sizeof(statsText), "\nSave to " STATS_FILE_NAME "?", _TRUNCATE);
+                    if (MessageBox(hwnd, statsText, "World Clock Statistics",
+                                   MB_ICONINFORMATION | MB_YESNO) == IDYES
+                        && !StatsDump(STATS_FILE_NAME))
+                        MessageBox(hwnd,
+                                   "Cannot save " STATS_FILE_NAME,
+                                   "World Clock Error Message",
+                                   MB_ICONINFORMATION | MB_OK);
                     break;
 
                 case WC_ABOUT:
@@ -256,109 +383,118 @@ LRESULT WndProc(HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam)
             } /* switch wParam */
             return(0);
 
-        case WM_CLOSE:
-            KillTimer(hwnd, TIMER_ID);
+        case WM_ERASEBKGND:
+            if (composite)
+                return(1);      /* the back buffer covers the whole window */
+            break;
 
-            clockInfoListPtr = clockInfoList;
-            while (clockInfoListPtr != NULL)
-            {
-                clockInfoListDeletePtr = clockInfoListPtr;
-                clockInfoListPtr = clockInfoListPtr->next;
-                wfree(clockInfoListDeletePtr);
-            } /* while clockInfoListPtr != NULL */
+        case WM_PAINT:
+            if (!composite)
+                break;
+            hdc = BeginPaint(hwnd, &ps);
+            CompositorPaint(hdc, &ps.rcPaint);
+            EndPaint(hwnd, &ps);
+            return(0);
+
+        case WM_RBUTTONDOWN: /* only reaches us in compositor mode */
+            point.x = LOWORD(lParam);
+            point.y = HIWORD(lParam);
+            menuClock = CompositorHitTest(point.x, point.y);
+            ClientToScreen(hwnd, &point);
+            TrackPopupMenu(popupMenu, TPM_LEFTALIGN | TPM_RIGHTBUTTON,
+                           point.x, point.y, 0, hwnd, NULL);
+            return(0);
 
+        case WM_CLOSE:
+            KillTimer(hwnd, TIMER_ID);
             break;
 
         case WM_DESTROY:
+            CompositorDetach();
             PostQuitMessage(0);
             return 0 ;
     }
     return DefWindowProc(hwnd, message, wParam, lParam) ;
 } /* WndProc() */
 
-HWND AddClock(HWND parentWindow, int layout, char *name, int gmtOffset)
+/******************************************************************************/
+/* AddClock -- a new clock at the end of the list.  It is only a registry     */
+/* entry; AdjustWindow() gives it a window, or a tile, if it is on screen.    */
+/******************************************************************************/
+ClockHandle AddClock(char *name, int gmtOffset, const char *zoneName)
 {
-    ClockInfoListStruct *clockInfoListPtr = clockInfoList;
-    ClockInfoListStruct *newClockInfoListNode = wmalloc(sizeof(ClockInfoListStruct));
+    ClockHandle handle;
 
-    if (clockInfoList == NULL)
-    {
-        clockInfoListPtr = newClockInfoListNode;
-        clockInfoList = clockInfoListPtr;
-    } /* if clockInfoList == NULL */
-    else
-    {
-        while (clockInfoListPtr->next != NULL)
-            clockInfoListPtr = clockInfoListPtr->next;
-        clockInfoListPtr->next = newClockInfoListNode;
-        clockInfoListPtr = clockInfoListPtr->next;
-    } /* if clockInfoList == NULL */
-    /* list entry is created, populate it */
-    if (layout)
-    {
-        clockInfoListPtr->hwnd = CreateWindow(CLOCK_CLASS_NAME,
-                                              name,
-                                              WS_CHILD | WS_VISIBLE | WS_BORDER,
-                                              0,
-                                              (numClocks-1) * CLOCK_DISPLAY_HEIGHT,
-                                              CLOCK_DISPLAY_WIDTH,
-                                              CLOCK_DISPLAY_HEIGHT,
-                                              parentWindow,
-                                              NULL,
-                                              hInstance,
-                                              NULL);
-    }
-    else
-    {
-        clockInfoListPtr->hwnd = CreateWindow(CLOCK_CLASS_NAME,
-                                              name,
-                                              WS_CHILD | WS_VISIBLE | WS_BORDER,
-                                              (numClocks-1) * CLOCK_DISPLAY_WIDTH,
-                                              0,
-                                              CLOCK_DISPLAY_WIDTH,
-                                              CLOCK_DISPLAY_HEIGHT,
-                                              parentWindow,
-                                              NULL,
-                                              hInstance,
-                                              NULL);
-    }
-    SendMessage(clockInfoListPtr->hwnd, CLOCK_PARAMS_MSG,
-                (WPARAM) gmtOffset,
-                (LPARAM) name);
-    return(clockInfoListPtr->hwnd);
+    CompositorBeginChange();
+    handle = ClockRegAdd(&clockRegistry, name, ClockRegHoursOffset(gmtOffset), zoneName);
+    CompositorEndChange();
+    return(handle);
 } /* AddClock */
 
-int ModifyClock(HWND clockWindow)
+int ModifyClock(HWND ownerWindow, ClockHandle handle)
 {
-    ClockInfoStruct *clockInfo;
     DLGPROC modifyDialogProc;
     INT_PTR dbx;
+    int index = ClockRegIndexOf(&clockRegistry, handle);
 
-    clockInfo = (ClockInfoStruct *) (LONG_PTR) GetWindowLongPtr(clockWindow, GWLP_USERDATA);
-
+    if (index < 0)
+        return(FALSE);
+    if (clockRegistry.windows[index] != NULL)
+        ownerWindow = (HWND) clockRegistry.windows[index];
     modifyDialogProc = (DLGPROC) MakeProcInstance((FARPROC) ModifyDialogProc, hInstance);
-    dbx = DialogBoxParamA(hInstance, "SetupDialog", clockWindow, modifyDialogProc, (LPARAM) clockInfo);
+    dbx = DialogBoxParamA(hInstance, "SetupDialog", ownerWindow, modifyDialogProc, (LPARAM) handle);
     FreeProcInstance((FARPROC) modifyDialogProc);
-    InvalidateRect(clockWindow, NULL, TRUE);
+    RedrawClock(handle);
     return (int) dbx;
 } /* ModifyClock() */
 
+/* list the zones matching what is typed in the Zone box, best first */
+static void FillZoneList(HWND hDlg)
+{
+    int zones[ZONE_LIST_SIZE];
+    char query[TZ_NAME_SIZE];
+    HWND list = GetDlgItem(hDlg, TIMEZONE_LIST);
+    int i, count;
+
+    GetWindowText(GetDlgItem(hDlg, TIMEZONE_ZONE), query, TZ_NAME_SIZE);
+    count = ZoneIndexSearch(query, TRUE, zones, ZONE_LIST_SIZE);
+    if (count > ZONE_LIST_SIZE)
+        count = ZONE_LIST_SIZE;
+    SendMessage(list, WM_SETREDRAW, FALSE, 0);
+    SendMessage(list, LB_RESETCONTENT, 0, 0);
+    for (i = 0; i < count; i++)
+        SendMessage(list, LB_ADDSTRING, 0, (LPARAM) ZoneIndexName(zones[i]));
+    SendMessage(list, WM_SETREDRAW, TRUE, 0);
+    InvalidateRect(list, NULL, TRUE);
+} /* FillZoneList() */
+
 LRESULT WINAPI ModifyDialogProc(HWND hDlg, UINT message, WPARAM wParam, LPARAM lParam)
 {
-    static ClockInfoStruct *clockInfo;
+    static ClockHandle clockHandle;
     static short gmtOffset;
+    static BOOL pickingZone = FALSE;    /* the list is writing the Zone box */
+    int index;
 	int nScrollCode;
     HWND tempControl;
-    char tempText[CLOCK_NAME_SIZE + 1];
+    char tempText[CLOCK_LABEL_SIZE];
+    char zoneText[TZ_NAME_SIZE];
     LPSTR tempTextPtr;
     int pos, min, max;
 
     switch (message)
     {
         case WM_INITDIALOG:
-            clockInfo = (ClockInfoStruct *) lParam;
-            SetWindowText(GetDlgItem(hDlg, TIMEZONE_NAME), clockInfo->locationName);
-            gmtOffset = clockInfo->gmtOffset;
+            clockHandle = (ClockHandle) lParam;
+            index = ClockRegIndexOf(&clockRegistry, clockHandle);
+            if (index < 0)
+            {
+                EndDialog(hDlg, FALSE);
+                return(TRUE);
+            }
+            SetWindowText(GetDlgItem(hDlg, TIMEZONE_NAME), ClockRegLabel(&clockRegistry, index));
+            SendDlgItemMessage(hDlg, TIMEZONE_NAME, EM_LIMITTEXT, CLOCK_LABEL_SIZE - 1, 0L);
+            SetWindowText(GetDlgItem(hDlg, TIMEZONE_ZONE), clockRegistry.zoneNames[index]);
+            gmtOffset = (short) (clockRegistry.gmtOffsets[index] / 3600);
             tempControl = GetDlgItem(hDlg, GMT_OFFSET_SLIDER);
             SetScrollRange(tempControl, SB_CTL, -23, 23, FALSE);
             SetScrollPos(tempControl, SB_CTL, gmtOffset, TRUE);
@@ -370,19 +506,56 @@ LRESULT WINAPI ModifyDialogProc(HWND hDlg, UINT message, WPARAM wParam, LPARAM l
             switch (LOWORD(wParam))
             {
                 case IDOK:
+                    index = ClockRegIndexOf(&clockRegistry, clockHandle);
+                    if (index < 0)
+                    {
+                        EndDialog(hDlg, FALSE);
+                        return(TRUE);
+                    }
+                    GetWindowText(GetDlgItem(hDlg, TIMEZONE_ZONE), zoneText, TZ_NAME_SIZE);
+                    CompositorBeginChange();
+                    if (!ClockRegSetZone(&clockRegistry, index, zoneText))
+                    {
+                        CompositorEndChange();
+                        MessageBox(hDlg,
+                                   "Unknown time zone.  Use an IANA name such as Asia/Kolkata, or leave it empty to use the GMT offset.",
+                                   "World Clock Error Message",
+                                   MB_ICONINFORMATION | MB_OK);
+                        return(TRUE);
+                    }
                     tempTextPtr = tempText;
                     tempControl = GetDlgItem(hDlg, TIMEZONE_NAME);
-                    GetWindowText(tempControl, tempTextPtr, CLOCK_NAME_SIZE);
-                    wfree(clockInfo->locationName);
-                    clockInfo->locationName = (char *) wmalloc(sizeof(tempText)+1);
-                    strcpy_s(clockInfo->locationName, CLOCK_NAME_SIZE, tempText);
-                    clockInfo->gmtOffset = gmtOffset;
+                    GetWindowText(tempControl, tempTextPtr, CLOCK_LABEL_SIZE);
+                    ClockRegSetLabel(&clockRegistry, index, tempText);
+                    ClockRegSetOffset(&clockRegistry, index, gmtOffset * 3600);
+                    CompositorEndChange();
+                    AlarmClockChanged(&alarmWheel, &clockRegistry, clockHandle);
                     EndDialog(hDlg, TRUE);
                     return(TRUE);
 
                 case IDCANCEL:
                     EndDialog(hDlg, FALSE);
                     return(TRUE);
+
+                case TIMEZONE_ZONE:
+                    if (HIWORD(wParam) == EN_CHANGE && !pickingZone)
+                        FillZoneList(hDlg);
+                    return(TRUE);
+
+                case TIMEZONE_LIST:
+                    if (HIWORD(wParam) == LBN_SELCHANGE)
+                    {
+                        tempControl = GetDlgItem(hDlg, TIMEZONE_LIST);
+                        pos = (int) SendMessage(tempControl, LB_GETCURSEL, 0, 0);
+                        if (pos != LB_ERR && SendMessage(tempControl, LB_GETTEXTLEN, pos, 0) < TZ_NAME_SIZE)
+                        {
+                            SendMessage(tempControl, LB_GETTEXT, pos, (LPARAM) zoneText);
+                            pickingZone = TRUE;
+                            SetWindowText(GetDlgItem(hDlg, TIMEZONE_ZONE), zoneText);
+                            pickingZone = FALSE;
+                        }
+                    }
+                    return(TRUE);
             } /* switch wParam */
 			return(TRUE);
 
@@ -464,94 +637,193 @@ LRESULT WINAPI AboutBoxDialogProc(HWND hDlg, UINT message, WPARAM wParam, LPARAM
     return(FALSE);
 } /* AboutBoxDialogProc() */
 
-void DeleteClock(HWND parentWindow, int layout, HWND clockWindow)
+void DeleteClock(HWND parentWindow, int layout, ClockHandle handle)
 {
-    ClockInfoListStruct *clockInfoListPtr = clockInfoList;
-    ClockInfoListStruct *lastNode = NULL;
+    int index = ClockRegIndexOf(&clockRegistry, handle);
 
-    while (clockInfoListPtr != NULL)
+    if (index < 0)
+        return;
+    if (clockRegistry.count <= 1)
     {
-        if (clockInfoListPtr->hwnd == clockWindow)
-        { /* found entry to delete */
-            if (clockInfoListPtr == clockInfoList)
-            { /* special case for first entry */
-                if (clockInfoListPtr->next == NULL)
-                {
-                    MessageBox(parentWindow,
-                               "Cannot delete last clock!",
-                               "World Clock Error Message",
-                               MB_ICONINFORMATION | MB_OK);
-                } /* if clockInfoListPtr->next == NULL */
-                else
-                {
-                    clockInfoList = clockInfoListPtr->next;
-                    DeleteClockListEntry(parentWindow, layout, clockInfoListPtr);
-                    break;
-                } /* if clockInfoListPtr->next == NULL */
-            } /* if clockInfoListPtr == clockInfoList */
-            else
-            { /* was not the first entry */
-                lastNode->next = clockInfoListPtr->next; /* unlink this node */
-                DeleteClockListEntry(parentWindow, layout, clockInfoListPtr);
-                break;
-            } /* if clockInfoListPtr == clockInfoList */
-        } /* if clockInfoListPtr->hwnd == clockWindow */
-        lastNode = clockInfoListPtr;
-        clockInfoListPtr = clockInfoListPtr->next;
-    } /* while clockInfoListPtr != NULL */
-} /* DeleteClock() */
-
-void DeleteClockListEntry(HWND parentWindow, int layout, ClockInfoListStruct *deleteEntry)
-{
-    SendMessage(deleteEntry->hwnd, WM_CLOSE, 0, 0L);
-    wfree(deleteEntry);
-    numClocks--;
+        MessageBox(parentWindow,
+                   "Cannot delete last clock!",
+                   "World Clock Error Message",
+                   MB_ICONINFORMATION | MB_OK);
+        return;
+    }
+    if (clockRegistry.windows[index] != NULL)
+        DestroyWindow((HWND) clockRegistry.windows[index]); /* lets go of its GDI objects */
+    CompositorBeginChange();
+    ClockRegRemove(&clockRegistry, handle);
+    CompositorEndChange();
     AdjustWindow(parentWindow, layout);
-} /* DeleteClockListEntry() */
+} /* DeleteClock() */
 
+/******************************************************************************/
+/* AdjustWindow -- lay out the clocks from viewFirst on, as many as fit in    */
+/* the work area (or viewMaxClocks): a row across it, a column down it, or    */
+/* with OR_GRID as many rows and columns as it holds.  Only those clocks get  */
+/* a window or a tile; the mouse wheel and the page commands move the view    */
+/* along the rest.  The window is resized without drawing and the clocks are  */
+/* moved together, so the whole relayout is painted once.                     */
+/******************************************************************************/
 void AdjustWindow(HWND hwnd, int layout)
 {
-    int x, y, width, height;
-    int deltaX, deltaY, newX, newY;
-    ClockInfoListStruct *clockInfoListPtr;
-
-    if (layout & OR_VERT)
-    { /* vertical layout */
-        width = CLOCK_DISPLAY_WIDTH;
-        height = CLOCK_DISPLAY_HEIGHT * numClocks;
-        deltaX = 0;
-        deltaY = CLOCK_DISPLAY_HEIGHT;
-    }
-    else
-    { /* horizontal layout */
-        width  = CLOCK_DISPLAY_WIDTH * numClocks;
-        height = CLOCK_DISPLAY_HEIGHT;
-        deltaX = CLOCK_DISPLAY_WIDTH;
-        deltaY = 0;
+    int x, y, width, height, tileWidth, tileHeight, areaWidth, areaHeight;
+    RECT workArea;
+
+    ClockTileSize(&tileWidth, &tileHeight);
+    if (!SystemParametersInfo(SPI_GETWORKAREA, 0, &workArea, 0))
+        SetRect(&workArea, 0, 0, GetSystemMetrics(SM_CXSCREEN), GetSystemMetrics(SM_CYSCREEN));
+    areaWidth = workArea.right - workArea.left;
+    areaHeight = workArea.bottom - workArea.top;
+    if (!(layout & OR_GRID))
+    {
+        if (layout & OR_VERT)
+            areaWidth = tileWidth;
+        else
+            areaHeight = tileHeight;
     }
+    LayoutInitGrid(&viewLayout, clockRegistry.count, viewFirst, viewMaxClocks,
+                   areaWidth, areaHeight, layout & OR_VERT, tileWidth, tileHeight);
+    viewFirst = viewLayout.first;
+    width = viewLayout.width;
+    height = viewLayout.height;
 
     if (layout & POS_RIGHT)
-        x = GetSystemMetrics(SM_CXSCREEN) - width;
+        x = workArea.right - width;
     else
-        x = 0;
+        x = workArea.left;
 
     if (layout & POS_BOTTOM)
-        y = GetSystemMetrics(SM_CYSCREEN) - height;
+        y = workArea.bottom - height;
     else
-        y = 0;
+        y = workArea.top;
 
-    clockInfoListPtr = clockInfoList;
-    newX = 0;
-    newY = 0;
-    while (clockInfoListPtr != NULL)
+    SetWindowPos(hwnd, (layout & ON_TOP) ? HWND_TOPMOST : HWND_NOTOPMOST,  x, y, width, height,
+                 SWP_SHOWWINDOW | SWP_NOREDRAW);
+    if (CompositorActive())
     {
-        MoveWindow(clockInfoListPtr->hwnd, newX, newY, CLOCK_DISPLAY_WIDTH, CLOCK_DISPLAY_HEIGHT, TRUE);
-        newX += deltaX;
-        newY += deltaY;
-        clockInfoListPtr = clockInfoListPtr->next;
-    } /* while clockInfoListPtr != NULL */
-    SetWindowPos(hwnd, (layout & ON_TOP) ? HWND_TOPMOST : HWND_NOTOPMOST,  x, y, width, height, SWP_SHOWWINDOW);
+        CompositorLayout(&viewLayout);
+        InvalidateRect(hwnd, NULL, FALSE);
+    }
+    else
+        ClockWindowLayout(hwnd, &viewLayout);
     CheckMenuItem(popupMenu, WC_ONTOP, ((layout & ON_TOP) ? MF_CHECKED : MF_UNCHECKED) | MF_BYCOMMAND);
+    CheckMenuItem(positionsMenu, WC_OR_GRID, ((layout & OR_GRID) ? MF_CHECKED : MF_UNCHECKED) | MF_BYCOMMAND);
 } /* AdjustWindow */
 
+/* with Rotate=N, show the next page of clocks every N seconds */
+void RotateView(HWND hwnd, int layout, int64_t utcSeconds)
+{
+    static int64_t rotated = 0;
+
+    if (rotateSeconds <= 0 || viewLayout.count >= viewLayout.total ||
+        utcSeconds % rotateSeconds != 0 || utcSeconds == rotated)
+        return;
+    rotated = utcSeconds;
+    viewFirst = LayoutPage(&viewLayout, TRUE);
+    AdjustWindow(hwnd, layout);
+} /* RotateView() */
+
+/******************************************************************************/
+/* LoadAlarms -- the alarms of [AlarmData].  AlarmNClock is the clock's       */
+/* number in [ClockData]; AlarmNTime=HH:MM[:SS] rings daily on that clock,    */
+/* on the weekdays of AlarmNDays (bit 0 Sunday, all by default), and          */
+/* AlarmNDue=seconds since 1970 UTC rings once instead.                       */
+/******************************************************************************/
+void LoadAlarms(void)
+{
+    char key[CLOCK_NAME_SIZE], name[ALARM_NAME_SIZE];
+    const char *value;
+    int i, numAlarms, clock, hours, minutes, seconds, weekdays;
+    ClockHandle handle;
 
+    numAlarms = ConfigGetInt(&wcConfig, "AlarmData", "NumAlarms", 0);
+    for (i = 1; i <= numAlarms; i++)
+    {
+        sprintf_s(key, CLOCK_NAME_SIZE, "Alarm%dClock", i);
+        clock = ConfigGetInt(&wcConfig, "AlarmData", key, 0);
+        if (clock < 1 || clock > clockRegistry.count)
+            continue;
+        handle = clockRegistry.handles[clock - 1];
+        sprintf_s(key, CLOCK_NAME_SIZE, "Alarm%dName", i);
+        strncpy_s(name, ALARM_NAME_SIZE, ConfigGetString(&wcConfig, "AlarmData", key, "Alarm"), _TRUNCATE);
+
+        sprintf_s(key, CLOCK_NAME_SIZE, "Alarm%dDue", i);
+        value = ConfigGetString(&wcConfig, "AlarmData", key, "");
+        if (value[0] != '\0')
+        {
+            AlarmAddCountdown(&alarmWheel, handle, name, _strtoi64(value, NULL, 10));
+            continue;
+        }
+        sprintf_s(key, CLOCK_NAME_SIZE, "Alarm%dTime", i);
+        value = ConfigGetString(&wcConfig, "AlarmData", key, "");
+        seconds = 0;
+        if (sscanf_s(value, "%d:%d:%d", &hours, &minutes, &seconds) < 2)
+            continue;
+        sprintf_s(key, CLOCK_NAME_SIZE, "Alarm%dDays", i);
+        weekdays = ConfigGetInt(&wcConfig, "AlarmData", key, ALARM_EVERY_DAY);
+        AlarmAddDaily(&alarmWheel, &clockRegistry, handle, name, hours * 3600 + minutes * 60 + seconds,
+                      (unsigned int) weekdays);
+    } /* for i */
+} /* LoadAlarms() */
+
+/* rewrite [AlarmData] from the wheel, leaving out alarms of deleted clocks */
+void SaveAlarms(void)
+{
+    char key[CLOCK_NAME_SIZE], value[32];
+    const AlarmStruct *alarm;
+    int i, index, numAlarms = 0;
+
+    ConfigClearSection(&wcConfig, "AlarmData");
+    for (i = 0; i < alarmWheel.capacity; i++)
+    {
+        alarm = &alarmWheel.alarms[i];
+        if (alarm->handle != ALARM_HANDLE_NONE && ClockRegIndexOf(&clockRegistry, alarm->clock) >= 0)
+            numAlarms++;
+    } /* for i */
+    ConfigSetInt(&wcConfig, "AlarmData", "NumAlarms", numAlarms);
+
+    numAlarms = 0;
+    for (i = 0; i < alarmWheel.capacity; i++)
+    {
+        alarm = &alarmWheel.alarms[i];
+        index = (alarm->handle != ALARM_HANDLE_NONE) ? ClockRegIndexOf(&clockRegistry, alarm->clock) : -1;
+        if (index < 0)
+            continue;
+        numAlarms++;
+        sprintf_s(key, CLOCK_NAME_SIZE, "Alarm%dClock", numAlarms);
+        ConfigSetInt(&wcConfig, "AlarmData", key, index + 1);
+        sprintf_s(key, CLOCK_NAME_SIZE, "Alarm%dName", numAlarms);
+        ConfigSetString(&wcConfig, "AlarmData", key, alarm->name);
+        if (alarm->kind == ALARM_COUNTDOWN)
+        {
+            sprintf_s(key, CLOCK_NAME_SIZE, "Alarm%dDue", numAlarms);
+            sprintf_s(value, sizeof(value), "%lld", (long long) alarm->dueUtc);
+            ConfigSetString(&wcConfig, "AlarmData", key, value);
+            continue;
+        }
+        sprintf_s(key, CLOCK_NAME_SIZE, "Alarm%dTime", numAlarms);
+        sprintf_s(value, sizeof(value), "%02d:%02d:%02d", alarm->localSeconds / 3600,
+                  alarm->localSeconds / 60 % 60, alarm->localSeconds % 60);
+        ConfigSetString(&wcConfig, "AlarmData", key, value);
+        sprintf_s(key, CLOCK_NAME_SIZE, "Alarm%dDays", numAlarms);
+        ConfigSetInt(&wcConfig, "AlarmData", key, (int) alarm->weekdays);
+    } /* for i */
+} /* SaveAlarms() */
+
+/* the wheel's ring function: tell the user once the wheel is done */
+void RingAlarm(void *context, const AlarmStruct *alarm, int64_t utcSeconds)
+{
+    int index = ClockRegIndexOf(&clockRegistry, alarm->clock);
+    char *text = (char *) wmalloc(ALARM_NAME_SIZE + CLOCK_LABEL_SIZE + 8);
+
+    (void) utcSeconds;
+    if (text == NULL)
+        return;
+    sprintf_s(text, ALARM_NAME_SIZE + CLOCK_LABEL_SIZE + 8, "%s\n%s", alarm->name,
+              (index >= 0) ? ClockRegLabel(&clockRegistry, index) : "");
+    if (!PostMessage((HWND) context, WC_ALARM, 0, (LPARAM) text))
+        wfree(text);
+} /* RingAlarm() */
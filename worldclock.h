@@ -1,19 +1,22 @@
-typedef struct ClockInfoListStructTag {
-    HWND hwnd;
-    struct ClockInfoListStructTag *next;
-} ClockInfoListStruct;
+#include "clockreg.h"
+
+/* Win32 state of a clock, kept in the registry sidecar */
+typedef struct ClockWinStructTag {
+    HBRUSH backBrush;           /* GDI objects are owned by gdicache.c */
+    HFONT labelFont;            /* NULL uses the DC default font */
+    uint32_t labelSerial;       /* the registry label the fields below are for */
+    HFONT labelExtentFont;
+    SIZE labelExtent;
+    HBITMAP labelBitmap;        /* the label as painted, made on first paint */
+} ClockWinStruct;
 
-typedef struct ClockInfoTag {
-    short gmtOffset;
-    char *locationName;
-} ClockInfoStruct;
-
-#define CLOCK_NAME_SIZE 32
 #define VERSION	"1.10 -- March 31, 2013"
 
 #define TIMEZONE_NAME	101
 #define GMT_OFFSET_SLIDER	102
 #define GMT_OFFSET_TEXT	103
+#define TIMEZONE_ZONE	104
+#define TIMEZONE_LIST	105
 
 #define wfree(z)   LocalFree((LOCALHANDLE) z)
 #define wmalloc(z) LocalAlloc(LPTR, z)
@@ -25,11 +28,23 @@ typedef struct ClockInfoTag {
 #define WC_SAVEDATA 105
 #define WC_ABOUT    106
 #define WC_EXIT	    107
+#define WC_STATS    108
+#define WC_PAGE_NEXT 109
+#define WC_PAGE_PREV 110
+
+#define WC_FRAME_READY  (WM_APP + 1)    /* the render thread has a new frame */
+#define WC_ALARM        (WM_APP + 2)    /* an alarm rang; lParam is its text, wfree() it */
+
+#ifndef WM_DPICHANGED                   /* older SDKs */
+#define WM_DPICHANGED   0x02E0
+#endif
+#define WC_DEFAULT_DPI  96              /* the DPI at which zoom 100 is 100% */
 
 #define POS_RIGHT    0x01
 #define POS_BOTTOM   0x02
 #define OR_VERT      0x04
 #define ON_TOP       0x08
+#define OR_GRID      0x10               /* rows and columns filling the work area */
 
 #define WC_POS_UL       200
 #define WC_POS_UR       201
@@ -39,6 +54,8 @@ typedef struct ClockInfoTag {
 #define WC_OR_BASE      210
 #define WC_OR_HORZ      210
 #define WC_OR_VERT      211
+#define WC_OR_GRID      212
 
 extern HMENU popupMenu;
+extern ClockRegistryStruct clockRegistry;
 